@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "/root/repo/cfemm/bin/xfemm-bench"
+  "/root/repo/cfemm/bin/xfemm-bench.pdb"
+  "CMakeFiles/xfemm-bench.dir/Benchmark.cpp.o"
+  "CMakeFiles/xfemm-bench.dir/Benchmark.cpp.o.d"
+  "CMakeFiles/xfemm-bench.dir/Json.cpp.o"
+  "CMakeFiles/xfemm-bench.dir/Json.cpp.o.d"
+  "CMakeFiles/xfemm-bench.dir/Report.cpp.o"
+  "CMakeFiles/xfemm-bench.dir/Report.cpp.o.d"
+  "CMakeFiles/xfemm-bench.dir/main.cpp.o"
+  "CMakeFiles/xfemm-bench.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xfemm-bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
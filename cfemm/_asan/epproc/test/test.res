@@ -0,0 +1,5162 @@
+[Format]      =  1
+[Precision]   =  1e-008
+[MinAngle]    =  30
+[Depth]       =  1
+[LengthUnits] =  meters
+[ProblemType] =  axisymmetric
+[Coordinates] =  cartesian
+[Comment]     =  "Add comments here."
+[PointProps]   = 0
+[BdryProps]   = 0
+[BlockProps]  = 2
+  <BeginBlock>
+    <BlockName> = "mat1"
+    <ex> = 4
+    <ey> = 4
+    <qv> = 0
+  <EndBlock>
+  <BeginBlock>
+    <BlockName> = "air"
+    <ex> = 1
+    <ey> = 1
+    <qv> = 0
+  <EndBlock>
+[ConductorProps]  = 2
+  <BeginConductor>
+    <ConductorName> = "m1t"
+    <Vc> = 50
+    <qc> = 0
+    <ConductorType> = 1
+  <EndConductor>
+  <BeginConductor>
+    <ConductorName> = "b1segm"
+    <Vc> = 0
+    <qc> = 0
+    <ConductorType> = 1
+  <EndConductor>
+[NumPoints] = 14
+0	-0.40000000000000002	0	2	2
+0.050000000000000003	-0.40000000000000002	0	2	2
+0.050000000000000003	0.40000000000000002	0	2	2
+0	0.40000000000000002	0	2	2
+0.17999999999999999	-0.29999999999999999	0	4	1
+0.20000000000000001	-0.29999999999999999	0	4	1
+0.20499999999999999	-0.29999999999999999	0	4	1
+0.20499999999999999	0.20000000000000001	0	4	1
+0.20000000000000001	0.20000000000000001	0	4	1
+0.17999999999999999	0.20000000000000001	0	4	1
+0.17499999999999999	0.20000000000000001	0	4	1
+0.17499999999999999	-0.29999999999999999	0	4	1
+0	-1	0	3	0
+0	1	0	3	0
+[NumSegments] = 10
+0	1	-1	0	0	2	2
+1	2	-1	0	0	2	2
+2	3	-1	0	0	2	2
+3	0	-1	0	0	3	0
+4	5	-1	0	0	4	1
+6	7	-1	0	0	4	1
+8	9	-1	0	0	4	1
+10	11	-1	0	0	4	1
+12	0	-1	0	0	0	0
+3	13	-1	0	0	0	0
+[NumArcSegments] = 5
+5	6	49.2486367043279	18	0	0	4	1
+7	8	49.2486367043279	18	0	0	4	1
+9	10	49.248636704328199	18	0	0	4	1
+11	4	49.248636704328199	18	0	0	4	1
+12	13	180	5	0	0	0	0
+[NumHoles] = 2
+0.029999999999999999	0	2
+0.19	-0.040000000000000001	4
+[NumBlockLabels] = 1
+0.90000000000000002	0	1	0.033333333333333333	3	0
+[Solution]
+1781
+0	-0.40000000000000002	0	1
+0	-0.40078800000000003	0.4034855566458817	-2
+0.00078800000000000018	-0.40000000000000002	0	1
+0	-0.40312559375000001	1.5981484708088696	-2
+0.0017909066172730509	-0.40179090661727307	0.91789314975868863	-2
+0.0038145000000000006	-0.40000000000000002	0	1
+0	-0.40546318750000004	2.7850299814826389	-2
+0.0022638513017708439	-0.40429439062500006	2.1969954381306032	-2
+0.0043197357731865043	-0.40260958894643972	1.3419213230437077	-2
+0.0068410000000000016	-0.40000000000000002	0	1
+0	-0.41013837500000005	5.1215262702593796	-2
+0.0026405120738774751	-0.40780078125000002	3.9663919555702929	-2
+0.0051788557289546714	-0.40575468327506053	2.9535049447768245	-2
+0.0077189064547505872	-0.40337095159613079	1.7479381183872298	-2
+0.012894000000000003	-0.40000000000000002	0	1
+0	-0.41481356250000001	7.3837550788672406	-2
+0.0036358319799358061	-0.41158521920269536	5.8515442997371121	-2
+0.007536851161291604	-0.41127751531924389	5.7441414138455889	-2
+0.0090715508811306765	-0.40735747522391258	3.8035332262762083	-2
+0.011923012288749884	-0.40416722141957967	2.1889167195144039	-2
+0.025000000000000005	-0.40000000000000002	0	1
+0.018947000000000006	-0.4036071191929404	1.9758641904161252	-2
+0	-0.41948875000000002	9.5771704860095692	-2
+0.0060642662255432937	-0.41749041736202958	8.7007397910222863	-2
+0.015253350702865853	-0.4120380945027588	6.3222505669716655	-2
+0.013267473320600895	-0.40823835659896018	4.3374769060533058	-2
+0.031053000000000004	-0.40000000000000002	0	1
+0.025286721181898657	-0.40736337803919948	4.2474218891754498	-2
+0.017965610311341043	-0.40820175790854091	4.4254439223517616	-2
+0	-0.43818950000000001	16.941153170498101	-2
+0.0064425747781850064	-0.42883912499999999	13.593825256287055	-2
+0.015924329500701145	-0.42310075181717416	11.592516116373377	-2
+0.023410246972267991	-0.41492801427016934	8.191808473854957	-2
+0.037106000000000007	-0.40000000000000002	0	1
+0.035168372120000561	-0.40469061397496292	3.1346380555102327	-2
+0.031010322104635779	-0.40892104636481469	5.4723585235100742	-2
+0	-0.47559100000000004	26.283918984388599	-2
+0.021356004768214022	-0.44277847383402186	19.433626169173252	-2
+0.032179023170157119	-0.43352544007226007	17.160124261688011	-2
+0.033049877442371228	-0.41931284094466664	11.232363743784488	-2
+0.043159000000000003	-0.40000000000000002	0	1
+0.040132500000000002	-0.40363529617710264	2.8258585652241841	-2
+0.036918057465231163	-0.40945452649054859	6.4038378238399538	-2
+0	-0.51299250000000007	31.778139081369439	-2
+0.032973860183540225	-0.49429175000000003	30.305648612904893	-2
+0.043170590227632033	-0.45733818287261063	24.927615762277984	-2
+0.045633510329961789	-0.44175820589978554	21.310369404843311	-2
+0.044293133415659505	-0.42604181166854327	16.019366885949477	-2
+0.044824249221399305	-0.41294953272694701	9.9831627890191008	-2
+0.046185500000000004	-0.40000000000000002	0	1
+0.044848834963590635	-0.40327299097914193	3.0867333331852582	-2
+0.042699497260594091	-0.40617260081453865	5.0854427911423432	-2
+0	-0.55039400000000005	35.092852683155918	-2
+0.026799614989497161	-0.53169325000000001	33.946686861623057	-2
+0.081852208525603445	-0.48255055595609408	31.854110415170553	-2
+0.070111874073139083	-0.52103231677372552	34.462160600089483	-2
+0.064005508327333663	-0.43996620856548829	23.70290929869137	-2
+0.084731072022705189	-0.45631218534491585	29.405850483807072	-2
+0.054474352023423767	-0.41779362159164846	15.241730810824976	-2
+0.046290175227866867	-0.40653923618434601	6.2114884680451938	-2
+0.049423724241386489	-0.40824999334940859	8.5687364046117942	-2
+0.049212000000000006	-0.40000000000000002	0	1
+0.047698750000000005	-0.40118083236795793	1.5046545791500712	-2
+0.048385067551891724	-0.40364834607078509	4.4569901701292975	-2
+0	-0.58779550000000003	37.09749775006263	-2
+0.027662518447773749	-0.56436116716301299	36.175421723537639	-2
+0.055988509106736764	-0.55179395034220058	35.9428577821826	-2
+0.10984028749238611	-0.51468136913809592	35.828459011691592	-2
+0.1274844548068565	-0.48653954102583008	35.541671875743049	-2
+0.10107670011558048	-0.54672007488615049	36.92208442161435	-2
+0.073115759150901155	-0.41743184310882042	21.107077668012106	-2
+0.10850784721940696	-0.44484898733519818	31.313242734224964	-2
+0.057399806167606607	-0.40739980616760668	11.978286183579989	-2
+0.050942665036409346	-0.40378381105837852	5.9671765685023814	-2
+0.050000000000000003	-0.40000000000000002	0	1
+0.049606000000000004	-0.40139690661727301	2.4629889873177899	-2
+0	-0.625197	38.423421769029957	-2
+0.025399919462543732	-0.60649624999999996	37.940786193898475	-2
+0.049591544341066773	-0.58625670343879877	37.442426622963978	-2
+0.082149559862168861	-0.57327293917191591	37.47511685516794	-2
+0.15503882655507598	-0.5092080091782254	37.737616386691833	-2
+0.13438294708669113	-0.53706299083446563	37.663791163912713	-2
+0.16262881321686334	-0.47321251647123469	37.385039082517991	-2
+0.14070489948847356	-0.44268257185353305	34.868513990486626	-2
+0.11417138033740237	-0.57942877001774817	38.312874641598555	-2
+0.070652711065539775	-0.39895032971050265	16.165469507748931	-2
+0.11496154278134874	-0.41640406357392507	30.1974596290226	-2
+0.096876674396829857	-0.39351954020756474	24.714041062838778	-2
+0.053783811058378483	-0.40094266503640941	6.1765570542406412	-2
+0.0582507802031784	-0.39942391311339936	9.2150932961855165	-2
+0.051050239404696093	-0.40105023940469609	3.3705486780437051	-2
+0.050000000000000003	-0.39921200000000001	0	1
+0.051396906617273051	-0.39960600000000002	2.5710628725066438	-2
+0	-0.66259849999999998	39.31766273945366	-2
+0.044479834345478447	-0.6391977305554567	38.978603243840226	-2
+0.078003369748832305	-0.60678401905017265	38.444637406506409	-2
+0.16868177206880722	-0.54217728106167151	38.874636690029099	-2
+0.19052743907897049	-0.50551189879782388	39.09355492898726	-2
+0.14735987038919127	-0.56760280217550052	38.789538149837689	-2
+0.17245865163084056	-0.43693428900233944	37.621874098771094	-2
+0.20247570908009688	-0.46453846511631264	39.39890464743533	-2
+0.14353321184134221	-0.41053690060387932	34.580355563534006	-2
+0.14246613386577112	-0.60042249074782428	39.296633417381535	-2
+0.11119104848859637	-0.61300988018972957	39.052404419601629	-2
+0.059831134613353661	-0.39287368150250329	8.6749239283021904	-2
+0.07167987033284344	-0.3844470106602364	14.572576419917251	-2
+0.13626221450102668	-0.37205787022430536	33.605510525428095	-2
+0.091522749128357797	-0.36886345542071591	22.01772199332947	-2
+0.053648560730753796	-0.39838468423010326	4.8054278803786215	-2
+0.053361352406047328	-0.39475649121359063	3.6363517381768884	-2
+0.050000000000000003	-0.39609315625000002	0	1
+0.051193855227557164	-0.39765257812499999	1.6590921472777842	-2
+0	-0.69999999999999996	39.943529555115582	-2
+0.034973019514478884	-0.67891375250214647	39.703811133129001	-2
+0.067513631519598785	-0.65423885639632462	39.433008712112596	-2
+0.091102681709422623	-0.64008442281665379	39.343304751406322	-2
+0.19595816760586796	-0.53358823498463426	39.546313636934904	-2
+0.17876421029138767	-0.57228549637092563	39.556086660770191	-2
+0.22050292025020984	-0.51427721741568944	40.09480058831592	-2
+0.17300541061099628	-0.60233799736436344	39.833983980141802	-2
+0.19942529152672078	-0.4377330072601322	39.342632796241908	-2
+0.18228635199160537	-0.40490686421242389	38.749196107361747	-2
+0.23989496481497297	-0.47714779964503495	40.642324348179592	-2
+0.23358294948791436	-0.43816890177041229	40.792427639146517	-2
+0.17375994486348312	-0.3725087158928026	39.121017176811911	-2
+0.13709800179434611	-0.63223193639611164	39.716618320412721	-2
+0.053806730410549147	-0.38985546874999999	3.4843495487173266	-2
+0.057432214789812162	-0.38154776400612872	5.7039796268989891	-2
+0.066633086623350046	-0.36472924047910105	10.609245709271729	-2
+0.11739416546523156	-0.341451582201516	30.224245200373755	-2
+0.16562180388403236	-0.33814860070945252	40.647978607262203	-2
+0.085588489940662468	-0.32760004497676909	19.561891776083996	-2
+0.050000000000000003	-0.39297431250000003	0	1
+0	-0.73740149999999993	40.384128288057603	-2
+0.038866964671769824	-0.72491785938856246	40.31316650884817	-2
+0.057099243038944904	-0.70020776503734938	40.068718012286787	-2
+0.079368451288818004	-0.67906333075246494	39.898183941078685	-2
+0.11613812585722541	-0.66159798049643836	39.912139249011176	-2
+0.22196800706678013	-0.54547359224578684	40.250715908393133	-2
+0.20309325611671869	-0.59268789130018562	40.214981088938217	-2
+0.22626856115643948	-0.57457272204795029	40.491336973911906	-2
+0.24953528980387135	-0.52854634969460035	40.758161680842797	-2
+0.26876941452508735	-0.50151747937132951	41.192605546587373	-2
+0.18162338124391325	-0.63169863720564812	40.263057888883814	-2
+0.21267263740540229	-0.41423097659680463	40.414031479274243	-2
+0.20751714567645102	-0.38286720262047957	41.201608265838424	-2
+0.27737731489930173	-0.46472727432743643	41.583716896347916	-2
+0.26212388484322752	-0.44049263772471559	41.550582258851023	-2
+0.24029290096869321	-0.39358522308055266	41.988960284974837	-2
+0.27237293635434756	-0.41375424430132735	42.23812899792587	-2
+0.19000000000000083	-0.34115417135493115	42.931946575215747	-2
+0.1491425602198107	-0.6621582840971455	40.214928572392267	-2
+0.050000000000000003	-0.386736625	0	1
+0.050000000000000003	-0.37426125000000005	0	1
+0.050000000000000003	-0.34931050000000002	0	1
+0.11024036408512117	-0.30750619658172001	29.142114262950926	-2
+0.14090479668744033	-0.31594244073034877	37.62159851785227	-2
+0.17973834892243529	-0.32448807542311509	44.129584523934106	-2
+0.17051973534246084	-0.31912500845277136	43.76498070375969	-2
+0.050000000000000003	-0.32435975000000006	0	1
+0.080949844688126799	-0.29689683984994525	17.868141552761198	-2
+0	-0.77480299999999991	40.694925232836738	-2
+0.03205373559959164	-0.75969323625224872	40.612219969857826	-2
+0.075792439972632714	-0.72519300698713496	40.411424036959083	-2
+0.067459594816685939	-0.76116702711281248	40.685155949097307	-2
+0.11391284805847791	-0.7005977701287891	40.347500056892187	-2
+0.13744973558659676	-0.68680555710471491	40.358787959640694	-2
+0.25503021091946865	-0.5684065543864214	40.905369086508813	-2
+0.2146315762677285	-0.62277219087340796	40.582843897298254	-2
+0.27009259176722494	-0.59936568218722441	41.167071003759048	-2
+0.24679410635417867	-0.62471372922141188	40.973749537914983	-2
+0.28065430483957465	-0.53738340356459002	41.271983972585794	-2
+0.30001554820007531	-0.48154198414263577	41.806226569172821	-2
+0.31180607628625645	-0.50715853193109839	41.800196496537183	-2
+0.22500062738323601	-0.65327925057575509	40.869871280216991	-2
+0.18612026439863946	-0.66904179395805696	40.607789525614123	-2
+0.21437819611596587	-0.33814860070945119	44.311546733895604	-2
+0.24378531194437111	-0.34602181700796075	44.161519596227087	-2
+0.30036580418203684	-0.44950870124168019	42.113062413799717	-2
+0.26413066925819023	-0.36866762085771154	43.341153698071878	-2
+0.29838836363741228	-0.37601916614173719	43.364661943908914	-2
+0.30657719583503745	-0.42264805679665679	42.539789173018043	-2
+0.20026165107756475	-0.32448807542311409	45.446903293651999	-2
+0.19000000000000031	-0.32158224665534685	45.437729391356662	-2
+0.156013971494329	-0.70679503833297153	40.656515602813236	-2
+0.10410935119799138	-0.27621251986938428	27.920005187484541	-2
+0.13424407845590702	-0.28664236810842264	37.643871547836945	-2
+0.15324636777354608	-0.29772974051182888	42.451581713183195	-2
+0.1609442060072051	-0.30686285372222993	43.546908470231749	-2
+0.18305030136013062	-0.31435021101705179	46.326551926067125	-2
+0.1776329397395798	-0.30803616562661196	47.181303775678053	-2
+0.17079028284501246	-0.30595356524910827	46.340687187110348	-2
+0.050000000000000003	-0.29940900000000004	0	1
+0.073501343549976547	-0.26796013679028258	14.409498880386767	-2
+0	-0.81220450000000011	40.91529829487839	-2
+0.044454539180683261	-0.80064909075697832	40.891410071790823	-2
+0.067045801527121099	-0.78736914356964549	40.849570368392669	-2
+0.10826404798197918	-0.74277598471228101	40.678141296527969	-2
+0.11011140447775045	-0.77473378690773342	40.886067793394773	-2
+0.13952241844068819	-0.73458395309472335	40.754182494700885	-2
+0.29315246822122387	-0.57380037348743329	41.398781957523553	-2
+0.27588096755176861	-0.62806737440417659	41.264191532355838	-2
+0.32283774604154641	-0.59831942866918808	41.666208400397203	-2
+0.25617840601460307	-0.67113676595488403	41.202095503658057	-2
+0.31421410463544946	-0.54080639074972581	41.683911615260065	-2
+0.32301603350140751	-0.46522629387060566	42.207891028436727	-2
+0.34761438276099516	-0.54553908815659635	41.975699689335016	-2
+0.34362388728436993	-0.49320002191904816	42.19454207605876	-2
+0.2295442238247638	-0.688920525346432	41.066679355151678	-2
+0.20106052615330516	-0.70356022226880577	40.930263299949132	-2
+0.20948026465753872	-0.31912500845277125	46.21990023292868	-2
+0.23909520331255965	-0.31594244073034877	45.891608428218333	-2
+0.27490862552254219	-0.33852232886655759	44.386295362599547	-2
+0.30537833494884548	-0.34168587117448124	44.180544406609819	-2
+0.32970430669572054	-0.360304632976159	43.741817792237129	-2
+0.32686702324324451	-0.39371098418953887	43.164240866641606	-2
+0.34190386735736933	-0.42367642758470475	42.818398040127619	-2
+0.34594712455059939	-0.45058239138452888	42.551447327875458	-2
+0.19694969863986975	-0.31435021101705157	46.984111295082975	-2
+0.19	-0.3115522590851364	47.334988510029561	-2
+0.19238087629467518	-0.73357384257915981	41.021741221868382	-2
+0.16929730259324327	-0.75462858909801089	41.006828024563703	-2
+0.093503184459129335	-0.24576240462203947	24.331384131835733	-2
+0.12509747154026093	-0.25220455607199516	35.832591883283513	-2
+0.14964555557153855	-0.27080114963959051	42.83142345654268	-2
+0.15623930978571682	-0.28616631677586868	44.161180111973081	-2
+0.16511748267955559	-0.29640796092585275	46.208310439487015	-2
+0.16886401664557524	-0.30094266503640937	46.817473358570098	-2
+0.18173066503640939	-0.30613598335442477	48.145093990624865	-2
+0.17510845036061537	-0.30429063513664029	47.895987502171273	-2
+0.17749999999999999	-0.30352126005711749	48.610418507525878	-2
+0.17360309338272695	-0.30227933007281876	48.221740318637309	-2
+0.050000000000000003	-0.24950750000000002	0	1
+0	-0.84960599999999997	41.075286677591372	-2
+0.02511738892406995	-0.83090524999999993	41.01579529547277	-2
+0.06604974455022139	-0.81988382920354963	41.00992798934687	-2
+0.090141088406811495	-0.79975178689200321	40.962218596205446	-2
+0.14045283084988822	-0.76688456359213908	40.948354740510702	-2
+0.1328314556023904	-0.79728402247368424	41.058578849475055	-2
+0.32736259948158059	-0.56823791781563304	41.750107250551594	-2
+0.29743790172042622	-0.64788128415434709	41.468316558742032	-2
+0.35153543488021344	-0.61107839235967198	41.859153988256679	-2
+0.33557639859978161	-0.6381275635139958	41.73720409372185	-2
+0.28534053219114963	-0.67464703121694536	41.419291230474265	-2
+0.26593251393559902	-0.70446983780376649	41.351858622138714	-2
+0.37232042433083823	-0.53062054866286579	42.217602122345234	-2
+0.3714488917103953	-0.56212754917115038	42.095333001693859	-2
+0.37719010138612552	-0.50217344764968652	42.384086695523628	-2
+0.36924099148738404	-0.46464207060773394	42.585950856235321	-2
+0.2351193724243979	-0.7204571624073175	41.210003872767132	-2
+0.20236706026042015	-0.30803616562661174	48.108382801526091	-2
+0.20920971715498751	-0.30595356524910827	48.082111875502029	-2
+0.21905579399279487	-0.30686285372222993	47.252593437762648	-2
+0.22675363222645392	-0.29772974051182888	47.454691860410179	-2
+0.24575592154409298	-0.2866423681084227	46.967990965065162	-2
+0.29436650828130717	-0.31310002037550255	44.957357339655168	-2
+0.32488495842363441	-0.32066753961006128	44.491820020102509	-2
+0.34944500995066308	-0.33779289226852993	44.060717489873149	-2
+0.35554020725679975	-0.37932260379477384	43.440143736546027	-2
+0.36982835126470665	-0.4084680866321112	43.107394150564247	-2
+0.37029888125492494	-0.43656306926100796	42.826724412373508	-2
+0.19826933496359062	-0.30613598335442477	48.597926262167888	-2
+0.19329300489077184	-0.30482299723946088	48.870238076571653	-2
+0.18670699510922817	-0.30482299723946088	48.747851577134476	-2
+0.20066359383138188	-0.76369941835804978	41.177574395302329	-2
+0.232146886210852	-0.75504341059180391	41.297762400185171	-2
+0.17834342424561847	-0.78753078842280422	41.170334192354154	-2
+0.067623754516641557	-0.22455675000000003	11.088094952140935	-2
+0.096148678496130055	-0.21362672892089199	25.930260568526684	-2
+0.15574497429681211	-0.25523313605478981	44.909138041565313	-2
+0.14345308484284106	-0.22303813192987854	41.866892182344223	-2
+0.16545942363660426	-0.27623139204517899	47.278046148478033	-2
+0.16972460123513139	-0.28753018749999998	48.290494485721915	-2
+0.17068138437214156	-0.29831664007229852	47.966417728801403	-2
+0.17089697975248519	-0.29398139746359059	48.4189354707513	-2
+0.17360309338272695	-0.29960599999999998	49.092613593821042	-2
+0.18306733007281878	-0.30139690661727303	49.59339322776875	-2
+0.180394	-0.30139690661727303	49.5561692556944	-2
+0.17536519199426412	-0.30179152901160622	49.042882345289556	-2
+0.17835661378563619	-0.30048418019518225	49.999999992680465	0
+0.17664338621436382	-0.30048418019518225	49.999999992680458	0
+0.17499999999999999	-0.29999999999999999	49.999999992680465	0
+0.050000000000000003	-0.19960600000000001	0	1
+0	-0.88700749999999995	41.183126726845373	-2
+0.036307921326141565	-0.86901507081151352	41.15169191858643	-2
+0.052780882627537502	-0.8455794584298848	41.092162622767695	-2
+0.092118919705739127	-0.83240286130557239	41.099052635222655	-2
+0.11781028676992167	-0.82102831079449923	41.109801867691246	-2
+0.16886378568819807	-0.8203107135322163	41.238649709526399	-2
+0.13888006051983126	-0.83961570908159522	41.214800811379192	-2
+0.37557767861296659	-0.59087148721734672	42.047109480482249	-2
+0.31705645612472788	-0.6728650323519425	41.61945867010099	-2
+0.37759413858816604	-0.63313653991426166	41.981824829442097	-2
+0.35787103004950438	-0.67057181445414926	41.846416777549564	-2
+0.30036003058981697	-0.69988918312995152	41.545449630199187	-2
+0.28931632673694574	-0.7301492770322382	41.520851300237311	-2
+0.26111098911010061	-0.74346759699322029	41.404777369140334	-2
+0.39616397761956218	-0.54688204543421481	42.284309051074061	-2
+0.41571374266645306	-0.51898401088799284	42.493438605587045	-2
+0.41639444122532276	-0.58316129008315365	42.271232455324707	-2
+0.40999526592369617	-0.47954235561236835	42.670908565858852	-2
+0.39888791811910962	-0.44029351105813108	42.895789785398946	-2
+0.20489154963938461	-0.30429063513664029	48.765181102936168	-2
+0.20250000000000001	-0.30352126005711744	49.111834996779962	-2
+0.20639690661727303	-0.30227933007281876	49.051057582529744	-2
+0.21113598335442474	-0.30094266503640937	48.549221393536236	-2
+0.21488251732044439	-0.29640796092585275	48.522678067209398	-2
+0.22376069021428319	-0.28616631677586868	48.201995553730875	-2
+0.23035444442846142	-0.27080114963959051	48.213757436632768	-2
+0.25490252845973904	-0.25220455607199516	47.458062021009113	-2
+0.28204800067026387	-0.27784789894400946	46.11690647756128	-2
+0.31824071352042277	-0.29277251082704642	45.079198780476872	-2
+0.35054724920577784	-0.30787201488647936	44.479944121196098	-2
+0.3744557337477657	-0.35477075454688828	43.740628987093103	-2
+0.40303759101172476	-0.32478641970604261	43.951137019239603	-2
+0.38750590998079887	-0.38203752943290359	43.412792601382428	-2
+0.4016082101894124	-0.40952212778276642	43.157656104986359	-2
+0.19693266992718123	-0.30139690661727303	49.679055024513623	-2
+0.19960600000000001	-0.30139690661727303	49.685182129201337	-2
+0.19	-0.29999999999999999	49.999999992680465	0
+0.194606	-0.29999999999999999	49.999999992680465	0
+0.185394	-0.29999999999999999	49.999999992680472	0
+0.21745003551564326	-0.78642876202086731	41.311100294752137	-2
+0.24385327042368277	-0.7964924032183891	41.429485589399221	-2
+0.27125806556752657	-0.78710156352967264	41.517953515632087	-2
+0.20324884006435176	-0.81085689611898848	41.318702869622001	-2
+0.11892235537990858	-0.19737280370433985	34.09712192924394	-2
+0.071788367709227349	-0.17465525000000001	14.062776675879643	-2
+0.10700742924988632	-0.17205749254551483	30.148350434534603	-2
+0.17499999999999999	-0.26806049999999998	49.999999992680472	0
+0.17499999999999999	-0.23690899999999998	49.999999992680472	0
+0.17499999999999999	-0.20575749999999998	49.999999992680493	0
+0.14596157116685993	-0.19018174999999998	42.570345510663678	-2
+0.17499999999999999	-0.28363624999999998	49.999999992680479	0
+0.17499999999999999	-0.29142412499999998	49.999999992680451	0
+0.17369683648593182	-0.29726503124999998	49.377672701038506	-2
+0.17499999999999999	-0.29531806249999998	49.999999992680479	0
+0.17499999999999999	-0.29921199999999998	49.999999992680493	0
+0.180788	-0.29999999999999999	49.999999992680472	0
+0.17999999999999999	-0.29999999999999999	49.999999992680443	0
+0.050000000000000003	-0.14970450000000002	0	1
+0	-0.92440900000000004	41.250881831516068	-2
+0.027830575126782258	-0.89753826272334236	41.213887585743329	-2
+0.068413908563720566	-0.89478681433600271	41.235450846610831	-2
+0.076743949002086864	-0.8612752486829488	41.167618823674523	-2
+0.11086656062654464	-0.8592082793570035	41.211099098629219	-2
+0.19244005848601597	-0.8388025142971165	41.344186390391712	-2
+0.16608611875141588	-0.85586336736455348	41.312559077613969	-2
+0.14104018519614478	-0.87527617799375135	41.29739102919843	-2
+0.40038265646723986	-0.61029138856044196	42.136280442342695	-2
+0.33283096749543289	-0.7012809347133655	41.713127715586289	-2
+0.40894391290479437	-0.64060845277742995	42.11768818608433	-2
+0.38320876996188041	-0.66000794373070226	41.9772939546137	-2
+0.37252838315985848	-0.70808667743098896	41.894746305009626	-2
+0.34073049173833991	-0.7328070545623756	41.75774894865183	-2
+0.31471491925825307	-0.74996210559611887	41.652979731991138	-2
+0.28605420482526844	-0.76219604345879821	41.543818903620476	-2
+0.42692047680307471	-0.55115391537839986	42.412336168835978	-2
+0.4441040716471415	-0.50015629553803298	42.675446278144129	-2
+0.44385024288534786	-0.57718455377327893	42.394823491450403	-2
+0.45234621342060405	-0.60396814775124352	42.357076335596638	-2
+0.42724218671605191	-0.4402488750860008	42.964344570594321	-2
+0.44263487464869888	-0.46406130247687588	42.853012114318247	-2
+0.42795866947729211	-0.41359512060936837	43.152199064981339	-2
+0.20463480800573586	-0.30179152901160622	49.45381104350146	-2
+0.20164338621436384	-0.30048418019518225	49.999999992680472	0
+0.20335661378563619	-0.30048418019518225	49.999999992680465	0
+0.20499999999999999	-0.29999999999999999	49.999999992680451	0
+0.20639690661727303	-0.29960599999999998	49.557008593201836	-2
+0.20931861562785842	-0.29831664007229852	49.100897965918982	-2
+0.20910302024751479	-0.29398139746359059	49.362888936390725	-2
+0.21027539876486859	-0.28753018749999998	49.393352929394922	-2
+0.21454057636339571	-0.27623139204517899	49.199150816388844	-2
+0.22425502570318787	-0.25523313605478981	48.818903505056127	-2
+0.23654691515715892	-0.22303813192987854	48.52019204496959	-2
+0.27997616052134577	-0.23162777825591518	46.913315565853615	-2
+0.31221057992819867	-0.26200202482012869	45.70543647848806	-2
+0.3437762332826203	-0.27457573774178734	45.014229196496444	-2
+0.39001383379253163	-0.28735051090501262	44.400027032377018	-2
+0.40466122319978076	-0.35595924912494287	43.646059535253194	-2
+0.43097595358923169	-0.33916888164854575	43.716649399583481	-2
+0.43110970266819543	-0.30774612832832143	43.951443788062889	-2
+0.42031357258369523	-0.38493783533157527	43.37155880437642	-2
+0.199212	-0.29999999999999999	49.999999992680472	0
+0.20000000000000001	-0.29999999999999999	49.999999992680451	0
+0.27611740978647775	-0.81566023017741673	41.561163188226786	-2
+0.23014826029539331	-0.83732414477420103	41.445830067600745	-2
+0.31056278755302363	-0.78084682009600404	41.653945880065834	-2
+0.31179939228855097	-0.81162006992799662	41.673688743344641	-2
+0.085011555023992297	-0.14428387844332446	21.061264830809051	-2
+0.120428965547053	-0.14338992369070777	34.748741298074115	-2
+0.14794890983406289	-0.15903024999999998	43.16821227327577	-2
+0.17499999999999999	-0.17460599999999998	49.999999992680479	0
+0.050000000000000003	-0.12475375000000001	0	1
+0.024143243527987478	-0.93834994885249079	41.273709736654865	-2
+0	-0.96181050000000001	41.289207909729804	-2
+0.046029560029212734	-0.92108045514341907	41.263111901242233	-2
+0.076975069218663178	-0.92824008225505683	41.292017761865871	-2
+0.10327129489014739	-0.89408789262433463	41.272708897491945	-2
+0.19508064901479122	-0.86864903195370813	41.396967933006017	-2
+0.17162680268807015	-0.8937367850275062	41.379847756193108	-2
+0.14193211276190265	-0.91099087590468875	41.349174730111102	-2
+0.43448643443907425	-0.65788753143844403	42.186980017691226	-2
+0.40749585021100027	-0.67280380874646917	42.066537936960088	-2
+0.39951321446175952	-0.69986140837886224	42.008094790091548	-2
+0.37028120709466378	-0.73800717612439815	41.873618029074215	-2
+0.41021813609621521	-0.72596199887356361	42.02335357031226	-2
+0.35095228877240553	-0.76128362089167512	41.798426490094897	-2
+0.45792504770015707	-0.55286496719913181	42.514159183477659	-2
+0.47152885362873392	-0.48096261019366748	42.826268194855174	-2
+0.47802133554860593	-0.51942906412596834	42.686224425736661	-2
+0.47187275121164318	-0.58303488162401251	42.468816431999898	-2
+0.46529336607390198	-0.65927314644619728	42.285749894696103	-2
+0.49148803105311334	-0.63666126362684849	42.403374170889364	-2
+0.48733838929554274	-0.60777850885536067	42.45306435052138	-2
+0.45352811484297562	-0.42961795214658705	43.065326298180736	-2
+0.47222894495568651	-0.45188943157523687	42.96314686714728	-2
+0.44952121202649387	-0.39791096509937618	43.261845154205517	-2
+0.20499999999999999	-0.29921199999999998	49.999999992680479	0
+0.20630316351406816	-0.29726503124999998	49.719777921486681	-2
+0.20499999999999999	-0.29531806249999998	49.999999992680465	0
+0.20499999999999999	-0.29142412499999998	49.999999992680479	0
+0.20499999999999999	-0.28363624999999998	49.999999992680465	0
+0.20499999999999999	-0.26806049999999998	49.999999992680472	0
+0.20499999999999999	-0.23690899999999998	49.999999992680479	0
+0.20499999999999999	-0.20575749999999998	49.999999992680479	0
+0.26209852232571362	-0.20456339460139186	47.735171062225426	-2
+0.23403842883314005	-0.19018174999999998	48.803674798913413	-2
+0.29353797318486702	-0.20216308671955746	46.839596303523528	-2
+0.31079580955598457	-0.22795982543414628	46.181037364623712	-2
+0.33898983662854648	-0.24093678509165767	45.500305096809207	-2
+0.36882734492071423	-0.25385128391172396	44.94544772429466	-2
+0.40101561814733505	-0.24927130055508645	44.629201853095857	-2
+0.42240781517285836	-0.27608081391160527	44.246377268252758	-2
+0.4472813826087409	-0.3660303838315872	43.477919733344905	-2
+0.47171910666468592	-0.32786419523511151	43.655182152695915	-2
+0.45535845723177681	-0.2856008605447477	43.973102635682558	-2
+0.26355800230426701	-0.85102464114167375	41.552204458556091	-2
+0.29920273794333296	-0.84524819906754811	41.646158110763061	-2
+0.23618503834961421	-0.87457533765264572	41.499369796578733	-2
+0.34011138038050592	-0.78953029626685989	41.760707156019244	-2
+0.34425132832770899	-0.83524640128071503	41.770315531682982	-2
+0.11934764409662232	-0.10916811529962223	34.585715315126834	-2
+0.079911928405247315	-0.11227837500000001	18.406422626920573	-2
+0.14802191086570213	-0.12787874999999999	43.173574273213269	-2
+0.17499999999999999	-0.14345449999999998	49.999999992680472	0
+0.050000000000000003	-0.099803000000000003	0	1
+0.032086534133014329	-0.96507354137527046	41.29837380408653	-2
+0	-0.98051124999999995	41.298589377742388	-2
+0.011428843887285224	-0.97537082957185206	41.297767353436463	-2
+0.071544633406902064	-0.95953537209660333	41.314407005587825	-2
+0.10763007533717972	-0.93655605479263615	41.329591147260707	-2
+0.20303940095448175	-0.89959650156434989	41.444986568243458	-2
+0.17202743783698959	-0.92807798118149532	41.408023102576372	-2
+0.1473800543677074	-0.95237210076286694	41.385220971103266	-2
+0.43895004938925364	-0.69784180728213585	42.148062883879568	-2
+0.38869709903165811	-0.76169559030718448	41.92678354745793	-2
+0.43951002371397213	-0.72715253012600289	42.114966156425929	-2
+0.42861083674027312	-0.76138671377156164	42.05052093726826	-2
+0.37704462124551669	-0.79437473577143203	41.875885421551615	-2
+0.49095368606845874	-0.54995919325611797	42.61320526900198	-2
+0.50028516507835663	-0.49386798927876863	42.821158764720828	-2
+0.49935940355414887	-0.46236216087959514	42.943721746595465	-2
+0.51471938527288308	-0.52188811677479896	42.747289476845758	-2
+0.50046925507489937	-0.5817206230280223	42.546504984602549	-2
+0.49000335032917869	-0.6712337012203573	42.335908531371892	-2
+0.47956423988497121	-0.69662391913071287	42.26901886665874	-2
+0.52377998010897531	-0.62933773752225741	42.493645602371416	-2
+0.51564774093572108	-0.66143556758068967	42.415516875513561	-2
+0.52884973546183478	-0.58462009421530658	42.601002530671373	-2
+0.47739278096010868	-0.41049543048053566	43.178669145934101	-2
+0.49170491179116033	-0.43329993683352425	43.065970989987292	-2
+0.48203586583339558	-0.37960761541764731	43.3403271867166	-2
+0.20499999999999999	-0.17460599999999998	49.999999992680451	0
+0.25980172769206145	-0.17447976967778872	47.976822040968415	-2
+0.28850035614477576	-0.17390419473600777	47.145157045495374	-2
+0.23574824637908906	-0.15213750919582589	48.834505322569704	-2
+0.32324823725347751	-0.20101160762737677	46.16260963601048	-2
+0.35006400724328057	-0.21374675106498109	45.562188162237057	-2
+0.37940782904133286	-0.21281116169980874	45.135381921015437	-2
+0.43064568686479315	-0.24756801645289775	44.368811584500769	-2
+0.41915019127617237	-0.20936910708137979	44.683736594713722	-2
+0.46356489747872143	-0.25708890468610085	44.078348540447223	-2
+0.48490806197306729	-0.35213474491915087	43.482182163842225	-2
+0.50763724895822937	-0.33643786041663126	43.50272794888231	-2
+0.49902459826028328	-0.29299553801973699	43.725919325838071	-2
+0.28697278410929844	-0.88264557219845929	41.622390367445369	-2
+0.31603045561468723	-0.87144976811252772	41.691637675682315	-2
+0.25838077435699902	-0.9096757824492071	41.561573131029519	-2
+0.36546404411979649	-0.85757189461851846	41.818382302504922	-2
+0.34562788986579152	-0.8811289306897967	41.760984151389259	-2
+0.37996897503520222	-0.82757023172932309	41.870408825156211	-2
+0.1043934492315118	-0.085090614340513016	29.09967043793517	-2
+0.13902937910114638	-0.081151499999999988	40.77858547014916	-2
+0.077963733150355805	-0.074852250000000009	17.710836658774461	-2
+0.17499999999999999	-0.11230299999999999	49.999999992680486	0
+0.050000000000000003	-0.049901500000000001	0	1
+0.059187999836045613	-0.99741579611828945	41.317752049352571	-2
+0.031220256924433053	-0.99863689414483325	41.306653238814192	-2
+0.019854096050345198	-0.98464754886085237	41.301616420367523	-2
+0	-0.98986162499999997	41.300790993670716	-2
+0.0054537855140278004	-0.98638632194460707	41.300313747077809	-2
+0.087155742747658166	-0.99619469809174555	41.333228659047677	-2
+0.10559872267897918	-0.96919248542168157	41.344675210829173	-2
+0.20647872336074941	-0.93136533328861815	41.465960038083139	-2
+0.18674123690414149	-0.95604565341746406	41.438322060859925	-2
+0.13040196020729425	-0.99050122555197684	41.369819577725821	-2
+0.17364817766693033	-0.98480775301220813	41.41861836033857	-2
+0.4677180680503098	-0.7351361558432784	42.185834801285253	-2
+0.40879990471015409	-0.78039944475798628	41.977110235825762	-2
+0.43542906642253526	-0.79392292177966339	42.039573548021075	-2
+0.46280341747834769	-0.78197965637471156	42.121093761813448	-2
+0.40901238702758025	-0.80785689946028771	41.959275454567809	-2
+0.5282260274011662	-0.55609870595291344	42.671334057167769	-2
+0.52604495016187769	-0.47734455304133971	42.909432620378041	-2
+0.518407146227302	-0.43674569872982072	43.055985026928148	-2
+0.54515817723331417	-0.51381463951384432	42.812492399632255	-2
+0.516544812834834	-0.71182836860320986	42.337384121558706	-2
+0.49658210766903343	-0.73280582393886273	42.261869054962737	-2
+0.54748589250641488	-0.60621991483421145	42.588088270302535	-2
+0.55401808271852004	-0.65407789862773091	42.509105169133228	-2
+0.54028727883330829	-0.68620132983373372	42.428441255019322	-2
+0.56208414087857272	-0.57478518390294575	42.680814585182809	-2
+0.50773240457691637	-0.40666132529923382	43.185320533765278	-2
+0.51695588064322684	-0.37216997180097849	43.326988572675461	-2
+0.20499999999999999	-0.14345449999999998	49.999999992680458	0
+0.27356316404510361	-0.14762976737547265	47.655811133138556	-2
+0.31367325304919652	-0.16011043444303649	46.599066364776448	-2
+0.22837482542672302	-0.12604451480443077	49.135580657006102	-2
+0.24983894122509864	-0.10947636989185558	48.442047257992108	-2
+0.34789739265782749	-0.18446807304813456	45.793554443829933	-2
+0.38677629482440601	-0.17293185553489657	45.242391095581738	-2
+0.45384445254996864	-0.22905695436509779	44.277912136752917	-2
+0.44795472483421983	-0.19902259929936994	44.452429793741302	-2
+0.42026327097840671	-0.17577969210239749	44.814554446987756	-2
+0.49232460039100112	-0.24979803527227173	43.940023483407188	-2
+0.54284289961552767	-0.3475815959779367	43.379902103803815	-2
+0.53433168115391749	-0.31328722903947259	43.52136616757172	-2
+0.51671658006360266	-0.26813314367724306	43.749164605418237	-2
+0.32225276693334975	-0.90251471806852335	41.699739011995355	-2
+0.2945531205646692	-0.91044223424429638	41.637488029042636	-2
+0.23264888423163504	-0.94864557978884323	41.51243085529066	-2
+0.27278451229643108	-0.93769028540919652	41.586824037709256	-2
+0.39624641016367068	-0.85664836617113549	41.893977536070146	-2
+0.38178952486989381	-0.88825145012751694	41.839178955171214	-2
+0.3537511605746787	-0.91102232564675645	41.76299884651047	-2
+0.41649036594300637	-0.83587926674161339	41.957948353632275	-2
+0.11636108216735286	-0.059397623887617587	33.63244286437812	-2
+0.17499999999999999	-0.081151499999999988	49.999999992680451	0
+0.14769053735987844	-0.054809156299706382	43.169593280682555	-2
+0.071386436298067596	-0.025714319523098599	13.753264381829148	-2
+0.10326314871642384	-0.030840191385612992	28.798676934395434	-2
+0.050000000000000003	0	0	1
+0.015610128462216532	-0.99931844707241657	41.302876427411235	-2
+0.0084846966837056961	-0.99365471453164034	41.30166941963693	-2
+0	-0.99453681250000003	41.301377055846551	-2
+0.002619753317722595	-0.99219921874999994	41.301172806171429	-2
+0.21623361138472552	-0.97536678965063828	41.480539315838143	-2
+0.49568461733064118	-0.76174986893931973	42.223389892841666	-2
+0.46079636416246395	-0.81472250741368435	42.082828058973604	-2
+0.49342145458297498	-0.80028940315790076	42.172380801489645	-2
+0.5624584961334621	-0.54012813523460967	42.762861377637371	-2
+0.54994639175288529	-0.44167475804072959	43.04190177183888	-2
+0.55587067733796058	-0.48420140881198559	42.909033218585726	-2
+0.53948520690714008	-0.41133290959251179	43.148056536502217	-2
+0.5718187173760868	-0.51164109256646306	42.845363971053793	-2
+0.53810505865006242	-0.73051274970823143	42.357258975601546	-2
+0.58058978049224408	-0.60248624828928232	42.65053600867526	-2
+0.58465955303616002	-0.67831668402888767	42.523709274025279	-2
+0.59664813556034313	-0.63167420639110761	42.620883639713114	-2
+0.56414711195178424	-0.71886106499223279	42.425426710107082	-2
+0.60112593929481151	-0.5849075001562376	42.712831305011385	-2
+0.60180345692392079	-0.5578836741104769	42.767789370245055	-2
+0.54995979494177516	-0.38099568557421792	43.249084604273747	-2
+0.20499999999999999	-0.11230299999999999	49.999999992680458	0
+0.30121296670174624	-0.12946223681863153	46.996483234453763	-2
+0.28084379532900972	-0.10579969778860014	47.553846969089662	-2
+0.33059641701119624	-0.13537316098555346	46.334871266797741	-2
+0.2256111609051614	-0.08220439908106783	49.247689099122383	-2
+0.26167172995044619	-0.076692494576647799	48.104225511644692	-2
+0.38539193961701307	-0.14441353696100889	45.362833819464242	-2
+0.36023451009859603	-0.13091114185318223	45.8053028602748	-2
+0.41389708812303172	-0.14278030633681488	44.982928016335514	-2
+0.4914219697140193	-0.20609335047845787	44.092753415068202	-2
+0.46306018458770998	-0.17240349972001601	44.40095750764376	-2
+0.44694159213167139	-0.14354665456973595	44.611847040383353	-2
+0.51640161828082143	-0.2255877654960165	43.885147444821826	-2
+0.57366220291885994	-0.3584823279769131	43.288516959401406	-2
+0.58214425453319041	-0.30989014359628414	43.40621673297148	-2
+0.54499484325480796	-0.27959982163816899	43.599246710999445	-2
+0.54447194465225401	-0.24028714768708198	43.709007670639458	-2
+0.31599669467794889	-0.9296851303598862	41.67420177542288	-2
+0.3004195942140947	-0.95280922353748843	41.632287475026807	-2
+0.25881904510252074	-0.96592582628906842	41.551428731659726	-2
+0.43016735974151632	-0.87357663952040088	41.957600765886127	-2
+0.42261826174069939	-0.90630778703665005	41.911404624889833	-2
+0.38231920253318408	-0.92300020391127924	41.813184864656108	-2
+0.34202014332566871	-0.93969262078590843	41.719667560286005	-2
+0.444548844550267	-0.8432205891671013	42.017768338882384	-2
+0.13183905350593833	-0.032056899408675177	38.647001494527423	-2
+0.17499999999999999	-0.049999999999999989	49.999999992680472	0
+0.17499999999999999	-0.01884849999999999	49.999999992680472	0
+0.094826080531822676	-0.0035111117560101754	25.541164920643123	-2
+0.12073050922474363	-0.0081917029189366511	34.943104548457192	-2
+0.050000000000000003	0.049901500000000001	0	1
+0.072300939055952279	0.024950750000000008	14.417707472137424	-2
+0.0078050642311082623	-0.99965922353620829	41.301921641467523	-2
+0.0028005204902681272	-0.99570560937499997	41.301516658065701	-2
+0	-0.99687440625000001	41.301526592396904	-2
+0.52464594871837966	-0.78649311244306397	42.255708439594834	-2
+0.54405948811842864	-0.75841427415756946	42.3317686653129	-2
+0.47709702808984811	-0.84289656636915478	42.0897276374033	-2
+0.51154528402015054	-0.82508844288863459	42.182216918255932	-2
+0.59024066420988663	-0.53103543663604991	42.814494744315503	-2
+0.57348779735679256	-0.40576632716849259	43.146367986118747	-2
+0.5742401885395032	-0.45996642193947745	42.987751034576	-2
+0.58606523342676342	-0.48900162509360323	42.913542849839246	-2
+0.60930138614582918	-0.50887206798163209	42.879167760595458	-2
+0.60313495658017557	-0.70270479154131105	42.517835083795056	-2
+0.60747960590398631	-0.65932019470356218	42.590848994788153	-2
+0.62511322387896417	-0.63195350023681296	42.65987155049956	-2
+0.62537249829424812	-0.59685951174325225	42.719879148961553	-2
+0.6061438009500687	-0.73315256945217855	42.479516680338826	-2
+0.58562592687163884	-0.75767639052462921	42.410551335964918	-2
+0.62212415808983046	-0.53591306051620824	42.831221514345714	-2
+0.6449358003780481	-0.55618483670496388	42.812112615813909	-2
+0.59692007678846504	-0.3830924348655883	43.19007844413774	-2
+0.20499999999999999	-0.049999999999999989	49.999999992680472	0
+0.31104262152984924	-0.097871911726201882	46.819427762816616	-2
+0.2910906389838534	-0.076248127050562761	47.307911704191127	-2
+0.3413192184541558	-0.10593364110084991	46.172670579197259	-2
+0.24329138781938298	-0.04220934303534634	48.647881901858668	-2
+0.28188943075063627	-0.048301616744925217	47.528744997421228	-2
+0.39805897831528458	-0.1159242061243187	45.232006537167962	-2
+0.42922009165548408	-0.11564549051402676	44.840703244931092	-2
+0.50161439213494707	-0.16872976126332828	44.104721335128708	-2
+0.52700123235878171	-0.19572703474815867	43.895829425836368	-2
+0.49205058577754462	-0.13120034770806893	44.224661204067893	-2
+0.46556024457119644	-0.12299333213195074	44.460051713446937	-2
+0.6036972921558561	-0.32526720594150577	43.323101046651743	-2
+0.60563531030809203	-0.35167234867496738	43.257725460210125	-2
+0.57374043509650641	-0.26772481577143886	43.533141386120832	-2
+0.62677597089870485	-0.31229176511595946	43.305423610527917	-2
+0.60426747629988131	-0.27367667010700947	43.429546861004965	-2
+0.56275351724388134	-0.20547990907626873	43.695553118641364	-2
+0.58178923633679425	-0.23768248541477816	43.566085206246804	-2
+0.46130913087034964	-0.88616659541054443	42.011095151204124	-2
+0.14860890465402998	-0.0097330809533257255	43.273241951940115	-2
+0.17499999999999999	0.012303000000000008	49.999999992680472	0
+0.10184197176186779	0.040673319605755535	28.225760847178105	-2
+0.13382744143925457	0.014642870125234714	39.292175665904104	-2
+0.050000000000000003	0.099803000000000003	0	1
+0.074236611017996057	0.064070580723641635	15.631375454059119	-2
+0.0039025321155541312	-0.99982961176810403	41.301700284748428	-2
+0.0013961963659369146	-0.99839575340557585	41.30159671703391	-2
+0	-0.99921199999999999	41.301601487155871	-2
+0.53961447119644479	-0.81261501928897684	42.253506375274213	-2
+0.55832053380671909	-0.78902489626972605	42.319416308815732	-2
+0.49999999999999994	-0.86602540378443882	42.111400402191059	-2
+0.53678821817552302	-0.84258872403671536	42.211352906943674	-2
+0.59976849534934074	-0.41862596873618108	43.096433932853685	-2
+0.60210637919505439	-0.44779066944352403	43.021703367634814	-2
+0.61431794130773099	-0.47731668644836944	42.952096950538468	-2
+0.63923365967247414	-0.49745414032787355	42.917620345138481	-2
+0.63163104557672956	-0.71384450590265014	42.546545523730863	-2
+0.64157726201130927	-0.68650738597961469	42.599536703179055	-2
+0.63713064156815558	-0.65775894404471236	42.635736160538357	-2
+0.65113330388324731	-0.62040816808005583	42.710353605967228	-2
+0.65221779129322044	-0.58472927561930721	42.768913921453716	-2
+0.61386707916017946	-0.76418081352723233	42.4502347386805	-2
+0.64661143438374069	-0.73793498537460245	42.536359968819205	-2
+0.60818202301879265	-0.79259824370398513	42.40410786850947	-2
+0.65036727879639744	-0.52601533904421494	42.869203481567858	-2
+0.67400504259068794	-0.56345031388350064	42.822173693814875	-2
+0.62366506728422677	-0.40174404591957752	43.122957820715271	-2
+0.63037469502333221	-0.36878003076669719	43.188115615827407	-2
+0.20499999999999999	-0.01884849999999999	49.999999992680451	0
+0.23149665758392315	-0.018479758716899782	49.018321611389801	-2
+0.31996856828734338	-0.06961944904757883	46.630773466559312	-2
+0.31117158741635448	-0.04066463358818731	46.795649525435401	-2
+0.34903663689202824	-0.076962672857130238	46.050241470192191	-2
+0.39505508265692812	-0.084890797484924924	45.295583395834115	-2
+0.26638899971483415	-0.021189234104414156	47.917666387818166	-2
+0.30709698118620432	-0.012070808721530796	46.828066740847405	-2
+0.42216977628232	-0.089123508888191608	44.935458262048606	-2
+0.4545753677481752	-0.097529126605792119	44.575365235801939	-2
+0.53478783590852152	-0.14029270541088287	43.919625940819451	-2
+0.55292445782558841	-0.1711043114495327	43.787659218594406	-2
+0.51686409806902434	-0.11955435596277469	44.045452639848968	-2
+0.48129417508273098	-0.081982030733270969	44.314429150554787	-2
+0.64517423811270191	-0.3388563859397386	43.226890801780563	-2
+0.64876330570131724	-0.29631131725386217	43.289781792625512	-2
+0.62883906956273405	-0.26014920575514822	43.387570846888295	-2
+0.61900365581656092	-0.23388097163658711	43.449574657953804	-2
+0.58588428865682918	-0.18027308077209164	43.625795300803617	-2
+0.6100040727972621	-0.20240633794945517	43.512210187577601	-2
+0.17499999999999999	0.043454500000000007	49.999999992680472	0
+0.10193641505403646	0.068641906412725731	28.139759759112369	-2
+0.13978857045798587	0.055448746068081665	40.769145479417148	-2
+0.050000000000000003	0.14970450000000002	0	1
+0.075533758218145591	0.12475375000000001	15.896324697898935	-2
+0.084241721046077467	0.090301744165561346	20.536427563541896	-2
+0.0019512660577770632	-0.99991480588405213	41.301631136951769	-2
+0.0009756330288885342	-0.99995740294202606	41.301613301917605	-2
+0	-1	41.301602168518357	-2
+0.57357643635104605	-0.81915204428899202	42.308876256720737	-2
+0.64551036936540107	-0.42131120178696529	43.070279761973502	-2
+0.6350839166286657	-0.45303331356953508	43.006555912437236	-2
+0.65998837235443164	-0.4730502067951467	42.969025654767144	-2
+0.67076285343018083	-0.50313040770788153	42.918794415711893	-2
+0.68014258343976797	-0.70996295310400481	42.620154313079965	-2
+0.67060371514725992	-0.68458115510134776	42.641050054286296	-2
+0.6782552846782981	-0.64237533625476551	42.708825912151113	-2
+0.67827679013182185	-0.59846757843126719	42.771977207908073	-2
+0.64278760968653925	-0.76604444311897824	42.493869264862475	-2
+0.67494719543654336	-0.73657561215276302	42.578895706936088	-2
+0.70113373618887675	-0.55072860074789864	42.859762746425027	-2
+0.69945449249531988	-0.57926592329321314	42.818176798356454	-2
+0.64922360824289593	-0.39221992012398127	43.124266202531992	-2
+0.66041898365946239	-0.36734801715319021	43.15906754752239	-2
+0.20499999999999999	0.012303000000000008	49.999999992680443	0
+0.24213869326715609	0.0057886551119917182	48.616486523492021	-2
+0.34047214221295458	-0.048230722362672916	46.18799951634989	-2
+0.33551490039734899	-0.0069102754017412726	46.17702926912289	-2
+0.37685213627313552	-0.053028917620435087	45.551936336674295	-2
+0.41194809615929723	-0.054108999738189278	45.037567844888187	-2
+0.2836709224794346	0.0048238356932765467	47.366754821320953	-2
+0.33025202750190724	0.034372357173664811	46.081319147888003	-2
+0.44050697220093715	-0.068706121639465073	44.708420840618025	-2
+0.56446136763857746	-0.14356966651972705	43.748899298345165	-2
+0.55904722437117715	-0.1126288511734258	43.778875172307622	-2
+0.53198111134411152	-0.096689198504062324	43.938186941846226	-2
+0.46759091635220029	-0.054272329262222765	44.414783347244445	-2
+0.49822533344544068	-0.056118103499625219	44.148150066157598	-2
+0.67736852694877425	-0.34163182866628677	43.1815219836719	-2
+0.67135517178212822	-0.31142505909968177	43.23083316526364	-2
+0.655142775328595	-0.26988935720412294	43.313582209512944	-2
+0.68556458165753675	-0.26916220304716315	43.256468896440808	-2
+0.65046137647817759	-0.24214444922043829	43.35476586562573	-2
+0.6401213632898155	-0.19379486183830069	43.421626555680753	-2
+0.6187774390544083	-0.17086789942155148	43.503399568023454	-2
+0.59587635921548243	-0.15299686988080291	43.598543657269573	-2
+0.17499999999999999	0.074606000000000006	49.999999992680451	0
+0.11977698415230859	0.090181750000000005	34.716185532398555	-2
+0.050000000000000003	0.19960600000000001	0	1
+0.075585442952592632	0.19290058944586666	14.984727329004791	-2
+0.082153525181381221	0.15983496177578779	18.708267450222287	-2
+0.10920129152119391	0.12243564857199081	30.550500967596626	-2
+0.66651978916167953	-0.44177324204643476	43.025812125011527	-2
+0.67396527004564966	-0.40370025806955012	43.088278543448666	-2
+0.69224072608035658	-0.44996390981081558	43.008608474008589	-2
+0.70404831118934197	-0.47423806413789971	42.97205879856363	-2
+0.70825079822766546	-0.5126989909819738	42.918409224950864	-2
+0.70710678118654746	-0.70710678118654779	42.658065949161617	-2
+0.70254649976851413	-0.67262074696485918	42.695684098316931	-2
+0.70865989559065146	-0.61069803689323665	42.783060627373501	-2
+0.72061656328468082	-0.64369211656739789	42.751834344114116	-2
+0.74280265723119954	-0.54318477517486685	42.893738977053722	-2
+0.72801941901651734	-0.58038109604945132	42.838045080409024	-2
+0.7002078625542878	-0.37512905520857054	43.114061244841139	-2
+0.20499999999999999	0.043454500000000007	49.999999992680436	0
+0.24040567399884855	0.043454500000000014	48.579063741642337	-2
+0.26914652409495859	0.032100179220044184	47.661256457326608	-2
+0.37913392340352225	-0.021100297899925978	45.436101462187871	-2
+0.35521232952068388	0.016577612775126611	45.69774713204567	-2
+0.41085417981544337	-0.016802781998005639	44.967440991324466	-2
+0.44243593284252447	-0.036691055195591064	44.633128815425351	-2
+0.32145524836240719	0.073445354159833665	45.997716357897851	-2
+0.279970186179751	0.061045047568258078	47.176758896642411	-2
+0.35091892180046047	0.05955197964662691	45.512353127972233	-2
+0.58789043477252168	-0.12506734848450102	43.636359881264937	-2
+0.55851851948370057	-0.082577160305331063	43.764898022484481	-2
+0.59666752083494334	-0.087603109182637751	43.576862148024759	-2
+0.53603145572151667	-0.051893592408713725	43.86451134622201	-2
+0.4861801734346321	-0.00088884588111491636	44.111238478507467	-2
+0.51375352733208945	-0.023803383994247175	43.959889084525194	-2
+0.70749907354549901	-0.33524750961154037	43.156948861138218	-2
+0.70967944583877773	-0.28772260118416226	43.201364656700399	-2
+0.72329081032951537	-0.3121595407306732	43.16325293355429	-2
+0.67848023499925936	-0.23956782713029379	43.292973319951642	-2
+0.72426239640487566	-0.26207875820059578	43.198394473512487	-2
+0.67029970704015929	-0.20218987678241634	43.334478784174017	-2
+0.63959086267501364	-0.15346719371781734	43.434082977094903	-2
+0.66634299450689416	-0.15797347868976797	43.353114997781034	-2
+0.61187283611733712	-0.11092565917242457	43.528236557961648	-2
+0.63476553376693901	-0.12677076394288975	43.445623015187927	-2
+0.17499999999999999	0.1057575	49.999999992680451	0
+0.14293052380316082	0.12133325	41.415831577180242	-2
+0.050000000000000003	0.24950750000000002	0	1
+0.076757730252578496	0.23528921771413516	14.411131437109473	-2
+0.10549033414368243	0.18416331529256882	27.528448714050661	-2
+0.094872753076714278	0.21099968030579136	22.67030418866517	-2
+0.12509747154026085	0.15220455607199529	35.55546100781747	-2
+0.70249827798483711	-0.40357028290283853	43.075114666229638	-2
+0.71119617221392872	-0.43074556710707879	43.033784522609295	-2
+0.72727867154377557	-0.45572229072378295	42.998610286872854	-2
+0.75027050021528396	-0.50150216961484073	42.946354435845997	-2
+0.73657561215276268	-0.67494719543654369	42.730722570384522	-2
+0.74110169086373368	-0.61519771810102775	42.80560224260492	-2
+0.7660444431189779	-0.64278760968653958	42.796379468674736	-2
+0.76642575151621206	-0.55980271390633041	42.887523836048608	-2
+0.78476411738106566	-0.53748879877052258	42.920452699827493	-2
+0.76077350392261389	-0.5907047678520404	42.849192414360971	-2
+0.74205128904601525	-0.36132499390500772	43.1020276076054	-2
+0.75080562602540746	-0.39920434925643616	43.059325748599939	-2
+0.20499999999999999	0.074606000000000006	49.999999992680465	0
+0.23403842883313988	0.090181750000000005	48.653780213003863	-2
+0.2652960075744199	0.088684622489189652	47.445636279189991	-2
+0.38522199908382027	0.01032546612063915	45.222544491765021	-2
+0.37945195159286776	0.04286981819342308	45.134405658647367	-2
+0.4449257441123412	0.0022820554626117318	44.492418757299731	-2
+0.42152224185932408	0.033545110285019109	44.615624204594432	-2
+0.29353797318486669	0.10216308671955684	46.416745868310556	-2
+0.33437193424461559	0.11135632410958121	45.300273113001069	-2
+0.37908331012038521	0.075919665444960094	44.89449767219778	-2
+0.57377077482575045	-0.056678273073048721	43.651269197271972	-2
+0.61783740769591555	-0.069382932167056655	43.466499897807495	-2
+0.54384872747428092	-0.022814578137875945	43.757686652723443	-2
+0.46772643337746256	0.028974196779194574	44.152254710914534	-2
+0.5155208447008508	0.037875323374242181	43.742295500471691	-2
+0.52897770615087303	0.0072003329071435368	43.766343721843057	-2
+0.74904261841311026	-0.32308097095410282	43.129092616251718	-2
+0.75259732434572224	-0.27028856872009588	43.157427902693762	-2
+0.76591511985111671	-0.29770118150914576	43.129821340042298	-2
+0.72564758342806635	-0.23261097261888219	43.209884810201373	-2
+0.70226380737213956	-0.20959494113174543	43.260058964154936	-2
+0.69435303813806259	-0.17775222739412899	43.281736612328267	-2
+0.67636649316883879	-0.11624988626471996	43.310874593801671	-2
+0.70539490006036965	-0.14528934505415603	43.250310435726675	-2
+0.63710813121130339	-0.098926211519197227	43.421830759797267	-2
+0.17499999999999999	0.136909	49.999999992680458	0
+0.15574497429681206	0.15523313605478983	44.738871534141516	-2
+0.050000000000000003	0.29940900000000004	0	1
+0.079429112956037135	0.27260370949512497	14.542525941704602	-2
+0.10682639276052841	0.23903237338993866	25.063137336149328	-2
+0.13424407845590663	0.18664236810842211	37.042852805935773	-2
+0.14090479668744016	0.21594244073034957	36.669082399286424	-2
+0.14964555557153855	0.17080114963959056	42.539261072279153	-2
+0.7377535463079864	-0.42345493090118291	43.036872671544835	-2
+0.75496494951568627	-0.44495411913423999	43.011224915576399	-2
+0.77969886824714973	-0.48789857438728901	42.968488548325553	-2
+0.79259824370398479	-0.60818202301879298	42.855176954097765	-2
+0.78971009267863479	-0.5784753495466658	42.882412405839531	-2
+0.80443401068541154	-0.5134498460503506	42.951762691543586	-2
+0.81376298926757773	-0.54428371473561477	42.928721044742417	-2
+0.77771109355485968	-0.3768124830552716	43.069456966221111	-2
+0.78895066905626721	-0.34366173951161305	43.087123730889729	-2
+0.77914248046625079	-0.40589277746625207	43.045649572333126	-2
+0.20499999999999999	0.1057575	49.999999992680479	0
+0.23654691515715906	0.12303813192987839	48.280799265171439	-2
+0.26887144210806896	0.12305417440302646	46.939031471298868	-2
+0.40431268640596679	0.055467379493775615	44.700442598870545	-2
+0.45436806967310384	0.061437960550068713	44.1074824696219	-2
+0.41876798522917191	0.079295913273578725	44.35259021397183	-2
+0.30685977367391865	0.14290008752282377	45.424888050026112	-2
+0.35947844307423382	0.12949683500551029	44.627481085194091	-2
+0.33922289460120636	0.15293030844061706	44.581563818253336	-2
+0.39774609522429655	0.11312419476278722	44.288488196171649	-2
+0.57380360456800705	-0.026497818422666655	43.598354441408986	-2
+0.61466672355307328	-0.041632513751259745	43.439122862770176	-2
+0.59944265489242921	-0.02000513297383523	43.463392219256043	-2
+0.64561462570001626	-0.072309554817507546	43.367254706208456	-2
+0.64550886213432968	-0.041467154293490731	43.324705783328518	-2
+0.56194263405975098	0.0012542679727383654	43.590569857925296	-2
+0.48956867700132967	0.061658009715509283	43.813567155603437	-2
+0.55104122484087603	0.035168615249476613	43.541885134977861	-2
+0.5303556119285322	0.084172898793596351	43.43753322188045	-2
+0.77424240783936638	-0.25171497561865053	43.138895114141995	-2
+0.79906621671627265	-0.26915630633631504	43.110267543453702	-2
+0.76354240913642057	-0.22527640478167371	43.156548301218955	-2
+0.79634572283105409	-0.29937253405223962	43.104230937177967	-2
+0.73980592062040951	-0.19483970302615439	43.192518172332939	-2
+0.72242324695995408	-0.17208148174342497	43.222314844194948	-2
+0.70855213445316345	-0.11310490325361656	43.226462361659166	-2
+0.67851353689129701	-0.082551794154480843	43.277125478188339	-2
+0.74531916307003965	-0.15488058045833258	43.17486084121159	-2
+0.75614117788447233	-0.12490954471858917	43.139545409569223	-2
+0.17499999999999999	0.1680605	49.999999992680451	0
+0.16545942363660426	0.17623139204517904	47.143988963178522	-2
+0.050000000000000003	0.32435975000000006	0	1
+0.07801207417205018	0.30060549330871283	13.02328346294596	-2
+0.11654428788176451	0.26791634641397244	26.136044098726085	-2
+0.10678772429472118	0.30072564755157227	22.175813633594775	-2
+0.13658246648237146	0.24561245392901243	32.502179086488688	-2
+0.15324636777354578	0.19772974051182907	41.909502814429793	-2
+0.1562393097857169	0.1861663167758687	43.817440601718779	-2
+0.16094420600720516	0.20686285372223015	42.909805049513487	-2
+0.16562180388402986	0.23814860070945337	38.891813426910289	-2
+0.17051973534246057	0.21912500845277111	42.786372528867027	-2
+0.78382136858276497	-0.45574127911674639	43.000507029097363	-2
+0.79776735539989629	-0.42827192904144523	43.024187735445146	-2
+0.8117875195025509	-0.48327200884217303	42.980396867234909	-2
+0.81915204428899169	-0.57357643635104638	42.90585083837253	-2
+0.83453805899570821	-0.50579986397074184	42.969504125869605	-2
+0.84258872403671514	-0.53678821817552336	42.949213746441664	-2
+0.81215517096444323	-0.40185771696298273	43.041954675854278	-2
+0.81235170463173445	-0.37177979796975724	43.061142166420794	-2
+0.82942346686171875	-0.32421506425969349	43.076276868508458	-2
+0.20499999999999999	0.136909	49.999999992680472	0
+0.22425502570318792	0.15523313605478983	48.576035628448196	-2
+0.25490252845973915	0.15220455607199523	46.945359272267886	-2
+0.45368746010470878	0.10449477102222454	43.818765025378632	-2
+0.4803962690324507	0.095643272844748162	43.674834679530235	-2
+0.42920357239002754	0.13141308446173011	43.790669970982158	-2
+0.2820480006702667	0.17784789894400896	45.316832376111435	-2
+0.31480449642767244	0.17641900270940816	44.549909441137842	-2
+0.38138355930406898	0.15139616842309242	44.032319363848572	-2
+0.34613015505372374	0.18610057646568842	43.860116153960114	-2
+0.41048182592474364	0.15382026085041658	43.705151004515045	-2
+0.62762290259408426	-0.016340329835545338	43.34154237972642	-2
+0.60862866117571368	0.0047967450687480652	43.363096044943696	-2
+0.67609192370042204	-0.037519261915729907	43.223646451049866	-2
+0.66474212791391785	-0.0088471213506023955	43.202504914219155	-2
+0.58602979437438329	0.031728601846699511	43.383410573163651	-2
+0.57150609800920515	0.063662630028366876	43.32855017464005	-2
+0.53287213468506611	0.11261608850026293	43.269814883003384	-2
+0.55822252788227111	0.088547308673047262	43.280104818022622	-2
+0.49815389163634061	0.11746931998531651	43.421597683613598	-2
+0.79968479318779773	-0.23882416385496377	43.113835428696056	-2
+0.83448993565726237	-0.25470633883472099	43.085452339468318	-2
+0.85127100587189153	-0.28908710535990251	43.072992343848881	-2
+0.79065826461359978	-0.20792114987543425	43.122062787961511	-2
+0.7687304405224934	-0.17847058062413518	43.145644162438614	-2
+0.71225892337747854	-0.083743473437904808	43.192635181352365	-2
+0.73763724488491578	-0.098967620127212025	43.154967625955862	-2
+0.70023681166410734	-0.056700864930151439	43.188230078029278	-2
+0.78453339786980303	-0.13937539527295914	43.105748415268501	-2
+0.76772435892309088	-0.097077226522786775	43.099180472544511	-2
+0.80002616111790392	-0.11360428577279494	43.066580243598423	-2
+0.17499999999999999	0.18363625	49.999999992680472	0
+0.16972460123513139	0.1875301875	48.176517655546753	-2
+0.050000000000000003	0.34931050000000002	0	1
+0.085588489940662468	0.32760004497676909	15.608495724778267	-2
+0.14482461589873266	0.2742928114667324	31.747326083248286	-2
+0.14093987265422545	0.30302163025972562	29.541769174181386	-2
+0.11630818621996557	0.34424054050319369	23.668040182722251	-2
+0.16511748267955553	0.19640796092585278	45.896836095615981	-2
+0.16886401664557524	0.2009426650364094	46.493771305729581	-2
+0.17079028284501258	0.20595356524910829	45.890881151905944	-2
+0.17973834892243526	0.22448807542311616	43.009604589095979	-2
+0.17375994486350091	0.27250871589277115	36.28693289078884	-2
+0.19000000000000183	0.24115417135492112	41.267520127895082	-2
+0.17763293973957972	0.20803616562661215	46.741742664056176	-2
+0.18305030136013092	0.21435021101705204	45.643555683461571	-2
+0.8145301107776951	-0.45328589835841876	43.005001027051463	-2
+0.83555244035954312	-0.43172783054614539	43.02112286363954	-2
+0.8452062056624472	-0.47121007378293123	42.997564606480708	-2
+0.8660254037844386	-0.50000000000000033	42.985157302120996	-2
+0.84124648180957673	-0.39421471560505827	43.042866406691502	-2
+0.84599496819413311	-0.35741440572551714	43.058298672422197	-2
+0.87045104994814781	-0.32950901206379801	43.06005901757181	-2
+0.20499999999999999	0.1680605	49.999999992680472	0
+0.23035444442846145	0.17080114963959056	47.821317424745189	-2
+0.21454057636339571	0.17623139204517904	49.0182149803248	-2
+0.24575592154409379	0.1866423681084205	46.277004929920089	-2
+0.4725149198871586	0.12265426745758122	43.53737771809535	-2
+0.46222309957579394	0.14670253116463666	43.404226549198739	-2
+0.29436650828131461	0.21310002037550207	43.777775668227719	-2
+0.32449492810026803	0.20774192231714833	43.581524476456437	-2
+0.37817022849656684	0.19346218486037986	43.414854339183933	-2
+0.40933487339433122	0.18299678984748988	43.348135736958284	-2
+0.3570672104473121	0.21866976732265497	43.080927933308303	-2
+0.4574203088771388	0.179677852248881	43.115143886388175	-2
+0.65559598468134972	0.027899757778280743	43.144837616462731	-2
+0.61988641011656154	0.041202949354515045	43.221481390154302	-2
+0.72244033029980004	-0.034464287301837336	43.10578518941815	-2
+0.72124482134880585	-0.0030631347310528592	43.053188314486903	-2
+0.69063252542922415	0.017108547198815594	43.080577189513512	-2
+0.598970821661297	0.085489422434252851	43.137871757757814	-2
+0.52258779677315692	0.13925403739253397	43.154007951774787	-2
+0.5611466544122351	0.11660350140483017	43.131198756691468	-2
+0.49027254249104851	0.14448031459814961	43.268005993696775	-2
+0.83277366107585882	-0.21238936828516963	43.081550445550008	-2
+0.86918913290833522	-0.25905560331760086	43.064597019414151	-2
+0.87000983877597537	-0.22087385519479827	43.057595471474976	-2
+0.87981957308616565	-0.28575932170423102	43.061587552314691	-2
+0.80195832571643033	-0.17777512011707133	43.102195269815759	-2
+0.74903707685902088	-0.051199719680182582	43.078727379158316	-2
+0.82457424356999365	-0.1443591456205201	43.060387229079517	-2
+0.77799556864020813	-0.059144617196127028	43.041427718889153	-2
+0.7948766028907337	-0.083978995090741859	43.045798324417213	-2
+0.8287773927955836	-0.1047984652575026	43.026275601753717	-2
+0.17499999999999999	0.191424125	49.999999992680458	0
+0.17089697975248519	0.19398139746359061	48.288321692933081	-2
+0.050000000000000003	0.37426125000000005	0	1
+0.066633086623350046	0.36472924047910105	8.7223012054027063	-2
+0.091522749128357797	0.36886345542071591	18.086824997749236	-2
+0.18361877504033516	0.30056463994673221	35.424761190023325	-2
+0.14707193697527587	0.34226701235651896	29.297681663297027	-2
+0.17489514415068758	0.32899402036696779	33.250703572062157	-2
+0.13790814830421055	0.37170046528125461	27.92486399461464	-2
+0.17068138437214156	0.19831664007229852	47.771631394601073	-2
+0.17360309338272695	0.19960600000000001	48.99521499185429	-2
+0.17360309338272695	0.20227933007281879	48.005172554616152	-2
+0.17510845036061537	0.20429063513664025	47.610629758634971	-2
+0.19000000000000061	0.22158224665534573	44.47518516542393	-2
+0.20751714567643384	0.28286720262047094	38.456912899294629	-2
+0.20026165107756455	0.22448807542311378	44.382092323097105	-2
+0.21437819611596493	0.23814860070945088	42.836159448872671	-2
+0.18173066503640939	0.20613598335442476	47.830451342753875	-2
+0.17749999999999999	0.20352126005711754	48.40664942583733	-2
+0.19	0.21155225908513625	46.793353392715495	-2
+0.88616659541054421	-0.46130913087035008	43.012449489168418	-2
+0.86971362324549251	-0.41772438775555959	43.031026998342128	-2
+0.8690995603366013	-0.38947810711203612	43.042790618650322	-2
+0.88211834328395766	-0.36440340404263999	43.049826078070481	-2
+0.90450198451185171	-0.30048594386479605	43.054331607381627	-2
+0.90509026559453298	-0.33566257749374273	43.052772399026701	-2
+0.20499999999999999	0.18363625	49.999999992680458	0
+0.22376069021428277	0.18616631677586859	47.782999661131456	-2
+0.21027539876486859	0.1875301875	49.250888189440502	-2
+0.22675363222645478	0.19772974051182912	46.842064855022862	-2
+0.23909520331256051	0.21594244073035029	44.853736674010925	-2
+0.48897356964107386	0.18427352265712688	42.941990218827669	-2
+0.27490862552255613	0.23852232886657079	42.934437974941353	-2
+0.31914535000307787	0.23787185610021699	42.779492071362149	-2
+0.40408941757160316	0.21901139069947201	42.861873336276837	-2
+0.43609462594638471	0.20528359079790628	42.930632036656199	-2
+0.38279516975599492	0.24852615465386008	42.429978418404851	-2
+0.34946772793565811	0.25217527790397576	42.366233788506726	-2
+0.47055609757507477	0.21030283640213854	42.760297217720399	-2
+0.67969699696737362	0.043876778250707814	43.040076280971945	-2
+0.64529863082566408	0.069599562891062283	43.051523955541953	-2
+0.75468002038040738	-0.003704138133748897	42.994557293572626	-2
+0.72239572236908201	0.031997720964551682	42.979308877613704	-2
+0.63039863816830732	0.10163840825479259	42.980194195225401	-2
+0.59900494128682724	0.1240786191992959	42.970526268756942	-2
+0.54690727288489793	0.15899539092015955	42.940716620708564	-2
+0.5182778517255574	0.17170421468687141	42.943049539092648	-2
+0.57795803667847268	0.16311946964005153	42.829911671099353	-2
+0.83129566606313976	-0.17326941082976707	43.070027472400071	-2
+0.86094151029085031	-0.1747202295044086	43.046270544324365	-2
+0.90061611145399223	-0.2437162613857668	43.04865476887467	-2
+0.9124792726865113	-0.27142206529020685	43.049667038209421	-2
+0.90173685224469058	-0.21028889757062949	43.037717401517796	-2
+0.89100821674294783	-0.18141470186939884	43.030482951324515	-2
+0.77925340941205279	-0.026386112720289838	42.99376034691835	-2
+0.86131798074769017	-0.12768566757514369	43.016150209969148	-2
+0.80775044759985448	-0.055099518819480886	42.997161592229283	-2
+0.83537295524076893	-0.070486432055231169	42.985146267705936	-2
+0.8673905172252514	-0.084475456003024502	42.972645891089329	-2
+0.17499999999999999	0.1953180625	49.999999992680479	0
+0.17369683648593182	0.19726503125	49.318018722128691	-2
+0.050000000000000003	0.386736625	0	1
+0.057432214789812162	0.38154776400612872	4.7709174934937693	-2
+0.07167987033284344	0.3844470106602364	12.1976969182479	-2
+0.096876674396829857	0.39351954020756474	20.835050534165365	-2
+0.22246550455908221	0.32803798693969838	37.150351257539924	-2
+0.17617271436058704	0.36747047601264926	32.621037239092807	-2
+0.19906086693652697	0.34745106098826234	34.885599129507668	-2
+0.15972452066381887	0.39386579548976214	30.973932001871052	-2
+0.12819424494620124	0.41299643359816701	27.687798086921617	-2
+0.17499999999999999	0.199212	49.999999992680493	0
+0.17499999999999999	0.20000000000000001	49.999999992680479	0
+0.17536519199426412	0.20179152901160621	48.917869552012931	-2
+0.19694969863986972	0.21435021101705148	46.315138469343005	-2
+0.23816337693110529	0.28509484207261343	39.818426786380201	-2
+0.24378531194437739	0.24602181700797135	42.582989961623817	-2
+0.20948026465753844	0.21912500845277133	45.298016000657249	-2
+0.18306733007281878	0.20139690661727305	49.523023173500555	-2
+0.18670699510922817	0.2048229972394609	48.511908755100094	-2
+0.180394	0.20139690661727305	49.485200838425683	-2
+0.17835661378563616	0.20048418019518227	49.999999992680451	0
+0.17664338621436379	0.20048418019518227	49.999999992680465	0
+0.19329300489077184	0.2048229972394609	48.634851875640578	-2
+0.19826933496359062	0.20613598335442476	48.28566375773876	-2
+0.90630778703664994	-0.42261826174069977	43.033458089194141	-2
+0.89729570778879209	-0.39527869395816972	43.041101199421355	-2
+0.92300020391127924	-0.38231920253318441	43.045770453719221	-2
+0.92867651670556761	-0.31567868001429583	43.05124056199039	-2
+0.93969262078590843	-0.3420201433256691	43.0510553226014	-2
+0.20499999999999999	0.191424125	49.999999992680443	0
+0.21488251732044467	0.19640796092585272	48.16833478411349	-2
+0.20910302024751479	0.19398139746359061	49.21070498658441	-2
+0.21905579399279507	0.20686285372223037	46.581615404766666	-2
+0.49292972210612285	0.23214214490331742	42.510795289196579	-2
+0.52065380693970753	0.21768843982101485	42.590155553900374	-2
+0.26413066925820128	0.26866762085773099	41.397973870306046	-2
+0.2941136573763462	0.26238816101113871	41.952378730394052	-2
+0.32295893401738301	0.27270131804280651	41.786984148401729	-2
+0.41693011564107763	0.25071471548027435	42.380843799194196	-2
+0.44909116679770239	0.23686463211472361	42.51972146898585	-2
+0.38212253831767373	0.27825484157671204	41.90958142676903	-2
+0.35295948279003775	0.28406547420154615	41.686846432422769	-2
+0.71351146332250326	0.058857351542731119	42.93169693781369	-2
+0.68820846261811408	0.071511519589531614	42.944481010966015	-2
+0.66506363474232155	0.10848204807245472	42.875677575908263	-2
+0.75594457908965218	0.030896452536763649	42.925712680865239	-2
+0.78397349689504137	0.012427063102726559	42.923600282071213	-2
+0.74169750076129937	0.06128986199528224	42.879087502967394	-2
+0.63985103611041627	0.14407457402851936	42.787605765767083	-2
+0.60606794869926794	0.15307989680571527	42.816577415614326	-2
+0.55740527351153146	0.19890928494205462	42.658395884899008	-2
+0.59816009864961139	0.19362573103999572	42.623270047924045	-2
+0.88191930551671349	-0.15136935075186664	43.017910672776061	-2
+0.93358548806240682	-0.24990756234623118	43.04061387566972	-2
+0.93827488861707875	-0.21669127832817214	43.027869857715231	-2
+0.95280922353748843	-0.30041959421409514	43.048175016586107	-2
+0.92174154219779925	-0.18348484766339565	43.017425938919573	-2
+0.92797328315302496	-0.15661277544883451	42.998743099239398	-2
+0.81646240781756108	-0.014376438246169855	42.929850322313435	-2
+0.88931913611804148	-0.10958899607461488	42.981720234127749	-2
+0.83515043092149488	-0.039319755156145733	42.947226407537599	-2
+0.86455809656497273	-0.051275898686051549	42.937644756412489	-2
+0.90787470009679394	-0.083553694516444107	42.946425666085005	-2
+0.89782242026511605	-0.053204105524497142	42.918763000550989	-2
+0.050000000000000003	0.39297431250000003	0	1
+0.053806730410549147	0.38985546874999999	2.9425747855161957	-2
+0.059831134613353661	0.39287368150250329	7.3398693624478692	-2
+0.070652711065539775	0.39895032971050265	13.719438355151549	-2
+0.073115759150899656	0.4174318431088182	18.12871096154781	-2
+0.10801641249253643	0.44515419104366744	27.36415706014683	-2
+0.25465634524636882	0.31102042526364804	39.279441460265147	-2
+0.24869934723908987	0.33870729662151794	38.155808116304399	-2
+0.22092773881784938	0.3694057842124005	36.046429905034081	-2
+0.19723228615771676	0.39891619880083212	34.197907698205839	-2
+0.16314176192573943	0.42477822710461716	31.877777103164359	-2
+0.14383300805542268	0.45729645426923915	31.374446281055995	-2
+0.20236706026042009	0.20803616562661173	47.672404049727241	-2
+0.20920971715498746	0.20595356524910841	47.622308157405733	-2
+0.180788	0.20000000000000001	49.999999992680472	0
+0.185394	0.20000000000000001	49.999999992680472	0
+0.19	0.20000000000000001	49.999999992680465	0
+0.17999999999999999	0.20000000000000001	49.999999992680451	0
+0.194606	0.20000000000000001	49.999999992680458	0
+0.19693266992718123	0.20139690661727305	49.608990805066853	-2
+0.19960600000000001	0.20139690661727305	49.614299904080013	-2
+0.20250000000000001	0.20352126005711743	48.90660817531792	-2
+0.20499999999999999	0.1953180625	49.999999992680465	0
+0.20931861562785853	0.19831664007229849	48.885158251370925	-2
+0.21113598335442488	0.20094266503640942	48.200330320614633	-2
+0.20630316351406816	0.19726503125	49.652683211619589	-2
+0.47450748539355136	0.25740388801364067	42.282022387433216	-2
+0.50691036847771409	0.26163513507342989	42.247354350491179	-2
+0.54711745387624156	0.23942459393607177	42.400508667138674	-2
+0.28438777900825446	0.28999925793128872	40.855637110542716	-2
+0.31205451741133	0.29956570812457456	40.955142810156701	-2
+0.40905450773541285	0.29086104173737631	41.797976818866879	-2
+0.44466922348644899	0.27072786678163863	42.128972445924163	-2
+0.37260033769776996	0.30943107670481951	41.331398576892184	-2
+0.33214728137884059	0.32046744470624811	40.723156098584724	-2
+0.72329231205744127	0.11003967556717886	42.774021230922777	-2
+0.74428182767272622	0.090114847544498791	42.801796208172192	-2
+0.69389224475419164	0.11994223536124921	42.786387639666252	-2
+0.67227319253929441	0.14219175736151451	42.74036112092255	-2
+0.77361747632919675	0.057716623603025714	42.845391058384564	-2
+0.7958152925948716	0.038963633399787867	42.859033526757088	-2
+0.81327919044708941	0.014857027671216641	42.885749473091181	-2
+0.62632174111364647	0.17500577351220198	42.673498707282889	-2
+0.6664844497885466	0.17414847314186122	42.624101432653823	-2
+0.58323307542077207	0.22703140825230719	42.451358109406293	-2
+0.6113789223428262	0.22774343894447194	42.427331103712312	-2
+0.63176535405354239	0.20832465708848025	42.509536353455545	-2
+0.90949481197479387	-0.13613134572938107	42.992128561320939	-2
+0.96592582628906842	-0.25881904510252113	43.038486866530157	-2
+0.97536678965063839	-0.21623361138472594	43.021353937701591	-2
+0.95471290971999323	-0.18778769643801574	43.010005440819185	-2
+0.96082093759214637	-0.15034946106706973	42.98489081744674	-2
+0.94899401827961161	-0.11907132990851826	42.963810402137938	-2
+0.8424210708876122	0.018791389977988598	42.853376301747041	-2
+0.85837503137673377	-0.018534443041597778	42.89897460464492	-2
+0.9214049540035294	-0.10945056378133741	42.965087790071181	-2
+0.89891572268509989	-0.016485293429131662	42.871515358816389	-2
+0.9308275304315583	-0.061298055648552896	42.913751215899964	-2
+0.930571146582996	-0.015253587647622135	42.857328902409471	-2
+0.050000000000000003	0.39609315625000002	0	1
+0.053361352406047328	0.39475649121359063	3.0879731464699702	-2
+0.0582507802031784	0.39942391311339936	7.8542479683106707	-2
+0.057399806167606648	0.40739980616760652	10.287972904929779	-2
+0.05447435202342471	0.41779362159164768	13.200504867364387	-2
+0.063773600427641783	0.43975439852132409	20.668416403844212	-2
+0.089924155744219428	0.46853436811209803	27.628171906475483	-2
+0.114472246864859	0.48500718378917546	30.726146734956306	-2
+0.29025391333326994	0.3186794575687687	40.054947508356015	-2
+0.28514689290297235	0.34785574303183636	39.167576738290542	-2
+0.26193516828729224	0.36374450317548318	38.092046818665807	-2
+0.2258546242202488	0.39763020309656683	35.998889616075964	-2
+0.21324800706730795	0.43621132153862763	35.352291718372598	-2
+0.18159128952780257	0.45943543865603775	33.902197612469962	-2
+0.15479269080080477	0.48705672740291739	33.185373027229822	-2
+0.20489154963938461	0.20429063513664034	48.475275680849307	-2
+0.20639690661727306	0.20227933007281884	48.825672721757805	-2
+0.199212	0.20000000000000001	49.999999992680465	0
+0.20000000000000001	0.20000000000000001	49.999999992680493	0
+0.20164338621436384	0.20048418019518224	49.999999992680458	0
+0.20335661378563619	0.20048418019518224	49.999999992680451	0
+0.20463480800573586	0.20179152901160627	49.325283668812176	-2
+0.20499999999999999	0.199212	49.999999992680451	0
+0.20639690661727306	0.19960600000000001	49.451246515395965	-2
+0.47045871081170332	0.28840939715927871	41.972624233509471	-2
+0.5389680458515963	0.27268676695202004	42.163299089152353	-2
+0.51744170220975039	0.29888695350099237	41.94737726342462	-2
+0.57157851227814849	0.26339210583767569	42.233090244566739	-2
+0.31051243689644042	0.33569736993129595	40.046598899347877	-2
+0.40333140035901782	0.33927954261365612	41.118836526185277	-2
+0.44091797042640113	0.31872281914005235	41.570301424208331	-2
+0.36137782067594959	0.34795285116212643	40.602680760874186	-2
+0.33468520519241174	0.34705432153594801	40.254677793167524	-2
+0.71103203820965233	0.14160374771290923	42.691267501852444	-2
+0.74862446867939847	0.12445595592081939	42.703280608733152	-2
+0.76957053230254902	0.10418751451431112	42.738156668933023	-2
+0.6957609732951201	0.16462087640944992	42.628066339147537	-2
+0.80270017037483288	0.071349296851915212	42.785670723505859	-2
+0.8239743871762496	0.046138804539517221	42.818791442269927	-2
+0.68699946486459762	0.19413571840713456	42.524316829261153	-2
+0.66667814359871969	0.21431986364228806	42.455430627768322	-2
+0.61072249015426261	0.25589063744535484	42.276371270385283	-2
+0.63857140986740157	0.23588040385828093	42.372523151816516	-2
+0.98480775301220824	-0.17364817766693075	42.996812032108146	-2
+0.99050122555197695	-0.13040196020729466	42.964826721864512	-2
+0.97477139129789525	-0.10633319957138804	42.9465542063637	-2
+0.96314886304626535	-0.071794759117698267	42.915280834090851	-2
+0.85695714289088776	0.045591951162768318	42.796787000979648	-2
+0.8806610540955192	0.015393124765014596	42.83409142299594	-2
+0.91903473051949924	0.014250548769117605	42.819143223945261	-2
+0.95406670670760496	-0.036503096247083339	42.877512807957707	-2
+0.96402302765314385	-0.0018801394574701621	42.832070831853557	-2
+0.050000000000000003	0.39921200000000001	0	1
+0.051193855227557164	0.39765257812499999	1.4153668677758902	-2
+0.053648560730753796	0.39838468423010326	4.099950948731319	-2
+0.053783811058378483	0.40094266503640941	5.2852503670577926	-2
+0.049423724241386892	0.40824999334940903	7.4023587588324302	-2
+0.050942665036409443	0.40378381105837852	5.1340014124278515	-2
+0.044369632439068406	0.42588941491019922	13.960234157229703	-2
+0.044824249221399839	0.41294953272694884	8.6684318828402063	-2
+0.047100497106508148	0.44257794971274933	19.141334108435991	-2
+0.060442426106556021	0.47072298675633689	25.441698100230798	-2
+0.079809269280863016	0.50679381674259139	30.347160511813478	-2
+0.14040645864100823	0.51377649766875866	33.473076965244637	-2
+0.11417849816367921	0.52904096254685284	33.062357884635624	-2
+0.30938425724801327	0.3621311424357847	39.526264119297444	-2
+0.28652939605675387	0.38851528898342297	38.546051474804202	-2
+0.24819525404732076	0.41556866122559788	36.934626049538323	-2
+0.24252693450063412	0.44587592664070463	36.653829514029823	-2
+0.21501874801279933	0.48002942808239779	35.793672025254118	-2
+0.18644865364150096	0.48897727927647217	34.771727145395467	-2
+0.17074510327253403	0.51446674453538865	34.709403935096695	-2
+0.20499999999999999	0.20000000000000001	49.999999992680479	0
+0.48320809315754065	0.31696088438489473	41.726735862009832	-2
+0.56873951791371491	0.29693660373795477	42.02137258472451	-2
+0.51534979344726861	0.33754223624559365	41.647830832290261	-2
+0.5484732282881789	0.32381727957017675	41.817503555523679	-2
+0.60788752144021085	0.29564596393624215	42.058475405073104	-2
+0.43127254783601204	0.34572742487840857	41.227039572629295	-2
+0.39707257259576439	0.36922350210948912	40.709795499535986	-2
+0.46350050471396737	0.35234421123745985	41.336946858180944	-2
+0.37193824544167575	0.38666136991978639	40.240532886910351	-2
+0.34718606052042184	0.37261943732667901	40.065594369087158	-2
+0.73694797195598316	0.15116188639744205	42.635165590202917	-2
+0.766004708808116	0.14796062154711853	42.622678201429572	-2
+0.79110375803482769	0.12307829104304532	42.672902756379678	-2
+0.715097168808011	0.18857920421448807	42.527392499496287	-2
+0.81800435765902224	0.11323456267648499	42.680023627707797	-2
+0.8279393108954799	0.085865912072620912	42.735408855809432	-2
+0.8553466514473882	0.076038195371437939	42.739970123991633	-2
+0.69382858393383418	0.23461277617241694	42.36302615686084	-2
+0.66342267961473766	0.24959375384024693	42.303076537566284	-2
+0.64214965447741656	0.28045175403792827	42.1558763182151	-2
+0.99619469809174577	-0.087155742747658554	42.926229327459161	-2
+0.99809734904587299	-0.043577871373829458	42.880138874379291	-2
+0.883355075581992	0.060847003399305065	42.756531340287729	-2
+0.90776620957090992	0.042580531203540925	42.778627835408891	-2
+0.93866353764120469	0.03846416628146062	42.777983763271067	-2
+1.0000000000000002	-3.6082248300317588e-16	42.827202803399366	-2
+0.99809734904587299	0.043577871373828729	42.76702221908463	-2
+0.96751390341458765	0.051092340849863263	42.755748143698568	-2
+0.050000000000000003	0.40000000000000002	0	1
+0.051396906617273051	0.39960600000000002	2.1997188631383144	-2
+0.0510502394046961	0.40105023940469609	2.8916063819355395	-2
+0.046290175227866562	0.40653923618434673	5.3744959937676935	-2
+0.048385067551891633	0.40364834607078531	3.8444314305636103	-2
+0.049606000000000004	0.40139690661727306	2.1185230091771823	-2
+0.032619771735844433	0.43384448485467536	15.217515926759354	-2
+0.033018476691252713	0.4196605714763017	9.9730958407288544	-2
+0.042699497260594077	0.40617260081453843	4.4118407709437362	-2
+0.036918057465231552	0.40945452649054848	5.5813680017302447	-2
+0.034218547976498967	0.46591937006586637	23.063502287871096	-2
+0.021406453950054978	0.4425395333652688	17.00821975356131	-2
+0.038814999805789605	0.51480888004871361	29.556000617417808	-2
+0.063320810018948459	0.53130433338895255	31.484922999231248	-2
+0.16693745854304382	0.54253157419674358	35.258106766372009	-2
+0.13840955803694036	0.54418829085186893	34.431483787606695	-2
+0.10154191743895823	0.55330865957663322	33.747528867091212	-2
+0.32112035535952527	0.39319860016601582	39.339236114487491	-2
+0.29094262092502154	0.42487176698063589	38.316378433351566	-2
+0.28087696150453678	0.45298563700085254	37.906011338167716	-2
+0.25820797583703597	0.47242333943425435	37.251047476845578	-2
+0.23865540069623928	0.49594966694376447	36.75658545103672	-2
+0.2263713400592314	0.52166439443107904	36.658747991332177	-2
+0.19461549346158791	0.54853650594945613	36.141854050369808	-2
+0.58419988138618995	0.32684095776344863	41.858516553332599	-2
+0.49735792602678003	0.37120191016932852	41.331884961477321	-2
+0.5360791763741839	0.36958866546006186	41.484449333157741	-2
+0.56616806243576023	0.35500107689974647	41.657094340577778	-2
+0.6401362475591692	0.31787773388181156	41.975403437429534	-2
+0.4272688975998668	0.37412203163423219	40.913170259824007	-2
+0.40624732858635426	0.40818680792194184	40.425803563279423	-2
+0.46518645605425901	0.39281057294066823	41.00768809402453	-2
+0.3599894908068963	0.41185031467912814	39.828950882553038	-2
+0.75450030942620294	0.17700874016077212	42.542376792504591	-2
+0.79502785572265156	0.15145332770614511	42.59713777434105	-2
+0.74203890983473353	0.20745032681281331	42.449488769681935	-2
+0.72758128804643818	0.23772784831172245	42.346042695900756	-2
+0.84294430654803276	0.12726512663875125	42.636657141088321	-2
+0.83458289015469278	0.15463197687006008	42.574241420082828	-2
+0.86562243668119765	0.10564083051080507	42.675470876022906	-2
+0.89111788682235527	0.091749800969825102	42.696120403283139	-2
+0.70783806357024159	0.26723370088605131	42.233537686560467	-2
+0.67717536878891105	0.28468395379404965	42.152548941312979	-2
+0.91296184979386286	0.072623380465506121	42.726422433600746	-2
+0.94193359784144204	0.069462489596472096	42.727121380166317	-2
+0.99619469809174577	0.087155742747657819	42.69966860030722	-2
+0.97384230690500595	0.10621088329059399	42.665459051857709	-2
+0.049212000000000006	0.40000000000000002	0	1
+0.044848834963590635	0.40327299097914193	2.6717080284307109	-2
+0.047698750000000005	0.40118083236795793	1.2975334298823578	-2
+0.015806910201272416	0.42303917493135923	10.143963546176133	-2
+0.031010322104636869	0.4089210463648148	4.7822325331560585	-2
+0.022359346899036566	0.41418503623600184	6.7790029161518373	-2
+0.040132500000000002	0.40363529617710264	2.4547819368156198	-2
+0.035168372120000541	0.40469061397496292	2.7329834993081872	-2
+0	0.47559100000000004	23.738271148687787	-2
+0	0.43818950000000001	14.938926553358657	-2
+0.006442574778184126	0.42883912499999999	11.952218657164904	-2
+0	0.51299250000000007	28.530291997509821	-2
+0	0.55039400000000005	31.783738104312103	-2
+0.042258211164067	0.55609198288327488	32.652648729995349	-2
+0.074691637086777951	0.55856857749908451	33.30041075865897	-2
+0.15435216367815766	0.5679036686209481	35.512176366863052	-2
+0.11842498431204809	0.57483925047656859	34.912256910653561	-2
+0.089439190442253347	0.5858391371329088	34.686441078849612	-2
+0.33466968019093007	0.42351919919235115	39.309464732647086	-2
+0.31390964179971032	0.4598701659709088	38.662915168370759	-2
+0.2895334997828713	0.48156485203763338	38.079962093940281	-2
+0.26589283303430222	0.50433224620733141	37.560901565393515	-2
+0.26665424738794968	0.5371446769276752	37.721420455623253	-2
+0.23388321884939373	0.56226931023179538	37.227544628705196	-2
+0.18437642729763151	0.58895082759658657	36.56530990479056	-2
+0.59756373709859567	0.35525149200264178	41.72426009131005	-2
+0.49041212021136288	0.40430116421504014	41.065596407624682	-2
+0.51803471547917423	0.40198598589094703	41.212888827532375	-2
+0.5655084317921012	0.38843315269299494	41.464015349788035	-2
+0.59711505988468316	0.38879792868866175	41.545759366250167	-2
+0.65548098432757262	0.3519844840675288	41.833807772387019	-2
+0.6240042735397433	0.37218220752097442	41.686545601829053	-2
+0.67618000608396267	0.32083513651335022	41.994468151882913	-2
+0.4410867506944986	0.42108206260183634	40.63002044112843	-2
+0.4147664071584648	0.44729870697585872	40.22187610393491	-2
+0.37467707420062091	0.43554695092699497	39.841706690522088	-2
+0.48031926895113392	0.43011786759561454	40.842304644571392	-2
+0.77432467776572067	0.20115700759490857	42.461907107597021	-2
+0.81379591532208029	0.18843443590391676	42.490734573833073	-2
+0.76451053355766752	0.23677114835800481	42.349802976106801	-2
+0.74661341256773373	0.25915543859486462	42.27202884402309	-2
+0.86996918851165161	0.13667328961237024	42.608699776383467	-2
+0.84685975068211472	0.18547443923282497	42.496363786177604	-2
+0.87103450387054004	0.16704999202864601	42.539760147044291	-2
+0.90772726193134057	0.11556381655094136	42.64715453621077	-2
+0.73476363287063984	0.28525038274630227	42.174988602849901	-2
+0.7074888887109928	0.30273395899459443	42.094044800325399	-2
+0.94553234800287589	0.098383112226248418	42.677318896197526	-2
+0.99050122555197706	0.13040196020729392	42.626211278483936	-2
+0.94088697659584164	0.13834549608034874	42.602959384581439	-2
+0.96810818170413304	0.14945174872586214	42.586528604224469	-2
+0.046185500000000004	0.40000000000000002	0	1
+0.043159000000000003	0.40000000000000002	0	1
+0.015253350702865567	0.41203809450275791	5.5424968952949492	-2
+0.0060642662255439989	0.41749041736203002	7.6386092539677382	-2
+0.031053000000000001	0.40000000000000002	0	1
+0.025286721181899931	0.40736337803920164	3.7141442947440328	-2
+0.017965610311339694	0.40820175790853996	3.8749412130177228	-2
+0.037106	0.40000000000000002	0	1
+0	0.41948875000000002	8.4097052870559139	-2
+0	0.58779550000000003	33.816997061465258	-2
+0.031827892569791141	0.60336632783455668	34.641382949488886	-2
+0.067043862963222775	0.60727795845828825	35.117778538954759	-2
+0.15499877829106543	0.61089149863656311	36.440842612240026	-2
+0.11200609531831154	0.61086233164637838	35.759620233867459	-2
+0.34299094417875725	0.45311898776329912	39.256020327925334	-2
+0.33062828849193199	0.48029370578615027	38.922773423814085	-2
+0.31520388011859163	0.5017114963383178	38.601823981991629	-2
+0.30815598891924878	0.53013779555226404	38.486032083178657	-2
+0.2910087082037765	0.55498529143862685	38.245730699959125	-2
+0.2628397147352951	0.56610380989659148	37.8085971783443	-2
+0.21907052334700289	0.60081501767237566	37.345310145033999	-2
+0.26229863597907738	0.59530807799988605	37.988570373618941	-2
+0.19048013136613356	0.62776149695267036	37.211982893157369	-2
+0.51957838902999376	0.43903738278852	41.003609136219737	-2
+0.54903490186088955	0.41925227962953659	41.235533110150598	-2
+0.58448845771832647	0.41777517698180311	41.365937267759485	-2
+0.6097020779007537	0.43079766423046933	41.37705157553021	-2
+0.63711721784399689	0.42346814045755171	41.48107999601465	-2
+0.65815063329471002	0.39077090708250606	41.668005535136814	-2
+0.68308998906433482	0.3695692576546597	41.798074279559152	-2
+0.70854615101477592	0.34899098699315528	41.913180060745319	-2
+0.45294063496203724	0.45930338318378316	40.481771965629306	-2
+0.4275741895552434	0.47326898317115196	40.193513765436379	-2
+0.38745718592907724	0.46620475541169071	39.814908848500657	-2
+0.48699363510477439	0.47244924662699378	40.646924555027297	-2
+0.79847337111342986	0.22697093890609582	42.382560028583953	-2
+0.85399292192127529	0.21493530546604103	42.421469183734168	-2
+0.83255165248969198	0.23636184826465623	42.361028020604927	-2
+0.77885421051022163	0.2604633699023946	42.276209766107492	-2
+0.76715939765919039	0.28556902230592784	42.189964683528338	-2
+0.90261090533843213	0.15073557145983957	42.575790177324258	-2
+0.87813433512432526	0.19660454062388991	42.470967123102326	-2
+0.90605623901002741	0.18435431214397582	42.502951299401026	-2
+0.73447285830234244	0.31481314178389153	42.067868708747405	-2
+0.98480775301220835	0.17364817766693003	42.545424723030663	-2
+0.92767731588832003	0.16285478077616583	42.552217285326421	-2
+0.96362892169340497	0.19129216625516759	42.503515962266356	-2
+0.013267473320600132	0.40823835659896007	3.8015816642928173	-2
+0.0075368511612917124	0.41127751531924367	5.0395031888368633	-2
+0	0.41481356250000001	6.4816172915726531	-2
+0.0036358319799358451	0.41158521920269553	5.134885459840894	-2
+0.025000000000000001	0.40000000000000002	0	1
+0.018947000000000002	0.40360711919294034	1.7296024785417665	-2
+0	0.625197	35.247809623611332	-2
+0.02972916650727948	0.63873666531954687	35.731816488834419	-2
+0.092043534163899515	0.6352523223382126	36.106059427887914	-2
+0.061894603489615709	0.6444402205194415	36.065557523518507	-2
+0.12894010283886395	0.64508677716424689	36.684043076913241	-2
+0.16480920359807261	0.65818184846750505	37.27869957486373	-2
+0.35700949826263062	0.47947768076295261	39.343167957353423	-2
+0.34464684257580536	0.50665239878580381	39.081455943214365	-2
+0.3372421534946396	0.53356157820480754	38.937865080952264	-2
+0.32116650433680038	0.55637619767450142	38.716668335162531	-2
+0.28906671939541595	0.5839848508039519	38.318108379253943	-2
+0.24445254950502879	0.62763917795571278	37.941726952110628	-2
+0.21751616393731962	0.64968461574175107	37.785636527538053	-2
+0.3036219132183855	0.60914219757762011	38.58999255665109	-2
+0.28128067429802017	0.64156149191279943	38.456854954124815	-2
+0.19394228867576616	0.67117467180350643	37.722720188558689	-2
+0.52347763297940575	0.47129233544946569	40.856957459585708	-2
+0.5504483044749221	0.45317690132224098	41.068620381219844	-2
+0.59231162319832964	0.4532227372980942	41.223409163036393	-2
+0.62359627811448537	0.47622226971543447	41.225091252723224	-2
+0.65924411782396064	0.45724906886188083	41.397801295712966	-2
+0.66893200216896798	0.42676623994477103	41.540312900096119	-2
+0.68919155810281141	0.40201531359371306	41.677905442219036	-2
+0.71915067600626992	0.38814350963106475	41.779561730907723	-2
+0.75042749790159813	0.33970271283326886	41.992368997957406	-2
+0.45914051559159058	0.49392155324139947	40.358255001391655	-2
+0.40998870126151066	0.49627431162031854	39.919991501996655	-2
+0.37794309816677774	0.50540049493657513	39.529922056237467	-2
+0.50994788101031407	0.50083098616664867	40.652436297420373	-2
+0.48149731606446189	0.51978101128729992	40.402463679315289	-2
+0.8054059876304106	0.26834153986676385	42.260802207504831	-2
+0.86456607484645476	0.24695699989561415	42.342524999295208	-2
+0.89975874764293207	0.21809947882337155	42.424952041030053	-2
+0.84487123561526434	0.27433023106363202	42.26053177790596	-2
+0.79623649161547505	0.29905362710014793	42.162030918117836	-2
+0.77813044746685023	0.32478572799629452	42.066602914895498	-2
+0.93612966451394397	0.18938321787712165	42.499073903267323	-2
+0.9753667896506385	0.21623361138472524	42.457442022807221	-2
+0.95503327094942148	0.23406500126854643	42.410582872967673	-2
+0.011923012288749941	0.40416722141957978	1.918591577509446	-2
+0.0090715508811303903	0.40735747522391247	3.3354284647955184	-2
+0.0026405120738775614	0.40780078125000008	3.4799267689360165	-2
+0.0051788557289546063	0.40575468327506053	2.5905582876855826	-2
+0	0.41013837500000005	4.4942085014975985	-2
+0.012894000000000001	0.40000000000000002	0	1
+0	0.66259849999999998	36.241274274368593	-2
+0.038247067347849086	0.67027380601830255	36.489669086549881	-2
+0.088996699020382652	0.6666225676257399	36.702173109801386	-2
+0.064407844543088982	0.67937249391683519	36.771909479383801	-2
+0.13555146275600582	0.68265000186468039	37.307092777733587	-2
+0.17197197944513526	0.69647323846982367	37.759335994235933	-2
+0.36275563796046861	0.5448750864053955	39.261633523424535	-2
+0.35134424267289971	0.58455610016747861	39.113780832935021	-2
+0.33457418785749027	0.61061319925298008	38.952118958570686	-2
+0.24911936778617555	0.66427254572232175	38.22727306179884	-2
+0.21623128046521276	0.69399464001984401	38.110614303446098	-2
+0.30868494244463607	0.63653900446877365	38.728812456552824	-2
+0.27387915766552057	0.67658829710821533	38.52809767869271	-2
+0.30047272324799862	0.66900494714405723	38.743454495626828	-2
+0.5436123953362052	0.48916536229813673	40.871882050535284	-2
+0.56938017530104257	0.4813631023959144	41.015113712590079	-2
+0.59747077609467913	0.48915482034231389	41.087686260795593	-2
+0.62238186985121347	0.50662380043897903	41.105001430413999	-2
+0.67688260119471333	0.49357584591354631	41.307829516514232	-2
+0.69022890293319561	0.46464996754366883	41.44331602662723	-2
+0.70917918543594471	0.43904299578538464	41.575741432248428	-2
+0.75934748320110312	0.37977975761773064	41.863210018582897	-2
+0.74595237222086663	0.41859092428695471	41.711996056673229	-2
+0.79007578383960653	0.3595702375095241	41.964943188594404	-2
+0.42318442132824824	0.51904025565515055	39.956005031007457	-2
+0.44815776342218439	0.52733166208205062	40.137297906380404	-2
+0.40439671522843967	0.53746408086556818	39.728029421021482	-2
+0.54774576917027884	0.51576928991504878	40.78193189997635	-2
+0.51118295988297713	0.53351736714197884	40.529242141552473	-2
+0.46994543868571631	0.54615418498225476	40.234007092064097	-2
+0.8284067121963814	0.30213969684981817	42.172422173660173	-2
+0.880441814675479	0.27143907519255295	42.286209326554051	-2
+0.89855901774574032	0.24856598884910636	42.351587891832111	-2
+0.92908870697063983	0.22643020933212207	42.416069852911804	-2
+0.87530300112476633	0.30016195320390238	42.208445581145206	-2
+0.85238632320773378	0.31375296828382376	42.155903101586567	-2
+0.80939987460566909	0.32827754380637308	42.081010352321783	-2
+0.96592582628906865	0.25881904510252046	42.363091523573821	-2
+0.93065725571251534	0.26410771341397238	42.330839202326231	-2
+0.0077189064547505733	0.40337095159613084	1.5326684823059622	-2
+0	0.40546318750000004	2.4432660648695594	-2
+0.0022638513017708443	0.404294390625	1.9271919655335248	-2
+0.0043197357731864748	0.40260958894643972	1.1769472408448176	-2
+0.0068410000000000007	0.40000000000000002	0	1
+0	0.69999999999999996	36.945171334785961	-2
+0.026179171477494753	0.69421500612660159	36.886443717617041	-2
+0.10616247056825748	0.7069603508551352	37.405402873519343	-2
+0.070535335736717053	0.70638408840153566	37.218156931660438	-2
+0.13750242551818723	0.71492801624485469	37.68260470063079	-2
+0.1894567872013605	0.72045482984170761	38.08290849929346	-2
+0.16328352563285747	0.73444752814714143	38.016204724449793	-2
+0.39053272604407285	0.57527500262631237	39.518304984054055	-2
+0.38964023072762954	0.61216076667353281	39.476600790578921	-2
+0.3623493686585425	0.62435170290994146	39.232503574896768	-2
+0.33040520867378348	0.65398748084099534	38.974794905957623	-2
+0.25822068180908864	0.69938165273923192	38.493241852864131	-2
+0.2189979296938295	0.7233107232640561	38.309465519947445	-2
+0.29446802578529901	0.69811146883962938	38.776633450760471	-2
+0.32417071483509524	0.6971133405690747	38.997033631967085	-2
+0.58663323009459256	0.51621660738973019	40.942029566126223	-2
+0.61955565119583278	0.53691803001948679	40.986086536819258	-2
+0.65559383666548166	0.52500116856432166	41.138323673880336	-2
+0.69187654080510397	0.52665692707624612	41.231674938097314	-2
+0.7119662050408393	0.48513364455428354	41.419487710279839	-2
+0.73995274667010003	0.45108894760361073	41.591606554764404	-2
+0.78888830722603964	0.39123043724501572	41.86283069456163	-2
+0.77303590031153746	0.41372299993479306	41.768913541328239	-2
+0.77646239451583443	0.44102635721561922	41.686510254299613	-2
+0.82994733357208017	0.37691806574314624	41.954576990869413	-2
+0.82733076660850913	0.34936315131286116	42.033553271751295	-2
+0.43043980956054761	0.5698619918457517	39.876977451536156	-2
+0.52931576540100211	0.56074100182090458	40.530045485600326	-2
+0.56693399575091952	0.53820513076208543	40.783630983613286	-2
+0.47630515341521612	0.57423521399255306	40.190488369297618	-2
+0.50712613146900554	0.5844417776851496	40.340524473846017	-2
+0.907311782631958	0.29106751626315608	42.252528172422124	-2
+0.89928417314907449	0.32336036938632656	42.165634750989199	-2
+0.85350896481260596	0.34037306395387484	42.08264258768591	-2
+0.95280922353748876	0.30041959421409448	42.261354972605808	-2
+0	0.40312559375000001	1.4019091462231217	-2
+0.0017909066172730507	0.40179090661727307	0.80512714170299526	-2
+0.0038145000000000006	0.40000000000000002	0	1
+0	0.73740149999999993	37.453900538182559	-2
+0.037099955347238853	0.71870075	37.276724520807562	-2
+0.10045306669830779	0.74285545757412363	37.760791266582572	-2
+0.07149666951896852	0.74200291280772979	37.639730663160933	-2
+0.13324784461112804	0.74896053062180867	37.964462583083844	-2
+0.20379454990858523	0.74852865989339612	38.346827833767641	-2
+0.17364413428629305	0.77153815846439433	38.305863859378512	-2
+0.4133960111303433	0.59402039798234696	39.692815997852421	-2
+0.39244995902381119	0.64521595053728653	39.480135945531309	-2
+0.41736989810189262	0.62331763120201245	39.682994486264285	-2
+0.38080558473282827	0.67627956753106933	39.393829967299439	-2
+0.34957307232860541	0.67877205974450128	39.162488001808079	-2
+0.28324880463724939	0.72563191712203423	38.770446822449699	-2
+0.24509207554257348	0.73695559912132425	38.553587967093371	-2
+0.30684369368088499	0.74388604928654289	38.966304167556949	-2
+0.34171374865963117	0.7183421281572332	39.148144217946196	-2
+0.60837904815234223	0.56435057062583971	40.852542712188374	-2
+0.63719360477102926	0.57121949096163049	40.928080137750179	-2
+0.67238433960805388	0.55543026011537266	41.085327120605562	-2
+0.72319045860782305	0.51281229081197122	41.35191159490072	-2
+0.72194664679914344	0.54702761389432886	41.240380487979017	-2
+0.70017704874254061	0.56899234591408909	41.117575400848423	-2
+0.74181563919916704	0.48408359349752023	41.485079060372122	-2
+0.76691672653696996	0.46881344495327998	41.581890600527871	-2
+0.8062976223506636	0.41770106426612219	41.803483973268172	-2
+0.80384089150342419	0.4453023438044208	41.715889505068077	-2
+0.79483161143896042	0.47797866306371228	41.60191968465579	-2
+0.8521701928394142	0.39808624917562957	41.918944401535221	-2
+0.85559658169917496	0.36758694880285536	42.008351651136252	-2
+0.45050613006038276	0.60211023469029901	39.951798149165661	-2
+0.5529328649385743	0.57517352364964769	40.595401661971827	-2
+0.57877075435261127	0.56525039170793012	40.737164816647393	-2
+0.48614745288364758	0.60922083487898659	40.15746882152942	-2
+0.52281130024128575	0.60769667128657279	40.355879899197724	-2
+0.92751334253168982	0.3153119326060162	42.207675761258415	-2
+0.88196240623510302	0.35187737336659186	42.076270836071402	-2
+0.91206257155601589	0.35418204453849672	42.098530645937053	-2
+0.93969262078590876	0.34202014332566849	42.153387778493638	-2
+0	0.40078800000000003	0.35392607545817167	-2
+0.00078800000000000018	0.40000000000000002	0	1
+0	0.77480299999999991	37.832521758064331	-2
+0.037873536296444882	0.76303540847811069	37.769838546642831	-2
+0.11434154853687263	0.77644364078098405	38.077141425714593	-2
+0.076828700712131881	0.77047692224689179	37.919346566200559	-2
+0.14706628800123117	0.79572852887962464	38.318116170768207	-2
+0.20937323865083798	0.7754094677113913	38.501769120855393	-2
+0.23682264724898983	0.77588859675729893	38.649632184432164	-2
+0.1962150999882564	0.7995043423524264	38.534440569339623	-2
+0.41250527927446529	0.67044809051517407	39.604065198323887	-2
+0.45184699075960472	0.6406964344771241	39.889203152301782	-2
+0.36772463848671372	0.70929485958404848	39.310973697958758	-2
+0.42062476199054449	0.70370850945467112	39.633134898665325	-2
+0.27094280530253734	0.75411418921154705	38.772541616248638	-2
+0.33663650017401298	0.74540947021454007	39.146341535074619	-2
+0.31580071629471257	0.77234134538333676	39.061323233059802	-2
+0.2833210347436475	0.78256514488811812	38.906378484201447	-2
+0.36387438966438035	0.73741842610496977	39.296963235863728	-2
+0.58043563370079254	0.59597387740319363	40.646931414084776	-2
+0.6145632101858538	0.60228032815180621	40.755397219942978	-2
+0.64709859122727054	0.6166887758167322	40.8201043735288	-2
+0.67079998566179866	0.59014827308068729	40.972047240418178	-2
+0.75408208116178499	0.51243790377388665	41.419719251597826	-2
+0.7544347115031258	0.54942826264989031	41.306785612798393	-2
+0.74363244060653821	0.57786121860369966	41.197955262686889	-2
+0.71801322883304042	0.59425566976557753	41.087159637305348	-2
+0.77280336494575286	0.49424559267664342	41.512846647349313	-2
+0.84237913573430667	0.43863600130211777	41.790986608992974	-2
+0.82377302909686134	0.46455269573791463	41.688830525877044	-2
+0.79605617536317463	0.50610954890001947	41.519991301466341	-2
+0.82404694578786997	0.50304963619344845	41.578332822240547	-2
+0.87698060338737593	0.41533609501456559	41.900817327155238	-2
+0.87853601737534226	0.38237667373936607	41.991703129621264	-2
+0.48136902556178418	0.63844077929208498	40.066053867179555	-2
+0.5504195750215225	0.60273705845013337	40.499957364733802	-2
+0.51282036365315986	0.6339072756657258	40.23991587045235	-2
+0.54862941502951934	0.63883988560366278	40.393474474810496	-2
+0.92300020391127946	0.38231920253318386	42.038393016690279	-2
+0.90078669302014525	0.39672470738703974	41.977765586320047	-2
+0	0.40000000000000002	0	1
+0	0.81220450000000011	38.102569729028943	-2
+0.022588452084188176	0.79350374999999995	37.99884535397365	-2
+0.050558391143892517	0.8023150340788725	38.086568257260183	-2
+0.11223310360937674	0.81436948872107562	38.295802261879388	-2
+0.084079770781664648	0.82640054086235526	38.290437010533807	-2
+0.17370112779033073	0.82490765546176403	38.537599868943772	-2
+0.14123120162782549	0.83480266208437293	38.467904683929206	-2
+0.23244108333684485	0.80544567398331279	38.710665521728096	-2
+0.26013162206179102	0.81667300588287883	38.859441393605458	-2
+0.22253737829697193	0.83363672829037894	38.739356036757663	-2
+0.44372960773366704	0.67844296828108697	39.78688214262133	-2
+0.4857214277476859	0.6677272115498224	40.032991801211011	-2
+0.39737431376820592	0.72884012550035981	39.486870472013905	-2
+0.46834504067068505	0.72415053918881667	39.854230572123711	-2
+0.47000517693674898	0.69377448257868968	39.90764579611902	-2
+0.4310600820163083	0.73668357163291498	39.656944076094334	-2
+0.35424619465576879	0.7747050415722736	39.258894397794087	-2
+0.3140618404650159	0.80634769921348826	39.084523103793281	-2
+0.35117473448716202	0.80874763215156853	39.254209104610808	-2
+0.38292459506289095	0.75846240586463309	39.402272084724324	-2
+0.58266337230813259	0.62666168568610026	40.566990722348507	-2
+0.62044128633439632	0.64025872446901899	40.666133071506678	-2
+0.67930148783593214	0.62159359483765753	40.902618656346547	-2
+0.66112151769333927	0.66640327487268081	40.723243881536163	-2
+0.78000483459483394	0.52924395518759126	41.420705617629388	-2
+0.78178988848833442	0.56711813983334303	41.313392118169389	-2
+0.75435225838891085	0.6063253635497059	41.140219528722163	-2
+0.72833246866549761	0.62392586137869555	41.027309404968463	-2
+0.86900480276623771	0.44083401693089996	41.821023712975041	-2
+0.85524267221730377	0.4697990103066802	41.721818441278558	-2
+0.81021126717683367	0.54202101821694804	41.442049136607352	-2
+0.84258872403671559	0.53678821817552291	41.515614166453233	-2
+0.86602540378443904	0.49999999999999983	41.655432980967838	-2
+0.90630778703665027	0.42261826174069922	41.917485000598866	-2
+0.52583517495087539	0.67187122509208019	40.214637829673471	-2
+0.5736319900845489	0.65506783160378523	40.455935910430078	-2
+0	0.84960599999999997	38.300611428109363	-2
+0.046063219132901005	0.84394096462078239	38.310643100583007	-2
+0.10757921813745185	0.84602532975056266	38.420403688277148	-2
+0.058773633559509236	0.86925675289170645	38.42664706277592	-2
+0.087069968090660727	0.87058386357870765	38.469761416337768	-2
+0.16777940571522876	0.85833130679918179	38.612930652650626	-2
+0.12015249258626681	0.87544749301067537	38.540337600852069	-2
+0.25818243178965378	0.8578712546253966	38.909814729317716	-2
+0.29276858196638922	0.83886237542514319	39.022565001807308	-2
+0.23033565799031724	0.87602857820287006	38.835733763020691	-2
+0.19710516568695532	0.87695895006653424	38.737668709696436	-2
+0.52302347743994371	0.7119054745076614	40.119435690995431	-2
+0.41096446675551457	0.77397505134922617	39.533017015778896	-2
+0.49756135059715195	0.72640986793701123	39.981821171509111	-2
+0.46669381758428524	0.75307905736051617	39.805692978273193	-2
+0.44266158570941938	0.76926663075507051	39.679562438604975	-2
+0.38407191337667335	0.79140109930151981	39.402861122447213	-2
+0.33219015673344243	0.84072750689052445	39.176999214570834	-2
+0.37985402140652785	0.82326951637963941	39.370649662039938	-2
+0.36243923534529265	0.85237945522975	39.291592856223794	-2
+0.62657924053276237	0.67542918862144341	40.590760806904491	-2
+0.58367424523082134	0.68313254436451809	40.422300881517423	-2
+0.70359781660053577	0.64329088057063522	40.907657406049871	-2
+0.67920807944259587	0.68882936859379373	40.714966921538604	-2
+0.7046122043225892	0.67523952552702082	40.822215612165309	-2
+0.66019260470231822	0.71047342357200138	40.60352284343179	-2
+0.81915204428899224	0.57357643635104594	41.37063050766556	-2
+0.79259824370398535	0.60818202301879265	41.21992173788756	-2
+0.76604444311897857	0.64278760968653925	41.065058743823883	-2
+0.7397343999053414	0.64826029401323648	40.986842641483911	-2
+0.88616659541054466	0.46130913087034953	41.789313382449919	-2
+0.55158235388527022	0.69379536945140263	40.273410968974915	-2
+0	0.88700749999999995	38.441857351894626	-2
+0.026772247594466562	0.8694751538533978	38.398030818017958	-2
+0.042969617764977361	0.8981842449891656	38.494385805152419	-2
+0.079681978688101396	0.90391734858194694	38.543455973835982	-2
+0.11789887720836087	0.90880959030659392	38.609681630040079	-2
+0.14995788635712129	0.89060489451681035	38.639945713134914	-2
+0.28578009651102476	0.8671157418190143	39.012109313996866	-2
+0.24552592550448638	0.9016378085428719	38.900640158746739	-2
+0.31045660662207586	0.88254822348222572	39.100457190806964	-2
+0.21608081386091715	0.90606073812144738	38.823429232895649	-2
+0.18083967599733278	0.90765786106956248	38.738109225491144	-2
+0.54854616611929008	0.73972987160426995	40.162205368777613	-2
+0.50396516781174017	0.75500512029109845	39.959009371285987	-2
+0.43389017220512627	0.81926423510831514	39.589990012140518	-2
+0.47999763533275513	0.77881996128028752	39.823820834165709	-2
+0.46566401599714397	0.80941631108240208	39.724212185119555	-2
+0.34023002205634478	0.87398063030378059	39.203552270823444	-2
+0.39484787051857684	0.85170490117643638	39.4099274909168	-2
+0.36954444323297925	0.88400682751766912	39.29693914144093	-2
+0.63021262817528256	0.71094586814920047	40.510706163762912	-2
+0.57607638001351924	0.71389013410268931	40.3205484294093	-2
+0.70710678118654813	0.70710678118654746	40.743550598730529	-2
+0.73657561215276335	0.67494719543654336	40.905591474349428	-2
+0.67494719543654402	0.73657561215276268	40.577824836064551	-2
+0.64528710110274101	0.73648972920679756	40.492408810895803	-2
+0	0.92440900000000004	38.528416177685358	-2
+0.055964955172982861	0.92847760927797407	38.565310181106668	-2
+0.090800732656082378	0.93619856479312791	38.610398519146358	-2
+0.11877811146148594	0.9367791770489976	38.648075792783253	-2
+0.15162698935155114	0.92743430004544813	38.696012008494016	-2
+0.27350986968477026	0.9118101127987448	38.984677426301062	-2
+0.24947984215007651	0.93433858722670937	38.918540815932204	-2
+0.29635282327012313	0.9261478040021901	39.04664902392534	-2
+0.32055980271448997	0.91425696451425054	39.122065759095427	-2
+0.21738331041496789	0.93838511320677354	38.84125976958061	-2
+0.18622014681899188	0.94706952203067207	38.775016782168564	-2
+0.53322660430831181	0.7677122610151903	40.047371943831074	-2
+0.58606607585926584	0.7439561092119622	40.285107244605875	-2
+0.56314506236049866	0.77878425085461411	40.130283004986161	-2
+0.49883149177967784	0.80687125564985751	39.850030541828168	-2
+0.43210292309735931	0.85682729705501348	39.538779439780448	-2
+0.46693651185753404	0.84265694151001258	39.679893171196575	-2
+0.35365920585773047	0.91080032732197458	39.22440375732004	-2
+0.41017452786341163	0.87827323347240793	39.437477523861361	-2
+0.38231920253318474	0.92300020391127946	39.297351807155046	-2
+0.61485868868309912	0.75389132143368831	40.35564082218108	-2
+0.64278760968653992	0.76604444311897801	40.411199099036544	-2
+0	0.96181050000000001	38.581106933654567	-2
+0.020845560319266133	0.95212385583211334	38.575888222747658	-2
+0.071845592592165719	0.96642847071551397	38.617945215165669	-2
+0.038377491873117522	0.96698991907193865	38.596787173438649	-2
+0.1054378935815702	0.96797086714358815	38.652301874350101	-2
+0.137331075796497	0.95772812331835722	38.690813177057493	-2
+0.27514951207765337	0.94302289829534425	38.98223989978996	-2
+0.25881904510252135	0.96592582628906865	38.93006541764408	-2
+0.30041959421409536	0.95280922353748876	39.040016337353904	-2
+0.34202014332566938	0.93969262078590876	39.163024560636529	-2
+0.21623361138472613	0.97536678965063861	38.831791182176829	-2
+0.17364817766693091	0.98480775301220846	38.751354563798351	-2
+0.53640429154772995	0.8050840477705884	39.985708927889981	-2
+0.59001322506141096	0.77151022981466555	40.235133098638471	-2
+0.57357643635104671	0.81915204428899191	40.077067756474726	-2
+0.50692237392622908	0.83630004668300706	39.826652620965682	-2
+0.46130913087035041	0.88616659541054454	39.592933369412428	-2
+0.50000000000000067	0.86602540378443882	39.750163534762649	-2
+0.42261826174070011	0.90630778703665027	39.440155404341141	-2
+0.60818202301879332	0.79259824370398502	40.243802254605669	-2
+0	0.98051124999999995	38.592699068825759	-2
+0.013141774579826479	0.97378072877213451	38.590969979863978	-2
+0.059187999836045876	0.99741579611828968	38.617349783254994	-2
+0.087155742747658693	0.99619469809174599	38.637498928378704	-2
+0.03122025692443306	0.99863689414483348	38.603336538939871	-2
+0.020409489037516385	0.9859664150021944	38.597586766706314	-2
+0.1304019602072948	0.99050122555197717	38.684274711595954	-2
+0.53678821817552369	0.84258872403671536	39.911818660704647	-2
+0	0.98986162499999997	38.595816022904323	-2
+0.0054537855140276729	0.98638632194460674	38.595176749590429	-2
+0.015610128462216535	0.99931844707241668	38.598538645998318	-2
+0.0084846966837055799	0.99365471453164056	38.597018926043205	-2
+0	0.99453681250000003	38.596611812431668	-2
+0.0026197533177227347	0.99219921874999994	38.596337959022968	-2
+0.0078050642311082632	0.9996592235362084	38.597331341205475	-2
+0.0028005204902681272	0.99570560937500008	38.596800600303894	-2
+0	0.99687440625000001	38.596812616956605	-2
+0.0039025321155541368	0.99982961176810403	38.597042408215749	-2
+0.001396196365936915	0.99839575340557585	38.59690758361107	-2
+0	0.99921199999999999	38.596915997102656	-2
+0.0019512660577770632	0.99991480588405213	38.596955200552991	-2
+0.00097563302888853409	0.99995740294202606	38.596934523703034	-2
+0	1	38.596922047036784	-2
+3302
+0	1	2	0
+4	2	1	0
+4	1	3	0
+4	5	2	0
+3	7	4	0
+6	7	3	0
+8	5	4	0
+8	4	7	0
+5	8	9	0
+7	6	11	0
+8	7	12	0
+10	11	6	0
+11	12	7	0
+8	13	9	0
+8	12	13	0
+14	9	13	0
+10	16	11	0
+12	11	17	0
+16	10	15	0
+13	12	18	0
+11	16	17	0
+14	13	19	0
+18	12	17	0
+13	18	19	0
+19	21	14	0
+16	15	23	0
+21	20	14	0
+23	17	16	0
+17	25	18	0
+22	23	15	0
+18	25	19	0
+17	23	24	0
+19	25	21	0
+17	24	25	0
+21	27	20	0
+20	27	26	0
+28	21	25	0
+23	22	30	0
+27	21	28	0
+28	25	24	0
+31	24	23	0
+22	29	30	0
+31	23	30	0
+32	28	24	0
+27	28	32	0
+24	31	32	0
+27	35	26	0
+34	33	26	0
+27	32	35	0
+26	35	34	0
+37	30	29	0
+37	31	30	0
+29	36	37	0
+39	32	31	0
+31	37	38	0
+39	35	32	0
+31	38	39	0
+34	41	33	0
+34	35	42	0
+41	40	33	0
+42	35	39	0
+42	41	34	0
+36	45	37	0
+46	38	37	0
+44	36	43	0
+39	38	47	0
+45	36	44	0
+37	45	46	0
+42	39	48	0
+41	50	40	0
+38	46	47	0
+39	47	48	0
+41	42	51	0
+50	49	40	0
+44	43	53	0
+48	51	42	0
+41	51	50	0
+54	45	44	0
+45	56	46	0
+52	53	43	0
+56	47	46	0
+55	44	53	0
+48	47	58	0
+55	54	44	0
+54	57	45	0
+45	57	56	0
+59	51	48	0
+59	50	51	0
+62	49	50	0
+56	58	47	0
+60	48	58	0
+60	59	48	0
+53	52	65	0
+50	59	63	0
+61	49	62	0
+55	53	66	0
+63	62	50	0
+55	67	54	0
+68	57	54	0
+64	65	52	0
+59	60	63	0
+56	57	70	0
+65	66	53	0
+56	70	58	0
+68	54	67	0
+72	60	58	0
+66	69	55	0
+55	69	67	0
+63	60	73	0
+68	71	57	0
+75	61	62	0
+71	70	57	0
+75	62	63	0
+58	70	72	0
+73	60	72	0
+64	77	65	0
+78	66	65	0
+74	61	75	0
+73	75	63	0
+79	69	66	0
+67	80	68	0
+77	64	76	0
+81	67	69	0
+65	77	78	0
+83	71	68	0
+78	79	66	0
+70	85	72	0
+86	70	71	0
+80	67	81	0
+82	68	80	0
+84	69	79	0
+68	82	83	0
+72	88	73	0
+84	81	69	0
+75	73	90	0
+75	90	74	0
+83	86	71	0
+85	70	87	0
+70	86	87	0
+89	72	85	0
+76	94	77	0
+94	78	77	0
+88	72	89	0
+88	90	73	0
+78	95	79	0
+74	90	92	0
+74	92	91	0
+81	96	80	0
+95	84	79	0
+80	97	82	0
+76	93	94	0
+84	98	81	0
+99	83	82	0
+78	94	95	0
+92	90	88	0
+101	86	83	0
+96	97	80	0
+96	81	98	0
+87	105	85	0
+104	89	85	0
+82	97	100	0
+86	106	87	0
+82	100	99	0
+95	103	84	0
+83	99	101	0
+98	84	102	0
+89	108	88	0
+88	108	92	0
+102	84	103	0
+101	106	86	0
+104	85	105	0
+92	111	91	0
+107	105	87	0
+107	87	106	0
+94	93	113	0
+89	104	109	0
+94	114	95	0
+89	109	108	0
+96	116	97	0
+117	96	98	0
+92	108	111	0
+110	91	111	0
+115	103	95	0
+100	97	118	0
+112	113	93	0
+99	100	120	0
+119	98	102	0
+113	114	94	0
+121	101	99	0
+95	114	115	0
+108	109	111	0
+117	116	96	0
+103	125	102	0
+110	111	109	0
+118	97	116	0
+101	124	106	0
+119	117	98	0
+127	104	105	0
+126	109	104	0
+107	128	105	0
+120	121	99	0
+100	118	122	0
+129	107	106	0
+115	125	103	0
+123	120	100	0
+123	100	122	0
+121	124	101	0
+125	119	102	0
+109	132	110	0
+126	104	127	0
+113	112	134	0
+130	106	124	0
+105	128	127	0
+136	114	113	0
+130	129	106	0
+136	115	114	0
+128	107	131	0
+132	109	126	0
+107	129	131	0
+138	116	117	0
+118	116	138	0
+117	119	139	0
+115	137	125	0
+134	112	133	0
+142	122	118	0
+113	134	135	0
+113	135	136	0
+120	144	121	0
+119	125	143	0
+120	123	144	0
+137	115	136	0
+145	124	121	0
+122	147	123	0
+117	140	138	0
+139	140	117	0
+118	138	141	0
+142	118	141	0
+139	119	143	0
+130	124	150	0
+152	126	127	0
+127	128	153	0
+126	152	132	0
+142	146	122	0
+144	145	121	0
+125	137	151	0
+131	154	128	0
+129	155	131	0
+123	148	144	0
+129	130	156	0
+122	146	147	0
+145	150	124	0
+123	147	149	0
+125	151	143	0
+123	149	148	0
+134	133	162	0
+163	135	134	0
+152	127	153	0
+135	163	136	0
+154	153	128	0
+157	130	150	0
+148	145	144	0
+136	165	137	0
+129	156	155	0
+158	156	130	0
+154	131	159	0
+130	157	158	0
+167	138	140	0
+155	160	131	0
+167	141	138	0
+140	139	168	0
+160	159	131	0
+143	168	139	0
+142	141	171	0
+137	166	151	0
+162	133	161	0
+164	134	162	0
+142	172	146	0
+163	134	164	0
+165	136	163	0
+165	166	137	0
+143	151	175	0
+177	145	148	0
+147	146	178	0
+176	150	145	0
+147	178	149	0
+167	140	169	0
+149	179	148	0
+140	168	170	0
+169	140	170	0
+171	141	167	0
+143	174	168	0
+142	171	173	0
+172	142	173	0
+150	183	157	0
+174	143	175	0
+172	178	146	0
+186	155	156	0
+145	177	176	0
+160	155	185	0
+184	151	166	0
+156	158	188	0
+157	189	158	0
+177	148	179	0
+178	181	149	0
+182	150	176	0
+180	179	149	0
+181	180	149	0
+184	175	151	0
+160	192	159	0
+168	174	170	0
+183	150	182	0
+184	166	165	0
+195	162	161	0
+162	196	164	0
+164	197	163	0
+165	163	197	0
+155	186	185	0
+189	157	183	0
+186	156	187	0
+156	188	187	0
+200	167	169	0
+158	189	190	0
+191	188	158	0
+171	167	200	0
+185	193	160	0
+158	190	191	0
+201	169	170	0
+160	193	192	0
+203	170	174	0
+171	204	173	0
+184	165	199	0
+172	173	205	0
+195	161	194	0
+195	196	162	0
+178	172	205	0
+174	175	208	0
+196	198	164	0
+197	164	198	0
+165	197	199	0
+205	181	178	0
+177	211	176	0
+209	175	184	0
+212	177	179	0
+210	182	176	0
+180	212	179	0
+202	200	169	0
+201	202	169	0
+203	201	170	0
+200	204	171	0
+215	180	181	0
+183	182	218	0
+206	173	204	0
+205	173	207	0
+203	174	208	0
+206	207	173	0
+183	219	189	0
+175	209	208	0
+186	223	185	0
+211	210	176	0
+186	187	225	0
+177	212	211	0
+185	222	193	0
+188	226	187	0
+181	205	217	0
+221	184	199	0
+180	213	212	0
+188	191	227	0
+180	214	213	0
+228	190	189	0
+215	214	180	0
+182	210	218	0
+190	229	191	0
+181	216	215	0
+220	209	184	0
+217	216	181	0
+192	193	232	0
+183	218	219	0
+194	234	195	0
+221	220	184	0
+235	196	195	0
+207	217	205	0
+198	196	236	0
+222	185	223	0
+237	197	198	0
+186	224	223	0
+197	237	199	0
+186	225	224	0
+228	189	219	0
+187	226	225	0
+239	200	202	0
+226	188	227	0
+202	201	240	0
+200	239	204	0
+240	201	203	0
+193	222	232	0
+190	228	230	0
+230	229	190	0
+206	204	239	0
+227	191	231	0
+191	229	231	0
+208	244	203	0
+221	199	237	0
+207	206	245	0
+234	194	233	0
+234	235	195	0
+209	249	208	0
+235	236	196	0
+236	238	198	0
+217	207	248	0
+252	210	211	0
+237	198	238	0
+220	249	209	0
+210	250	218	0
+211	212	255	0
+213	255	212	0
+239	202	241	0
+214	256	213	0
+202	240	242	0
+202	242	241	0
+240	203	243	0
+214	215	258	0
+259	215	216	0
+244	243	203	0
+239	246	206	0
+217	260	216	0
+246	245	206	0
+261	219	218	0
+207	245	247	0
+244	208	249	0
+207	247	248	0
+264	220	221	0
+228	219	263	0
+210	251	250	0
+223	268	222	0
+252	251	210	0
+252	211	253	0
+223	224	269	0
+211	254	253	0
+271	224	225	0
+254	211	255	0
+222	267	232	0
+272	225	226	0
+255	213	256	0
+266	221	237	0
+217	248	260	0
+227	273	226	0
+214	257	256	0
+261	218	250	0
+214	258	257	0
+259	258	215	0
+231	275	227	0
+265	249	220	0
+228	277	230	0
+260	259	216	0
+229	230	278	0
+229	278	231	0
+266	237	238	0
+262	219	261	0
+262	263	219	0
+265	220	264	0
+264	221	266	0
+284	234	233	0
+234	285	235	0
+236	235	286	0
+267	222	268	0
+223	270	268	0
+236	287	238	0
+223	269	270	0
+269	224	271	0
+263	276	228	0
+225	272	271	0
+290	239	241	0
+226	274	272	0
+291	242	240	0
+226	273	274	0
+291	240	243	0
+227	275	273	0
+290	246	239	0
+292	241	242	0
+294	243	244	0
+228	276	277	0
+282	232	267	0
+279	230	277	0
+281	275	231	0
+245	246	297	0
+230	280	278	0
+230	279	280	0
+244	249	296	0
+245	298	247	0
+281	231	278	0
+266	238	288	0
+247	300	248	0
+284	233	283	0
+250	251	302	0
+285	234	284	0
+235	285	286	0
+305	251	252	0
+286	287	236	0
+248	301	260	0
+249	265	296	0
+252	253	306	0
+289	238	287	0
+303	261	250	0
+307	253	254	0
+289	288	238	0
+268	282	267	0
+254	255	310	0
+311	255	256	0
+241	292	290	0
+312	256	257	0
+242	291	293	0
+242	293	292	0
+291	243	294	0
+258	313	257	0
+258	259	315	0
+244	295	294	0
+299	246	290	0
+316	259	260	0
+244	296	295	0
+281	278	280	0
+245	297	298	0
+262	261	317	0
+246	299	297	0
+263	262	319	0
+298	300	247	0
+248	300	301	0
+265	264	322	0
+322	264	266	0
+303	250	302	0
+251	304	302	0
+304	251	305	0
+276	263	321	0
+305	252	306	0
+270	326	268	0
+253	307	306	0
+269	330	270	0
+307	254	308	0
+329	269	271	0
+309	308	254	0
+254	310	309	0
+311	310	255	0
+272	333	271	0
+268	327	282	0
+316	260	301	0
+325	266	288	0
+312	311	256	0
+334	272	274	0
+318	261	303	0
+335	274	273	0
+314	312	257	0
+335	273	275	0
+313	314	257	0
+265	324	296	0
+313	258	315	0
+259	316	315	0
+276	338	277	0
+275	281	337	0
+279	277	339	0
+261	318	317	0
+317	320	262	0
+319	262	320	0
+263	319	321	0
+284	283	342	0
+265	322	323	0
+324	265	323	0
+285	284	344	0
+322	266	325	0
+286	285	344	0
+287	286	345	0
+287	345	289	0
+326	328	268	0
+327	268	328	0
+288	289	347	0
+326	270	332	0
+269	329	330	0
+292	349	290	0
+270	330	331	0
+332	270	331	0
+329	271	333	0
+293	291	350	0
+294	350	291	0
+321	338	276	0
+292	293	352	0
+349	299	290	0
+334	333	272	0
+294	295	354	0
+334	274	336	0
+335	336	274	0
+356	295	296	0
+275	337	335	0
+282	327	340	0
+297	357	298	0
+299	357	297	0
+277	338	339	0
+300	298	358	0
+325	288	346	0
+300	361	301	0
+341	342	283	0
+284	342	343	0
+302	364	303	0
+302	304	364	0
+325	323	322	0
+284	343	344	0
+344	345	286	0
+296	324	356	0
+305	368	304	0
+301	363	316	0
+306	369	305	0
+346	288	347	0
+289	345	348	0
+289	348	347	0
+371	306	307	0
+332	328	326	0
+303	365	318	0
+307	308	372	0
+308	309	373	0
+351	349	292	0
+309	310	375	0
+352	351	292	0
+353	293	350	0
+310	311	376	0
+350	294	354	0
+353	352	293	0
+377	311	312	0
+295	355	354	0
+312	314	378	0
+355	295	356	0
+314	313	379	0
+315	379	313	0
+337	336	335	0
+360	299	349	0
+358	298	357	0
+315	316	382	0
+357	299	359	0
+317	318	383	0
+359	299	360	0
+362	300	358	0
+383	320	317	0
+361	300	362	0
+301	361	363	0
+323	385	324	0
+366	303	364	0
+386	323	325	0
+365	303	366	0
+364	304	367	0
+304	368	367	0
+369	368	305	0
+328	389	327	0
+370	369	306	0
+370	306	371	0
+371	307	372	0
+332	391	328	0
+308	373	372	0
+392	332	331	0
+309	374	373	0
+327	389	340	0
+353	350	354	0
+386	325	346	0
+375	374	309	0
+360	349	351	0
+376	375	310	0
+363	382	316	0
+377	376	311	0
+387	356	324	0
+378	377	312	0
+365	384	318	0
+381	378	314	0
+379	380	314	0
+381	314	380	0
+379	315	382	0
+394	342	341	0
+343	342	396	0
+383	318	384	0
+343	398	344	0
+398	345	344	0
+346	347	399	0
+398	348	345	0
+323	386	385	0
+347	348	400	0
+364	367	366	0
+324	385	388	0
+356	387	355	0
+387	324	388	0
+351	352	403	0
+389	328	390	0
+391	390	328	0
+352	353	404	0
+354	405	353	0
+402	360	351	0
+392	391	332	0
+355	407	354	0
+389	393	340	0
+358	357	408	0
+357	359	408	0
+409	362	358	0
+395	394	341	0
+411	359	360	0
+346	399	386	0
+396	342	394	0
+396	397	343	0
+361	362	415	0
+398	343	397	0
+415	363	361	0
+347	400	399	0
+401	348	398	0
+401	400	348	0
+355	387	407	0
+367	368	418	0
+368	369	419	0
+403	402	351	0
+370	419	369	0
+404	403	352	0
+382	363	417	0
+370	371	421	0
+353	406	404	0
+353	405	406	0
+422	371	372	0
+407	405	354	0
+423	372	373	0
+373	374	424	0
+360	402	412	0
+375	426	374	0
+410	358	408	0
+410	409	358	0
+408	359	411	0
+429	375	376	0
+430	376	377	0
+412	413	360	0
+360	414	411	0
+378	431	377	0
+416	362	409	0
+414	360	413	0
+381	433	378	0
+380	379	434	0
+362	416	415	0
+415	417	363	0
+434	379	382	0
+435	381	380	0
+419	418	368	0
+385	386	437	0
+420	419	370	0
+421	420	370	0
+388	385	438	0
+371	422	421	0
+387	388	440	0
+422	372	423	0
+423	373	424	0
+390	442	389	0
+425	424	374	0
+386	399	439	0
+390	391	444	0
+443	393	389	0
+427	425	374	0
+427	374	426	0
+392	445	391	0
+375	428	426	0
+429	428	375	0
+417	434	382	0
+407	387	440	0
+429	376	430	0
+447	394	395	0
+447	396	394	0
+430	377	431	0
+432	431	378	0
+450	397	396	0
+433	432	378	0
+451	398	397	0
+435	380	434	0
+451	401	398	0
+381	436	433	0
+399	400	452	0
+435	436	381	0
+453	400	401	0
+420	418	419	0
+403	455	402	0
+437	438	385	0
+403	404	455	0
+437	386	439	0
+455	404	406	0
+441	388	438	0
+406	405	456	0
+405	407	456	0
+441	440	388	0
+412	402	455	0
+389	442	443	0
+444	442	390	0
+460	410	408	0
+408	411	460	0
+410	461	409	0
+391	445	444	0
+393	443	446	0
+416	409	462	0
+464	411	414	0
+465	413	412	0
+439	399	452	0
+395	449	447	0
+395	448	449	0
+396	447	450	0
+413	467	414	0
+450	451	397	0
+415	416	471	0
+417	415	470	0
+452	400	453	0
+407	440	459	0
+451	454	401	0
+454	453	401	0
+457	455	406	0
+458	406	456	0
+458	457	406	0
+407	459	456	0
+434	417	472	0
+425	427	473	0
+427	426	474	0
+475	426	428	0
+461	462	409	0
+455	466	412	0
+460	463	410	0
+428	429	477	0
+410	463	461	0
+411	464	460	0
+429	430	478	0
+431	478	430	0
+441	459	440	0
+431	432	479	0
+466	465	412	0
+480	432	433	0
+413	465	468	0
+469	464	414	0
+468	467	413	0
+462	471	416	0
+414	467	469	0
+482	433	436	0
+434	483	435	0
+415	471	470	0
+436	435	485	0
+417	470	472	0
+438	437	486	0
+437	439	486	0
+438	487	441	0
+474	426	475	0
+476	473	427	0
+492	443	442	0
+474	476	427	0
+452	488	439	0
+442	444	493	0
+477	475	428	0
+443	494	446	0
+429	478	477	0
+444	445	495	0
+431	479	478	0
+434	472	483	0
+441	491	459	0
+432	481	479	0
+432	480	481	0
+447	497	450	0
+499	447	449	0
+482	480	433	0
+501	449	448	0
+484	435	483	0
+485	482	436	0
+450	503	451	0
+435	484	485	0
+454	451	503	0
+452	453	504	0
+438	486	487	0
+454	505	453	0
+486	439	488	0
+487	490	441	0
+508	455	457	0
+441	490	489	0
+489	491	441	0
+509	458	456	0
+508	457	458	0
+459	509	456	0
+492	442	493	0
+508	466	455	0
+443	492	494	0
+444	495	493	0
+496	446	494	0
+460	513	463	0
+462	461	514	0
+464	513	460	0
+463	514	461	0
+447	498	497	0
+504	488	452	0
+498	447	499	0
+469	513	464	0
+462	515	471	0
+517	465	466	0
+450	497	502	0
+448	500	501	0
+501	499	449	0
+468	465	517	0
+520	467	468	0
+519	469	467	0
+450	502	503	0
+504	453	505	0
+512	459	491	0
+454	503	506	0
+471	523	470	0
+472	470	523	0
+454	507	505	0
+454	506	507	0
+525	473	476	0
+474	475	526	0
+476	474	526	0
+458	511	508	0
+509	510	458	0
+458	510	511	0
+524	483	472	0
+475	477	527	0
+509	459	512	0
+478	530	477	0
+530	478	479	0
+514	515	462	0
+481	531	479	0
+483	524	484	0
+508	518	466	0
+516	463	513	0
+463	516	514	0
+480	532	481	0
+480	482	532	0
+517	466	518	0
+482	485	535	0
+522	513	469	0
+468	517	521	0
+537	485	484	0
+523	471	515	0
+519	467	520	0
+468	521	520	0
+469	519	522	0
+502	506	503	0
+539	487	486	0
+486	488	540	0
+490	487	539	0
+524	472	523	0
+490	544	489	0
+491	489	543	0
+526	475	527	0
+528	525	476	0
+529	476	526	0
+510	509	512	0
+493	547	492	0
+488	504	541	0
+547	494	492	0
+476	529	528	0
+477	530	527	0
+493	495	548	0
+479	531	530	0
+550	496	494	0
+524	536	484	0
+533	481	532	0
+481	534	531	0
+533	534	481	0
+491	546	512	0
+482	535	532	0
+553	498	499	0
+499	501	554	0
+484	536	537	0
+500	556	501	0
+538	535	485	0
+537	538	485	0
+539	486	540	0
+505	557	504	0
+510	512	546	0
+557	505	507	0
+540	488	542	0
+488	541	542	0
+539	545	490	0
+544	543	489	0
+511	558	508	0
+544	490	545	0
+510	559	511	0
+491	543	546	0
+508	558	518	0
+549	547	493	0
+548	549	493	0
+516	513	561	0
+562	515	514	0
+551	494	547	0
+514	516	563	0
+550	494	551	0
+513	522	561	0
+552	496	550	0
+518	566	517	0
+504	557	541	0
+515	564	523	0
+566	521	517	0
+567	519	520	0
+499	554	553	0
+522	519	567	0
+520	521	568	0
+556	554	501	0
+500	555	556	0
+564	524	523	0
+510	546	559	0
+525	528	574	0
+575	526	527	0
+511	560	558	0
+560	511	559	0
+526	576	529	0
+524	573	536	0
+530	577	527	0
+528	529	578	0
+514	563	562	0
+531	580	530	0
+562	564	515	0
+561	565	516	0
+566	518	558	0
+563	516	565	0
+582	531	534	0
+583	533	532	0
+532	535	583	0
+534	533	584	0
+561	522	572	0
+520	569	567	0
+566	570	521	0
+568	569	520	0
+538	586	535	0
+568	521	570	0
+571	522	567	0
+564	573	524	0
+588	537	536	0
+537	589	538	0
+522	571	572	0
+539	540	591	0
+540	542	592	0
+591	545	539	0
+542	541	593	0
+576	526	575	0
+577	575	527	0
+578	574	528	0
+544	594	543	0
+594	546	543	0
+579	529	576	0
+545	596	544	0
+578	529	579	0
+577	530	581	0
+593	541	557	0
+530	580	581	0
+580	531	582	0
+547	549	599	0
+573	587	536	0
+548	600	549	0
+547	599	551	0
+584	533	583	0
+582	534	585	0
+585	534	584	0
+550	551	602	0
+598	559	546	0
+602	552	550	0
+583	535	586	0
+569	571	567	0
+536	587	588	0
+606	553	554	0
+589	537	588	0
+538	590	586	0
+607	554	556	0
+590	538	589	0
+555	607	556	0
+591	540	592	0
+609	558	560	0
+593	592	542	0
+560	559	611	0
+595	594	544	0
+597	545	591	0
+566	558	610	0
+595	544	596	0
+597	596	545	0
+546	594	598	0
+561	613	565	0
+615	562	563	0
+614	564	562	0
+563	565	616	0
+610	570	566	0
+561	572	613	0
+549	601	599	0
+601	549	600	0
+614	573	564	0
+599	603	551	0
+551	603	602	0
+568	619	569	0
+570	618	568	0
+602	605	552	0
+571	569	621	0
+605	604	552	0
+571	621	572	0
+554	607	606	0
+598	611	559	0
+555	608	607	0
+558	609	610	0
+627	574	578	0
+576	575	628	0
+577	628	575	0
+592	597	591	0
+612	609	560	0
+560	611	612	0
+629	579	576	0
+626	587	573	0
+577	581	630	0
+631	578	579	0
+615	614	562	0
+580	633	581	0
+616	615	563	0
+613	617	565	0
+633	580	582	0
+565	617	616	0
+582	585	634	0
+584	583	635	0
+570	610	623	0
+618	619	568	0
+636	583	586	0
+584	637	585	0
+620	569	619	0
+624	613	572	0
+618	570	622	0
+620	621	569	0
+590	636	586	0
+626	573	614	0
+587	639	588	0
+622	570	623	0
+588	641	589	0
+625	572	621	0
+589	641	590	0
+625	624	572	0
+628	629	576	0
+628	577	630	0
+646	594	595	0
+627	578	631	0
+594	646	598	0
+632	579	629	0
+631	579	632	0
+633	630	581	0
+647	599	601	0
+599	647	603	0
+634	633	582	0
+587	626	640	0
+613	624	617	0
+635	583	636	0
+646	611	598	0
+650	602	603	0
+584	635	637	0
+605	602	649	0
+634	585	638	0
+638	585	637	0
+652	604	605	0
+607	653	606	0
+640	639	587	0
+639	642	588	0
+607	608	654	0
+644	636	590	0
+641	588	643	0
+588	642	643	0
+610	609	657	0
+590	641	645	0
+609	612	656	0
+645	644	590	0
+658	612	611	0
+615	660	614	0
+623	610	657	0
+615	616	662	0
+617	662	616	0
+648	647	601	0
+660	626	614	0
+650	603	647	0
+649	602	650	0
+619	618	665	0
+624	663	617	0
+618	622	664	0
+620	619	666	0
+652	605	649	0
+651	604	652	0
+621	620	667	0
+623	669	622	0
+654	653	607	0
+625	621	668	0
+611	646	658	0
+608	655	654	0
+672	624	625	0
+656	657	609	0
+656	612	659	0
+643	645	641	0
+658	659	612	0
+627	631	677	0
+678	629	628	0
+615	661	660	0
+630	678	628	0
+615	662	661	0
+629	679	632	0
+675	640	626	0
+663	662	617	0
+633	681	630	0
+650	647	648	0
+632	682	631	0
+618	664	665	0
+665	666	619	0
+657	671	623	0
+634	684	633	0
+666	667	620	0
+622	670	664	0
+667	668	621	0
+634	638	685	0
+687	635	636	0
+637	635	686	0
+624	672	663	0
+674	626	660	0
+622	669	670	0
+671	669	623	0
+689	638	637	0
+673	625	668	0
+636	644	687	0
+690	639	640	0
+672	625	673	0
+690	642	639	0
+675	626	674	0
+691	643	642	0
+676	627	677	0
+693	645	643	0
+644	645	695	0
+629	678	679	0
+680	678	630	0
+682	677	631	0
+630	681	680	0
+696	650	648	0
+632	679	683	0
+683	682	632	0
+650	698	649	0
+649	697	652	0
+633	684	681	0
+685	684	634	0
+651	652	701	0
+690	640	675	0
+686	635	687	0
+702	653	654	0
+637	686	688	0
+685	638	689	0
+703	654	655	0
+689	637	688	0
+705	657	656	0
+705	656	659	0
+690	691	642	0
+644	694	687	0
+643	691	692	0
+660	661	707	0
+693	643	692	0
+707	661	662	0
+663	707	662	0
+644	695	694	0
+657	705	671	0
+693	695	645	0
+710	665	664	0
+706	674	660	0
+666	665	711	0
+650	696	698	0
+664	670	710	0
+697	649	698	0
+709	663	672	0
+666	712	667	0
+667	713	668	0
+700	699	651	0
+652	697	701	0
+701	700	651	0
+714	670	669	0
+671	714	669	0
+673	668	713	0
+654	703	702	0
+672	673	716	0
+655	704	703	0
+718	675	674	0
+677	720	676	0
+706	660	707	0
+707	663	708	0
+678	722	679	0
+722	678	680	0
+708	663	709	0
+721	677	682	0
+690	675	719	0
+679	723	683	0
+724	680	681	0
+710	711	665	0
+711	712	666	0
+684	725	681	0
+683	726	682	0
+712	713	667	0
+670	715	710	0
+685	728	684	0
+672	716	709	0
+706	718	674	0
+714	715	670	0
+729	686	687	0
+689	728	685	0
+717	673	713	0
+730	688	686	0
+673	717	716	0
+689	688	731	0
+694	729	687	0
+675	718	719	0
+735	691	690	0
+720	677	721	0
+692	691	736	0
+693	692	738	0
+723	679	722	0
+680	724	722	0
+693	739	695	0
+721	682	726	0
+694	695	740	0
+724	681	725	0
+727	683	723	0
+726	683	727	0
+696	742	698	0
+725	684	728	0
+743	697	698	0
+743	701	697	0
+719	734	690	0
+730	686	729	0
+699	700	746	0
+701	747	700	0
+730	731	688	0
+689	732	728	0
+689	731	733	0
+689	733	732	0
+690	734	735	0
+748	706	707	0
+708	748	707	0
+737	691	735	0
+729	694	741	0
+736	691	737	0
+692	736	738	0
+708	709	751	0
+693	738	739	0
+718	706	749	0
+740	695	739	0
+694	740	741	0
+754	711	710	0
+754	712	711	0
+752	709	716	0
+715	753	710	0
+712	755	713	0
+698	742	743	0
+717	713	755	0
+718	749	719	0
+745	744	699	0
+699	746	745	0
+747	701	743	0
+717	758	716	0
+747	746	700	0
+721	761	720	0
+749	706	748	0
+708	750	748	0
+722	763	723	0
+751	750	708	0
+763	722	724	0
+721	726	762	0
+709	752	751	0
+725	763	724	0
+759	734	719	0
+727	723	764	0
+727	762	726	0
+753	754	710	0
+725	728	766	0
+756	712	754	0
+755	712	756	0
+757	752	716	0
+732	766	728	0
+759	719	749	0
+730	729	770	0
+755	758	717	0
+757	716	758	0
+730	771	731	0
+773	733	731	0
+774	732	733	0
+729	741	770	0
+760	720	761	0
+761	721	762	0
+735	734	776	0
+748	750	749	0
+735	777	737	0
+764	723	763	0
+779	736	737	0
+738	736	779	0
+765	763	725	0
+765	725	766	0
+762	727	768	0
+781	739	738	0
+764	769	727	0
+739	782	740	0
+768	727	767	0
+769	767	727	0
+741	740	782	0
+759	776	734	0
+743	742	786	0
+732	774	766	0
+772	730	770	0
+730	772	771	0
+731	771	773	0
+743	787	747	0
+745	789	744	0
+733	773	775	0
+746	790	745	0
+774	733	775	0
+792	746	747	0
+778	735	776	0
+735	778	777	0
+761	762	768	0
+749	750	794	0
+737	777	780	0
+741	784	770	0
+795	750	751	0
+779	737	780	0
+781	738	779	0
+796	751	752	0
+793	759	749	0
+739	781	783	0
+753	797	754	0
+783	782	739	0
+752	757	796	0
+797	756	754	0
+741	782	785	0
+798	755	756	0
+785	784	741	0
+758	755	798	0
+758	800	757	0
+743	786	787	0
+744	789	788	0
+789	745	791	0
+747	787	792	0
+770	784	772	0
+761	805	760	0
+745	790	791	0
+792	790	746	0
+764	763	808	0
+765	808	763	0
+749	794	793	0
+807	761	768	0
+776	759	803	0
+750	795	794	0
+765	766	810	0
+796	795	751	0
+809	769	764	0
+768	767	812	0
+813	767	769	0
+783	785	782	0
+766	774	810	0
+799	756	797	0
+798	756	799	0
+801	796	757	0
+804	759	793	0
+772	815	771	0
+758	798	802	0
+801	757	800	0
+771	815	773	0
+758	802	800	0
+773	817	775	0
+804	803	759	0
+774	775	820	0
+806	805	761	0
+816	772	784	0
+761	807	806	0
+778	776	821	0
+822	777	778	0
+777	822	780	0
+809	764	808	0
+780	824	779	0
+808	765	811	0
+779	825	781	0
+811	765	810	0
+807	768	812	0
+826	783	781	0
+767	813	812	0
+809	814	769	0
+827	785	783	0
+813	769	814	0
+829	784	785	0
+821	776	803	0
+818	810	774	0
+786	830	787	0
+815	772	816	0
+815	817	773	0
+792	787	831	0
+789	833	788	0
+818	774	819	0
+775	817	820	0
+774	820	819	0
+791	834	789	0
+835	791	790	0
+792	835	790	0
+778	821	823	0
+778	823	822	0
+793	794	838	0
+822	824	780	0
+795	838	794	0
+809	808	811	0
+779	824	825	0
+816	784	829	0
+795	796	839	0
+826	781	825	0
+793	838	804	0
+801	840	796	0
+826	828	783	0
+783	828	827	0
+798	799	841	0
+811	810	818	0
+827	829	785	0
+841	802	798	0
+842	801	800	0
+802	842	800	0
+787	830	831	0
+803	804	845	0
+832	788	833	0
+834	833	789	0
+806	848	805	0
+792	831	837	0
+836	834	791	0
+807	849	806	0
+791	835	836	0
+837	835	792	0
+850	807	812	0
+803	846	821	0
+851	809	811	0
+838	795	839	0
+814	809	851	0
+840	839	796	0
+812	813	854	0
+811	818	852	0
+813	814	855	0
+843	840	801	0
+842	802	841	0
+842	844	801	0
+843	801	844	0
+847	804	838	0
+859	815	816	0
+846	823	821	0
+858	817	815	0
+845	846	803	0
+845	804	847	0
+817	863	820	0
+864	818	819	0
+848	806	849	0
+819	820	865	0
+829	861	816	0
+850	849	807	0
+823	868	822	0
+822	869	824	0
+811	853	851	0
+811	852	853	0
+850	812	854	0
+814	851	853	0
+825	824	871	0
+813	856	854	0
+825	872	826	0
+813	855	856	0
+838	839	847	0
+853	857	814	0
+857	855	814	0
+828	826	872	0
+873	827	828	0
+874	829	827	0
+860	858	815	0
+818	864	852	0
+815	859	860	0
+859	816	862	0
+831	830	877	0
+863	817	858	0
+846	870	823	0
+862	816	861	0
+832	833	880	0
+878	837	831	0
+833	834	881	0
+863	865	820	0
+866	864	819	0
+819	865	866	0
+836	883	834	0
+884	836	835	0
+822	868	867	0
+885	835	837	0
+869	822	867	0
+870	868	823	0
+829	874	861	0
+824	869	871	0
+872	825	871	0
+839	840	889	0
+827	873	874	0
+840	843	891	0
+842	841	892	0
+828	872	875	0
+847	839	890	0
+873	828	876	0
+842	892	844	0
+876	828	875	0
+893	843	844	0
+860	863	858	0
+878	831	877	0
+847	895	845	0
+846	845	896	0
+832	880	879	0
+849	898	848	0
+882	880	833	0
+833	881	882	0
+834	883	881	0
+850	900	849	0
+837	878	885	0
+835	885	884	0
+854	900	850	0
+887	883	836	0
+901	853	852	0
+886	836	884	0
+886	888	836	0
+888	887	836	0
+853	903	857	0
+870	846	897	0
+856	905	854	0
+906	856	855	0
+872	871	875	0
+902	852	864	0
+889	890	839	0
+855	857	906	0
+891	889	840	0
+843	893	891	0
+909	860	859	0
+859	862	909	0
+892	894	844	0
+844	894	893	0
+866	902	864	0
+895	847	890	0
+863	860	910	0
+861	911	862	0
+845	895	896	0
+896	897	846	0
+863	913	865	0
+866	865	914	0
+861	874	911	0
+899	898	849	0
+899	849	900	0
+868	918	867	0
+867	918	869	0
+901	852	902	0
+853	901	903	0
+854	904	900	0
+868	870	920	0
+869	922	871	0
+904	854	905	0
+856	907	905	0
+903	908	857	0
+875	871	922	0
+906	907	856	0
+923	874	873	0
+857	908	906	0
+873	876	924	0
+875	926	876	0
+860	909	910	0
+909	862	912	0
+878	877	929	0
+866	917	902	0
+862	911	912	0
+910	913	863	0
+897	920	870	0
+932	879	880	0
+913	914	865	0
+878	930	885	0
+882	932	880	0
+866	914	916	0
+883	933	881	0
+881	934	882	0
+916	915	866	0
+866	915	917	0
+887	933	883	0
+918	868	919	0
+884	885	936	0
+884	936	886	0
+868	920	919	0
+869	918	921	0
+911	874	925	0
+886	938	888	0
+922	869	921	0
+888	939	887	0
+923	873	924	0
+923	925	874	0
+875	922	926	0
+890	889	944	0
+891	944	889	0
+876	927	924	0
+945	895	890	0
+891	893	946	0
+928	876	926	0
+927	876	928	0
+894	947	893	0
+929	930	878	0
+948	896	895	0
+932	931	879	0
+896	949	897	0
+933	934	881	0
+899	951	898	0
+882	935	932	0
+885	930	936	0
+882	934	935	0
+900	952	899	0
+902	955	901	0
+904	954	900	0
+955	903	901	0
+936	937	886	0
+933	887	940	0
+886	937	938	0
+905	957	904	0
+908	903	956	0
+887	939	941	0
+920	897	950	0
+940	887	941	0
+938	942	888	0
+939	888	943	0
+958	905	907	0
+959	907	906	0
+888	942	943	0
+955	902	917	0
+906	908	960	0
+944	945	890	0
+944	891	946	0
+963	910	909	0
+912	963	909	0
+946	893	947	0
+910	964	913	0
+948	895	945	0
+912	911	966	0
+964	914	913	0
+948	949	896	0
+950	897	949	0
+968	916	914	0
+911	925	965	0
+915	916	970	0
+917	915	969	0
+899	953	951	0
+953	899	952	0
+900	954	952	0
+940	934	933	0
+972	918	919	0
+972	921	918	0
+973	919	920	0
+903	955	956	0
+904	957	954	0
+922	921	976	0
+957	905	958	0
+926	922	976	0
+977	923	924	0
+959	906	960	0
+977	925	923	0
+908	956	962	0
+958	907	961	0
+959	961	907	0
+924	927	977	0
+908	962	960	0
+978	928	926	0
+944	946	945	0
+927	928	980	0
+910	963	964	0
+982	930	929	0
+967	963	912	0
+911	965	966	0
+971	955	917	0
+950	975	920	0
+912	966	967	0
+914	964	968	0
+985	931	932	0
+983	936	930	0
+986	932	935	0
+970	969	915	0
+916	968	970	0
+969	971	917	0
+934	988	935	0
+940	987	934	0
+936	991	937	0
+972	919	974	0
+973	974	919	0
+925	977	965	0
+975	973	920	0
+993	938	937	0
+976	921	972	0
+994	942	938	0
+939	995	941	0
+939	943	995	0
+940	941	996	0
+978	926	976	0
+956	955	971	0
+977	927	979	0
+942	999	943	0
+927	980	979	0
+981	928	978	0
+928	981	980	0
+945	946	1002	0
+983	930	982	0
+947	1002	946	0
+948	945	1003	0
+985	984	931	0
+949	948	1004	0
+986	985	932	0
+950	949	1005	0
+987	989	934	0
+983	991	936	0
+986	935	990	0
+988	934	989	0
+951	953	1008	0
+990	935	988	0
+1009	953	952	0
+954	1009	952	0
+991	992	937	0
+992	993	937	0
+1012	954	957	0
+940	996	987	0
+993	994	938	0
+1015	957	958	0
+956	1013	962	0
+950	1006	975	0
+995	997	941	0
+1015	958	961	0
+959	960	1016	0
+941	998	996	0
+994	1000	942	0
+959	1016	961	0
+997	998	941	0
+960	962	1017	0
+1001	995	943	0
+956	971	1013	0
+1000	999	942	0
+943	999	1001	0
+963	1022	964	0
+945	1002	1003	0
+963	967	1021	0
+1023	966	965	0
+968	964	1022	0
+948	1003	1004	0
+967	966	1024	0
+949	1004	1005	0
+1007	950	1005	0
+1006	950	1007	0
+968	1026	970	0
+1023	965	977	0
+970	1027	969	0
+1028	971	969	0
+1010	1008	953	0
+953	1009	1010	0
+1011	1009	954	0
+954	1012	1011	0
+972	974	1031	0
+972	1030	976	0
+973	1032	974	0
+975	1033	973	0
+1014	1012	957	0
+976	1030	978	0
+1015	1014	957	0
+979	1036	977	0
+1016	960	1017	0
+1016	1018	961	0
+1020	962	1013	0
+961	1019	1015	0
+978	1037	981	0
+980	1038	979	0
+1018	1019	961	0
+1017	962	1020	0
+980	981	1039	0
+963	1021	1022	0
+982	1041	983	0
+1024	1021	967	0
+1013	971	1028	0
+985	1044	984	0
+1023	1024	966	0
+975	1006	1033	0
+1022	1025	968	0
+985	986	1045	0
+983	1042	991	0
+1026	968	1025	0
+990	1046	986	0
+1047	989	987	0
+1028	969	1027	0
+992	991	1042	0
+1029	970	1026	0
+989	1048	988	0
+1029	1027	970	0
+988	1048	990	0
+1047	987	996	0
+1030	972	1031	0
+977	1036	1023	0
+1053	993	992	0
+1033	1032	973	0
+1031	978	1030	0
+974	1035	1031	0
+1032	1034	974	0
+1054	994	993	0
+974	1034	1035	0
+978	1031	1037	0
+1055	997	995	0
+994	1054	1000	0
+998	1057	996	0
+995	1001	1055	0
+1058	998	997	0
+1036	979	1038	0
+1039	1038	980	0
+1040	981	1037	0
+1000	1061	999	0
+981	1040	1039	0
+1001	999	1060	0
+1041	1042	983	0
+998	1012	1057	0
+1012	998	1058	0
+984	1044	1043	0
+1003	1002	1066	0
+985	1045	1044	0
+1003	1067	1004	0
+1005	1004	1067	0
+1045	986	1046	0
+1068	1007	1005	0
+1007	1069	1006	0
+1012	1014	1057	0
+989	1047	1049	0
+1052	992	1042	0
+1048	989	1049	0
+1051	1046	990	0
+990	1048	1050	0
+1071	1008	1010	0
+1050	1051	990	0
+1009	1072	1010	0
+1011	1072	1009	0
+1052	1053	992	0
+1074	1011	1012	0
+1047	996	1056	0
+1054	993	1053	0
+1015	1078	1014	0
+1013	1075	1020	0
+1006	1069	1033	0
+1057	1056	996	0
+997	1055	1058	0
+1015	1019	1079	0
+1016	1080	1018	0
+1081	1016	1017	0
+1063	1000	1054	0
+1013	1028	1076	0
+1081	1017	1020	0
+1060	999	1059	0
+999	1061	1059	0
+1082	1019	1018	0
+1065	1055	1001	0
+1062	1061	1000	0
+1060	1064	1001	0
+1063	1062	1000	0
+1022	1021	1085	0
+1021	1024	1084	0
+1065	1001	1064	0
+1022	1086	1025	0
+1023	1087	1024	0
+1041	1052	1042	0
+1067	1003	1066	0
+1005	1067	1068	0
+1090	1026	1025	0
+1058	1074	1012	0
+1070	1007	1068	0
+1029	1026	1091	0
+1070	1069	1007	0
+1028	1027	1092	0
+1023	1036	1088	0
+1027	1029	1092	0
+1077	1057	1014	0
+1010	1073	1071	0
+1072	1073	1010	0
+1072	1011	1074	0
+1033	1095	1032	0
+1094	1031	1035	0
+1094	1037	1031	0
+1034	1032	1096	0
+1076	1075	1013	0
+1035	1034	1098	0
+1078	1077	1014	0
+1063	1054	1053	0
+1078	1015	1079	0
+1038	1100	1036	0
+1075	1081	1020	0
+1016	1081	1080	0
+1101	1040	1037	0
+1102	1038	1039	0
+1080	1082	1018	0
+1079	1019	1083	0
+1039	1040	1103	0
+1082	1083	1019	0
+1057	1077	1056	0
+1021	1084	1085	0
+1086	1022	1085	0
+1043	1044	1107	0
+1076	1028	1092	0
+1108	1044	1045	0
+1084	1024	1089	0
+1087	1023	1088	0
+1069	1097	1033	0
+1024	1087	1089	0
+1045	1046	1109	0
+1068	1067	1066	0
+1086	1090	1025	0
+1090	1091	1026	0
+1111	1046	1051	0
+1114	1049	1047	0
+1114	1048	1049	0
+1050	1048	1115	0
+1091	1093	1029	0
+1093	1092	1029	0
+1047	1056	1112	0
+1050	1116	1051	0
+1095	1096	1032	0
+1036	1100	1088	0
+1095	1033	1097	0
+1096	1098	1034	0
+1099	1094	1035	0
+1055	1118	1058	0
+1098	1099	1035	0
+1037	1094	1101	0
+1070	1097	1069	0
+1055	1065	1118	0
+1059	1061	1120	0
+1060	1059	1121	0
+1100	1038	1102	0
+1103	1102	1039	0
+1077	1112	1056	0
+1040	1101	1104	0
+1064	1060	1122	0
+1123	1061	1062	0
+1103	1040	1105	0
+1040	1104	1105	0
+1058	1119	1074	0
+1125	1065	1064	0
+1107	1106	1043	0
+1108	1107	1044	0
+1109	1108	1045	0
+1046	1110	1109	0
+1111	1110	1046	0
+1071	1073	1128	0
+1047	1112	1113	0
+1047	1113	1114	0
+1072	1129	1073	0
+1130	1072	1074	0
+1115	1048	1114	0
+1051	1117	1111	0
+1050	1115	1116	0
+1133	1075	1076	0
+1117	1051	1116	0
+1075	1132	1081	0
+1077	1078	1135	0
+1078	1079	1136	0
+1058	1118	1119	0
+1083	1136	1079	0
+1080	1137	1082	0
+1080	1081	1138	0
+1120	1121	1059	0
+1076	1092	1134	0
+1122	1060	1121	0
+1120	1061	1123	0
+1083	1082	1139	0
+1064	1122	1124	0
+1065	1127	1118	0
+1084	1141	1085	0
+1125	1064	1124	0
+1085	1143	1086	0
+1084	1089	1142	0
+1126	1065	1125	0
+1127	1065	1126	0
+1090	1086	1144	0
+1146	1087	1088	0
+1145	1089	1087	0
+1074	1119	1130	0
+1112	1077	1135	0
+1091	1090	1148	0
+1072	1130	1129	0
+1091	1148	1093	0
+1128	1073	1131	0
+1131	1073	1129	0
+1088	1100	1147	0
+1150	1092	1093	0
+1075	1133	1132	0
+1134	1133	1076	0
+1154	1096	1095	0
+1099	1153	1094	0
+1097	1154	1095	0
+1101	1094	1153	0
+1135	1078	1136	0
+1098	1096	1156	0
+1081	1132	1138	0
+1156	1099	1098	0
+1080	1138	1137	0
+1139	1082	1137	0
+1140	1136	1083	0
+1102	1160	1100	0
+1083	1139	1140	0
+1103	1160	1102	0
+1101	1161	1104	0
+1084	1142	1141	0
+1141	1143	1085	0
+1162	1103	1105	0
+1163	1105	1104	0
+1143	1144	1086	0
+1145	1142	1089	0
+1150	1134	1092	0
+1146	1145	1087	0
+1106	1107	1166	0
+1107	1108	1166	0
+1147	1146	1088	0
+1149	1090	1144	0
+1167	1108	1109	0
+1148	1090	1149	0
+1168	1109	1110	0
+1110	1111	1170	0
+1148	1152	1093	0
+1151	1150	1093	0
+1152	1151	1093	0
+1173	1113	1112	0
+1172	1111	1117	0
+1114	1113	1175	0
+1096	1154	1155	0
+1114	1176	1115	0
+1100	1159	1147	0
+1096	1155	1156	0
+1116	1115	1177	0
+1153	1099	1158	0
+1116	1178	1117	0
+1156	1157	1099	0
+1157	1158	1099	0
+1101	1153	1161	0
+1119	1118	1180	0
+1160	1159	1100	0
+1112	1135	1173	0
+1160	1103	1162	0
+1118	1127	1180	0
+1163	1104	1161	0
+1130	1119	1181	0
+1124	1182	1125	0
+1105	1164	1162	0
+1163	1164	1105	0
+1125	1182	1126	0
+1126	1184	1127	0
+1166	1165	1106	0
+1167	1166	1108	0
+1109	1168	1167	0
+1136	1173	1135	0
+1187	1128	1131	0
+1129	1130	1188	0
+1168	1110	1169	0
+1188	1131	1129	0
+1152	1148	1149	0
+1169	1110	1170	0
+1171	1170	1111	0
+1111	1172	1171	0
+1133	1189	1132	0
+1190	1133	1134	0
+1132	1189	1138	0
+1173	1174	1113	0
+1113	1174	1175	0
+1175	1176	1114	0
+1172	1117	1179	0
+1176	1177	1115	0
+1193	1136	1140	0
+1139	1137	1194	0
+1195	1137	1138	0
+1116	1177	1178	0
+1161	1153	1158	0
+1178	1179	1117	0
+1139	1196	1140	0
+1192	1134	1150	0
+1181	1119	1180	0
+1142	1199	1141	0
+1141	1198	1143	0
+1144	1143	1198	0
+1200	1142	1145	0
+1182	1183	1126	0
+1180	1127	1186	0
+1183	1184	1126	0
+1202	1145	1146	0
+1149	1144	1201	0
+1147	1203	1146	0
+1127	1184	1185	0
+1127	1185	1186	0
+1181	1188	1130	0
+1136	1193	1173	0
+1149	1205	1152	0
+1131	1188	1187	0
+1151	1206	1150	0
+1203	1147	1159	0
+1207	1151	1152	0
+1133	1191	1189	0
+1190	1191	1133	0
+1190	1134	1192	0
+1155	1208	1156	0
+1157	1156	1208	0
+1138	1189	1195	0
+1209	1158	1157	0
+1195	1194	1137	0
+1196	1139	1194	0
+1193	1140	1197	0
+1161	1158	1211	0
+1160	1213	1159	0
+1197	1140	1196	0
+1211	1163	1161	0
+1213	1160	1162	0
+1199	1198	1141	0
+1214	1162	1164	0
+1173	1193	1174	0
+1144	1198	1201	0
+1142	1200	1199	0
+1180	1186	1181	0
+1164	1163	1215	0
+1145	1202	1200	0
+1192	1150	1206	0
+1218	1165	1166	0
+1202	1146	1203	0
+1219	1166	1167	0
+1201	1204	1149	0
+1167	1168	1220	0
+1204	1205	1149	0
+1221	1168	1169	0
+1223	1169	1170	0
+1205	1207	1152	0
+1151	1207	1206	0
+1226	1170	1171	0
+1227	1171	1172	0
+1159	1212	1203	0
+1209	1157	1208	0
+1209	1210	1158	0
+1158	1210	1211	0
+1228	1172	1179	0
+1175	1174	1231	0
+1232	1176	1175	0
+1212	1159	1213	0
+1177	1176	1232	0
+1163	1211	1215	0
+1213	1162	1214	0
+1234	1178	1177	0
+1179	1178	1235	0
+1216	1214	1164	0
+1216	1164	1215	0
+1174	1193	1230	0
+1217	1165	1218	0
+1218	1166	1219	0
+1181	1186	1237	0
+1219	1167	1220	0
+1188	1181	1237	0
+1185	1237	1186	0
+1168	1222	1220	0
+1168	1221	1222	0
+1237	1187	1188	0
+1221	1169	1224	0
+1223	1224	1169	0
+1191	1238	1189	0
+1225	1223	1170	0
+1190	1239	1191	0
+1230	1193	1197	0
+1225	1170	1226	0
+1239	1190	1192	0
+1189	1238	1195	0
+1227	1226	1171	0
+1172	1229	1227	0
+1172	1228	1229	0
+1194	1195	1243	0
+1196	1194	1244	0
+1230	1231	1174	0
+1231	1232	1175	0
+1206	1242	1192	0
+1196	1247	1197	0
+1233	1177	1232	0
+1179	1236	1228	0
+1234	1177	1233	0
+1199	1248	1198	0
+1201	1198	1248	0
+1235	1178	1234	0
+1250	1199	1200	0
+1235	1236	1179	0
+1202	1250	1200	0
+1201	1251	1204	0
+1203	1253	1202	0
+1255	1205	1204	0
+1205	1256	1207	0
+1240	1238	1191	0
+1254	1203	1212	0
+1206	1207	1257	0
+1191	1239	1241	0
+1240	1191	1241	0
+1239	1192	1242	0
+1230	1197	1247	0
+1209	1258	1210	0
+1195	1238	1245	0
+1210	1258	1211	0
+1243	1244	1194	0
+1245	1243	1195	0
+1213	1260	1212	0
+1211	1259	1215	0
+1196	1244	1246	0
+1214	1261	1213	0
+1247	1196	1246	0
+1215	1259	1216	0
+1214	1216	1262	0
+1249	1248	1199	0
+1250	1249	1199	0
+1251	1201	1248	0
+1217	1218	1267	0
+1202	1252	1250	0
+1267	1218	1219	0
+1206	1257	1242	0
+1267	1219	1220	0
+1253	1252	1202	0
+1254	1253	1203	0
+1255	1204	1251	0
+1220	1222	1268	0
+1270	1222	1221	0
+1269	1221	1224	0
+1255	1256	1205	0
+1224	1223	1273	0
+1207	1256	1257	0
+1225	1272	1223	0
+1240	1245	1238	0
+1260	1254	1212	0
+1225	1226	1276	0
+1258	1259	1211	0
+1278	1226	1227	0
+1213	1261	1260	0
+1229	1279	1227	0
+1261	1214	1262	0
+1263	1216	1259	0
+1228	1281	1229	0
+1264	1216	1263	0
+1265	1262	1216	0
+1228	1236	1280	0
+1283	1231	1230	0
+1265	1216	1264	0
+1232	1231	1284	0
+1285	1233	1232	0
+1267	1266	1217	0
+1234	1233	1286	0
+1268	1267	1220	0
+1288	1235	1234	0
+1235	1288	1236	0
+1269	1270	1221	0
+1247	1283	1230	0
+1271	1268	1222	0
+1222	1270	1271	0
+1269	1224	1274	0
+1273	1223	1272	0
+1241	1239	1290	0
+1239	1242	1290	0
+1275	1224	1273	0
+1241	1292	1240	0
+1275	1274	1224	0
+1225	1277	1272	0
+1240	1291	1245	0
+1276	1277	1225	0
+1276	1226	1278	0
+1295	1244	1243	0
+1245	1295	1243	0
+1227	1279	1278	0
+1296	1246	1244	0
+1228	1280	1281	0
+1282	1279	1229	0
+1246	1298	1247	0
+1281	1282	1229	0
+1242	1257	1294	0
+1249	1299	1248	0
+1251	1248	1299	0
+1283	1284	1231	0
+1249	1250	1300	0
+1268	1266	1267	0
+1285	1232	1284	0
+1250	1252	1300	0
+1233	1285	1286	0
+1266	1268	1271	0
+1236	1289	1280	0
+1286	1287	1234	0
+1255	1251	1302	0
+1303	1252	1253	0
+1234	1287	1288	0
+1305	1253	1254	0
+1289	1236	1288	0
+1255	1307	1256	0
+1254	1260	1306	0
+1256	1308	1257	0
+1292	1291	1240	0
+1293	1241	1290	0
+1290	1242	1294	0
+1241	1293	1292	0
+1283	1247	1298	0
+1261	1309	1260	0
+1262	1309	1261	0
+1291	1297	1245	0
+1244	1295	1296	0
+1310	1262	1265	0
+1245	1297	1295	0
+1296	1298	1246	0
+1311	1265	1264	0
+1300	1299	1249	0
+1313	1266	1271	0
+1251	1299	1301	0
+1270	1269	1314	0
+1302	1251	1301	0
+1271	1270	1315	0
+1252	1304	1300	0
+1314	1269	1274	0
+1304	1252	1303	0
+1308	1294	1257	0
+1273	1272	1316	0
+1253	1305	1303	0
+1307	1255	1302	0
+1317	1275	1273	0
+1254	1306	1305	0
+1316	1272	1277	0
+1275	1319	1274	0
+1256	1307	1308	0
+1321	1277	1276	0
+1321	1276	1278	0
+1306	1260	1309	0
+1309	1262	1310	0
+1326	1278	1279	0
+1312	1310	1265	0
+1312	1265	1311	0
+1279	1282	1327	0
+1280	1328	1281	0
+1329	1282	1281	0
+1328	1280	1289	0
+1284	1283	1331	0
+1313	1271	1315	0
+1270	1314	1315	0
+1332	1285	1284	0
+1285	1333	1286	0
+1286	1334	1287	0
+1318	1273	1316	0
+1319	1314	1274	0
+1317	1273	1318	0
+1334	1288	1287	0
+1298	1331	1283	0
+1275	1317	1320	0
+1288	1336	1289	0
+1319	1275	1320	0
+1277	1323	1316	0
+1321	1322	1277	0
+1293	1290	1338	0
+1277	1322	1323	0
+1294	1338	1290	0
+1340	1291	1292	0
+1324	1321	1278	0
+1292	1293	1341	0
+1291	1339	1297	0
+1278	1325	1324	0
+1278	1326	1325	0
+1279	1327	1326	0
+1346	1296	1295	0
+1328	1329	1281	0
+1346	1295	1297	0
+1282	1330	1327	0
+1329	1330	1282	0
+1348	1298	1296	0
+1308	1345	1294	0
+1331	1332	1284	0
+1350	1299	1300	0
+1301	1299	1350	0
+1333	1285	1332	0
+1334	1286	1333	0
+1289	1337	1328	0
+1302	1301	1352	0
+1304	1351	1300	0
+1334	1335	1288	0
+1336	1288	1335	0
+1354	1304	1303	0
+1353	1307	1302	0
+1354	1303	1305	0
+1289	1336	1337	0
+1305	1306	1357	0
+1291	1340	1339	0
+1309	1357	1306	0
+1341	1340	1292	0
+1338	1342	1293	0
+1307	1359	1308	0
+1293	1342	1341	0
+1294	1344	1338	0
+1331	1298	1348	0
+1310	1360	1309	0
+1344	1294	1343	0
+1310	1312	1360	0
+1294	1345	1343	0
+1311	1361	1312	0
+1297	1339	1349	0
+1296	1346	1347	0
+1347	1348	1296	0
+1349	1346	1297	0
+1364	1313	1315	0
+1364	1315	1314	0
+1365	1314	1319	0
+1318	1316	1366	0
+1351	1350	1300	0
+1352	1301	1350	0
+1369	1317	1318	0
+1368	1320	1317	0
+1367	1316	1323	0
+1302	1352	1353	0
+1320	1371	1319	0
+1304	1355	1351	0
+1308	1359	1345	0
+1356	1304	1354	0
+1356	1355	1304	0
+1354	1305	1357	0
+1323	1322	1372	0
+1353	1358	1307	0
+1326	1373	1325	0
+1342	1338	1344	0
+1358	1359	1307	0
+1360	1357	1309	0
+1327	1375	1326	0
+1375	1327	1330	0
+1376	1329	1328	0
+1312	1362	1360	0
+1377	1330	1329	0
+1312	1361	1363	0
+1312	1363	1362	0
+1337	1376	1328	0
+1332	1331	1378	0
+1364	1314	1365	0
+1332	1379	1333	0
+1380	1334	1333	0
+1316	1367	1366	0
+1334	1381	1335	0
+1366	1370	1318	0
+1383	1336	1335	0
+1368	1317	1369	0
+1319	1371	1365	0
+1337	1336	1384	0
+1348	1378	1331	0
+1370	1369	1318	0
+1368	1371	1320	0
+1367	1323	1372	0
+1387	1339	1340	0
+1341	1388	1340	0
+1341	1342	1389	0
+1326	1374	1373	0
+1374	1326	1375	0
+1339	1387	1349	0
+1391	1342	1344	0
+1344	1343	1392	0
+1357	1360	1362	0
+1345	1393	1343	0
+1330	1377	1375	0
+1377	1329	1376	0
+1395	1347	1346	0
+1378	1379	1332	0
+1346	1349	1395	0
+1380	1333	1379	0
+1397	1348	1347	0
+1381	1334	1380	0
+1359	1394	1345	0
+1382	1335	1381	0
+1376	1337	1386	0
+1382	1383	1335	0
+1351	1399	1350	0
+1352	1350	1399	0
+1385	1336	1383	0
+1336	1385	1384	0
+1355	1400	1351	0
+1386	1337	1384	0
+1353	1352	1402	0
+1404	1356	1354	0
+1353	1403	1358	0
+1340	1388	1387	0
+1404	1354	1357	0
+1405	1355	1356	0
+1389	1388	1341	0
+1342	1390	1389	0
+1404	1357	1362	0
+1390	1342	1391	0
+1397	1378	1348	0
+1407	1359	1358	0
+1344	1392	1391	0
+1343	1393	1392	0
+1394	1393	1345	0
+1408	1363	1361	0
+1387	1398	1349	0
+1363	1409	1362	0
+1347	1395	1396	0
+1396	1397	1347	0
+1349	1398	1395	0
+1366	1367	1412	0
+1370	1366	1411	0
+1351	1401	1399	0
+1368	1369	1415	0
+1367	1372	1413	0
+1351	1400	1401	0
+1399	1402	1352	0
+1369	1370	1416	0
+1353	1402	1403	0
+1407	1394	1359	0
+1400	1355	1405	0
+1373	1374	1417	0
+1406	1356	1404	0
+1375	1418	1374	0
+1406	1405	1356	0
+1403	1407	1358	0
+1377	1419	1375	0
+1421	1377	1376	0
+1409	1404	1362	0
+1378	1423	1379	0
+1408	1410	1363	0
+1409	1363	1410	0
+1379	1424	1380	0
+1422	1376	1386	0
+1381	1380	1425	0
+1382	1381	1426	0
+1412	1411	1366	0
+1427	1383	1382	0
+1367	1414	1412	0
+1367	1413	1414	0
+1383	1427	1385	0
+1416	1370	1411	0
+1384	1385	1428	0
+1423	1378	1397	0
+1429	1386	1384	0
+1369	1416	1415	0
+1417	1374	1418	0
+1388	1434	1387	0
+1389	1434	1388	0
+1420	1418	1375	0
+1390	1435	1389	0
+1375	1419	1420	0
+1421	1419	1377	0
+1436	1390	1391	0
+1433	1398	1387	0
+1422	1421	1376	0
+1404	1409	1406	0
+1392	1438	1391	0
+1392	1393	1439	0
+1424	1379	1423	0
+1440	1393	1394	0
+1424	1425	1380	0
+1425	1426	1381	0
+1442	1396	1395	0
+1426	1427	1382	0
+1395	1398	1442	0
+1397	1396	1443	0
+1422	1386	1432	0
+1384	1428	1429	0
+1407	1441	1394	0
+1430	1385	1427	0
+1428	1385	1431	0
+1431	1385	1430	0
+1386	1429	1432	0
+1399	1401	1447	0
+1399	1447	1402	0
+1400	1448	1401	0
+1434	1433	1387	0
+1449	1400	1405	0
+1451	1403	1402	0
+1389	1435	1434	0
+1406	1449	1405	0
+1436	1435	1390	0
+1403	1452	1407	0
+1391	1437	1436	0
+1397	1444	1423	0
+1391	1438	1437	0
+1406	1409	1453	0
+1439	1438	1392	0
+1410	1453	1409	0
+1408	1454	1410	0
+1439	1393	1440	0
+1441	1440	1394	0
+1433	1445	1398	0
+1457	1411	1412	0
+1442	1443	1396	0
+1426	1430	1427	0
+1416	1411	1456	0
+1444	1397	1443	0
+1412	1414	1458	0
+1446	1442	1398	0
+1413	1460	1414	0
+1446	1398	1445	0
+1444	1424	1423	0
+1415	1416	1461	0
+1400	1449	1448	0
+1417	1418	1462	0
+1401	1450	1447	0
+1450	1401	1448	0
+1452	1441	1407	0
+1402	1447	1451	0
+1420	1463	1418	0
+1464	1420	1419	0
+1464	1419	1421	0
+1452	1403	1451	0
+1449	1406	1453	0
+1422	1466	1421	0
+1424	1468	1425	0
+1455	1453	1410	0
+1454	1455	1410	0
+1426	1425	1468	0
+1467	1422	1432	0
+1456	1411	1457	0
+1426	1470	1430	0
+1459	1457	1412	0
+1428	1471	1429	0
+1459	1412	1458	0
+1471	1428	1431	0
+1458	1414	1460	0
+1461	1416	1456	0
+1429	1472	1432	0
+1430	1473	1431	0
+1468	1424	1444	0
+1476	1433	1434	0
+1463	1462	1418	0
+1477	1434	1435	0
+1420	1465	1463	0
+1464	1465	1420	0
+1436	1478	1435	0
+1421	1466	1464	0
+1436	1437	1480	0
+1433	1476	1445	0
+1467	1466	1422	0
+1438	1481	1437	0
+1482	1438	1439	0
+1439	1440	1482	0
+1468	1469	1426	0
+1483	1440	1441	0
+1470	1426	1469	0
+1442	1486	1443	0
+1467	1432	1472	0
+1429	1471	1472	0
+1470	1473	1430	0
+1442	1446	1487	0
+1443	1488	1444	0
+1431	1474	1471	0
+1485	1441	1452	0
+1475	1431	1473	0
+1431	1475	1474	0
+1446	1445	1490	0
+1476	1434	1477	0
+1492	1447	1450	0
+1451	1447	1492	0
+1435	1478	1477	0
+1448	1493	1450	0
+1448	1449	1494	0
+1478	1436	1479	0
+1480	1479	1436	0
+1449	1453	1495	0
+1481	1480	1437	0
+1468	1444	1488	0
+1438	1482	1481	0
+1452	1451	1498	0
+1455	1495	1453	0
+1482	1440	1484	0
+1440	1483	1484	0
+1455	1454	1499	0
+1483	1441	1485	0
+1445	1476	1489	0
+1457	1501	1456	0
+1487	1486	1442	0
+1486	1488	1443	0
+1457	1459	1501	0
+1461	1456	1501	0
+1459	1458	1503	0
+1458	1460	1502	0
+1445	1489	1490	0
+1491	1487	1446	0
+1490	1491	1446	0
+1463	1507	1462	0
+1465	1507	1463	0
+1452	1498	1485	0
+1493	1448	1494	0
+1508	1464	1466	0
+1509	1465	1464	0
+1449	1495	1494	0
+1450	1493	1496	0
+1450	1497	1492	0
+1451	1492	1498	0
+1477	1489	1476	0
+1496	1497	1450	0
+1510	1466	1467	0
+1455	1500	1495	0
+1468	1513	1469	0
+1472	1511	1467	0
+1470	1469	1515	0
+1500	1455	1499	0
+1516	1473	1470	0
+1472	1471	1517	0
+1487	1488	1486	0
+1517	1471	1474	0
+1502	1503	1458	0
+1475	1473	1516	0
+1459	1504	1501	0
+1504	1459	1503	0
+1505	1461	1501	0
+1519	1474	1475	0
+1468	1488	1513	0
+1462	1507	1506	0
+1521	1477	1478	0
+1478	1479	1521	0
+1465	1509	1507	0
+1508	1509	1464	0
+1479	1480	1523	0
+1508	1466	1510	0
+1525	1480	1481	0
+1498	1492	1497	0
+1521	1489	1477	0
+1525	1481	1482	0
+1495	1500	1494	0
+1512	1510	1467	0
+1512	1467	1511	0
+1484	1526	1482	0
+1485	1527	1483	0
+1483	1528	1484	0
+1513	1514	1469	0
+1514	1515	1469	0
+1518	1511	1472	0
+1516	1470	1515	0
+1518	1472	1517	0
+1488	1487	1532	0
+1532	1487	1491	0
+1501	1504	1505	0
+1519	1517	1474	0
+1475	1516	1520	0
+1533	1490	1489	0
+1498	1531	1485	0
+1519	1475	1520	0
+1490	1535	1491	0
+1522	1521	1479	0
+1494	1537	1493	0
+1523	1522	1479	0
+1497	1531	1498	0
+1537	1496	1493	0
+1523	1480	1524	0
+1525	1524	1480	0
+1538	1497	1496	0
+1500	1537	1494	0
+1482	1526	1525	0
+1513	1488	1532	0
+1527	1528	1483	0
+1484	1529	1526	0
+1540	1500	1499	0
+1528	1529	1484	0
+1527	1485	1530	0
+1534	1489	1521	0
+1485	1531	1530	0
+1503	1502	1541	0
+1542	1504	1503	0
+1543	1505	1504	0
+1534	1533	1489	0
+1545	1506	1507	0
+1532	1491	1535	0
+1490	1533	1536	0
+1490	1536	1535	0
+1507	1509	1545	0
+1546	1509	1508	0
+1510	1546	1508	0
+1531	1497	1539	0
+1548	1510	1512	0
+1538	1496	1537	0
+1549	1512	1511	0
+1539	1497	1538	0
+1522	1534	1521	0
+1540	1537	1500	0
+1513	1551	1514	0
+1549	1511	1518	0
+1552	1515	1514	0
+1515	1555	1516	0
+1541	1542	1503	0
+1542	1543	1504	0
+1516	1555	1520	0
+1519	1556	1517	0
+1517	1557	1518	0
+1544	1506	1545	0
+1513	1532	1551	0
+1558	1519	1520	0
+1547	1545	1509	0
+1546	1547	1509	0
+1548	1546	1510	0
+1522	1523	1561	0
+1523	1524	1562	0
+1548	1512	1550	0
+1549	1550	1512	0
+1525	1563	1524	0
+1560	1534	1522	0
+1526	1566	1525	0
+1514	1551	1553	0
+1552	1514	1553	0
+1515	1552	1554	0
+1567	1526	1529	0
+1568	1528	1527	0
+1515	1554	1555	0
+1557	1549	1518	0
+1568	1527	1530	0
+1568	1529	1528	0
+1517	1556	1557	0
+1558	1556	1519	0
+1530	1531	1572	0
+1555	1559	1520	0
+1558	1520	1559	0
+1573	1532	1535	0
+1534	1574	1533	0
+1572	1531	1539	0
+1574	1536	1533	0
+1522	1561	1560	0
+1523	1562	1561	0
+1536	1576	1535	0
+1565	1562	1524	0
+1563	1564	1524	0
+1537	1578	1538	0
+1565	1524	1564	0
+1563	1525	1566	0
+1578	1537	1540	0
+1579	1539	1538	0
+1532	1573	1551	0
+1526	1567	1566	0
+1541	1582	1542	0
+1567	1529	1570	0
+1569	1529	1568	0
+1570	1529	1569	0
+1542	1583	1543	0
+1534	1560	1575	0
+1530	1571	1568	0
+1572	1571	1530	0
+1545	1585	1544	0
+1545	1547	1585	0
+1573	1553	1551	0
+1547	1546	1587	0
+1548	1586	1546	0
+1534	1575	1574	0
+1576	1573	1535	0
+1548	1550	1588	0
+1574	1577	1536	0
+1550	1549	1589	0
+1577	1576	1536	0
+1579	1572	1539	0
+1549	1557	1590	0
+1578	1580	1538	0
+1580	1579	1538	0
+1553	1592	1552	0
+1554	1552	1592	0
+1581	1578	1540	0
+1555	1554	1594	0
+1583	1542	1582	0
+1594	1559	1555	0
+1556	1596	1557	0
+1558	1596	1556	0
+1585	1584	1544	0
+1558	1559	1597	0
+1546	1586	1587	0
+1573	1593	1553	0
+1585	1547	1587	0
+1586	1548	1588	0
+1602	1560	1561	0
+1562	1604	1561	0
+1589	1549	1590	0
+1550	1591	1588	0
+1591	1550	1589	0
+1562	1565	1604	0
+1563	1605	1564	0
+1605	1563	1566	0
+1601	1575	1560	0
+1607	1565	1564	0
+1593	1592	1553	0
+1580	1578	1581	0
+1554	1592	1595	0
+1566	1567	1609	0
+1554	1595	1594	0
+1557	1596	1590	0
+1570	1609	1567	0
+1610	1569	1568	0
+1610	1568	1571	0
+1570	1569	1611	0
+1601	1574	1575	0
+1598	1558	1597	0
+1594	1600	1559	0
+1599	1596	1558	0
+1599	1558	1598	0
+1559	1600	1597	0
+1571	1572	1615	0
+1601	1560	1602	0
+1616	1573	1576	0
+1615	1572	1579	0
+1561	1603	1602	0
+1603	1561	1604	0
+1574	1617	1577	0
+1576	1577	1618	0
+1580	1615	1579	0
+1605	1606	1564	0
+1564	1606	1607	0
+1604	1565	1608	0
+1607	1608	1565	0
+1566	1609	1605	0
+1581	1620	1580	0
+1573	1616	1593	0
+1590	1596	1599	0
+1622	1583	1582	0
+1610	1611	1569	0
+1570	1612	1609	0
+1574	1601	1617	0
+1585	1624	1584	0
+1613	1570	1611	0
+1614	1610	1571	0
+1570	1613	1612	0
+1587	1625	1585	0
+1587	1586	1626	0
+1615	1614	1571	0
+1588	1626	1586	0
+1628	1588	1591	0
+1630	1589	1590	0
+1591	1589	1630	0
+1618	1616	1576	0
+1577	1617	1619	0
+1619	1618	1577	0
+1580	1621	1615	0
+1592	1593	1633	0
+1592	1633	1595	0
+1590	1599	1631	0
+1580	1620	1621	0
+1635	1594	1595	0
+1635	1600	1594	0
+1584	1624	1623	0
+1639	1598	1597	0
+1625	1624	1585	0
+1600	1639	1597	0
+1598	1640	1599	0
+1625	1587	1627	0
+1627	1587	1626	0
+1593	1616	1634	0
+1588	1629	1626	0
+1588	1628	1629	0
+1643	1601	1602	0
+1603	1644	1602	0
+1614	1615	1621	0
+1632	1628	1591	0
+1590	1631	1630	0
+1645	1603	1604	0
+1591	1630	1632	0
+1645	1604	1608	0
+1605	1647	1606	0
+1633	1593	1634	0
+1648	1607	1606	0
+1609	1647	1605	0
+1601	1643	1617	0
+1649	1608	1607	0
+1595	1633	1637	0
+1618	1634	1616	0
+1595	1637	1636	0
+1635	1595	1638	0
+1647	1609	1612	0
+1636	1638	1595	0
+1640	1631	1599	0
+1610	1652	1611	0
+1651	1610	1614	0
+1613	1611	1652	0
+1600	1635	1642	0
+1598	1639	1641	0
+1653	1612	1613	0
+1617	1643	1619	0
+1598	1641	1640	0
+1600	1642	1639	0
+1643	1602	1644	0
+1621	1656	1614	0
+1630	1631	1632	0
+1646	1644	1603	0
+1645	1646	1603	0
+1618	1619	1657	0
+1620	1656	1621	0
+1647	1648	1606	0
+1608	1650	1645	0
+1633	1634	1637	0
+1607	1648	1649	0
+1623	1624	1660	0
+1649	1650	1608	0
+1660	1624	1625	0
+1634	1618	1657	0
+1653	1647	1612	0
+1660	1625	1627	0
+1610	1651	1652	0
+1626	1661	1627	0
+1661	1626	1629	0
+1652	1655	1613	0
+1619	1643	1658	0
+1613	1654	1653	0
+1656	1651	1614	0
+1629	1628	1664	0
+1654	1613	1655	0
+1664	1628	1632	0
+1632	1631	1666	0
+1619	1658	1657	0
+1640	1667	1631	0
+1670	1637	1634	0
+1659	1623	1660	0
+1635	1638	1671	0
+1644	1658	1643	0
+1637	1672	1636	0
+1636	1673	1638	0
+1635	1671	1642	0
+1647	1653	1648	0
+1660	1627	1662	0
+1663	1627	1661	0
+1662	1627	1663	0
+1661	1629	1665	0
+1639	1675	1641	0
+1639	1642	1675	0
+1676	1640	1641	0
+1665	1629	1664	0
+1634	1657	1670	0
+1667	1666	1631	0
+1669	1664	1632	0
+1666	1668	1632	0
+1679	1644	1646	0
+1669	1632	1668	0
+1645	1681	1646	0
+1645	1650	1681	0
+1672	1637	1670	0
+1673	1636	1672	0
+1658	1644	1680	0
+1676	1667	1640	0
+1648	1686	1649	0
+1671	1638	1674	0
+1638	1673	1674	0
+1648	1653	1685	0
+1687	1650	1649	0
+1642	1671	1675	0
+1661	1665	1663	0
+1651	1689	1652	0
+1685	1653	1654	0
+1677	1641	1675	0
+1678	1676	1641	0
+1656	1689	1651	0
+1677	1678	1641	0
+1652	1689	1655	0
+1644	1679	1680	0
+1657	1658	1690	0
+1646	1684	1679	0
+1646	1681	1683	0
+1660	1692	1659	0
+1646	1683	1682	0
+1684	1646	1682	0
+1662	1692	1660	0
+1670	1657	1690	0
+1694	1662	1663	0
+1688	1681	1650	0
+1648	1685	1686	0
+1687	1649	1686	0
+1665	1695	1663	0
+1664	1696	1665	0
+1650	1687	1688	0
+1658	1680	1690	0
+1669	1696	1664	0
+1666	1667	1697	0
+1666	1698	1668	0
+1669	1668	1700	0
+1667	1676	1699	0
+1659	1692	1691	0
+1670	1703	1672	0
+1693	1692	1662	0
+1703	1673	1672	0
+1694	1693	1662	0
+1671	1674	1704	0
+1671	1704	1675	0
+1694	1663	1695	0
+1673	1705	1674	0
+1683	1681	1688	0
+1704	1677	1675	0
+1695	1665	1696	0
+1697	1698	1666	0
+1702	1670	1690	0
+1707	1676	1678	0
+1667	1699	1697	0
+1677	1708	1678	0
+1669	1701	1696	0
+1668	1698	1700	0
+1680	1679	1710	0
+1700	1701	1669	0
+1679	1684	1710	0
+1670	1702	1703	0
+1692	1693	1691	0
+1712	1682	1683	0
+1682	1712	1684	0
+1680	1711	1690	0
+1705	1673	1703	0
+1676	1707	1699	0
+1688	1713	1683	0
+1704	1674	1706	0
+1706	1674	1705	0
+1687	1713	1688	0
+1704	1708	1677	0
+1678	1709	1707	0
+1708	1709	1678	0
+1691	1693	1716	0
+1711	1680	1710	0
+1702	1690	1711	0
+1694	1717	1693	0
+1694	1695	1718	0
+1683	1713	1712	0
+1684	1715	1710	0
+1714	1684	1712	0
+1695	1696	1720	0
+1714	1715	1684	0
+1698	1697	1721	0
+1721	1697	1699	0
+1696	1701	1720	0
+1722	1700	1698	0
+1725	1701	1700	0
+1693	1717	1716	0
+1717	1694	1718	0
+1699	1707	1724	0
+1718	1695	1719	0
+1702	1727	1703	0
+1720	1719	1695	0
+1730	1705	1703	0
+1706	1705	1730	0
+1711	1728	1702	0
+1721	1722	1698	0
+1732	1704	1706	0
+1731	1708	1704	0
+1699	1723	1721	0
+1723	1699	1724	0
+1725	1700	1722	0
+1701	1726	1720	0
+1710	1728	1711	0
+1733	1707	1709	0
+1709	1708	1734	0
+1701	1725	1726	0
+1729	1727	1702	0
+1728	1729	1702	0
+1730	1703	1727	0
+1715	1736	1710	0
+1733	1724	1707	0
+1737	1715	1714	0
+1731	1704	1732	0
+1730	1732	1706	0
+1716	1717	1739	0
+1708	1731	1734	0
+1728	1710	1736	0
+1718	1740	1717	0
+1735	1733	1709	0
+1735	1709	1734	0
+1719	1742	1718	0
+1720	1743	1719	0
+1721	1744	1722	0
+1744	1721	1723	0
+1736	1715	1737	0
+1743	1720	1726	0
+1725	1722	1745	0
+1738	1716	1739	0
+1723	1724	1746	0
+1741	1739	1717	0
+1741	1717	1740	0
+1748	1726	1725	0
+1740	1718	1742	0
+1743	1742	1719	0
+1733	1747	1724	0
+1729	1750	1727	0
+1750	1730	1727	0
+1728	1751	1729	0
+1744	1745	1722	0
+1744	1723	1746	0
+1733	1735	1747	0
+1751	1728	1736	0
+1730	1753	1732	0
+1747	1746	1724	0
+1732	1754	1731	0
+1749	1743	1726	0
+1745	1748	1725	0
+1731	1754	1734	0
+1748	1749	1726	0
+1734	1756	1735	0
+1736	1737	1757	0
+1752	1750	1729	0
+1729	1751	1752	0
+1750	1753	1730	0
+1745	1744	1746	0
+1739	1759	1738	0
+1759	1739	1741	0
+1753	1755	1732	0
+1740	1760	1741	0
+1732	1755	1754	0
+1761	1740	1742	0
+1734	1754	1756	0
+1736	1757	1751	0
+1764	1742	1743	0
+1759	1758	1738	0
+1764	1743	1749	0
+1752	1751	1757	0
+1761	1760	1740	0
+1763	1759	1741	0
+1762	1741	1760	0
+1763	1741	1762	0
+1764	1761	1742	0
+1752	1765	1750	0
+1750	1765	1753	0
+1755	1753	1765	0
+1767	1758	1759	0
+1763	1767	1759	0
+1767	1766	1758	0
+1762	1768	1763	0
+1763	1769	1767	0
+1768	1769	1763	0
+1767	1771	1766	0
+1766	1771	1770	0
+1767	1769	1771	0
+1768	1772	1769	0
+1769	1773	1771	0
+1773	1770	1771	0
+1769	1772	1773	0
+1773	1774	1770	0
+1772	1775	1773	0
+1774	1773	1776	0
+1775	1776	1773	0
+1777	1774	1776	0
+1775	1778	1776	0
+1777	1776	1779	0
+1778	1779	1776	0
+1780	1777	1779	0
+2
+49.999999992680472	7.2978690474119403e-09
+0	-7.2978690969015252e-09
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cfemm/esolver/esolver.cpp" "esolver/CMakeFiles/esolver.dir/esolver.cpp.o" "gcc" "esolver/CMakeFiles/esolver.dir/esolver.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/cfemm/_asan/libfemm/CMakeFiles/femm.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/libfemm/CMakeFiles/luacomplex.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
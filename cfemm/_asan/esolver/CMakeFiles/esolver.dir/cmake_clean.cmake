@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/esolver.dir/esolver.cpp.o"
+  "CMakeFiles/esolver.dir/esolver.cpp.o.d"
+  "libesolver.a"
+  "libesolver.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/esolver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
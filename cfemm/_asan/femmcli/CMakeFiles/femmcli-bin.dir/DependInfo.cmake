@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cfemm/femmcli/main.cpp" "femmcli/CMakeFiles/femmcli-bin.dir/main.cpp.o" "gcc" "femmcli/CMakeFiles/femmcli-bin.dir/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/cfemm/_asan/femmcli/CMakeFiles/femmcli.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/fmesher/CMakeFiles/fmesher.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/fmesher/CMakeFiles/triangle.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/esolver/CMakeFiles/esolver.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/epproc/CMakeFiles/epproc.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/fsolver/CMakeFiles/fsolver.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/fpproc/CMakeFiles/fpproc.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/hsolver/CMakeFiles/hsolver.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/hpproc/CMakeFiles/hpproc.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/libfemm/CMakeFiles/femm.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/libfemm/CMakeFiles/luacomplex.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cfemm/femmcli/FemmState.cpp" "femmcli/CMakeFiles/femmcli.dir/FemmState.cpp.o" "gcc" "femmcli/CMakeFiles/femmcli.dir/FemmState.cpp.o.d"
+  "/root/repo/cfemm/femmcli/LuaBaseCommands.cpp" "femmcli/CMakeFiles/femmcli.dir/LuaBaseCommands.cpp.o" "gcc" "femmcli/CMakeFiles/femmcli.dir/LuaBaseCommands.cpp.o.d"
+  "/root/repo/cfemm/femmcli/LuaCommonCommands.cpp" "femmcli/CMakeFiles/femmcli.dir/LuaCommonCommands.cpp.o" "gcc" "femmcli/CMakeFiles/femmcli.dir/LuaCommonCommands.cpp.o.d"
+  "/root/repo/cfemm/femmcli/LuaElectrostaticsCommands.cpp" "femmcli/CMakeFiles/femmcli.dir/LuaElectrostaticsCommands.cpp.o" "gcc" "femmcli/CMakeFiles/femmcli.dir/LuaElectrostaticsCommands.cpp.o.d"
+  "/root/repo/cfemm/femmcli/LuaHeatflowCommands.cpp" "femmcli/CMakeFiles/femmcli.dir/LuaHeatflowCommands.cpp.o" "gcc" "femmcli/CMakeFiles/femmcli.dir/LuaHeatflowCommands.cpp.o.d"
+  "/root/repo/cfemm/femmcli/LuaMagneticsCommands.cpp" "femmcli/CMakeFiles/femmcli.dir/LuaMagneticsCommands.cpp.o" "gcc" "femmcli/CMakeFiles/femmcli.dir/LuaMagneticsCommands.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/cfemm/_asan/libfemm/CMakeFiles/femm.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/fmesher/CMakeFiles/fmesher.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/esolver/CMakeFiles/esolver.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/epproc/CMakeFiles/epproc.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/fsolver/CMakeFiles/fsolver.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/fpproc/CMakeFiles/fpproc.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/hsolver/CMakeFiles/hsolver.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/hpproc/CMakeFiles/hpproc.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/fmesher/CMakeFiles/triangle.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/libfemm/CMakeFiles/luacomplex.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
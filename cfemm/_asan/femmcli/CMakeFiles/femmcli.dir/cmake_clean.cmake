@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/femmcli.dir/FemmState.cpp.o"
+  "CMakeFiles/femmcli.dir/FemmState.cpp.o.d"
+  "CMakeFiles/femmcli.dir/LuaBaseCommands.cpp.o"
+  "CMakeFiles/femmcli.dir/LuaBaseCommands.cpp.o.d"
+  "CMakeFiles/femmcli.dir/LuaCommonCommands.cpp.o"
+  "CMakeFiles/femmcli.dir/LuaCommonCommands.cpp.o.d"
+  "CMakeFiles/femmcli.dir/LuaElectrostaticsCommands.cpp.o"
+  "CMakeFiles/femmcli.dir/LuaElectrostaticsCommands.cpp.o.d"
+  "CMakeFiles/femmcli.dir/LuaHeatflowCommands.cpp.o"
+  "CMakeFiles/femmcli.dir/LuaHeatflowCommands.cpp.o.d"
+  "CMakeFiles/femmcli.dir/LuaMagneticsCommands.cpp.o"
+  "CMakeFiles/femmcli.dir/LuaMagneticsCommands.cpp.o.d"
+  "libfemmcli.a"
+  "libfemmcli.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/femmcli.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
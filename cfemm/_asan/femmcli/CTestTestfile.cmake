@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/cfemm/femmcli
+# Build directory: /root/repo/cfemm/_asan/femmcli
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("test")
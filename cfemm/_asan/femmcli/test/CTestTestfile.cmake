@@ -0,0 +1,76 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/cfemm/femmcli/test
+# Build directory: /root/repo/cfemm/_asan/femmcli/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(femmcli_chdir.lua "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_chdir.lua")
+set_tests_properties(femmcli_chdir.lua PROPERTIES  LABELS "lua;" WORKING_DIRECTORY "/root/repo/cfemm/femmcli/test" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;19;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;65;test_lua;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_compatmode.lua "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_compatmode.lua")
+set_tests_properties(femmcli_compatmode.lua PROPERTIES  LABELS "lua;" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;19;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;66;test_lua;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_complex.lua "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_complex.lua")
+set_tests_properties(femmcli_complex.lua PROPERTIES  LABELS "lua;" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;19;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;67;test_lua;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_pureLua.lua "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_pureLua.lua")
+set_tests_properties(femmcli_pureLua.lua PROPERTIES  LABELS "lua;" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;19;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;68;test_lua;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_trace.lua "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_trace.lua")
+set_tests_properties(femmcli_trace.lua PROPERTIES  LABELS "lua;" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;19;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;69;test_lua;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_luaparam.lua "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_luaparam.lua" "--lua-cache-dir" "/root/repo/cfemm/_asan/femmcli/test" "--lua-param" "turns=100" "--lua-param=current=-2.5" "--lua-param" "circuit=coil" "--lua-param" "label=a=b" "--lua-param" "empty=")
+set_tests_properties(femmcli_luaparam.lua PROPERTIES  LABELS "lua;" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;19;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;72;test_lua;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_luaparam.cached "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_luaparam.lua" "--lua-cache-dir" "/root/repo/cfemm/_asan/femmcli/test" "--lua-param" "turns=100" "--lua-param=current=-2.5" "--lua-param" "circuit=coil" "--lua-param" "label=a=b" "--lua-param" "empty=")
+set_tests_properties(femmcli_luaparam.cached PROPERTIES  DEPENDS "femmcli_luaparam.lua" LABELS "lua" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;74;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_femfile.lua "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_femfile.lua")
+set_tests_properties(femmcli_femfile.lua PROPERTIES  LABELS "lua;magnetics;solver" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;19;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;80;test_lua;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_femfile.check.ans "/usr/bin/cmake" "-E" "compare_files" "femmcli_femfile.result.ans" "femmcli_femfile.result.ans.check")
+set_tests_properties(femmcli_femfile.check.ans PROPERTIES  DEPENDS "femmcli_femfile.lua" DISABLED "TRUE" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;51;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;82;test_lua_check;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_femfile.check.fem "/usr/bin/cmake" "-E" "compare_files" "femmcli_femfile.result.fem" "femmcli_femfile.result.fem.check")
+set_tests_properties(femmcli_femfile.check.fem PROPERTIES  DEPENDS "femmcli_femfile.lua" DISABLED "TRUE" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;51;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;83;test_lua_check;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_fpproc.lua "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_fpproc.lua")
+set_tests_properties(femmcli_fpproc.lua PROPERTIES  LABELS "lua;magnetics;postprocessor" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;19;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;84;test_lua;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_matlib.lua "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_matlib.lua")
+set_tests_properties(femmcli_matlib.lua PROPERTIES  LABELS "lua;magnetics" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;19;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;86;test_lua;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_matlib.check.fem "/usr/bin/cmake" "-E" "compare_files" "femmcli_matlib.result.fem" "femmcli_matlib.result.fem.check")
+set_tests_properties(femmcli_matlib.check.fem PROPERTIES  DEPENDS "femmcli_matlib.lua" DISABLED "TRUE" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;51;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;87;test_lua_check;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_matlibcache.lua "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_matlibcache.lua" "--lua-base-dir" "/root/repo/cfemm/_asan/femmcli/test")
+set_tests_properties(femmcli_matlibcache.lua PROPERTIES  LABELS "lua;magnetics" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;19;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;89;test_lua;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_TorqueBenchmark.lua "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_TorqueBenchmark.lua")
+set_tests_properties(femmcli_TorqueBenchmark.lua PROPERTIES  LABELS "lua;magnetics;postprocessor;fromWiki" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;19;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;90;test_lua;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_antiperiodicBC_flux.lua "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_antiperiodicBC_flux.lua")
+set_tests_properties(femmcli_antiperiodicBC_flux.lua PROPERTIES  LABELS "lua;magnetics;postprocessor" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;19;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;92;test_lua;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_antiperiodicBC_AGE_TorqueBenchmark.lua "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_antiperiodicBC_AGE_TorqueBenchmark.lua")
+set_tests_properties(femmcli_antiperiodicBC_AGE_TorqueBenchmark.lua PROPERTIES  LABELS "lua;magnetics;postprocessor;fromWiki" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;19;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;94;test_lua;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_adaptive.lua "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_adaptive.lua")
+set_tests_properties(femmcli_adaptive.lua PROPERTIES  LABELS "lua;magnetics;solver" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;19;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;96;test_lua;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_harmonic.lua "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_harmonic.lua")
+set_tests_properties(femmcli_harmonic.lua PROPERTIES  LABELS "lua;magnetics;solver" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;19;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;98;test_lua;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_bhcache.clean "/usr/bin/cmake" "-E" "remove_directory" "/root/repo/cfemm/_asan/femmcli/test/bhcache")
+set_tests_properties(femmcli_bhcache.clean PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;101;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_bhcache.mkdir "/usr/bin/cmake" "-E" "make_directory" "/root/repo/cfemm/_asan/femmcli/test/bhcache")
+set_tests_properties(femmcli_bhcache.mkdir PROPERTIES  DEPENDS "femmcli_bhcache.clean" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;102;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_bhcache.lua "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_bhcache.lua" "--bh-cache-dir" "/root/repo/cfemm/_asan/femmcli/test/bhcache" "--lua-param" "pass=1")
+set_tests_properties(femmcli_bhcache.lua PROPERTIES  DEPENDS "femmcli_bhcache.mkdir" LABELS "lua;magnetics;solver" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;19;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;104;test_lua;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_bhcache.cached "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_bhcache.lua" "--bh-cache-dir" "/root/repo/cfemm/_asan/femmcli/test/bhcache" "--lua-param" "pass=2")
+set_tests_properties(femmcli_bhcache.cached PROPERTIES  DEPENDS "femmcli_bhcache.lua" LABELS "lua;magnetics;solver" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;107;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_stresstensor.lua "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_stresstensor.lua")
+set_tests_properties(femmcli_stresstensor.lua PROPERTIES  LABELS "lua;magnetics;postprocessor" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;19;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;111;test_lua;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_stats.lua "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_stats.lua")
+set_tests_properties(femmcli_stats.lua PROPERTIES  LABELS "lua;magnetics;solver;postprocessor" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;19;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;112;test_lua;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_solutions.lua "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_solutions.lua")
+set_tests_properties(femmcli_solutions.lua PROPERTIES  LABELS "lua;magnetics;postprocessor" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;19;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;113;test_lua;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_inductance.lua "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_inductance.lua")
+set_tests_properties(femmcli_inductance.lua PROPERTIES  LABELS "lua;magnetics;solver;postprocessor" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;19;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;114;test_lua;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_sweep.lua "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_sweep.lua")
+set_tests_properties(femmcli_sweep.lua PROPERTIES  LABELS "lua;magnetics;solver;postprocessor" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;19;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;115;test_lua;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_previous.lua "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_previous.lua")
+set_tests_properties(femmcli_previous.lua PROPERTIES  LABELS "lua;magnetics;solver;postprocessor" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;19;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;116;test_lua;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_kernels.scalar "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_kernels.lua")
+set_tests_properties(femmcli_kernels.scalar PROPERTIES  ENVIRONMENT "XFEMM_ASSEMBLY_KERNEL=scalar" LABELS "lua;magnetics;solver" WORKING_DIRECTORY "/root/repo/cfemm/_asan/femmcli/test/kernel_scalar" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;126;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_kernels.default "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_kernels.lua")
+set_tests_properties(femmcli_kernels.default PROPERTIES  ENVIRONMENT "XFEMM_ASSEMBLY_KERNEL=" LABELS "lua;magnetics;solver" WORKING_DIRECTORY "/root/repo/cfemm/_asan/femmcli/test/kernel_default" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;126;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_kernels.compare.femmcli_kernels.ans "/usr/bin/cmake" "-E" "compare_files" "kernel_scalar/femmcli_kernels.ans" "kernel_default/femmcli_kernels.ans")
+set_tests_properties(femmcli_kernels.compare.femmcli_kernels.ans PROPERTIES  DEPENDS "femmcli_kernels.scalar;femmcli_kernels.default" LABELS "magnetics;solver" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;133;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_kernels.compare.femmcli_kernels_incremental.ans "/usr/bin/cmake" "-E" "compare_files" "kernel_scalar/femmcli_kernels_incremental.ans" "kernel_default/femmcli_kernels_incremental.ans")
+set_tests_properties(femmcli_kernels.compare.femmcli_kernels_incremental.ans PROPERTIES  DEPENDS "femmcli_kernels.scalar;femmcli_kernels.default" LABELS "magnetics;solver" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;133;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_epproc.lua "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_epproc.lua")
+set_tests_properties(femmcli_epproc.lua PROPERTIES  LABELS "lua;electrostatics;postprocessor" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;19;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;140;test_lua;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
+add_test(femmcli_hpproc.lua "/root/repo/cfemm/bin/femmcli" "--lua-base-dir" "/root/repo/cfemm/femmcli/test/../debug" "--lua-script" "/root/repo/cfemm/femmcli/test/femmcli_hpproc.lua")
+set_tests_properties(femmcli_hpproc.lua PROPERTIES  LABELS "lua;heatflow;postprocessor" _BACKTRACE_TRIPLES "/root/repo/cfemm/femmcli/test/CMakeLists.txt;19;add_test;/root/repo/cfemm/femmcli/test/CMakeLists.txt;144;test_lua;/root/repo/cfemm/femmcli/test/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/cfemm/bin/fmesher"
+  "/root/repo/cfemm/bin/fmesher.pdb"
+  "CMakeFiles/fmesher-bin.dir/main.cpp.o"
+  "CMakeFiles/fmesher-bin.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fmesher-bin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
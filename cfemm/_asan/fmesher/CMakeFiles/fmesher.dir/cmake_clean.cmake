@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fmesher.dir/fmesher.cpp.o"
+  "CMakeFiles/fmesher.dir/fmesher.cpp.o.d"
+  "CMakeFiles/fmesher.dir/nosebl.cpp.o"
+  "CMakeFiles/fmesher.dir/nosebl.cpp.o.d"
+  "CMakeFiles/fmesher.dir/writepoly.cpp.o"
+  "CMakeFiles/fmesher.dir/writepoly.cpp.o.d"
+  "libfmesher.a"
+  "libfmesher.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fmesher.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
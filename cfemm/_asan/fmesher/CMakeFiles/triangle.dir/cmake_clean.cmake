@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/triangle.dir/triangle/triangle.c.o"
+  "CMakeFiles/triangle.dir/triangle/triangle.c.o.d"
+  "libtriangle.a"
+  "libtriangle.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/triangle.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
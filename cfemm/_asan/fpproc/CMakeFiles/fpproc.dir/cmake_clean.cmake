@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fpproc.dir/CMPointVals.cpp.o"
+  "CMakeFiles/fpproc.dir/CMPointVals.cpp.o.d"
+  "CMakeFiles/fpproc.dir/CPostProcMElement.cpp.o"
+  "CMakeFiles/fpproc.dir/CPostProcMElement.cpp.o.d"
+  "CMakeFiles/fpproc.dir/fpproc.cpp.o"
+  "CMakeFiles/fpproc.dir/fpproc.cpp.o.d"
+  "CMakeFiles/fpproc.dir/makemask.cpp.o"
+  "CMakeFiles/fpproc.dir/makemask.cpp.o.d"
+  "libfpproc.a"
+  "libfpproc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fpproc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
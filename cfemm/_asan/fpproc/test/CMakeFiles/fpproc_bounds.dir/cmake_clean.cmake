@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/cfemm/bin/fpproc_bounds"
+  "/root/repo/cfemm/bin/fpproc_bounds.pdb"
+  "CMakeFiles/fpproc_bounds.dir/fpproc_bounds.cpp.o"
+  "CMakeFiles/fpproc_bounds.dir/fpproc_bounds.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fpproc_bounds.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
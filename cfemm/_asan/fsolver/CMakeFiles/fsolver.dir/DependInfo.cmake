@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cfemm/fsolver/fsolver.cpp" "fsolver/CMakeFiles/fsolver.dir/fsolver.cpp.o" "gcc" "fsolver/CMakeFiles/fsolver.dir/fsolver.cpp.o.d"
+  "/root/repo/cfemm/fsolver/harmonic2d.cpp" "fsolver/CMakeFiles/fsolver.dir/harmonic2d.cpp.o" "gcc" "fsolver/CMakeFiles/fsolver.dir/harmonic2d.cpp.o.d"
+  "/root/repo/cfemm/fsolver/harmonicaxi.cpp" "fsolver/CMakeFiles/fsolver.dir/harmonicaxi.cpp.o" "gcc" "fsolver/CMakeFiles/fsolver.dir/harmonicaxi.cpp.o.d"
+  "/root/repo/cfemm/fsolver/inductance.cpp" "fsolver/CMakeFiles/fsolver.dir/inductance.cpp.o" "gcc" "fsolver/CMakeFiles/fsolver.dir/inductance.cpp.o.d"
+  "/root/repo/cfemm/fsolver/static2d.cpp" "fsolver/CMakeFiles/fsolver.dir/static2d.cpp.o" "gcc" "fsolver/CMakeFiles/fsolver.dir/static2d.cpp.o.d"
+  "/root/repo/cfemm/fsolver/staticaxi.cpp" "fsolver/CMakeFiles/fsolver.dir/staticaxi.cpp.o" "gcc" "fsolver/CMakeFiles/fsolver.dir/staticaxi.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/cfemm/_asan/libfemm/CMakeFiles/femm.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/libfemm/CMakeFiles/luacomplex.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fsolver.dir/fsolver.cpp.o"
+  "CMakeFiles/fsolver.dir/fsolver.cpp.o.d"
+  "CMakeFiles/fsolver.dir/harmonic2d.cpp.o"
+  "CMakeFiles/fsolver.dir/harmonic2d.cpp.o.d"
+  "CMakeFiles/fsolver.dir/harmonicaxi.cpp.o"
+  "CMakeFiles/fsolver.dir/harmonicaxi.cpp.o.d"
+  "CMakeFiles/fsolver.dir/inductance.cpp.o"
+  "CMakeFiles/fsolver.dir/inductance.cpp.o.d"
+  "CMakeFiles/fsolver.dir/static2d.cpp.o"
+  "CMakeFiles/fsolver.dir/static2d.cpp.o.d"
+  "CMakeFiles/fsolver.dir/staticaxi.cpp.o"
+  "CMakeFiles/fsolver.dir/staticaxi.cpp.o.d"
+  "libfsolver.a"
+  "libfsolver.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fsolver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/cfemm/bin/hpproc-test"
+  "/root/repo/cfemm/bin/hpproc-test.pdb"
+  "CMakeFiles/hpproc-test.dir/main.cpp.o"
+  "CMakeFiles/hpproc-test.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpproc-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
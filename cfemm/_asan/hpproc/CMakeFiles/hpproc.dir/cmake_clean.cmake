@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hpproc.dir/CHPointVals.cpp.o"
+  "CMakeFiles/hpproc.dir/CHPointVals.cpp.o.d"
+  "CMakeFiles/hpproc.dir/hpproc.cpp.o"
+  "CMakeFiles/hpproc.dir/hpproc.cpp.o.d"
+  "libhpproc.a"
+  "libhpproc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hpproc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/cfemm/hpproc/test
+# Build directory: /root/repo/cfemm/_asan/hpproc/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(hpproc_Temp0 "/root/repo/cfemm/bin/hpproc-test" "Temp0.anh" "Temp0.out")
+set_tests_properties(hpproc_Temp0 PROPERTIES  LABELS "heatflow;postprocessor" _BACKTRACE_TRIPLES "/root/repo/cfemm/hpproc/test/CMakeLists.txt;13;add_test;/root/repo/cfemm/hpproc/test/CMakeLists.txt;30;test_hpproc;/root/repo/cfemm/hpproc/test/CMakeLists.txt;0;")
+add_test(hpproc_Temp0.out.check "/usr/bin/cmake" "-E" "compare_files" "Temp0.out" "Temp0.out.check")
+set_tests_properties(hpproc_Temp0.out.check PROPERTIES  DEPENDS "hpproc_Temp0" LABELS "heatflow" _BACKTRACE_TRIPLES "/root/repo/cfemm/hpproc/test/CMakeLists.txt;20;add_test;/root/repo/cfemm/hpproc/test/CMakeLists.txt;30;test_hpproc;/root/repo/cfemm/hpproc/test/CMakeLists.txt;0;")
+add_test(hpproc_Temp1 "/root/repo/cfemm/bin/hpproc-test" "Temp1.anh" "Temp1.out")
+set_tests_properties(hpproc_Temp1 PROPERTIES  LABELS "heatflow;postprocessor" _BACKTRACE_TRIPLES "/root/repo/cfemm/hpproc/test/CMakeLists.txt;13;add_test;/root/repo/cfemm/hpproc/test/CMakeLists.txt;31;test_hpproc;/root/repo/cfemm/hpproc/test/CMakeLists.txt;0;")
+add_test(hpproc_Temp1.out.check "/usr/bin/cmake" "-E" "compare_files" "Temp1.out" "Temp1.out.check")
+set_tests_properties(hpproc_Temp1.out.check PROPERTIES  DEPENDS "hpproc_Temp1" LABELS "heatflow" _BACKTRACE_TRIPLES "/root/repo/cfemm/hpproc/test/CMakeLists.txt;20;add_test;/root/repo/cfemm/hpproc/test/CMakeLists.txt;31;test_hpproc;/root/repo/cfemm/hpproc/test/CMakeLists.txt;0;")
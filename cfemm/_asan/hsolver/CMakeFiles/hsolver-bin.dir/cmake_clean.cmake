@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/cfemm/bin/hsolver"
+  "/root/repo/cfemm/bin/hsolver.pdb"
+  "CMakeFiles/hsolver-bin.dir/main.cpp.o"
+  "CMakeFiles/hsolver-bin.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hsolver-bin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hsolver.dir/hsolver.cpp.o"
+  "CMakeFiles/hsolver.dir/hsolver.cpp.o.d"
+  "libhsolver.a"
+  "libhsolver.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hsolver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
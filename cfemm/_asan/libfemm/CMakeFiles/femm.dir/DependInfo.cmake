@@ -0,0 +1,65 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cfemm/libfemm/AndersonAcceleration.cpp" "libfemm/CMakeFiles/femm.dir/AndersonAcceleration.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/AndersonAcceleration.cpp.o.d"
+  "/root/repo/cfemm/libfemm/Arena.cpp" "libfemm/CMakeFiles/femm.dir/Arena.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/Arena.cpp.o.d"
+  "/root/repo/cfemm/libfemm/BlockILU.cpp" "libfemm/CMakeFiles/femm.dir/BlockILU.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/BlockILU.cpp.o.d"
+  "/root/repo/cfemm/libfemm/CAirGapElement.cpp" "libfemm/CMakeFiles/femm.dir/CAirGapElement.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/CAirGapElement.cpp.o.d"
+  "/root/repo/cfemm/libfemm/CArcSegment.cpp" "libfemm/CMakeFiles/femm.dir/CArcSegment.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/CArcSegment.cpp.o.d"
+  "/root/repo/cfemm/libfemm/CBlockLabel.cpp" "libfemm/CMakeFiles/femm.dir/CBlockLabel.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/CBlockLabel.cpp.o.d"
+  "/root/repo/cfemm/libfemm/CBoundaryProp.cpp" "libfemm/CMakeFiles/femm.dir/CBoundaryProp.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/CBoundaryProp.cpp.o.d"
+  "/root/repo/cfemm/libfemm/CCircuit.cpp" "libfemm/CMakeFiles/femm.dir/CCircuit.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/CCircuit.cpp.o.d"
+  "/root/repo/cfemm/libfemm/CCommonPoint.cpp" "libfemm/CMakeFiles/femm.dir/CCommonPoint.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/CCommonPoint.cpp.o.d"
+  "/root/repo/cfemm/libfemm/CElement.cpp" "libfemm/CMakeFiles/femm.dir/CElement.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/CElement.cpp.o.d"
+  "/root/repo/cfemm/libfemm/CMaterialProp.cpp" "libfemm/CMakeFiles/femm.dir/CMaterialProp.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/CMaterialProp.cpp.o.d"
+  "/root/repo/cfemm/libfemm/CMeshNode.cpp" "libfemm/CMakeFiles/femm.dir/CMeshNode.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/CMeshNode.cpp.o.d"
+  "/root/repo/cfemm/libfemm/CNode.cpp" "libfemm/CMakeFiles/femm.dir/CNode.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/CNode.cpp.o.d"
+  "/root/repo/cfemm/libfemm/CPointProp.cpp" "libfemm/CMakeFiles/femm.dir/CPointProp.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/CPointProp.cpp.o.d"
+  "/root/repo/cfemm/libfemm/CSegment.cpp" "libfemm/CMakeFiles/femm.dir/CSegment.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/CSegment.cpp.o.d"
+  "/root/repo/cfemm/libfemm/CliTools.cpp" "libfemm/CMakeFiles/femm.dir/CliTools.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/CliTools.cpp.o.d"
+  "/root/repo/cfemm/libfemm/ComplexKernels.cpp" "libfemm/CMakeFiles/femm.dir/ComplexKernels.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/ComplexKernels.cpp.o.d"
+  "/root/repo/cfemm/libfemm/ElementKernels.cpp" "libfemm/CMakeFiles/femm.dir/ElementKernels.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/ElementKernels.cpp.o.d"
+  "/root/repo/cfemm/libfemm/FemmProblem.cpp" "libfemm/CMakeFiles/femm.dir/FemmProblem.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/FemmProblem.cpp.o.d"
+  "/root/repo/cfemm/libfemm/FemmReader.cpp" "libfemm/CMakeFiles/femm.dir/FemmReader.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/FemmReader.cpp.o.d"
+  "/root/repo/cfemm/libfemm/FemmStateBase.cpp" "libfemm/CMakeFiles/femm.dir/FemmStateBase.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/FemmStateBase.cpp.o.d"
+  "/root/repo/cfemm/libfemm/FourierTransform.cpp" "libfemm/CMakeFiles/femm.dir/FourierTransform.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/FourierTransform.cpp.o.d"
+  "/root/repo/cfemm/libfemm/Instrumentation.cpp" "libfemm/CMakeFiles/femm.dir/Instrumentation.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/Instrumentation.cpp.o.d"
+  "/root/repo/cfemm/libfemm/IntPoint.cpp" "libfemm/CMakeFiles/femm.dir/IntPoint.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/IntPoint.cpp.o.d"
+  "/root/repo/cfemm/libfemm/LuaInstance.cpp" "libfemm/CMakeFiles/femm.dir/LuaInstance.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/LuaInstance.cpp.o.d"
+  "/root/repo/cfemm/libfemm/MaskSolver.cpp" "libfemm/CMakeFiles/femm.dir/MaskSolver.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/MaskSolver.cpp.o.d"
+  "/root/repo/cfemm/libfemm/MaterialCurveCache.cpp" "libfemm/CMakeFiles/femm.dir/MaterialCurveCache.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/MaterialCurveCache.cpp.o.d"
+  "/root/repo/cfemm/libfemm/MaterialLibraryCache.cpp" "libfemm/CMakeFiles/femm.dir/MaterialLibraryCache.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/MaterialLibraryCache.cpp.o.d"
+  "/root/repo/cfemm/libfemm/MatlibReader.cpp" "libfemm/CMakeFiles/femm.dir/MatlibReader.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/MatlibReader.cpp.o.d"
+  "/root/repo/cfemm/libfemm/MessageCallback.cpp" "libfemm/CMakeFiles/femm.dir/MessageCallback.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/MessageCallback.cpp.o.d"
+  "/root/repo/cfemm/libfemm/PostProcessor.cpp" "libfemm/CMakeFiles/femm.dir/PostProcessor.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/PostProcessor.cpp.o.d"
+  "/root/repo/cfemm/libfemm/TextFile.cpp" "libfemm/CMakeFiles/femm.dir/TextFile.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/TextFile.cpp.o.d"
+  "/root/repo/cfemm/libfemm/ThreadPool.cpp" "libfemm/CMakeFiles/femm.dir/ThreadPool.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/ThreadPool.cpp.o.d"
+  "/root/repo/cfemm/libfemm/Tokenizer.cpp" "libfemm/CMakeFiles/femm.dir/Tokenizer.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/Tokenizer.cpp.o.d"
+  "/root/repo/cfemm/libfemm/cspars.cpp" "libfemm/CMakeFiles/femm.dir/cspars.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/cspars.cpp.o.d"
+  "/root/repo/cfemm/libfemm/cuthill.cpp" "libfemm/CMakeFiles/femm.dir/cuthill.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/cuthill.cpp.o.d"
+  "/root/repo/cfemm/libfemm/feasolver.cpp" "libfemm/CMakeFiles/femm.dir/feasolver.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/feasolver.cpp.o.d"
+  "/root/repo/cfemm/libfemm/femmconstants.cpp" "libfemm/CMakeFiles/femm.dir/femmconstants.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/femmconstants.cpp.o.d"
+  "/root/repo/cfemm/libfemm/femmenums.cpp" "libfemm/CMakeFiles/femm.dir/femmenums.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/femmenums.cpp.o.d"
+  "/root/repo/cfemm/libfemm/femmversion.cpp" "libfemm/CMakeFiles/femm.dir/femmversion.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/femmversion.cpp.o.d"
+  "/root/repo/cfemm/libfemm/fileTools.cpp" "libfemm/CMakeFiles/femm.dir/fileTools.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/fileTools.cpp.o.d"
+  "/root/repo/cfemm/libfemm/fparse.cpp" "libfemm/CMakeFiles/femm.dir/fparse.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/fparse.cpp.o.d"
+  "/root/repo/cfemm/libfemm/fullmatrix.cpp" "libfemm/CMakeFiles/femm.dir/fullmatrix.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/fullmatrix.cpp.o.d"
+  "/root/repo/cfemm/libfemm/locationTools.cpp" "libfemm/CMakeFiles/femm.dir/locationTools.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/locationTools.cpp.o.d"
+  "/root/repo/cfemm/libfemm/spars.cpp" "libfemm/CMakeFiles/femm.dir/spars.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/spars.cpp.o.d"
+  "/root/repo/cfemm/libfemm/stringTools.cpp" "libfemm/CMakeFiles/femm.dir/stringTools.cpp.o" "gcc" "libfemm/CMakeFiles/femm.dir/stringTools.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/cfemm/_asan/libfemm/CMakeFiles/luacomplex.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,101 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/femm.dir/AndersonAcceleration.cpp.o"
+  "CMakeFiles/femm.dir/AndersonAcceleration.cpp.o.d"
+  "CMakeFiles/femm.dir/Arena.cpp.o"
+  "CMakeFiles/femm.dir/Arena.cpp.o.d"
+  "CMakeFiles/femm.dir/BlockILU.cpp.o"
+  "CMakeFiles/femm.dir/BlockILU.cpp.o.d"
+  "CMakeFiles/femm.dir/CAirGapElement.cpp.o"
+  "CMakeFiles/femm.dir/CAirGapElement.cpp.o.d"
+  "CMakeFiles/femm.dir/CArcSegment.cpp.o"
+  "CMakeFiles/femm.dir/CArcSegment.cpp.o.d"
+  "CMakeFiles/femm.dir/CBlockLabel.cpp.o"
+  "CMakeFiles/femm.dir/CBlockLabel.cpp.o.d"
+  "CMakeFiles/femm.dir/CBoundaryProp.cpp.o"
+  "CMakeFiles/femm.dir/CBoundaryProp.cpp.o.d"
+  "CMakeFiles/femm.dir/CCircuit.cpp.o"
+  "CMakeFiles/femm.dir/CCircuit.cpp.o.d"
+  "CMakeFiles/femm.dir/CCommonPoint.cpp.o"
+  "CMakeFiles/femm.dir/CCommonPoint.cpp.o.d"
+  "CMakeFiles/femm.dir/CElement.cpp.o"
+  "CMakeFiles/femm.dir/CElement.cpp.o.d"
+  "CMakeFiles/femm.dir/CMaterialProp.cpp.o"
+  "CMakeFiles/femm.dir/CMaterialProp.cpp.o.d"
+  "CMakeFiles/femm.dir/CMeshNode.cpp.o"
+  "CMakeFiles/femm.dir/CMeshNode.cpp.o.d"
+  "CMakeFiles/femm.dir/CNode.cpp.o"
+  "CMakeFiles/femm.dir/CNode.cpp.o.d"
+  "CMakeFiles/femm.dir/CPointProp.cpp.o"
+  "CMakeFiles/femm.dir/CPointProp.cpp.o.d"
+  "CMakeFiles/femm.dir/CSegment.cpp.o"
+  "CMakeFiles/femm.dir/CSegment.cpp.o.d"
+  "CMakeFiles/femm.dir/CliTools.cpp.o"
+  "CMakeFiles/femm.dir/CliTools.cpp.o.d"
+  "CMakeFiles/femm.dir/ComplexKernels.cpp.o"
+  "CMakeFiles/femm.dir/ComplexKernels.cpp.o.d"
+  "CMakeFiles/femm.dir/ElementKernels.cpp.o"
+  "CMakeFiles/femm.dir/ElementKernels.cpp.o.d"
+  "CMakeFiles/femm.dir/FemmProblem.cpp.o"
+  "CMakeFiles/femm.dir/FemmProblem.cpp.o.d"
+  "CMakeFiles/femm.dir/FemmReader.cpp.o"
+  "CMakeFiles/femm.dir/FemmReader.cpp.o.d"
+  "CMakeFiles/femm.dir/FemmStateBase.cpp.o"
+  "CMakeFiles/femm.dir/FemmStateBase.cpp.o.d"
+  "CMakeFiles/femm.dir/FourierTransform.cpp.o"
+  "CMakeFiles/femm.dir/FourierTransform.cpp.o.d"
+  "CMakeFiles/femm.dir/Instrumentation.cpp.o"
+  "CMakeFiles/femm.dir/Instrumentation.cpp.o.d"
+  "CMakeFiles/femm.dir/IntPoint.cpp.o"
+  "CMakeFiles/femm.dir/IntPoint.cpp.o.d"
+  "CMakeFiles/femm.dir/LuaInstance.cpp.o"
+  "CMakeFiles/femm.dir/LuaInstance.cpp.o.d"
+  "CMakeFiles/femm.dir/MaskSolver.cpp.o"
+  "CMakeFiles/femm.dir/MaskSolver.cpp.o.d"
+  "CMakeFiles/femm.dir/MaterialCurveCache.cpp.o"
+  "CMakeFiles/femm.dir/MaterialCurveCache.cpp.o.d"
+  "CMakeFiles/femm.dir/MaterialLibraryCache.cpp.o"
+  "CMakeFiles/femm.dir/MaterialLibraryCache.cpp.o.d"
+  "CMakeFiles/femm.dir/MatlibReader.cpp.o"
+  "CMakeFiles/femm.dir/MatlibReader.cpp.o.d"
+  "CMakeFiles/femm.dir/MessageCallback.cpp.o"
+  "CMakeFiles/femm.dir/MessageCallback.cpp.o.d"
+  "CMakeFiles/femm.dir/PostProcessor.cpp.o"
+  "CMakeFiles/femm.dir/PostProcessor.cpp.o.d"
+  "CMakeFiles/femm.dir/TextFile.cpp.o"
+  "CMakeFiles/femm.dir/TextFile.cpp.o.d"
+  "CMakeFiles/femm.dir/ThreadPool.cpp.o"
+  "CMakeFiles/femm.dir/ThreadPool.cpp.o.d"
+  "CMakeFiles/femm.dir/Tokenizer.cpp.o"
+  "CMakeFiles/femm.dir/Tokenizer.cpp.o.d"
+  "CMakeFiles/femm.dir/cspars.cpp.o"
+  "CMakeFiles/femm.dir/cspars.cpp.o.d"
+  "CMakeFiles/femm.dir/cuthill.cpp.o"
+  "CMakeFiles/femm.dir/cuthill.cpp.o.d"
+  "CMakeFiles/femm.dir/feasolver.cpp.o"
+  "CMakeFiles/femm.dir/feasolver.cpp.o.d"
+  "CMakeFiles/femm.dir/femmconstants.cpp.o"
+  "CMakeFiles/femm.dir/femmconstants.cpp.o.d"
+  "CMakeFiles/femm.dir/femmenums.cpp.o"
+  "CMakeFiles/femm.dir/femmenums.cpp.o.d"
+  "CMakeFiles/femm.dir/femmversion.cpp.o"
+  "CMakeFiles/femm.dir/femmversion.cpp.o.d"
+  "CMakeFiles/femm.dir/fileTools.cpp.o"
+  "CMakeFiles/femm.dir/fileTools.cpp.o.d"
+  "CMakeFiles/femm.dir/fparse.cpp.o"
+  "CMakeFiles/femm.dir/fparse.cpp.o.d"
+  "CMakeFiles/femm.dir/fullmatrix.cpp.o"
+  "CMakeFiles/femm.dir/fullmatrix.cpp.o.d"
+  "CMakeFiles/femm.dir/locationTools.cpp.o"
+  "CMakeFiles/femm.dir/locationTools.cpp.o.d"
+  "CMakeFiles/femm.dir/spars.cpp.o"
+  "CMakeFiles/femm.dir/spars.cpp.o.d"
+  "CMakeFiles/femm.dir/stringTools.cpp.o"
+  "CMakeFiles/femm.dir/stringTools.cpp.o.d"
+  "libfemm.a"
+  "libfemm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/femm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
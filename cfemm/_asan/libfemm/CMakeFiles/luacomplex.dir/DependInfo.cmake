@@ -0,0 +1,44 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cfemm/libfemm/liblua/femmcomplex.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/femmcomplex.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/femmcomplex.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/lapi.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/lapi.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/lapi.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/lauxlib.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/lauxlib.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/lauxlib.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/lbaselib.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/lbaselib.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/lbaselib.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/lcode.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/lcode.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/lcode.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/ldblib.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/ldblib.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/ldblib.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/ldebug.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/ldebug.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/ldebug.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/ldo.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/ldo.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/ldo.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/ldump.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/ldump.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/ldump.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/lfunc.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/lfunc.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/lfunc.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/lgc.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/lgc.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/lgc.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/liolib.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/liolib.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/liolib.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/llex.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/llex.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/llex.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/lmathlib.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/lmathlib.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/lmathlib.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/lmem.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/lmem.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/lmem.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/lobject.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/lobject.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/lobject.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/lparser.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/lparser.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/lparser.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/lstate.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/lstate.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/lstate.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/lstring.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/lstring.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/lstring.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/lstrlib.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/lstrlib.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/lstrlib.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/ltable.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/ltable.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/ltable.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/ltests.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/ltests.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/ltests.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/ltm.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/ltm.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/ltm.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/lundump.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/lundump.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/lundump.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/lvm.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/lvm.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/lvm.cpp.o.d"
+  "/root/repo/cfemm/libfemm/liblua/lzio.cpp" "libfemm/CMakeFiles/luacomplex.dir/liblua/lzio.cpp.o" "gcc" "libfemm/CMakeFiles/luacomplex.dir/liblua/lzio.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
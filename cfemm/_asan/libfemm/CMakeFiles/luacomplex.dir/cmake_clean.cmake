@@ -0,0 +1,61 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/luacomplex.dir/liblua/femmcomplex.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/femmcomplex.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/lapi.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/lapi.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/lauxlib.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/lauxlib.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/lbaselib.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/lbaselib.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/lcode.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/lcode.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/ldblib.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/ldblib.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/ldebug.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/ldebug.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/ldo.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/ldo.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/ldump.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/ldump.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/lfunc.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/lfunc.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/lgc.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/lgc.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/liolib.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/liolib.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/llex.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/llex.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/lmathlib.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/lmathlib.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/lmem.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/lmem.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/lobject.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/lobject.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/lparser.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/lparser.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/lstate.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/lstate.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/lstring.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/lstring.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/lstrlib.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/lstrlib.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/ltable.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/ltable.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/ltests.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/ltests.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/ltm.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/ltm.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/lundump.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/lundump.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/lvm.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/lvm.cpp.o.d"
+  "CMakeFiles/luacomplex.dir/liblua/lzio.cpp.o"
+  "CMakeFiles/luacomplex.dir/liblua/lzio.cpp.o.d"
+  "libluacomplex.a"
+  "libluacomplex.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/luacomplex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
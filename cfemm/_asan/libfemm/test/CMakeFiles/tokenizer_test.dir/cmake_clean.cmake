@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/cfemm/bin/tokenizer_test"
+  "/root/repo/cfemm/bin/tokenizer_test.pdb"
+  "CMakeFiles/tokenizer_test.dir/tokenizer_test.cpp.o"
+  "CMakeFiles/tokenizer_test.dir/tokenizer_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tokenizer_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
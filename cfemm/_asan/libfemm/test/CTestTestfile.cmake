@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/cfemm/libfemm/test
+# Build directory: /root/repo/cfemm/_asan/libfemm/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tokenizer_test "/root/repo/cfemm/bin/tokenizer_test")
+set_tests_properties(tokenizer_test PROPERTIES  LABELS "parser" _BACKTRACE_TRIPLES "/root/repo/cfemm/libfemm/test/CMakeLists.txt;7;add_test;/root/repo/cfemm/libfemm/test/CMakeLists.txt;0;")
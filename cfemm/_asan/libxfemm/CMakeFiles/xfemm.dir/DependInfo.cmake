@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cfemm/libxfemm/xfemm.cpp" "libxfemm/CMakeFiles/xfemm.dir/xfemm.cpp.o" "gcc" "libxfemm/CMakeFiles/xfemm.dir/xfemm.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/cfemm/_asan/libxfemm/libxfemm.so" "/root/repo/cfemm/_asan/libxfemm/libxfemm.so.0.0.0"
+  "/root/repo/cfemm/_asan/libxfemm/libxfemm.so.0" "/root/repo/cfemm/_asan/libxfemm/libxfemm.so.0.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/cfemm/_asan/fmesher/CMakeFiles/fmesher.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/fsolver/CMakeFiles/fsolver.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/fpproc/CMakeFiles/fpproc.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/fmesher/CMakeFiles/triangle.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/libfemm/CMakeFiles/femm.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_asan/libfemm/CMakeFiles/luacomplex.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
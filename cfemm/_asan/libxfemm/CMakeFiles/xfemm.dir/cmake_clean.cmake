@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xfemm.dir/xfemm.cpp.o"
+  "CMakeFiles/xfemm.dir/xfemm.cpp.o.d"
+  "libxfemm.pdb"
+  "libxfemm.so"
+  "libxfemm.so.0"
+  "libxfemm.so.0.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xfemm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
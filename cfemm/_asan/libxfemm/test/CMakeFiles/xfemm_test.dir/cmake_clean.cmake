@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/cfemm/bin/xfemm_test"
+  "/root/repo/cfemm/bin/xfemm_test.pdb"
+  "CMakeFiles/xfemm_test.dir/xfemm_test.c.o"
+  "CMakeFiles/xfemm_test.dir/xfemm_test.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/xfemm_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
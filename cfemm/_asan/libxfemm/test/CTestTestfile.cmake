@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/cfemm/libxfemm/test
+# Build directory: /root/repo/cfemm/_asan/libxfemm/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(xfemm_test "/root/repo/cfemm/bin/xfemm_test")
+set_tests_properties(xfemm_test PROPERTIES  ENVIRONMENT "TMPDIR=/root/repo/cfemm/_asan/libxfemm/test" LABELS "magnetics;library" WORKING_DIRECTORY "/root/repo/cfemm/_asan/libxfemm/test" _BACKTRACE_TRIPLES "/root/repo/cfemm/libxfemm/test/CMakeLists.txt;11;add_test;/root/repo/cfemm/libxfemm/test/CMakeLists.txt;0;")
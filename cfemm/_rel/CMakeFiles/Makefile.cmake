@@ -0,0 +1,181 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/cfemm/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cfemm/bench/CMakeLists.txt"
+  "/root/repo/cfemm/epproc/CMakeLists.txt"
+  "/root/repo/cfemm/epproc/test/CMakeLists.txt"
+  "/root/repo/cfemm/epproc/test/test.out.check"
+  "/root/repo/cfemm/epproc/test/test.res"
+  "/root/repo/cfemm/esolver/CMakeLists.txt"
+  "/root/repo/cfemm/esolver/test/CMakeLists.txt"
+  "/root/repo/cfemm/esolver/test/test.fee"
+  "/root/repo/cfemm/esolver/test/test.res.check"
+  "/root/repo/cfemm/femmcli/CMakeLists.txt"
+  "/root/repo/cfemm/femmcli/test/CMakeLists.txt"
+  "/root/repo/cfemm/femmcli/test/femmcli_TorqueBenchmark.fem"
+  "/root/repo/cfemm/femmcli/test/femmcli_antiperiodicBC_AGE_TorqueBenchmark.fem"
+  "/root/repo/cfemm/femmcli/test/femmcli_antiperiodicBC_flux.fem"
+  "/root/repo/cfemm/femmcli/test/femmcli_epproc.fee"
+  "/root/repo/cfemm/femmcli/test/femmcli_femfile.fem"
+  "/root/repo/cfemm/femmcli/test/femmcli_femfile.result.ans.check"
+  "/root/repo/cfemm/femmcli/test/femmcli_femfile.result.fem.check"
+  "/root/repo/cfemm/femmcli/test/femmcli_fpproc.fem"
+  "/root/repo/cfemm/femmcli/test/femmcli_hpproc.feh"
+  "/root/repo/cfemm/femmcli/test/femmcli_matlib.result.fem.check"
+  "/root/repo/cfemm/fmesher/CMakeLists.txt"
+  "/root/repo/cfemm/fmesher/test/CMakeLists.txt"
+  "/root/repo/cfemm/fpproc/CMakeLists.txt"
+  "/root/repo/cfemm/fpproc/test/CMakeLists.txt"
+  "/root/repo/cfemm/fsolver/CMakeLists.txt"
+  "/root/repo/cfemm/fsolver/test/CMakeLists.txt"
+  "/root/repo/cfemm/fsolver/test/Temp.ans.check"
+  "/root/repo/cfemm/fsolver/test/Temp.fem"
+  "/root/repo/cfemm/fsolver/test/Temp1.ans.check"
+  "/root/repo/cfemm/fsolver/test/Temp1.fem"
+  "/root/repo/cfemm/hpproc/CMakeLists.txt"
+  "/root/repo/cfemm/hpproc/test/CMakeLists.txt"
+  "/root/repo/cfemm/hpproc/test/Temp0.anh"
+  "/root/repo/cfemm/hpproc/test/Temp0.out.check"
+  "/root/repo/cfemm/hpproc/test/Temp1.anh"
+  "/root/repo/cfemm/hpproc/test/Temp1.out.check"
+  "/root/repo/cfemm/hsolver/CMakeLists.txt"
+  "/root/repo/cfemm/hsolver/test/CMakeLists.txt"
+  "/root/repo/cfemm/hsolver/test/Temp0.anh.check"
+  "/root/repo/cfemm/hsolver/test/Temp0.feh"
+  "/root/repo/cfemm/hsolver/test/Temp1.anh.check"
+  "/root/repo/cfemm/hsolver/test/Temp1.feh"
+  "/root/repo/cfemm/libfemm/CMakeLists.txt"
+  "/root/repo/cfemm/libfemm/femmversion.h.in"
+  "/root/repo/cfemm/libfemm/test/CMakeLists.txt"
+  "/root/repo/cfemm/libxfemm/CMakeLists.txt"
+  "/root/repo/cfemm/libxfemm/test/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseArguments.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "/root/repo/cfemm/libfemm/femmversion.h"
+  "libfemm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libfemm/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "epproc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "epproc/test/test.res"
+  "epproc/test/test.out.check"
+  "epproc/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "esolver/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "esolver/test/test.fee"
+  "esolver/test/test.res.check"
+  "esolver/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "femmcli/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "femmcli/test/femmcli_femfile.fem"
+  "femmcli/test/femmcli_femfile.result.ans.check"
+  "femmcli/test/femmcli_femfile.result.fem.check"
+  "femmcli/test/femmcli_fpproc.fem"
+  "femmcli/test/femmcli_matlib.result.fem.check"
+  "femmcli/test/femmcli_TorqueBenchmark.fem"
+  "femmcli/test/femmcli_antiperiodicBC_flux.fem"
+  "femmcli/test/femmcli_antiperiodicBC_AGE_TorqueBenchmark.fem"
+  "femmcli/test/femmcli_TorqueBenchmark.fem"
+  "femmcli/test/femmcli_epproc.fee"
+  "femmcli/test/femmcli_hpproc.feh"
+  "femmcli/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "fmesher/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "fmesher/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "fsolver/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "fsolver/test/Temp.fem"
+  "fsolver/test/Temp.ans.check"
+  "fsolver/test/Temp1.fem"
+  "fsolver/test/Temp1.ans.check"
+  "fsolver/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "fpproc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "fpproc/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "hsolver/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "hsolver/test/Temp0.feh"
+  "hsolver/test/Temp0.anh.check"
+  "hsolver/test/Temp1.feh"
+  "hsolver/test/Temp1.anh.check"
+  "hsolver/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "hpproc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "hpproc/test/Temp0.anh"
+  "hpproc/test/Temp0.out.check"
+  "hpproc/test/Temp1.anh"
+  "hpproc/test/Temp1.out.check"
+  "hpproc/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libxfemm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libxfemm/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bench/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "libfemm/CMakeFiles/luacomplex.dir/DependInfo.cmake"
+  "libfemm/CMakeFiles/femm.dir/DependInfo.cmake"
+  "libfemm/test/CMakeFiles/tokenizer_test.dir/DependInfo.cmake"
+  "epproc/CMakeFiles/epproc.dir/DependInfo.cmake"
+  "epproc/CMakeFiles/epproc-test.dir/DependInfo.cmake"
+  "esolver/CMakeFiles/esolver.dir/DependInfo.cmake"
+  "esolver/CMakeFiles/esolver-bin.dir/DependInfo.cmake"
+  "femmcli/CMakeFiles/femmcli.dir/DependInfo.cmake"
+  "femmcli/CMakeFiles/femmcli-bin.dir/DependInfo.cmake"
+  "fmesher/CMakeFiles/triangle.dir/DependInfo.cmake"
+  "fmesher/CMakeFiles/fmesher.dir/DependInfo.cmake"
+  "fmesher/CMakeFiles/fmesher-bin.dir/DependInfo.cmake"
+  "fsolver/CMakeFiles/fsolver.dir/DependInfo.cmake"
+  "fsolver/CMakeFiles/fsolver-bin.dir/DependInfo.cmake"
+  "fpproc/CMakeFiles/fpproc.dir/DependInfo.cmake"
+  "fpproc/CMakeFiles/fpproc-test.dir/DependInfo.cmake"
+  "fpproc/test/CMakeFiles/fpproc_bounds.dir/DependInfo.cmake"
+  "hsolver/CMakeFiles/hsolver.dir/DependInfo.cmake"
+  "hsolver/CMakeFiles/hsolver-bin.dir/DependInfo.cmake"
+  "hpproc/CMakeFiles/hpproc.dir/DependInfo.cmake"
+  "hpproc/CMakeFiles/hpproc-test.dir/DependInfo.cmake"
+  "libxfemm/CMakeFiles/xfemm.dir/DependInfo.cmake"
+  "libxfemm/test/CMakeFiles/xfemm_test.dir/DependInfo.cmake"
+  "bench/CMakeFiles/xfemm-bench.dir/DependInfo.cmake"
+  "bench/CMakeFiles/bench.dir/DependInfo.cmake"
+  )
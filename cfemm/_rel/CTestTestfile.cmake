@@ -0,0 +1,17 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/cfemm
+# Build directory: /root/repo/cfemm/_rel
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("libfemm")
+subdirs("epproc")
+subdirs("esolver")
+subdirs("femmcli")
+subdirs("fmesher")
+subdirs("fsolver")
+subdirs("fpproc")
+subdirs("hsolver")
+subdirs("hpproc")
+subdirs("libxfemm")
+subdirs("bench")
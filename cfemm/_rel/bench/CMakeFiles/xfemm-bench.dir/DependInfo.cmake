@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cfemm/bench/Benchmark.cpp" "bench/CMakeFiles/xfemm-bench.dir/Benchmark.cpp.o" "gcc" "bench/CMakeFiles/xfemm-bench.dir/Benchmark.cpp.o.d"
+  "/root/repo/cfemm/bench/Json.cpp" "bench/CMakeFiles/xfemm-bench.dir/Json.cpp.o" "gcc" "bench/CMakeFiles/xfemm-bench.dir/Json.cpp.o.d"
+  "/root/repo/cfemm/bench/Report.cpp" "bench/CMakeFiles/xfemm-bench.dir/Report.cpp.o" "gcc" "bench/CMakeFiles/xfemm-bench.dir/Report.cpp.o.d"
+  "/root/repo/cfemm/bench/main.cpp" "bench/CMakeFiles/xfemm-bench.dir/main.cpp.o" "gcc" "bench/CMakeFiles/xfemm-bench.dir/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/cfemm/_rel/femmcli/CMakeFiles/femmcli.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_rel/fmesher/CMakeFiles/fmesher.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_rel/fmesher/CMakeFiles/triangle.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_rel/esolver/CMakeFiles/esolver.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_rel/epproc/CMakeFiles/epproc.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_rel/fsolver/CMakeFiles/fsolver.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_rel/fpproc/CMakeFiles/fpproc.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_rel/hsolver/CMakeFiles/hsolver.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_rel/hpproc/CMakeFiles/hpproc.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_rel/libfemm/CMakeFiles/femm.dir/DependInfo.cmake"
+  "/root/repo/cfemm/_rel/libfemm/CMakeFiles/luacomplex.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
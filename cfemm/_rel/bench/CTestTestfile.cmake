@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/cfemm/bench
+# Build directory: /root/repo/cfemm/_rel/bench
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(xfemm-bench "/root/repo/cfemm/bin/xfemm-bench" "--repeat=1" "--output=xfemm-bench-test.json")
+set_tests_properties(xfemm-bench PROPERTIES  LABELS "bench" WORKING_DIRECTORY "/root/repo/cfemm/_rel/bench" _BACKTRACE_TRIPLES "/root/repo/cfemm/bench/CMakeLists.txt;30;add_test;/root/repo/cfemm/bench/CMakeLists.txt;0;")
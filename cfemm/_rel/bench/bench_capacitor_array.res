@@ -0,0 +1,11328 @@
+[Format]      =  1
+[Precision]   =  1e-08
+[MinAngle]    =  30
+[Depth]       =  10
+[LengthUnits] =  millimeters
+[ProblemType] =  planar
+[Coordinates] =  cartesian
+[PrevSoln]    = ""
+[PrevType]    =  0
+[Comment]     =  ""
+[PointProps]  =  0
+[BdryProps]   = 1
+  <BeginBdry>
+    <BdryName> = "Ground"
+    <BdryType> = 0
+    <Vs> = 0
+    <qs> = 0
+    <c0> = 0
+    <c1> = 0
+  <EndBdry>
+[BlockProps]  = 1
+  <BeginBlock>
+    <BlockName> = "Dielectric"
+    <ex> = 4.5
+    <ey> = 4.5
+    <qv> = 0
+  <EndBlock>
+[ConductorProps]  = 2
+  <BeginConductor>
+    <ConductorName> = "low"
+    <Vc> = 0
+    <qc> = 0
+    <ConductorType> = 1
+  <EndConductor>
+  <BeginConductor>
+    <ConductorName> = "high"
+    <Vc> = 100
+    <qc> = 0
+    <ConductorType> = 1
+  <EndConductor>
+[NumPoints] = 68
+0	0	0	0	0
+50	0	0	0	0
+50	50	0	0	0
+0	50	0	0	0
+7	7	0	0	0
+13	7	0	0	0
+13	13	0	0	0
+7	13	0	0	0
+7	17	0	0	0
+13	17	0	0	0
+13	23	0	0	0
+7	23	0	0	0
+7	27	0	0	0
+13	27	0	0	0
+13	33	0	0	0
+7	33	0	0	0
+7	37	0	0	0
+13	37	0	0	0
+13	43	0	0	0
+7	43	0	0	0
+17	7	0	0	0
+23	7	0	0	0
+23	13	0	0	0
+17	13	0	0	0
+17	17	0	0	0
+23	17	0	0	0
+23	23	0	0	0
+17	23	0	0	0
+17	27	0	0	0
+23	27	0	0	0
+23	33	0	0	0
+17	33	0	0	0
+17	37	0	0	0
+23	37	0	0	0
+23	43	0	0	0
+17	43	0	0	0
+27	7	0	0	0
+33	7	0	0	0
+33	13	0	0	0
+27	13	0	0	0
+27	17	0	0	0
+33	17	0	0	0
+33	23	0	0	0
+27	23	0	0	0
+27	27	0	0	0
+33	27	0	0	0
+33	33	0	0	0
+27	33	0	0	0
+27	37	0	0	0
+33	37	0	0	0
+33	43	0	0	0
+27	43	0	0	0
+37	7	0	0	0
+43	7	0	0	0
+43	13	0	0	0
+37	13	0	0	0
+37	17	0	0	0
+43	17	0	0	0
+43	23	0	0	0
+37	23	0	0	0
+37	27	0	0	0
+43	27	0	0	0
+43	33	0	0	0
+37	33	0	0	0
+37	37	0	0	0
+43	37	0	0	0
+43	43	0	0	0
+37	43	0	0	0
+[NumSegments] = 68
+0	1	-1	1	0	0	0
+1	2	-1	1	0	0	0
+2	3	-1	1	0	0	0
+3	0	-1	1	0	0	0
+4	5	0.40000000000000002	0	0	1	1
+5	6	0.40000000000000002	0	0	1	1
+6	7	0.40000000000000002	0	0	1	1
+7	4	0.40000000000000002	0	0	1	1
+8	9	0.40000000000000002	0	0	1	2
+9	10	0.40000000000000002	0	0	1	2
+10	11	0.40000000000000002	0	0	1	2
+11	8	0.40000000000000002	0	0	1	2
+12	13	0.40000000000000002	0	0	1	1
+13	14	0.40000000000000002	0	0	1	1
+14	15	0.40000000000000002	0	0	1	1
+15	12	0.40000000000000002	0	0	1	1
+16	17	0.40000000000000002	0	0	1	2
+17	18	0.40000000000000002	0	0	1	2
+18	19	0.40000000000000002	0	0	1	2
+19	16	0.40000000000000002	0	0	1	2
+20	21	0.40000000000000002	0	0	1	2
+21	22	0.40000000000000002	0	0	1	2
+22	23	0.40000000000000002	0	0	1	2
+23	20	0.40000000000000002	0	0	1	2
+24	25	0.40000000000000002	0	0	1	1
+25	26	0.40000000000000002	0	0	1	1
+26	27	0.40000000000000002	0	0	1	1
+27	24	0.40000000000000002	0	0	1	1
+28	29	0.40000000000000002	0	0	1	2
+29	30	0.40000000000000002	0	0	1	2
+30	31	0.40000000000000002	0	0	1	2
+31	28	0.40000000000000002	0	0	1	2
+32	33	0.40000000000000002	0	0	1	1
+33	34	0.40000000000000002	0	0	1	1
+34	35	0.40000000000000002	0	0	1	1
+35	32	0.40000000000000002	0	0	1	1
+36	37	0.40000000000000002	0	0	1	1
+37	38	0.40000000000000002	0	0	1	1
+38	39	0.40000000000000002	0	0	1	1
+39	36	0.40000000000000002	0	0	1	1
+40	41	0.40000000000000002	0	0	1	2
+41	42	0.40000000000000002	0	0	1	2
+42	43	0.40000000000000002	0	0	1	2
+43	40	0.40000000000000002	0	0	1	2
+44	45	0.40000000000000002	0	0	1	1
+45	46	0.40000000000000002	0	0	1	1
+46	47	0.40000000000000002	0	0	1	1
+47	44	0.40000000000000002	0	0	1	1
+48	49	0.40000000000000002	0	0	1	2
+49	50	0.40000000000000002	0	0	1	2
+50	51	0.40000000000000002	0	0	1	2
+51	48	0.40000000000000002	0	0	1	2
+52	53	0.40000000000000002	0	0	1	2
+53	54	0.40000000000000002	0	0	1	2
+54	55	0.40000000000000002	0	0	1	2
+55	52	0.40000000000000002	0	0	1	2
+56	57	0.40000000000000002	0	0	1	1
+57	58	0.40000000000000002	0	0	1	1
+58	59	0.40000000000000002	0	0	1	1
+59	56	0.40000000000000002	0	0	1	1
+60	61	0.40000000000000002	0	0	1	2
+61	62	0.40000000000000002	0	0	1	2
+62	63	0.40000000000000002	0	0	1	2
+63	60	0.40000000000000002	0	0	1	2
+64	65	0.40000000000000002	0	0	1	1
+65	66	0.40000000000000002	0	0	1	1
+66	67	0.40000000000000002	0	0	1	1
+67	64	0.40000000000000002	0	0	1	1
+[NumArcSegments] = 0
+[NumHoles] = 16
+10 10 1
+10 20 1
+10 30 1
+10 40 1
+20 10 1
+20 20 1
+20 30 1
+20 40 1
+30 10 1
+30 20 1
+30 30 1
+30 40 1
+40 10 1
+40 20 1
+40 30 1
+40 40 1
+[NumBlockLabels] = 1
+1	1	1	1.6000000000000001	0	0
+[Solution]
+4085
+0	0	0	-1
+0.017176470588235265	0	0	-1
+0	0.017176470588235265	0	-1
+0.06597104779411761	0	0	-1
+0.036131961924317932	0.036131961924317932	4.8394994142600033e-05	-2
+0	0.065971047794117624	0	-1
+0.11476562499999997	0	0	-1
+0.090368336397058796	0.050535247780369046	0.00016548397518210373	-2
+0.050535247780369059	0.090368336397058796	0.00016591363716498793	-2
+0	0.11476562499999998	0	-1
+0.21235477941176467	0	0	-1
+0.1635602022058823	0.05471378856331123	0.00032520274494928549	-2
+0.12294940501973117	0.12294940501973114	0.00054802391268918391	-2
+0.054713788563311251	0.16356020220588235	0.00032864755464224088	-2
+0	0.2123547794117647	0	-1
+0.40753308823529411	0	0	-1
+0.27569505175586884	0.10560256697040729	0.0010546195082838414	-2
+0.20028741935432573	0.12277486734662445	0.00090165699629230996	-2
+0.12277486734662457	0.20028741935432576	0.00091530189298980372	-2
+0.10560256697040726	0.27569505175586895	0.001059118161599183	-2
+0	0.30994393382352942	0	-1
+0.60271139705882359	0	0	-1
+0.44685867095812876	0.18419242234692357	0.0029869367667319608	-2
+0.26552827494537673	0.23511036995262063	0.0022853886439550726	-2
+0.18525376454065701	0.25417461515516115	0.00171691705848608	-2
+0.07819251746518327	0.36195250614371499	0.0010446265052530437	-2
+0.16718548248939527	0.3454627691067107	0.002121143939208172	-2
+0	0.40753308823529411	0	-1
+0.79788970588235297	0	0	-1
+0.67003179894425313	0.32268732920535159	0.0077600319531369163	-2
+0.40769431461172168	0.33557641741649058	0.0049772243406497052	-2
+0.25596193101215398	0.37336854012010029	0.003469213455773027	-2
+0.13562963678951045	0.42354657057100165	0.0021219706606439028	-2
+0.21239672134341486	0.43826838233022525	0.0033465991659131335	-2
+0	0.60271139705882359	0	-1
+0.1504056773673034	0.55400911018196175	0.0029609005627456754	-2
+1.1882463235294118	0	0	-1
+1.0090552107494459	0.28968371913267743	0.010094877299628926	-2
+0.54685595123073183	0.49181489548593432	0.0098042654347448958	-2
+0.87965229519529664	0.60477259147816054	0.019192640205679908	-2
+0.33825096901011292	0.47567846066678221	0.0058030297218413926	-2
+0	0.79788970588235297	0	-1
+0.11468785993884818	0.70030055147058823	0.0028729952804711538	-2
+0.30914086183159128	0.67027119856134498	0.0075072696634232361	-2
+1.5786029411764706	0	0	-1
+1.3834246323529413	0.32099585935287706	0.015808058569745116	-2
+0.61678328478805533	0.83251645221392634	0.018915076548573339	-2
+1.1134217246177376	1.1401742025225565	0.047572070507958752	-2
+0	1.1882463235294118	0	-1
+0.21383527534692745	0.93300549872199035	0.0072835796983085586	-2
+2.3593161764705881	0	0	-1
+1.9689595588235296	0.4571884564016982	0.034235181674433492	-2
+0.4922208189149565	1.3834246323529413	0.025699896469034526	-2
+1.0097997926045692	1.7903709175801301	0.068273370013410925	-2
+2.1042487373159524	1.6314379054639685	0.12782111776946861	-2
+0	1.5786029411764708	0	-1
+3.1400294117647061	0	0	-1
+2.7496727941176471	0.72853562044469078	0.07600687510554377	-2
+0.43959355143016088	1.9689595588235298	0.032517877329367444	-2
+0.73062636095522082	2.7394000289621849	0.078232932808084424	-2
+1.5540892998917986	2.7530895302480274	0.16155685413063414	-2
+3.2560948181121265	1.7726788766064676	0.21485932702373553	-2
+2.6622296554566969	2.7092783817058077	0.26295038550657007	-2
+0	2.3593161764705886	0	-1
+3.8406841169402632	0.84426403210618939	0.12399085709031102	-2
+4.701455882352942	0	0	-1
+0	3.1400294117647061	0	-1
+1.1268705571111566	3.6778488849419064	0.16380792131669905	-2
+2.1455434831522728	3.6767589180881437	0.29585481151622395	-2
+3.7640247259123711	2.8355403597026076	0.38172493602874036	-2
+4.3581172763991924	1.8183278131110137	0.31029521980888941	-2
+3.1717156795301529	3.6735199900324496	0.41102594776772794	-2
+6.262882352941177	0	0	-1
+5.8907391635568915	1.5169859064312694	0.41689943898899379	-2
+0	4.701455882352942	0	-1
+1.6372272755669537	4.6308251814847168	0.30889292906939031	-2
+2.668076810391093	4.5676048611527929	0.45806676156644799	-2
+4.9393119041762112	2.7557445446750473	0.50348206957362018	-2
+4.4584893381875936	4.3689753246707594	0.61708749519608153	-2
+7.824308823529412	0	0	-1
+7.2555748798838477	1.2658537096277853	0.54922986122566042	-2
+7.3427777377228001	2.650858971140456	1.0348418512717015	-2
+0	6.262882352941177	0	-1
+1.0643385601001016	5.6933571079901126	0.28512986299968929	-2
+2.2583182472065255	5.5156267449966911	0.52848620580468908	-2
+3.6854991569977633	5.5699248721841963	0.72410516928643787	-2
+6.5280845263310372	4.3032388061211861	0.91270996228809587	-2
+5.7504378688147817	5.4481291059733614	0.74236815980290816	-2
+9.385735294117648	0	0	-1
+8.6050220588235309	1.1114555045980328	0.85665354749640765	-2
+8.6142614072110621	2.7842431157697991	1.7206399994864419	-2
+7.9084174302812267	4.4041803580918542	1.412118457954574	-2
+0	7.824308823529412	0	-1
+1.8561053893999879	6.9129895887974762	0.71363164180577843	-2
+3.1891236169832595	6.8112543889643478	0.98314976459751668	-2
+4.7148090713372497	7.0580818606882785	0.99714026883215401	-2
+7.0174404401858421	5.597858021264055	0.76293855681881306	-2
+5.7649452736473368	6.723865677190175	0.72470787116128588	-2
+6.4886706274769637	6.4886706274769637	0.52959087413121742	-2
+10.947161764705882	0	0	-1
+9.6373123279842403	2.0175431318654082	2.1737014945528603	-2
+9.0829771433586686	3.9736831565038613	2.3837185601485449	-2
+8.9047525930392002	5.2118892660926806	1.7132811613669536	-2
+8.2691255455942247	5.6350203526318392	1.08480125254273	-2
+0	9.385735294117648	0	-1
+1.6979860125317074	8.3584640309370482	1.1308067007480993	-2
+3.6233013681698156	8.0756820564601668	1.6244536594627161	-2
+5.7311731733065781	7.4840988943176514	0.80532473879313604	-2
+5.1155541560621058	8.084673248623691	1.2891774075127695	-2
+7.6000000000000005	6.1200037934051217	0.61185300611832105	-2
+7.2000000000000002	6.3585707497076625	0.45175339693059524	-2
+6.3585707497076625	7.2000000000000002	0.44903527566737	-2
+7	7	0	0
+12.508588235294118	0	0	-1
+11.727875000000001	1.215993015106831	3.0992152895316809	-2
+11.936447034432481	2.6459055561402698	6.5981367378193925	-2
+10.333107734480667	3.9279462425216041	4.0781615506758984	-2
+10.043093820353814	5.0875592904037701	3.0838432522304036	-2
+9.5457086948702887	5.6269036458012884	1.9156367976698434	-2
+8.9001137587161647	5.9754599183937946	1.1000147723107288	-2
+8.5948044916961219	6.2737522581297291	0.70455857582592951	-2
+8	6.3585707497076642	0.50726605532832481	-2
+0	10.947161764705884	0	-1
+1.3218286822981609	9.9417113524381087	1.7680730534998768	-2
+3.4428279640286079	9.220050606993933	2.5621753058193022	-2
+4.6012127884656255	9.2028858883219407	2.3546216031056582	-2
+6.2822817653959557	7.8521065663986613	0.53806652779011688	-2
+5.9754599183937991	8.1001137587161587	0.8055390037486212	-2
+5.7238998060705351	8.692613952606397	1.2122679701761159	-2
+7.5999999999999996	6.5857442711815963	0.30278098573152007	-2
+7.4000000000000004	7	0	0
+7	7.4000000000000004	0	0
+6.5857442711815954	7.5999999999999996	0.3046843267926948	-2
+14.070014705882354	0	0	-1
+13.744356444001795	1.6520297860373017	8.2254691710665249	-2
+13.455116359724654	4.0271979628100931	15.909684411356283	-2
+11.958650057688029	4.6986676607362723	8.5180411259954827	-2
+10.753556019575921	5.0468893736798428	4.433904784432972	-2
+10.800000000000001	5.7569974889216073	3.3368653883622397	-2
+10.285389478204754	6.0685522978242981	1.9977333231333285	-2
+9.6000000000000014	6.3585707497076625	0.98785970106188514	-2
+9.2000000000000011	6.5857442711815946	0.53791008868002976	-2
+8.8000000000000007	6.6480340661906698	0.37671049759816749	-2
+8.3999999999999986	6.6535459896320654	0.31717331672488541	-2
+7.7999999999999998	7	0	0
+8.1999999999999993	7	0	0
+0	12.50858823529412	0	-1
+1.4393723135113385	11.370880319891876	3.2199802628402669	-2
+2.6494455874467633	10.483720389203452	3.7232061538957493	-2
+4.077396069252492	10.1893149408501	3.9087350022759706	-2
+5.1902920680835729	10.283594985316478	3.324813135319602	-2
+5.7238998060705395	9.7073860473936016	1.958926734667916	-2
+6.6480340661906725	8	0.28183045249878913	-2
+6.5857442711815946	8.3999999999999986	0.38482245289047251	-2
+6.3585707497076625	8.8000000000000007	0.6892231795805176	-2
+6.1200037934051217	9.2000000000000011	1.1122886411044284	-2
+7	7.7999999999999998	0	0
+15.631441176470588	0	0	-1
+15.254798303201273	1.4735742694054343	10.411123258956637	-2
+14.643693791253794	2.7825988371912374	16.952099756460552	-2
+14.217333238211351	5.4795437819985686	26.33035510168726	-2
+15.401156538335181	4.3977087503784418	32.806418924685808	-2
+12.98255955981416	5.5978580212640541	13.316343513920323	-2
+11.323764727619368	5.4726505836570629	5.1668469701991917	-2
+11.876169577789325	5.6963278823273118	6.3698788754061964	-2
+10.800000000000001	6.3585707497076625	1.8631276132639152	-2
+11.314610521795249	6.0685522978242927	3.5030144770401437	-2
+10.399999999999999	6.6480340661906725	0.8456073288135626	-2
+10	6.5857442711815963	0.79349980158027078	-2
+9.4000000000000004	7	0	0
+9.8000000000000007	7	0	0
+9	7	0	0
+8.5999999999999996	7	0	0
+0	14.070014705882356	0	-1
+1.6584902484813224	13.184696998467864	6.9088234970463631	-2
+2.8592773868236305	11.855854188975462	6.8919036297398524	-2
+3.9916689244189643	11.053065328758166	5.7035426418549866	-2
+4.8572820440096596	10.988817346960221	5.1537424147803046	-2
+5.6350203526318534	10.930874454405775	3.7945024787796511	-2
+5.9754599183938	10.299886241283836	2.144207588769206	-2
+6.3585707497076625	9.6000000000000014	0.98002094205318613	-2
+7	8.1999999999999993	0	0
+7	8.5999999999999996	0	0
+7	9	0	0
+6.5857442711815963	9.1999999999999993	0.53411147022570127	-2
+18.75429411764706	0	0	-1
+16.994918410051405	1.1843434401330701	11.207351150234599	-2
+16.087875294253866	2.7460772000178091	23.263964805918253	-2
+13.500668968081438	6.4919945808004966	15.780873864937513	-2
+15	6.4418831379779311	42.236998994192298	-2
+16.654161104556199	5.3986004521053941	56.765132467528417	-2
+17.000823139798875	4.2842565326028934	44.35129942647977	-2
+12.4	6.1200037934051208	7.0686820432633928	-2
+12.800000000000001	6.3585707497076625	7.9681181302649087	-2
+12	6.3585707497076651	4.0753558105935159	-2
+11	7	0	0
+10.6	7	0	0
+11.199999999999999	6.6480340661906707	1.3178574833735075	-2
+11.600000000000001	6.5857442711815972	2.0579258539631482	-2
+10.199999999999999	7	0	0
+0	15.631441176470592	0	-1
+1.8072673786456539	15.284936880673436	12.787525710516103	-2
+2.8544750950298523	14.507471049416536	16.808968086057135	-2
+3.4424654765885871	13.343269850645033	13.529510636935235	-2
+4.1848078913518867	12.26786077881545	9.8873194250875329	-2
+4.6363011016754427	11.634325366966726	7.3486381058698562	-2
+5.3183861712104523	11.617798459056985	6.3249630579603773	-2
+6.2737522581297345	10.605195508303874	1.8305729387467691	-2
+6.3585707497076625	11.199999999999999	2.335044465658211	-2
+6.0685522978242981	11.714610521795246	4.4312697256930091	-2
+6.5857442711815963	10	0.78040848991168998	-2
+6.6480340661906725	10.399999999999999	0.83591547539082778	-2
+7	9.8000000000000007	0	0
+7	9.4000000000000004	0	0
+20.315720588235294	0	0	-1
+19.214773398218341	1.6662567948811744	18.568932127372666	-2
+17.87652259627728	2.760577435930788	29.685192079122153	-2
+13	7	0	0
+13.414255728818404	7.2000000000000002	10.407136773437019	-2
+14.169271739847707	7.0357106460867627	27.431203573038786	-2
+15.830728260152293	7.0357106460867627	63.032296384943749	-2
+16.499331031918562	6.4919945808004975	71.178618432146436	-2
+14.966202518144343	7.462470361992918	45.275432849379548	-2
+17.738331305587877	5.1887003633659381	61.905588762627922	-2
+17.199999999999999	6.3585707497076651	80.228596461440958	-2
+18.16461020279127	4.3710701814279815	51.213012099954838	-2
+12.4	6.5857442711815963	3.7100775847259895	-2
+12.6	7	0	0
+11.800000000000001	7	0	0
+12.199999999999999	7	0	0
+11.4	7	0	0
+0	18.754294117647063	0	-1
+1.2011976719786379	17.022452381491536	11.412929251829921	-2
+3.0069450647580762	16.680305668616811	28.31109426843496	-2
+3.9633906857053898	15.194059232233073	27.880869390466483	-2
+4.664464602925964	12.880349697961377	13.434590200267753	-2
+5.4457968844090177	14.231672325870711	26.551840634851395	-2
+4.9620183087018326	12.233843074640623	9.4754223930898505	-2
+5.6717571758902139	12.286566525027597	8.2868658856293198	-2
+6.6535459896320654	10.800000000000001	1.0198223694183812	-2
+7	11.4	0	0
+7	11	0	0
+6.6480340661906725	11.600000000000001	1.6767976454083739	-2
+6.5857442711815963	12	2.6636722500502068	-2
+6.3585707497076625	12.399999999999999	5.3478803877912853	-2
+7	10.199999999999999	0	0
+7	10.6	0	0
+21.877147058823532	0	0	-1
+20.981606911769315	1.3042469608001523	14.414861883610824	-2
+20.589005152696142	2.7150370193839022	31.492394338885791	-2
+19.02888278411724	3.9219332598742933	47.143361544100465	-2
+13	7.4000000000000004	0	0
+13.641429250292337	7.5999999999999996	15.391095151632463	-2
+14.163786877682439	7.5595995676296388	27.40661213480027	-2
+16.585744271181596	7.2000000000000002	85.316541201594106	-2
+15.731173173306569	7.8840988943176535	64.952456791704748	-2
+16.358570749707663	7.5999999999999996	80.603642841276198	-2
+17	7	100.00000003700208	1
+14.361189717289871	7.9984409334310671	32.259720554461353	-2
+15.134797641301185	8.4770420555391315	51.493073227820339	-2
+18.278575144878239	5.2860810035453767	66.094498252052801	-2
+17.885389478204754	6.0685522978243052	79.095960374792014	-2
+17.399999999999999	7	100.00000003700208	1
+17.600000000000001	6.5857442711815963	89.045072816195514	-2
+18.702409156409164	4.8395966183809449	60.13377726206167	-2
+0	20.315720588235298	0	-1
+0.95593566813080721	19.535007352941179	10.564720753936173	-2
+1.24450768025574	18.334985540145151	13.186353502255056	-2
+2.8377510687646041	17.858802188168763	30.323781930878692	-2
+4.1666376804272112	16.94973783454877	42.800763743891274	-2
+3.8046484993394492	17.564132509877805	41.317986222555099	-2
+5.7620095469502761	15.454997839125275	45.108168315550188	-2
+5.4117711824955252	16.843372757412972	58.166534643900626	-2
+5.8307282601522914	12.964289353913234	12.478490362660853	-2
+6.49933103191856	13.508005419199504	16.048161460378729	-2
+6.7239270571206866	14.235026932221723	28.462806100027827	-2
+7	11.800000000000001	0	0
+7	12.199999999999999	0	0
+7	12.6	0	0
+6.5857442711815946	12.799999999999999	5.4836491499818063	-2
+23.438573529411766	0	0	-1
+22.229276728256668	2.0709181808498625	21.453151983035514	-2
+20.475355023456636	4.6842155253538227	58.973691873115818	-2
+22.213998457252558	3.8330607670730577	42.571875933772759	-2
+19.31789912889753	4.8520733684517152	61.472341955327309	-2
+13	7.7999999999999998	0	0
+13.414255728818404	7.9999999999999991	9.923904099423444	-2
+13.879996206594877	7.9999999999999991	20.975966985450775	-2
+17	7.4000000000000004	100.0000000370021	1
+16.282281765395954	8.2521065663986608	80.381670342478586	-2
+15.975459918393797	8.5001137587161626	72.711974011584672	-2
+17	7.7999999999999998	100.00000003700205	1
+16.585744271181596	8	88.16633749654244	-2
+14.096048355975139	8.3999999999999986	26.290118419657798	-2
+14.358303253862593	8.7999999999999989	32.915555172361017	-2
+14.980079623919792	9.199999999999994	48.473223880519335	-2
+15.731173173306571	9.4840988943176558	67.52331879467522	-2
+18.359393753187735	5.8290494625960525	76.283373315109259	-2
+18.80345144262397	5.4468642957049918	70.53904247943025	-2
+18	6.6480340661906725	91.947487702031722	-2
+18.399999999999999	6.3585707497076598	86.687044499508872	-2
+17.800000000000001	7	100.00000003700208	1
+0	21.877147058823532	0	-1
+1.1927467651394532	20.800567110681904	13.161258400747517	-2
+2.3383164684754632	19.091240622911013	26.432467007448526	-2
+3.6482844764004052	18.8624978992911	43.043072858475874	-2
+4.0750983996467198	18.223961151057502	47.332006303846313	-2
+4.5170485269128511	17.595805605884895	51.118821320047033	-2
+6.4886706274769654	16.488670627476964	71.465273758905028	-2
+7.0174404401858403	15.597858021264056	57.226285789487122	-2
+5.2515687726189784	17.569895469995267	61.870926824436339	-2
+6.3585707497076651	17.199999999999999	80.408902014972981	-2
+5.9880949863521025	17.674915470529147	76.286519605364006	-2
+7	13	0	0
+7.2000000000000002	13.641429250292337	15.765826649780948	-2
+7.484098894317655	14.268826826693426	29.754536306144786	-2
+7.6168189413181455	14.915981359808923	44.565005829184884	-2
+25	0	0	-1
+24.219286764705885	1.2832184014590977	10.274160058921625	-2
+23.780364648891869	2.9072830427407794	25.540476432946523	-2
+20.907386047393601	5.7238998060705484	75.858817432810213	-2
+21.515326751376293	5.115554156062089	63.825075792582503	-2
+19.817440440185834	5.5978580212640576	74.348518345229976	-2
+22.618682237171136	5.1112481868878126	58.484651409250034	-2
+23.273426152962585	4.6547328424561947	47.046942460334847	-2
+19.305046976637055	5.7496094915333096	76.670560685249328	-2
+13	8.1999999999999993	0	0
+13.641429250292337	8.3999999999999986	15.412798582496571	-2
+16.648034066190672	8.3999999999999986	90.385905733565664	-2
+16.585744271181596	8.7999999999999989	89.02821170544992	-2
+16.358570749707663	9.1999999999999993	83.342080088202422	-2
+17	8.1999999999999993	100.0000000370021	1
+13.879996206594878	8.7999999999999989	21.300444484387526	-2
+14.096048355975137	9.1999999999999993	26.737620624991301	-2
+14.3583032538626	9.6000000000000014	33.377768986361822	-2
+15.196540361724262	10.052557373307138	54.395601913503306	-2
+16.282281765395954	9.8521065663986604	81.669054295329943	-2
+15.975459918393799	10.100113758716162	73.949613371267759	-2
+18.8506399314414	6.0308385929665445	81.190266288054829	-2
+18.199999999999999	7	100.00000003700207	1
+18.600000000000001	7	100.00000003700202	1
+18.800000000000001	6.5857442711815928	91.766026249389625	-2
+0	23.438573529411769	0	-1
+1.7455025071480783	22.130761031183454	17.992607467224417	-2
+2.4771659019870698	20.889945390922794	28.146743456706744	-2
+4.1826308090204973	20.301721404220217	51.533027864495978	-2
+4.9762861862422207	19.041230678033418	63.091932391034042	-2
+4.8425286479773559	18.254785133097876	58.839298880506384	-2
+7	17	100.00000003700208	1
+7.2000000000000002	16.358570749707663	77.981027323524728	-2
+7.5636860045927667	15.574464838449568	59.658008062777242	-2
+7.5999999999999996	16.120003793405122	73.904916404147485	-2
+5.6387251349570811	18.205198559181298	72.17578585727459	-2
+7	17.399999999999999	100.00000003700208	1
+6.5857442711815963	17.600000000000001	89.131036076109481	-2
+6.2737522581297345	18.205195508303877	84.47903711760253	-2
+7.4000000000000004	13	0	0
+7.6000000000000005	13.414255728818404	10.019988296722424	-2
+7.8521065663986613	13.717718234604046	17.133033881670357	-2
+8.1001137587161605	14.024540081606201	24.434720899404841	-2
+7.9938733136774944	15.458432833115472	58.350971663117548	-2
+8.4908137426769983	14.89881094979755	45.638072338607941	-2
+26.561426470588238	0	0	-1
+25.566627676732043	1.9471725326964622	11.667203236394078	-2
+25.269208086828513	3.9531858386513159	25.062875540062116	-2
+20.399999999999999	6.120003793405119	83.506990179082862	-2
+21.499886241283836	5.9754599183937938	79.277661963963212	-2
+20.800000000000001	6.3585707497076651	87.71427767618718	-2
+22.115901105682344	5.7311731733065656	72.209476524156088	-2
+19.347893433601339	6.282281765395954	86.433610104505902	-2
+20	6.3585707497076651	88.01189523763037	-2
+22.964289353913237	5.8307282601522861	67.319444535842976	-2
+23.687451339222804	5.7980236751452683	57.427328012008914	-2
+24.820664624433928	5.4995490722480138	39.332293933092025	-2
+13	8.5999999999999996	0	0
+13.414255728818404	8.8000000000000007	10.027093297052875	-2
+17	8.5999999999999996	100.00000003700205	1
+17	9	100.00000003700207	1
+17	9.4000000000000004	100.00000003700202	1
+16.585744271181596	9.5999999999999996	89.343362637988022	-2
+13.641429250292337	9.1999999999999993	15.6388504475837	-2
+13.87999620659488	9.5999999999999996	21.604163618714765	-2
+14.096048355975134	10	27.068749038081751	-2
+14.384730067268302	10.414273924593932	34.378014005993172	-2
+15.025708670586548	10.813999307310295	50.360328244276921	-2
+15.731173173306567	11.084098894317655	67.886341697412263	-2
+16.648034066190672	10	91.006071548866586	-2
+16.585744271181596	10.399999999999999	89.450631371254786	-2
+16.358570749707663	10.800000000000001	83.681379862422816	-2
+19	7	100.00000003700208	1
+19.199999999999999	6.6480340661906716	93.24776100409801	-2
+0	25.000000000000004	0	-1
+2.3590871392139845	23.434014143880805	21.146399116544647	-2
+3.0702393355912729	22.075784336136252	33.392923059085696	-2
+5.205824794291817	21.091975418509161	66.52323043232019	-2
+5.4736423960023011	20.37039760733251	72.107929191117506	-2
+4.3959012494426748	22.099671399494596	50.524217641904102	-2
+5.9964916448802317	18.729853275686974	80.279148524265622	-2
+6.0685522978242936	19.714610521795244	82.657962531430186	-2
+7.4000000000000004	17	100.0000000370021	1
+7.5999999999999996	16.585744271181596	87.237991750888	-2
+8	15.903951644024861	69.657330879004917	-2
+8	16.358570749707663	81.805591615905414	-2
+7	17.800000000000001	100.00000003700208	1
+6.6480340661906725	18	91.924245893390562	-2
+6.6535459896320672	18.399999999999999	92.67788966243512	-2
+6.5857442711815972	18.800000000000001	91.779586441214931	-2
+7.7999999999999998	13	0	0
+8	13.351965933809328	8.4428625689534069	-2
+8.3999999999999986	13.414255728818405	9.9658197733737808	-2
+8.9567309024626951	14.225919675211941	29.763840269939351	-2
+8.8000000000000007	13.641429250292337	15.529996327113361	-2
+8.4000000000000004	15.641696746137407	63.881706992621943	-2
+9.1084064595109293	15.000222842770462	48.842584966652915	-2
+28.122852941176472	0	0	-1
+27.066552835814321	1.485770678491543	6.2767181764193571	-2
+26.185350229828824	3.0639617879915022	15.546172932207627	-2
+25.779030482821877	5.4804420753123901	26.687811754038062	-2
+27.50713971231945	4.3396856401500594	11.96836092981137	-2
+20.399999999999999	6.5857442711815963	92.185293957765495	-2
+21.199999999999999	6.5857442711815972	91.732820143099943	-2
+21.747893433601337	6.2822817653959504	84.731308587446733	-2
+20.600000000000001	7	100.00000003700208	1
+21	7	100.0000000370021	1
+22.399999999999999	6.3585707497076598	83.761818562757156	-2
+19.600000000000001	6.5857442711815963	92.191284400661644	-2
+20.199999999999999	7	100.00000003700211	1
+19.800000000000001	7	100.00000003700211	1
+22.800000000000001	6.5857442711815928	86.971523422351012	-2
+23.508005419199502	6.4993310319185644	72.180102252108924	-2
+24.241792328163683	6.2635759438084193	54.148370559635083	-2
+24.991399215965327	6.4427775149437236	41.814876528648249	-2
+13	9	0	0
+17	9.8000000000000007	100.00000003700207	1
+13	9.4000000000000004	0	0
+13.414255728818404	9.6000000000000014	10.166746872927053	-2
+13.641429250292335	10	15.840463207359702	-2
+13.87999620659488	10.4	21.856233948700474	-2
+14.276100193929457	10.907386047393603	31.895169115653747	-2
+15.093435978396593	11.693444429225726	52.204230043324131	-2
+16.282281765395954	11.45210656639866	81.560936594873183	-2
+15.975459918393799	11.700113758716164	73.621804384887	-2
+17	10.199999999999999	100.00000003700208	1
+17	10.6	100.0000000370021	1
+17	11	100.0000000370021	1
+16.585744271181596	11.199999999999999	89.379048366363179	-2
+19.399999999999999	7	100.00000003700208	1
+0	26.561426470588238	0	-1
+2.4941627074280621	25.001640337002186	17.280511340182048	-2
+2.1204538838710465	26.530050951229995	10.298707553211193	-2
+4.0399975499335277	24.708226073230474	29.789374222123584	-2
+4.4663167043494543	23.527070092542491	42.726839174296458	-2
+5.9754599183937973	21.099886241283841	80.202395368928208	-2
+5.6350203526318543	21.730874454405779	72.210719248730797	-2
+6.3585707497076598	20.399999999999999	87.95408412594891	-2
+5.5978580212640523	22.982559559814167	63.583426247367782	-2
+6.3585707497076651	19.199999999999999	87.663455678905507	-2
+6.6480340661906716	19.600000000000001	93.340796379323137	-2
+6.5857442711815954	20	92.23032343304827	-2
+7.7999999999999998	17	100.00000003700205	1
+8.4000000000000004	16.120003793405122	76.223474998191648	-2
+8.1999999999999993	17	100.0000000370021	1
+8.4000000000000004	16.585744271181596	88.691640442573586	-2
+7	18.199999999999999	100.00000003700207	1
+7	18.600000000000001	100.0000000370021	1
+7	19	100.0000000370021	1
+8.1999999999999993	13	0	0
+8.5999999999999996	13	0	0
+9.4929345535162959	14.506417941171392	36.951221246267608	-2
+9.4853894782047519	13.93144770217571	22.815287740548829	-2
+9	13	0	0
+9.1999999999999993	13.414255728818404	10.09606382139302	-2
+8.8000000000000007	15.903951644024861	71.182918459137881	-2
+9.2018097697071646	15.638346129700857	64.897412945348364	-2
+9.7336244946344692	15.02864016986023	50.013227282518329	-2
+29.684279411764706	0	0	-1
+28.564143592943086	1.9546939963956829	5.7179917225676027	-2
+27.449834468397512	2.8875660713076359	10.109773563477953	-2
+27.035710646086763	5.8307282601522861	13.203540011200021	-2
+25.764973067778275	6.7239270571206857	28.478728454452657	-2
+26.491994580800498	6.4993310319185635	16.253032487263781	-2
+28.509013966748093	4.6795044241558621	8.402916430833935	-2
+28.138331305587922	5.1887003633659399	8.6430710558300241	-2
+28.898176391753871	3.6957455946586384	7.8902262268743613	-2
+21.399999999999999	7	100.00000003700208	1
+21.600000000000001	6.6480340661906716	92.536325031293501	-2
+22	6.5857442711815954	90.479562136679874	-2
+22.199999999999999	7	100.00000003700205	1
+22.600000000000001	7	100.00000003700202	1
+23	7	100.00000003700208	1
+23.641429250292337	7.2000000000000002	78.095723443307023	-2
+24.402141978735944	7.0174404401858403	57.331946951874258	-2
+25.062438076926423	7.2627866914218799	43.852038968075853	-2
+13	9.8000000000000007	0	0
+13	10.199999999999999	0	0
+13.414255728818404	10.4	10.295366362275566	-2
+13.641429250292337	10.800000000000001	16.051583176477429	-2
+14.024540081606203	11.499886241283837	26.029674213207826	-2
+15.000000000000004	12.63173678257548	49.690253258282596	-2
+14.268826826693431	12.115901105682344	32.766192760277029	-2
+16.648034066190672	11.600000000000001	90.817656132458509	-2
+16.585744271181596	12	88.794255589020622	-2
+16.358570749707663	12.399999999999999	81.871632373199276	-2
+15.830728260152293	12.964289353913236	66.742379334689815	-2
+17	11.4	100.00000003700207	1
+0	28.122852941176475	0	-1
+1.2451574510288448	28.261668551821717	4.0962508407032843	-2
+4.3381597419957041	26.221423391474307	20.104656828123755	-2
+3.8434962364642882	27.422109475764827	12.549549758573733	-2
+2.4858978809073764	28.435593930292768	7.2301290941713194	-2
+5.5079462508112709	25.181294174360744	34.404950114063617	-2
+5.5064703678068678	24.230602485921093	46.871759770983786	-2
+6.5857442711815928	20.800000000000001	92.037259297638045	-2
+6.2737522581297336	21.405195508303876	85.3337606709391	-2
+6.6480340661906716	21.199999999999999	92.949668977537726	-2
+6.120003793405119	22.399999999999999	78.250674556981792	-2
+6.3585707497076651	22	85.353653454102528	-2
+7	20.600000000000001	100.00000003700202	1
+7	20.199999999999999	100.00000003700205	1
+6.3585707497076651	22.800000000000001	80.571160284990341	-2
+6.4886706274769654	23.511329372523036	71.619271649026743	-2
+7	19.399999999999999	100.00000003700208	1
+7	19.800000000000001	100.00000003700208	1
+8.8000000000000007	16.358570749707663	83.007398142956049	-2
+8.5999999999999996	17	100.0000000370021	1
+9.9574179755487826	14.167444705429691	28.795037406739269	-2
+9.6000000000000014	13.35196593380933	8.6369470666009125	-2
+10	13.641429250292335	15.832100161087569	-2
+9.4000000000000004	13	0	0
+9.2000000000000011	16.120003793405122	77.152569546360382	-2
+9.642582024451217	15.832555294570305	70.108668436117654	-2
+10.114417284233033	15.47887730886281	61.42597979056918	-2
+10.49450079734269	14.509942436472757	37.483200145441153	-2
+31.245705882352944	0	0	-1
+30.695152840182693	1.6687311106475187	4.4345019133530137	-2
+29.828510141939564	3.1973587976490609	6.8447355201070517	-2
+27.199999999999999	6.5857442711815928	5.8423995120376686	-2
+27.600000000000001	6.3585707497076598	6.1143521609947937	-2
+25.731173173306573	7.4840988943176558	29.560914536604564	-2
+26.358570749707663	7.2000000000000002	15.75809917713261	-2
+27	7	0	0
+29.137099689576576	4.7263495367273887	7.1043435953803398	-2
+28.678575144878256	5.286081003545414	6.8572781570399544	-2
+28.285389478204756	6.0685522978242936	5.0281209411046168	-2
+29.790747040284803	4.2521024794606426	6.9363762033642473	-2
+21.800000000000001	7	100.00000003700207	1
+23	7.4000000000000004	100.0000000370021	1
+23.414255728818404	7.5999999999999996	87.274445315960904	-2
+23.879996206594878	7.5999999999999996	73.962252092972776	-2
+24.425535161550432	7.5636860045927667	59.777727228310738	-2
+25.030157525875257	8.0189641670976766	46.555948748583383	-2
+13	10.6	0	0
+13	11	0	0
+13.414255728818404	11.200000000000001	10.496325661375185	-2
+13.717718234604048	11.747893433601339	18.550543032580549	-2
+15.154003615804573	13.450901014411572	52.496479018912957	-2
+14.169271739847712	12.964289353913234	33.551960987644442	-2
+13.641429250292337	12.399999999999999	17.961241658706857	-2
+17	11.800000000000001	100.00000003700208	1
+17	12.199999999999999	100.00000003700207	1
+17	12.6	100.00000003700202	1
+16.585744271181596	12.799999999999999	86.49761937327024	-2
+16.499331031918562	13.508005419199504	73.534254047235365	-2
+15.445796884409024	14.231672325870713	52.813548873969147	-2
+0	29.68427941176471	0	-1
+1.8446372172752308	29.361809843416864	5.0427985613539272	-2
+5.7980230090606746	26.31254784169894	21.034136363096533	-2
+5.1155812463484756	27.161075408368482	13.790192593703537	-2
+3.9362096092274523	28.717386777049928	8.5812274588962083	-2
+5.2776897231932711	28.3222602379549	8.1276952808614364	-2
+3.5190366492626657	29.491735778297848	7.3770794230603123	-2
+2.7869149937613713	29.979226840580512	6.4687534187203033	-2
+6.2635811956236234	25.758210715012261	28.688943131185503	-2
+6.4428259622249033	25.008618785593143	41.988849896363007	-2
+6.7238656771901759	24.235054726352669	59.056760988979462	-2
+7	21	100.00000003700208	1
+6.6535459896320672	21.600000000000001	92.647477425653449	-2
+7	21.399999999999999	100.0000000370021	1
+6.5857442711815963	22.399999999999999	89.240394880425285	-2
+7	22.199999999999999	100.00000003700211	1
+7	21.800000000000001	100.00000003700205	1
+7	22.600000000000001	100.00000003700208	1
+7	23	100.00000003700208	1
+7.2000000000000002	23.641429250292337	78.299118988425874	-2
+9	17	100.00000003700207	1
+9.2000000000000011	16.585744271181596	89.20171704715959	-2
+10.4	13.87999620659488	21.839537580554634	-2
+9.8000000000000007	13	0	0
+10.199999999999999	13	0	0
+10.399999999999999	13.414255728818404	10.288603203621662	-2
+9.6000000000000014	16.358570749707663	83.490522999060701	-2
+10.114610521795246	16.068552297824297	76.275162758830916	-2
+10.676169577789322	15.696327882327301	66.993121993222488	-2
+10.825561677654079	15.066349767571625	51.369876643771299	-2
+11.084098894317655	14.268826826693433	31.774210434108717	-2
+32.807132352941181	0	0	-1
+32.148015716002746	1.7054995146630185	5.966564185471376	-2
+30.860580477126149	3.4181326851355269	7.5473309413566447	-2
+27.399999999999999	7	0	0
+27.800000000000001	7	0	0
+28	6.5857442711815954	3.0526790445055485	-2
+26.282281765395954	7.8521065663986613	17.065164025826867	-2
+25.975459918393799	8.1001137587161622	24.337528331213232	-2
+27	7.4000000000000004	0	0
+26.585744271181596	7.6000000000000005	9.9962855299921305	-2
+29.779357542629029	5.0595895751824269	5.9899704953479391	-2
+29.203451442623962	5.4468642957050237	5.5666441464149878	-2
+28.759393753187737	5.8290494625960676	4.9873433744063753	-2
+28.399999999999999	6.6480340661906716	1.9700808210807228	-2
+28.800000000000001	6.3585707497076651	2.9061107732801776	-2
+30.454324424932601	4.7123526125383446	6.7334416475916354	-2
+23	7.7999999999999998	100.00000003700205	1
+23.641429250292337	8	81.817492297073983	-2
+24.096048355975139	8	69.613498668672918	-2
+24.384730067268297	8.4142739245939353	63.268214062757202	-2
+25.02570867058655	8.8139993073102882	47.867824716439856	-2
+13	11.4	0	0
+13.351965933809328	11.600000000000001	9.1052801940953092	-2
+13.414255728818404	12	11.087763800694519	-2
+14.395097780565141	13.947901136630396	43.781351337664923	-2
+13.414255728818405	12.800000000000001	13.4992833094711	-2
+13.493820655405248	13.49382065540525	25.961076116492116	-2
+13	12.199999999999999	0	0
+13	12.6	0	0
+17	13	100.00000003700207	1
+16.72392705712069	14.235026932221722	63.447843280932638	-2
+17.199999999999999	13.641429250292335	80.006375919051607	-2
+16.082881052294898	14.988094419109025	49.756531471721452	-2
+14.727718267743176	15.497068554600679	51.436085514761864	-2
+0	31.245705882352944	0	-1
+1.8022326741133705	30.487550937614582	4.8383617846168336	-2
+5.8307282601522861	27.035710646086763	13.161275618652843	-2
+6.4993310319185644	26.491994580800498	15.868962634905115	-2
+5.5992308675497009	27.702586829195756	9.6978536770489416	-2
+4.3962585015086448	29.556012338578938	7.0912871444123349	-2
+5.2645313116905097	29.154714266271224	6.2480581726231872	-2
+5.8526482141437244	28.718248337171527	5.233261305260088	-2
+5.9754599183937991	28.299886241283836	5.6988007745956999	-2
+3.5462250421271833	30.32606910211225	7.2775984643831579	-2
+2.8534975815665398	30.838028829371464	7.0332895162520721	-2
+7.0174404401858403	25.597858021264056	32.072536869601386	-2
+7.2627866914218799	24.937561923073577	46.7695410295958	-2
+7.4840988943176558	24.268826826693427	63.427008257730215	-2
+7.4000000000000004	23	100.0000000370021	1
+7.6000000000000005	23.414255728818404	87.230594071524621	-2
+7.8521065663986613	23.717718234604046	79.47422045507227	-2
+9.4000000000000004	17	100.00000003700208	1
+10.800000000000001	13.641429250292337	16.040591598384776	-2
+10.6	13	0	0
+9.8000000000000007	17	100.00000003700207	1
+10	16.648034066190672	90.992560398274136	-2
+10.4	16.585744271181596	89.438823543886926	-2
+10.800000000000001	16.358570749707663	83.664177315534801	-2
+11.181548032907871	15.607149304781336	64.750194802092423	-2
+11.200000000000001	16.120003793405122	77.556775609411432	-2
+11.652801703564371	15.22746170155137	55.412379888140421	-2
+11.580690678250287	14.622234282006781	40.74931401003488	-2
+11.45210656639866	13.717718234604046	18.254685703855113	-2
+11.700113758716164	14.024540081606201	26.166494914425616	-2
+34.368558823529412	0	0	-1
+33.587845588235297	1.507882737802491	7.5277231162015861	-2
+32.632611285538836	3.0756562887060275	10.892043179720066	-2
+31.565146244261445	4.2002166666290721	9.084182717139889	-2
+28.199999999999999	7	0	0
+26.648034066190672	8	8.4155308145486032	-2
+26.585744271181596	8.3999999999999986	9.9401370534469731	-2
+25.731173173306566	9.0840988943176555	30.870072339834497	-2
+26.358570749707663	8.8000000000000007	15.50738031940798	-2
+27	7.7999999999999998	0	0
+29.70504697663705	5.7496094915332918	4.3687812351560549	-2
+30.217440440185847	5.5978580212640514	4.8130200970617807	-2
+29.250639931441395	6.0308385929665551	3.7337758527686082	-2
+28.600000000000001	7	0	0
+29	7	0	0
+29.199999999999999	6.5857442711815972	1.7017744489429398	-2
+30.762697818453439	5.5755673606053726	5.2643941411200919	-2
+31.648715871077709	5.2495423509623667	7.8260575012803493	-2
+23	8.1999999999999993	100.0000000370021	1
+23.414255728818404	8.4000000000000004	88.694226925162212	-2
+23.879996206594878	8.4000000000000004	76.232293667466934	-2
+24.276100193929459	8.9073860473936026	66.743391790432554	-2
+25.093435978396581	9.6934444292257336	46.95220427035126	-2
+13	11.800000000000001	0	0
+13.649433249595052	14.627955507265051	45.227499166861726	-2
+13	13	0	0
+12.799999999999999	13.414255728818405	13.463874274255572	-2
+12.964289353913234	14.169271739847709	33.412013256264125	-2
+17.399999999999999	13	100.00000003700208	1
+17.484098894317654	14.268826826693429	66.287271361788711	-2
+17.066879064789745	15.08708195123333	48.453561028095478	-2
+17.600000000000001	13.414255728818404	88.128049899514522	-2
+17.85210656639866	13.717718234604046	80.781774215507539	-2
+16.388232798182251	15.722096533635071	39.97774704407103	-2
+15.759482668655739	16.208586068430584	40.925464343744814	-2
+14.259899479320493	16.241321076937339	59.756232058001579	-2
+15	16.543842801818837	50.009422574468154	-2
+13.346558913607923	15.39481931061124	56.230038325333787	-2
+0	32.807132352941181	0	-1
+1.6107788506858374	31.579035290112522	5.039892408178468	-2
+6.5857442711815928	27.199999999999999	5.688743755943162	-2
+6.3585707497076598	27.600000000000001	5.8199240638764254	-2
+7	27	0	0
+7.2000000000000002	26.358570749707663	15.875689234516965	-2
+5.2532741720607774	29.980820478998915	5.6408805815044092	-2
+4.3515947660791339	30.545684474241117	7.2918891566240376	-2
+5.9964916448802228	29.129853275686973	4.1062150985439176	-2
+6.2737522581297336	28.605195508303876	3.637348901901611	-2
+6.5857442711815954	28	3.0250490910653252	-2
+6.6480340661906716	28.399999999999999	2.0223932859590579	-2
+3.7762848741060102	31.068924335842979	8.0825864216350851	-2
+3.0544224003906422	31.67564647133624	8.6102569405376403	-2
+7.5999999999999996	26.120003793405122	20.930508959561692	-2
+7.5636860045927667	25.574464838449568	33.191901380561198	-2
+8.0189641670976766	24.969842474124743	48.059245155550876	-2
+8.1001137587161622	24.024540081606201	71.893676381568454	-2
+7.7999999999999998	23	100.00000003700208	1
+8	23.351965933809328	89.927504016263569	-2
+8.3999999999999986	23.414255728818404	88.71468553762783	-2
+11	13	0	0
+11.199999999999999	13.414255728818404	10.481928087402895	-2
+10.199999999999999	17	100.00000003700208	1
+10.6	17	100.0000000370021	1
+11	17	100.00000003700207	1
+11.200000000000001	16.585744271181596	89.378418494107336	-2
+11.642582024451217	15.832555294570305	70.103508726674704	-2
+11.600000000000001	16.358570749707663	83.361279377965602	-2
+12.257034725294346	15.193621583277304	54.511044599539382	-2
+12.291381109162131	14.453456880309556	37.470108874267012	-2
+11.600000000000001	13.351965933809328	9.0823279825771763	-2
+12	13.414255728818404	11.08245318338578	-2
+12.399999999999999	13.641429250292337	17.901392676781345	-2
+35.92998529411765	0	0	-1
+35.241863068760594	1.891874509645181	13.675970085113587	-2
+34.646825361244908	3.5887564676394326	22.318843570621357	-2
+33.623622276098196	4.2681389403762013	18.728000675059132	-2
+32.5292779719666	4.6227309101286496	12.592695396950505	-2
+27	8.1999999999999993	0	0
+27	8.5999999999999996	0	0
+26.282281765395954	9.4521065663986601	17.559859333048227	-2
+25.975459918393799	9.7001137587161637	25.167908294613706	-2
+27	9	0	0
+26.585744271181596	9.1999999999999993	10.08638354848688	-2
+29.747893433601337	6.2822817653959504	2.6357484932971125	-2
+30.800000000000001	6.1200037934051235	3.5244678034549719	-2
+30.399999999999999	6.3585707497076598	2.4457646615868387	-2
+29.399999999999999	7	0	0
+29.600000000000001	6.6480340661906716	1.3438884067083083	-2
+31.206248174482248	5.8934754664702096	4.8685850362110026	-2
+32.161012983132835	5.6389312318571765	8.5027438448986778	-2
+31.6506399314414	6.0308385929665427	5.2031652036346179	-2
+23	8.5999999999999996	100.0000000370021	1
+23.641429250292337	8.8000000000000007	83.001238817952071	-2
+24.024540081606204	9.4998862412838374	73.628622568582401	-2
+25.731173173306562	10.684098894317655	31.550063185482966	-2
+24.268826826693434	10.115901105682344	67.74141036562412	-2
+12.855531289558948	14.850514789554195	46.823532742519014	-2
+12.6	13	0	0
+17.800000000000001	13	100.0000000370021	1
+18.100113758716162	14.024540081606201	73.444463787347971	-2
+18.159783312637472	15.073849963600162	48.251672862643396	-2
+17.300113758716169	15.975459918393792	28.687452374554677	-2
+18	13.351965933809328	90.536859778546955	-2
+18.399999999999999	13.414255728818404	89.253263745882563	-2
+16.535596887370595	16.503302407949167	25.09047301320598	-2
+15.830728260152286	17.035710646086763	33.411021752329454	-2
+13.500668968081435	16.491994580800498	73.854888441514206	-2
+14.169271739847714	17.035710646086763	66.482708712322136	-2
+14.876907637134929	17.501387416259707	52.841144132583601	-2
+12.800000000000001	16.358570749707663	79.658397788735215	-2
+0	34.368558823529412	0	-1
+1.5836545541465503	33.045671379831461	6.9770492315417076	-2
+3.0445053258536507	32.912734665822178	11.831250744146397	-2
+7	27.399999999999999	0	0
+7	27.800000000000001	0	0
+7.4000000000000004	27	0	0
+7.5999999999999996	26.585744271181596	10.005736789126992	-2
+5.7053183454346366	30.672365317182731	4.8986958430285021	-2
+6.0685522978243052	30.114610521795246	3.3998385897534185	-2
+4.3352791759492435	31.60955988321113	9.2079008191747143	-2
+5.052108219922312	31.346545251952886	7.5966304896957295	-2
+6.5857442711815928	29.199999999999999	1.7467245939653289	-2
+6.3585707497076598	29.600000000000001	2.5197925541638626	-2
+6.6535459896320646	28.800000000000001	1.6880919741695717	-2
+7	28.199999999999999	0	0
+7	28.600000000000001	0	0
+4.145853765959032	32.349248053043048	11.649253808399397	-2
+8	25.903951644024861	26.01490646728918	-2
+8	26.358570749707663	15.331183156680968	-2
+8.4142739245939353	25.615269932731703	33.197073672464867	-2
+8.8139993073102882	24.97429132941345	49.225260323483759	-2
+9.0840988943176555	24.268826826693434	67.208220023529336	-2
+8.8000000000000007	23.641429250292337	83.052378770717482	-2
+8.1999999999999993	23	100.00000003700208	1
+8.5999999999999996	23	100.0000000370021	1
+11.4	13	0	0
+11.4	17	100.00000003700208	1
+12.114610521795246	16.068552297824297	75.264999291183202	-2
+11.800000000000001	17	100.00000003700207	1
+12	16.648034066190672	90.491459618958885	-2
+11.800000000000001	13	0	0
+12.199999999999999	13	0	0
+37.491411764705887	0	0	-1
+36.534314359894729	1.1508381249409225	10.300335922637558	-2
+35.716699580278672	3.626235642760562	29.378961750242354	-2
+37.126058965576519	2.3081973307223627	22.638638727660254	-2
+35.336889873884807	4.6271253070342411	34.630253748090091	-2
+34.62444240067628	4.8353108713087014	29.078744281769541	-2
+33.345729769071028	5.3844277361348727	17.339035655083009	-2
+26.648034066190672	9.6000000000000014	8.6247484736448836	-2
+26.585744271181596	10	10.219328852357579	-2
+26.358570749707663	10.399999999999999	15.915725108439215	-2
+27	9.4000000000000004	0	0
+30	6.5857442711815954	1.5542235505010025	-2
+30.800000000000001	6.5857442711815972	1.7195665982660366	-2
+31.199999999999999	6.3585707497076651	2.9669079144927228	-2
+30.199999999999999	7	0	0
+30.600000000000001	7	0	0
+29.800000000000001	7	0	0
+32.147893433601347	6.2822817653959531	5.2425887909555966	-2
+32.799999999999997	6.3585707497076651	8.3311245961574247	-2
+31.600000000000001	6.5857442711815963	2.2985056055037125	-2
+23	9	100.00000003700207	1
+23.414255728818404	9.2000000000000011	89.179637864716028	-2
+23.71771823460405	9.7478934336013392	81.582547330829797	-2
+26.28228176539595	11.05210656639866	18.013674725430253	-2
+25.071945615761244	11.301966643611024	48.053813065644952	-2
+25.975459918393796	11.300113758716163	25.797571502856851	-2
+24.024540081606201	11.099886241283837	73.915203242491629	-2
+23.641429250292337	10.399999999999999	83.642091735563213	-2
+18.199999999999999	13	100.0000000370021	1
+18.800000000000001	13.641429250292335	83.66467466713631	-2
+19.084098894317648	14.268826826693434	68.085295541079105	-2
+18.79161622510356	15.307932378615078	42.421419939649276	-2
+18.699886241283835	15.975459918393794	25.966412219741855	-2
+18	16.358570749707667	17.167652831746675	-2
+17.199999999999999	16.648034066190668	11.684813994889632	-2
+17.600000000000001	16.585744271181596	11.842466898862771	-2
+18.600000000000001	13	100.00000003700205	1
+17	17	0	0
+16.585744271181593	17.199999999999999	13.525494275188265	-2
+16.35857074970766	17.600000000000001	18.143454641242144	-2
+15.193621583277302	18.142965274705684	45.347794089415842	-2
+13	17	100.00000003700205	1
+13.414255728818407	17.199999999999999	86.587549051210971	-2
+14.163786877682446	17.55959956762964	68.841332583834074	-2
+13.64142925029234	17.600000000000001	82.106856546838344	-2
+14.364026390179044	18.000268863750168	65.00730211188737	-2
+12.6	17	100.00000003700202	1
+12.4	16.585744271181596	87.962699012947809	-2
+0	35.92998529411765	0	-1
+1.3305807046042053	34.653778402069179	8.4920640295894589	-2
+2.5823614901626044	34.120074285208325	14.087899879697554	-2
+3.847430101967432	33.853902744969837	18.989534909007535	-2
+7.7999999999999998	27	0	0
+5.9880949863521078	31.274915470529148	4.7078955895123924	-2
+6.3585707497076651	30.800000000000001	2.6805896593240917	-2
+6.6480340661906725	30	1.3557772531727679	-2
+6.5857442711815963	30.399999999999999	1.6315633383021837	-2
+4.9736374077130137	32.028510169615956	9.9027239941000147	-2
+5.659260939711622	32.062483536563342	8.1713895048523622	-2
+7	29.399999999999999	0	0
+7	29	0	0
+7	29.800000000000001	0	0
+4.9211887147795608	33.236616358019077	16.981538232487082	-2
+5.288125459162587	32.638699552338601	12.521946057883707	-2
+8.4000000000000004	26.120003793405122	21.102134267966942	-2
+8.1999999999999993	27	0	0
+8.4000000000000004	26.585744271181596	9.9502577539031876	-2
+8.9073860473936026	25.723899806070541	30.943355646012158	-2
+9.6934444292257336	24.906564021603419	51.620493412094568	-2
+9.4521065663986601	23.717718234604046	81.521759682313643	-2
+9.7001137587161637	24.024540081606201	73.801703120884781	-2
+9	23	100.0000000370021	1
+9.1999999999999993	23.414255728818404	89.215954985287013	-2
+12.199999999999999	17	100.0000000370021	1
+39.052838235294118	0	0	-1
+37.831329994089216	1.2368175074440542	12.931134974696757	-2
+36.079103622373097	4.6335582541391105	41.440249148278312	-2
+36.942466712760712	4.229085863051516	43.439248045246821	-2
+38.506976507341435	2.3271219321426533	26.15634289611636	-2
+38.851454559971152	3.6645172622337254	43.766470061614683	-2
+35.701985973021273	5.2733663376480733	43.806471209856142	-2
+34.245871680624994	6.2659513308881261	28.451179776174268	-2
+35.262060693210074	5.8081601170390478	42.113645527956791	-2
+33.511329372523036	6.488670627476961	16.047088776857578	-2
+27	9.8000000000000007	0	0
+27	10.199999999999999	0	0
+27	10.6	0	0
+26.585744271181596	10.799999999999999	10.357426701139307	-2
+31	7	0	0
+31.399999999999999	7	0	0
+32.400000000000006	6.585744271181599	4.0226887060063845	-2
+32	6.6480340661906716	2.5476031837792625	-2
+32.600000000000001	7	0	0
+33	7	0	0
+31.800000000000001	7	0	0
+23	9.4000000000000004	100.0000000370021	1
+23.351965933809328	9.6000000000000014	90.923105166683044	-2
+23.414255728818404	10	89.390526795271583	-2
+26.648034066190672	11.199999999999999	8.899785150017486	-2
+26.585744271181596	11.6	10.681456777269185	-2
+25.527721543976309	12	37.406369915182744	-2
+24.268826826693434	11.715901105682345	67.486075337617123	-2
+26.358570749707667	12	16.917817160430012	-2
+23.414255728818404	10.800000000000001	89.415640316416514	-2
+23.717718234604046	11.347893433601341	81.564469954461273	-2
+23	10.6	100.0000000370021	1
+23	10.199999999999999	100.00000003700207	1
+19	13	100.00000003700208	1
+19.199999999999999	13.414255728818404	89.52131371157104	-2
+19.452106566398658	13.71771823460405	81.939517824607378	-2
+19.635277002996794	14.759883942141773	55.971420136571076	-2
+19.70011375871616	14.024540081606208	74.285083670213112	-2
+19.315901105682343	15.731173173306566	31.854804848060333	-2
+18.399999999999999	16.585744271181596	10.803920626027825	-2
+18.947893433601337	16.28228176539595	18.168014733955893	-2
+17.800000000000001	17	0	0
+18.199999999999999	17	0	0
+17.399999999999999	17	0	0
+17	17.399999999999999	0	0
+17	17.800000000000001	0	0
+16.585744271181596	18	11.174617641909029	-2
+16.06855229782429	18.285389478204756	23.980366181541427	-2
+14.699473961882498	18.414196168003283	57.227580004513491	-2
+15.207169929661225	18.753400596917899	44.866281199520721	-2
+15.832555294570316	18.757417975548787	29.478971127420227	-2
+13	17.399999999999999	100.00000003700207	1
+13.879996206594877	18	76.91652194514063	-2
+13	17.800000000000001	100.00000003700205	1
+13.414255728818405	18	88.957653155720152	-2
+14.167444705429704	18.442582024451216	70.273404877430139	-2
+0	37.491411764705887	0	-1
+1.2900846710750409	35.943296027162134	10.548747338821887	-2
+2.4636646809728879	35.407380367262981	18.570430854729196	-2
+5.0797634907854885	33.977815863351857	23.612216106029809	-2
+4.4851285605893914	34.915665768423814	29.857473776767495	-2
+6.5857442711815972	31.199999999999999	1.9700312089288046	-2
+6.2737522581297291	31.805195508303878	4.4711995879475923	-2
+7	30.600000000000001	0	0
+7	31	0	0
+7	30.199999999999999	0	0
+6.3110857671706579	32.200037541248278	5.4378576095651328	-2
+5.9292361901399806	32.396329025285681	8.5739166312356883	-2
+5.5629259470483623	32.953207809076851	13.895696935525754	-2
+5.753468526764185	33.630477137051678	20.115360376029262	-2
+8.8000000000000007	26.358570749707663	15.506454671555764	-2
+8.5999999999999996	27	0	0
+9.4998862412838374	25.975459918393796	25.099021179943268	-2
+10.547125360721932	24.868116094659666	52.921814917953434	-2
+10.5565294630432	24.22639572926203	68.946097670260627	-2
+10.115901105682344	25.731173173306566	31.384867882049843	-2
+9.6000000000000014	23.351965933809328	90.940022101204335	-2
+10	23.414255728818404	89.4169264245253	-2
+10.399999999999999	23.641429250292337	83.686899555628315	-2
+9.4000000000000004	23	100.00000003700207	1
+40.614264705882356	0	0	-1
+39.809945274714359	1.869340555344023	21.708354777017178	-2
+36.807561822087607	5.0648041336336576	53.141105202815318	-2
+36.433369611841087	5.4024015190628507	53.879604866615281	-2
+38.048753015553899	4.6916271058878092	55.522240223515276	-2
+37.306450484424751	4.9933764957806801	56.126380029398405	-2
+39.639363425545746	4.8639632862193833	62.505153242174401	-2
+38.774762287378962	4.9658253332398195	62.504251325445523	-2
+40.347417354257672	3.8321160450319529	47.418722852515444	-2
+35.933100490547936	5.9791695573662	54.593748565019162	-2
+34.992059151256775	6.4458417034401938	41.550516340457328	-2
+34.402141978735948	7.0174404401858528	31.860504980897499	-2
+35.764973067778271	6.7239270571206831	58.793173553491457	-2
+33.64142925029234	7.2000000000000002	15.817587892114041	-2
+27	11	0	0
+32.200000000000003	7	0	0
+33	7.4000000000000004	0	0
+23	9.8000000000000007	100.00000003700208	1
+27	11.4	0	0
+27	11.800000000000001	0	0
+25.167651257623938	12.723506844613491	46.172154175843801	-2
+25.975459918393796	12.699886241283835	28.471634364617369	-2
+23.879996206594882	12.399999999999999	75.731916261298394	-2
+24.402141978735948	12.982559559814165	61.817711385299638	-2
+23.641429250292333	12	82.799167968578416	-2
+27	12.199999999999999	0	0
+26.585744271181596	12.399999999999999	11.734292555191557	-2
+23	11	100.00000003700208	1
+23.351965933809328	11.199999999999999	90.940842652547957	-2
+23.414255728818404	11.600000000000001	89.15744648613483	-2
+19.399999999999999	13	100.00000003700207	1
+19.599999999999998	13.351965933809328	91.136499576573243	-2
+20	13.414255728818405	89.584146347071695	-2
+20.300877571896777	15.079117838837565	48.038920156486832	-2
+20.684098894317657	14.268826826693434	68.153197399030162	-2
+20.399999999999999	13.64142925029234	83.869688118942577	-2
+20.299886241283836	15.975459918393794	25.733266806988468	-2
+19.600000000000001	16.35857074970766	16.139065620717176	-2
+18.600000000000001	17	0	0
+18.800000000000001	16.648034066190672	8.9881138511898779	-2
+19.199999999999999	16.585744271181593	10.471956618380029	-2
+17	18.199999999999999	0	0
+16.648034066190672	18.399999999999999	9.1365110606815971	-2
+16.358570749707667	18.800000000000001	16.300355996754565	-2
+14.532710857574573	18.920210944081592	61.473119131916924	-2
+15.49005756352725	19.294500797342689	37.824613230201479	-2
+14.898508136654245	19.39606670960967	52.481798005673433	-2
+16.120003793405122	19.199999999999999	22.157037627658831	-2
+13.64142925029234	18.399999999999999	83.442643775311879	-2
+13	18.199999999999999	100.00000003700205	1
+13.931447702175698	18.914610521795243	76.430795900087148	-2
+0	39.052838235294118	0	-1
+1.8594511557282241	37.504684828314495	19.164722377615046	-2
+3.1522831738337489	36.741451148257227	30.517983287941764	-2
+5.6815124621066326	34.438707219101595	30.868782447706714	-2
+5.7405764723936974	35.203197398557585	41.940023627934366	-2
+4.6535270120646093	36.727056163490403	47.387107491399362	-2
+7	31.399999999999999	0	0
+6.6480340661906716	31.600000000000001	2.0672158268669265	-2
+6.6535459896320672	32	2.5216779743156263	-2
+6.6535898357113625	32.400000000000006	3.3251267101378756	-2
+6.3072012404610476	32.600000002402965	7.2448182949204192	-2
+5.9531798836872918	32.804437460429639	11.173864107601243	-2
+5.8808054748072323	33.224101436780778	15.34037108254689	-2
+6.5060802940969538	33.455494025483567	15.331424441463698	-2
+6.6615012119061223	34.263294675466824	29.242961398291577	-2
+9	27	0	0
+9.2000000000000011	26.585744271181596	10.088174537956229	-2
+9.7478934336013392	26.28228176539595	17.64881971226453	-2
+11.086211821876836	24.519864386973939	61.631286558269473	-2
+10.705499202657306	25.490057563527252	37.582104342226664	-2
+11.420757016406842	25.003924697281381	49.777481247617644	-2
+11.085389478204753	23.931447702175706	76.297152112787771	-2
+10.799999999999999	26.120003793405122	22.003225364720439	-2
+10.399999999999999	26.358570749707663	15.942603851275381	-2
+9.8000000000000007	23	100.00000003700208	1
+10.199999999999999	23	100.00000003700207	1
+10.6	23	100.00000003700202	1
+10.799999999999999	23.414255728818404	89.442645784120074	-2
+42.175691176470593	0	0	-1
+41.847403887002457	1.3244709262141838	14.712859321671914	-2
+41.222490092490141	2.5375160730414592	29.778263282938738	-2
+37.172407442241237	5.4124813953470374	61.852860233161941	-2
+37.035710646086763	5.8307282601523092	67.918721343764204	-2
+36.491994580800494	6.4993310319185547	72.195777605761734	-2
+38.021571119577892	5.1528472448047573	62.874255335854755	-2
+37.609496597902883	5.3617909228563603	64.131551242681297	-2
+40.45980438354151	5.1551464574114956	67.401370551682078	-2
+39.715901105682356	5.7311731733065887	77.113756639180025	-2
+39.099886241283841	5.9754599183937911	80.643159897846132	-2
+38.507386047393609	5.7238998060705573	74.80239671912409	-2
+41.191833965475489	4.8568115623110346	61.899539790242436	-2
+41.994412763662844	3.8961465505463106	45.986505160687464	-2
+35.06191230376659	7.264284079767716	46.566758150027795	-2
+34.423357678242816	7.5617343351302768	32.990303166522587	-2
+33.879996206594875	7.6000000000000023	20.847400830173299	-2
+35.731173173306587	7.4840988943176541	63.313386528998407	-2
+36.35857074970766	7.2000000000000002	78.25954297221422	-2
+33.414255728818404	7.5999999999999996	9.9707927724423673	-2
+33	7.7999999999999998	0	0
+24.873501677248029	13.545581135794082	51.813645030222986	-2
+25.591432562809409	13.391475639599554	40.040140542570853	-2
+26.648034066190672	12.800000000000001	11.666311119338205	-2
+26.503302407949167	13.4644031126294	25.374430037867302	-2
+23.414255728818404	12.4	88.138877031993232	-2
+23.641429250292337	12.800000000000001	79.836447694817778	-2
+24.164112292878936	13.660658317394033	61.571345048043149	-2
+23	12.199999999999999	100.00000003700208	1
+23	11.800000000000001	100.00000003700208	1
+27	12.6	0	0
+23	11.4	100.0000000370021	1
+19.800000000000001	13	100.00000003700208	1
+20.199999999999999	13	100.00000003700205	1
+21.241504073930873	14.775586669916386	55.507139755033513	-2
+20.915901105682345	15.731173173306566	31.946703629504643	-2
+21.052106566398663	13.71771823460405	81.845196724912881	-2
+21.300113758716165	14.024540081606206	74.043941223726023	-2
+20.600000000000001	13	100.00000003700202	1
+20.800000000000001	13.414255728818407	89.536973109603252	-2
+20	16.585744271181596	10.422591796808534	-2
+20.547893433601338	16.28228176539595	18.075099315971645	-2
+19.399999999999999	17	0	0
+19.800000000000001	17	0	0
+19	17	0	0
+17	18.600000000000001	0	0
+17	19	0	0
+16.585744271181596	19.199999999999999	10.457847879651199	-2
+14.303672117672713	19.476169577789321	67.266280709781228	-2
+15.73117317330656	19.884098894317653	31.784244930166754	-2
+15.065532448487614	19.9822388970086	48.339555684716117	-2
+14.392696384244703	19.981423225642565	65.074386525616333	-2
+16.35857074970766	19.600000000000001	16.125108593565933	-2
+13	18.600000000000001	100.00000003700208	1
+13.351965933809328	18.800000000000001	91.019229148186994	-2
+13.414255728818407	19.199999999999999	89.524885994928553	-2
+13.64142925029234	19.600000000000001	83.853022310216403	-2
+0	40.614264705882356	0	-1
+2.2548465383711322	38.785788155476347	25.721281917675611	-2
+1.3089941803612619	39.923936625449144	15.105569503223256	-2
+3.519903547691174	38.341722837476027	40.649829926036738	-2
+6.4862961326285511	35.024770998787098	42.824986421325661	-2
+5.7975358598468558	36.311948798677392	57.602668886038188	-2
+6.2673351518069236	35.760385953230667	54.644604313546061	-2
+4.7934043942975206	38.069460609253426	57.379923207034714	-2
+5.8307282601523092	37.035710646086763	67.777510920078882	-2
+7	31.800000000000001	0	0
+7	32.200000000000003	0	0
+7	32.600000000000001	0	0
+6.65358983848623	32.800000000000004	4.7234643658931219	-2
+6.273255026606698	33.058755564742846	11.539039551112619	-2
+7	33	0	0
+7.2000000000000002	33.64142925029234	15.903489770395259	-2
+7.4840988943176541	34.268826826693413	29.704819941691529	-2
+7.2627866914219066	34.937561923073574	44.07187080608378	-2
+9.4000000000000004	27	0	0
+9.6000000000000014	26.648034066190672	8.6369278425291967	-2
+10	26.585744271181596	10.230343288013559	-2
+11.557417975548786	24.167444705429698	70.147183636787176	-2
+11.242582024451215	25.832555294570305	29.383513272507372	-2
+12.03826566486973	24.423357678242816	63.472378512563807	-2
+11.704638157755625	25.498436991031728	37.957580830089341	-2
+12.342331115747541	25.231626742437026	44.831881503942476	-2
+11.199999999999999	23.351965933809328	90.966804639801154	-2
+11.600000000000001	23.641429250292337	83.366296115572894	-2
+10.800000000000001	26.585744271181596	10.375940297368816	-2
+11.199999999999999	26.358570749707663	16.215446778845234	-2
+10.199999999999999	27	0	0
+10.6	27	0	0
+11	23	100.00000003700208	1
+43.737117647058824	0	0	-1
+43.105276800228999	1.8533863381506968	18.819706933404404	-2
+43.364325622572302	3.2671651716925822	33.807722253917106	-2
+37.559599567629633	5.8362131223175702	72.569562746241417	-2
+37.200000000000003	6.585744271181599	87.153762235332792	-2
+37.599999999999994	6.3585707497076651	84.104866909120474	-2
+37	7	100.00000003700207	1
+38.013910300664882	5.6148041517398113	70.94292793024826	-2
+41.26366553769271	5.6440289679200806	74.876496700917102	-2
+40.685389478204769	6.0685522978243132	83.003080415085151	-2
+39.347893433601328	6.282281765395954	86.598813742460379	-2
+40	6.3585707497076545	88.293153405065993	-2
+38.799999999999997	6.585744271181599	91.800253423031364	-2
+38.400000000000006	6.3585707497076651	86.714244080977423	-2
+38	6.1200037934051048	80.72660113227829	-2
+41.927462860160851	5.1461576315171369	64.72576003387546	-2
+42.94194574489142	4.7141876507441376	53.758052163470119	-2
+34.697149727443346	8.0159736235453511	40.016913973811917	-2
+34.167444705429688	8.0425820244512138	27.641879752352022	-2
+33.641429250292333	8	15.28712497375893	-2
+36.282281765395958	7.8521065663986631	79.416317075208966	-2
+35.281019072401271	8.485313187020779	55.067964834671919	-2
+35.975459918393803	8.1001137587161569	71.807439277290328	-2
+37	7.4000000000000004	100.00000003700211	1
+36.585744271181596	7.5999999999999996	87.200985800987297	-2
+33	8.1999999999999993	0	0
+25.314688059750804	14.132546071965251	47.638497575219958	-2
+24.621540830578926	14.19425416753954	52.883828476501691	-2
+25.966584659665397	14.486404752278753	45.284375950011324	-2
+27	13	0	0
+26.672403212821493	14.25835801883567	37.216563885669991	-2
+27.199999999999999	13.641429250292335	20.025000693408952	-2
+23	12.6	100.0000000370021	1
+23	13	100.00000003700211	1
+23.464403112629402	13.496697592050833	74.995383277637501	-2
+23.513537363570389	14.385439675653245	59.279197069465937	-2
+21.511957655860126	15.47869472205676	38.445118182632385	-2
+22.004435957224018	14.464174625032095	62.634107735659335	-2
+21.599999999999998	16.120003793405118	22.626308173646724	-2
+21.199999999999999	16.358570749707667	16.351154674045606	-2
+21.199999999999999	13.351965933809328	91.031832129668857	-2
+21.600000000000001	13.414255728818404	89.255729224052942	-2
+22	13.641429250292335	83.000511944263664	-2
+21	13	100.00000003700208	1
+20.199999999999999	17	0	0
+20.400000000000002	16.648034066190672	8.8703510098890188	-2
+20.800000000000001	16.585744271181596	10.487831633100003	-2
+17	19.399999999999999	0	0
+13.879996206594877	20	77.886994245378602	-2
+16.28228176539595	20.252106566398659	18.021822278368283	-2
+15.975459918393794	20.500113758716164	25.723506977105348	-2
+14.536097763116873	20.397459258493985	61.489094430221456	-2
+15.092704023580543	20.883836126189664	47.690774959084237	-2
+14.096048355975146	20.399999999999999	72.455961888559997	-2
+17	19.800000000000001	0	0
+16.585744271181596	20	10.410145437220722	-2
+13	19	100.00000003700205	1
+13	19.399999999999999	100.00000003700207	1
+13	19.800000000000001	100.00000003700205	1
+13.414255728818405	20	89.57599235348178	-2
+0	42.175691176470593	0	-1
+1.2321944605403481	41.364525460404394	14.008956475198133	-2
+3.4066198051511005	39.472069136861876	41.163684909221551	-2
+2.6233192895754538	40.982470361754544	31.020849513184409	-2
+4.5072728325541762	39.190859471082739	56.53802525704225	-2
+7.0174404401858528	35.597858021264052	57.61802606794042	-2
+6.4993310319185547	36.491994580800494	72.380195401195238	-2
+5.9754599183937858	38.299886241283836	79.01647993145761	-2
+5.6350203526318081	38.930874454405782	74.570879387497484	-2
+6.585744271181599	37.200000000000003	86.997890465052691	-2
+6.3585707497076651	37.599999999999994	83.583127903492496	-2
+7.4000000000000004	33	0	0
+7.5999999999999996	33.414255728818404	10.062108817961585	-2
+7.8521065663986631	33.717718234604042	17.143258018208446	-2
+8.0189641670976606	34.969842474124789	46.683742380660952	-2
+8.1001137587161569	34.024540081606197	24.42244574076819	-2
+7.5636860045927738	35.574464838449579	59.954506998185643	-2
+9.8000000000000007	27	0	0
+12	23.879996206594875	76.8517685866167	-2
+11.714610521795246	26.068552297824294	23.902947767188842	-2
+12.582559559814154	24.402141978735941	62.920873387834746	-2
+12.195016765573083	25.775004239216191	31.947774828697018	-2
+13.299807611335574	25.238078199331326	45.893082301426688	-2
+12.964289353913237	25.830728260152291	33.418711335212791	-2
+11.4	23	100.0000000370021	1
+11.800000000000001	23	100.00000003700207	1
+12	23.414255728818404	88.890400201304061	-2
+11	27	0	0
+11.4	27	0	0
+11.600000000000001	26.648034066190672	9.082396588496465	-2
+44.306642892009776	1.064338560099271	9.262161708492588	-2
+45.298544117647062	0	0	-1
+44.484373254998445	2.2583182472056103	19.416443994032086	-2
+44.535596483636091	3.4413637965022663	29.938547595618374	-2
+37.399999999999999	7	100.00000003700205	1
+37.799999999999997	7	100.00000003700205	1
+38	6.5857442711815937	90.688599420319065	-2
+41.899886241283824	5.9754599183937875	79.310415642694906	-2
+41.200000000000003	6.3585707497076651	87.868984284034795	-2
+40.799999999999997	6.6480340661906752	93.471187780756807	-2
+40.400000000000006	6.585744271181591	92.414381462723483	-2
+39.599999999999994	6.585744271181591	92.321733095275022	-2
+39.200000000000003	6.6480340661906752	93.318905429632451	-2
+40.200000000000003	7	100.00000003700207	1
+39.799999999999997	7	100.00000003700207	1
+38.600000000000001	7	100.00000003700205	1
+39	7	100.0000000370021	1
+38.200000000000003	7	100.00000003700205	1
+42.515901105682339	5.731173173306523	71.952860326542122	-2
+43.276134322809817	5.7649452736473297	66.458962529681372	-2
+44.551870894026671	5.7504378688147533	52.880485934143103	-2
+34.532710857574635	8.5202109440815832	36.785995283959998	-2
+33.931447702175717	8.5146105217952481	22.348674384098111	-2
+33.351965933809332	8.3999999999999986	8.4374998051812451	-2
+36.648034066190675	8	89.902079769203667	-2
+36.585744271181596	8.3999999999999986	88.690496049472955	-2
+35.731173173306587	9.0840988943176555	67.18855614762353	-2
+35.016695691082042	9.2110065729737869	49.36461720864456	-2
+36.35857074970766	8.8000000000000007	83.02858484493899	-2
+37	7.7999999999999998	100.00000003700207	1
+33	8.5999999999999996	0	0
+25.746333685191566	15.210618547863801	51.366962651791098	-2
+24.878703918871782	15.249295430976709	50.067931974518736	-2
+24.227475784148229	14.767816465419751	51.723838178545044	-2
+26.479484137321592	15.022239865381122	50.396582948845634	-2
+27.399999999999999	13	0	0
+27.262786691421848	14.93756192307357	48.698421078904758	-2
+27.484098894317654	14.268826826693429	33.711324732508302	-2
+27.600000000000001	13.414255728818404	11.877964683698305	-2
+27.85210656639866	13.717718234604046	19.209862726488247	-2
+22.600000000000001	13	100.0000000370021	1
+22.800000000000001	13.35196593380933	88.351103210286851	-2
+22.699886241283831	14.024540081606208	71.341952251036247	-2
+23.487238156376975	15.096401815307576	48.288016656336893	-2
+22.741860322102028	14.829051228086371	53.611703860207498	-2
+22	15.903951644024872	28.513430859688043	-2
+22.436313995407229	15.574464838449551	37.058124247818753	-2
+21.600000000000001	16.585744271181596	10.742605437536263	-2
+22	16.358570749707667	17.048646084451288	-2
+21	17	0	0
+21.399999999999999	17	0	0
+21.399999999999999	13	100.00000003700208	1
+21.800000000000001	13	100.00000003700211	1
+22.199999999999999	13	100.00000003700211	1
+22.399999999999999	13.414255728818404	88.223125903507565	-2
+20.600000000000001	17	0	0
+13.64142925029234	20.399999999999999	83.84530652029558	-2
+16.648034066190672	20.399999999999999	8.8569789218125123	-2
+16.585744271181596	20.800000000000001	10.471840785012999	-2
+16.358570749707667	21.199999999999999	16.312741897086216	-2
+15.731173173306571	21.484098894317654	32.143080409588144	-2
+14.358303253862589	20.800000000000001	65.845114265738275	-2
+15.02129272292075	21.545239326640679	49.418725581806044	-2
+13.879996206594878	20.800000000000001	77.784744171872262	-2
+17	20.199999999999999	0	0
+13	20.199999999999999	100.00000003700205	1
+0	43.737117647058824	0	-1
+1.2603447886297439	42.748747154996167	13.132435350306908	-2
+2.6625587676516727	42.683450026894207	28.90729776506917	-2
+4.1826308090205462	40.301721404220139	52.559658112397699	-2
+4.3959012494426108	42.099671399494511	52.726458725735824	-2
+5.4736423960023339	40.370397607332499	72.931993614259781	-2
+7.6000000000000023	36.120003793405125	74.084225141073233	-2
+7.2000000000000002	36.35857074970766	78.226562040699989	-2
+7	37	100.00000003700207	1
+6.5857442711815937	38	90.452779800699204	-2
+6.2737522581297211	38.605195508303893	85.559525110166661	-2
+6.6480340661906689	38.400000000000006	92.648390303664641	-2
+6.0685522978242981	39.714610521795244	83.005975128020566	-2
+6.3585707497076651	39.200000000000003	87.932803048874192	-2
+7	37.399999999999999	100.00000003700205	1
+7	37.799999999999997	100.00000003700205	1
+7.7999999999999998	33	0	0
+8	33.351965933809325	8.4538478310694636	-2
+8.3999999999999986	33.414255728818404	9.9720540735450012	-2
+8.8139993073102882	34.97429132941344	47.941460467279299	-2
+8.4142739245939282	35.615269932731692	63.356855755261677	-2
+9.0840988943176555	34.268826826693413	30.922237617379277	-2
+8.8000000000000007	33.64142925029234	15.544130925354967	-2
+7.9999999999999982	35.903951644024872	69.721805225071094	-2
+12.399999999999999	23.641429250292337	81.921663820026026	-2
+12	26.585744271181596	11.068971131133468	-2
+12.399999999999999	26.358570749707663	17.873882927023946	-2
+12.833837862079605	23.939576851134895	72.428057421564773	-2
+13.449955718468175	24.573802547527567	56.804936676703569	-2
+13.6874513392228	25.798023675145274	39.43422313263504	-2
+14.111201232323754	25.072372770873017	49.133399177042833	-2
+12.800000000000001	26.585744271181596	13.348566273101754	-2
+13.508005419199502	26.499331031918565	25.824416402797951	-2
+12.199999999999999	23	100.00000003700207	1
+11.800000000000001	27	0	0
+45.36917481851296	1.6372272755685788	11.932588717466537	-2
+46.859970588235299	0	0	-1
+46.322151115055462	1.1268705571108975	6.6732888458331487	-2
+45.432395138843447	2.6680768103962236	19.365661229959635	-2
+45.631024675328284	4.4584893381835702	31.887252470598607	-2
+41.599999999999994	6.585744271181599	91.754630622980713	-2
+42.147893433601347	6.2822817653959397	84.543314732498331	-2
+41	7	100.0000000370021	1
+41.399999999999999	7	100.00000003700207	1
+40.600000000000001	7	100.00000003700211	1
+39.399999999999999	7	100.00000003700211	1
+42.799999999999997	6.3585707497076651	82.630987575351909	-2
+43.511329372523036	6.488670627476961	75.729019160943068	-2
+45.687625417811105	6.5270048996026873	45.201541516643047	-2
+44.402141978735948	7.0174404401858528	66.806526817202339	-2
+34.303672117672697	9.0761695777893276	31.69455474163383	-2
+33.414255728818404	8.8000000000000007	10.007540885094846	-2
+33.64142925029234	9.1999999999999993	15.62194145908393	-2
+37	8.1999999999999993	100.00000003700205	1
+37	8.5999999999999996	100.00000003700202	1
+36.282281765395958	9.4521065663986636	81.512077739823596	-2
+35.975459918393803	9.7001137587161583	73.794404133446292	-2
+34.392696384244722	9.5814232256425758	34.186761595919499	-2
+35.065679899003833	10.00432384266422	51.089987577064171	-2
+37	9	100.00000003700208	1
+36.585744271181596	9.1999999999999993	89.206096711338219	-2
+33	9	0	0
+25.541011820846457	15.93219830255366	54.780936356217531	-2
+26.270441455195847	15.756793573742421	59.95782496124751	-2
+24.245201544403518	16.26708030190651	40.509756593642933	-2
+23.696633032162058	15.776337546326189	40.009968101800482	-2
+24.99138121440685	16.442825962224831	49.567260272789873	-2
+27.017440440185826	15.597858021264058	61.707580601627406	-2
+27.800000000000001	13	0	0
+27.563686004592768	15.574464838449547	62.888260018494208	-2
+28.018964167097682	14.969842474124682	49.303228495694128	-2
+28.100113758716162	14.024540081606201	26.525461480580589	-2
+28	13.351965933809328	9.4601734739593244	-2
+28.399999999999999	13.414255728818404	10.73944612225192	-2
+22.98255955981417	15.597858021264052	38.269156731838855	-2
+22.399999999999999	16.120003793405118	24.070642823377021	-2
+21.800000000000001	17	0	0
+22.199999999999999	17	0	0
+22.399999999999999	16.585744271181596	11.776243609106089	-2
+13	20.600000000000001	100.00000003700205	1
+13.414255728818404	20.800000000000001	89.515621857497081	-2
+17	20.600000000000001	0	0
+17	21	0	0
+17	21.399999999999999	0	0
+16.585744271181596	21.600000000000001	10.738329346114769	-2
+16.282281765395954	21.85210656639866	18.727713218767207	-2
+15.975459918393799	22.100113758716162	26.873284746046249	-2
+15.173387972096203	22.407286146343225	46.249590927928509	-2
+14.096048355975135	21.199999999999999	72.219797711688983	-2
+14.358303253862603	21.600000000000001	65.507273824104033	-2
+14.541567166884505	22.006126686322506	60.70567460355425	-2
+13.641429250292335	21.199999999999999	83.648339642678692	-2
+0	45.298544117647062	0	-1
+1.5169859064315001	44.109260836442814	13.404160625722341	-2
+4.3123745821888173	43.472995100397277	45.216065026419386	-2
+2.7557445446745681	45.060688095824666	21.594409723478378	-2
+5.2058247942918126	41.091975418509129	67.766929000453317	-2
+5.635020352631809	41.730874454405772	73.68289574063094	-2
+5.5978580212640647	42.982559559814142	66.81669171506266	-2
+6.3585707497076651	40.400000000000006	88.329954677138687	-2
+5.9754599183937884	41.099886241283826	81.033811199869717	-2
+7.5999999999999996	36.585744271181596	87.336736485932462	-2
+8	36.358570749707667	81.886616316778188	-2
+7.4000000000000004	37	100.00000003700211	1
+7	38.200000000000003	100.00000003700208	1
+6.6535459896320726	38.800000000000004	93.200379209254947	-2
+7	38.600000000000001	100.00000003700208	1
+6.5857442711815937	40	92.430546159969438	-2
+6.6480340661906689	39.599999999999994	93.49039410961683	-2
+7	39.399999999999999	100.00000003700205	1
+7	39	100.00000003700205	1
+8.1999999999999993	33	0	0
+8.5999999999999996	33	0	0
+8.9073860473936044	35.723899806070534	66.806506662734805	-2
+9.6934444292257034	34.906564021603387	46.990798380970602	-2
+8.3999999999999986	36.120003793405118	76.299684128129613	-2
+9.4521065663986636	33.717718234604042	17.591964114402096	-2
+9.7001137587161583	34.024540081606197	25.211038481570839	-2
+9	33	0	0
+9.1999999999999993	33.414255728818404	10.107352407989987	-2
+12.6	23	100.00000003700202	1
+12.799999999999999	23.414255728818404	86.685668906678387	-2
+12.199999999999999	27	0	0
+12.6	27	0	0
+13.508005419199504	23.500668968081438	73.825828530469281	-2
+14.338061855724062	24.083706591038144	56.283117617925647	-2
+14.241792328163683	26.263575943808409	40.468925304132391	-2
+14.820664624433924	25.49954907224798	49.221900307505742	-2
+14.811146919484342	24.712622259407937	50.275495929074147	-2
+13	27	0	0
+13.641429250292335	27.199999999999999	20.165383936030487	-2
+14.402141978735948	27.017440440185833	38.511126308340302	-2
+46.323241081910119	2.1455434831541114	12.586509926004558	-2
+47.640683823529415	0	0	-1
+47.260599971037635	0.73062636095536848	3.2825117163056108	-2
+47.24691046975137	1.5540892998921554	6.8786408824486411	-2
+46.326480009966744	3.1717156795338708	18.634659951422655	-2
+47.244255455325813	4.9393119041746063	21.583578295370994	-2
+47.16445964030116	3.7640247259128832	16.926738443557845	-2
+41.799999999999997	7	100.0000000370021	1
+42	6.6480340661906681	92.434136419273031	-2
+42.400000000000006	6.585744271181599	90.10525199249912	-2
+42.600000000000001	7	100.00000003700207	1
+43	7	100.00000003700205	1
+43.64142925029234	7.2000000000000002	82.562424365407423	-2
+47.337441232348006	7.3165499731057242	28.893715426304706	-2
+45.604098750557306	7.9003286005053823	52.711901826111344	-2
+43.879996206594875	7.6000000000000023	80.000926074301645	-2
+44.364979647368131	8.2691255455942212	73.673983749142295	-2
+33.879996206594882	9.6000000000000014	21.591628335019184	-2
+33	9.4000000000000004	0	0
+33.414255728818404	9.6000000000000014	10.160083626838484	-2
+36.648034066190675	9.6000000000000014	90.934552289243442	-2
+36.585744271181596	10	89.411228527606355	-2
+35.73117317330658	10.684098894317643	67.892834279225923	-2
+36.35857074970766	10.399999999999999	83.676379773303879	-2
+34.096048355975128	10	27.058885142395809	-2
+34.384730067268308	10.414273924593928	34.379768856834495	-2
+35.005764042355736	10.80960561602117	49.910534028006239	-2
+37	9.4000000000000004	100.00000003700208	1
+25.764945273647339	16.723865677190176	63.416567410841104	-2
+26.488670627476967	16.488670627476967	73.736684537583102	-2
+23.511329372523033	16.488670627476967	26.004911041622819	-2
+24.402141978735941	17.017440440185826	38.34314409366737	-2
+25.06243807692643	17.262786691421844	51.241603895673258	-2
+27.599999999999998	16.120003793405118	75.894807602098012	-2
+27.199999999999999	16.358570749707667	79.865691404680447	-2
+28.199999999999999	13	0	0
+28	15.903951644024872	71.485094146641472	-2
+28.414273924593928	15.615269932731691	64.918524109275168	-2
+28.813999307310311	14.974291329413461	49.334392834862285	-2
+29.084098894317648	14.268826826693434	31.896030691421963	-2
+28.800000000000001	13.641429250292335	16.324987275144473	-2
+28.600000000000001	13	0	0
+22.800000000000001	16.358570749707667	20.064570611814702	-2
+22.600000000000001	17	0	0
+13	21	100.0000000370021	1
+17	21.800000000000001	0	0
+16.648034066190672	22	9.4696158033523794	-2
+16.585744271181596	22.399999999999999	11.975673615098918	-2
+16.358570749707667	22.800000000000001	20.149792226075387	-2
+14.425535161550444	22.436313995407229	62.678601976185639	-2
+15.528229834174084	23.321154415945355	41.104354340527927	-2
+14.402141978735948	22.982559559814167	61.557720671072083	-2
+13.87999620659488	21.600000000000001	77.355251570577096	-2
+14.09604835597513	22	71.448555938165271	-2
+13	21.399999999999999	100.00000003700208	1
+13.414255728818404	21.600000000000001	89.243873386467811	-2
+0	46.859970588235299	0	-1
+0.84426403210588263	46.159315883060309	5.1200685714442695	-2
+1.8183278131102325	45.641882723600865	12.589473723657555	-2
+5.4481291059733303	44.249562131185229	52.898132033676987	-2
+4.3689753246712639	45.54151066181457	31.908652783975082	-2
+2.8355403597005742	46.235975274087366	16.935244608405249	-2
+6.2737522581297203	41.405195508303883	86.067299878019384	-2
+6.1200037934051332	42.399999999999999	80.007184934133363	-2
+6.3585707497076545	42	86.372068357766722	-2
+6.3585707497076651	42.799999999999997	82.567497099442178	-2
+6.488670627476961	43.511329372523036	75.734946289313925	-2
+7	40.200000000000003	100.00000003700205	1
+7	40.600000000000001	100.00000003700207	1
+6.585744271181599	40.799999999999997	92.341615330896474	-2
+6.6480340661906698	41.200000000000003	93.285141573983168	-2
+7.7999999999999998	37	100.00000003700205	1
+8.1999999999999993	37	100.00000003700208	1
+8.4000000000000004	36.585744271181596	88.72845070455989	-2
+7	39.799999999999997	100.00000003700208	1
+9.4998862412838427	35.975459918393796	73.675506422901833	-2
+8.8000000000000007	36.35857074970766	83.041719766529482	-2
+10.544913982762779	34.868424504357208	46.426892392500299	-2
+10.556490021360972	34.226488940276141	30.534173920167266	-2
+10.115901105682358	35.73117317330658	67.800648505598872	-2
+9.6000000000000014	33.351965933809325	8.6419188335702817	-2
+10	33.414255728818404	10.241900953238906	-2
+10.399999999999999	33.64142925029234	15.956920152165583	-2
+9.4000000000000004	33	0	0
+13	23	100.00000003700207	1
+13.641429250292335	22.800000000000001	79.757881945649842	-2
+15.11733608248886	23.989908960472459	47.820450608362883	-2
+14.991399215965334	26.442777514943703	50.286254000111924	-2
+15.779030482821891	25.480442075312457	53.710955882488207	-2
+15.898644667640349	24.009350559611281	40.944928176274281	-2
+13	27.399999999999999	0	0
+13.414255728818404	27.600000000000001	11.821527438350415	-2
+13.87999620659488	27.600000000000001	24.165000859314997	-2
+14.425535161550444	27.563686004592771	37.222543130801903	-2
+15.062438076926426	27.262786691421869	51.420497757364252	-2
+47.290721618295294	2.6622296554569451	11.491358230653788	-2
+48.42139705882353	0	0	-1
+48.031040441176472	0.43959355143017897	1.3786854754103783	-2
+48.209629082419674	1.0097997926048805	2.909645339950591	-2
+48.368562094534859	2.1042487373167842	5.489117268080963	-2
+48.483014093568272	5.8907391635574911	13.39728284996607	-2
+48.181672186890424	4.3581172763991152	12.583251932766487	-2
+48.227321123394603	3.2560948181123504	9.1666688132651259	-2
+42.200000000000003	7	100.0000000370021	1
+43	7.4000000000000004	100.00000003700211	1
+43.414255728818404	7.5999999999999996	90.164146723849967	-2
+48.739655211369517	7.2512528450046005	13.124559739311472	-2
+47.376680710424779	9.0175296382454722	30.996486916035565	-2
+48.767805539459616	8.6354745395967143	13.995143621380471	-2
+44.794175205708179	8.9080245814908334	67.754639988660429	-2
+45.817369190979527	9.6982785957797475	52.534930423911796	-2
+43.641429250292333	8	86.367670189625514	-2
+43.72624774187026	8.594804491696129	86.062575610097866	-2
+44.024540081606197	8.9001137587161576	81.027204897471123	-2
+33.641429250292333	10	15.835633148956196	-2
+33	9.8000000000000007	0	0
+37	9.8000000000000007	100.00000003700208	1
+37	10.199999999999999	100.00000003700211	1
+36.282281765395958	11.052106566398663	81.69937925192481	-2
+35.975459918393796	11.300113758716158	73.861742852870364	-2
+37	10.6	100.0000000370021	1
+36.585744271181596	10.800000000000001	89.434843026370515	-2
+33.879996206594882	10.399999999999999	21.856785730459922	-2
+34.276100193929466	10.907386047393604	31.906155422058387	-2
+34.794038329773663	11.551178739117191	44.904121342702197	-2
+25.731173173306569	17.484098894317654	66.256013344276653	-2
+26.358570749707667	17.199999999999999	80.105109696856545	-2
+27	17	100.00000003700207	1
+23	17	0	0
+23.641429250292333	17.199999999999999	20.081884431339319	-2
+23.879996206594882	17.599999999999998	24.088183990627847	-2
+24.425535161550453	17.563686004592768	37.10954303550902	-2
+25.030157525875321	18.018964167097685	50.68190867200294	-2
+27.600000000000001	16.585744271181596	88.202155077251604	-2
+28	16.358570749707667	82.946464095268297	-2
+27.399999999999999	17	100.00000003700207	1
+28.399999999999999	16.120003793405118	77.399125492249169	-2
+28.907386047393601	15.723899806070552	67.842827234517472	-2
+29.693444429225696	14.906564021603371	47.677161200489621	-2
+29.452106566398658	13.71771823460405	18.057673370719659	-2
+29.70011375871616	14.024540081606208	25.717292777050879	-2
+29	13	0	0
+29.199999999999999	13.414255728818404	10.474993939055413	-2
+17	22.199999999999999	0	0
+17	22.600000000000001	0	0
+17	23	0	0
+16.491994580800498	23.500668968081435	26.003969376074188	-2
+13.87999620659488	22.399999999999999	75.797757498754976	-2
+13.641429250292335	22	82.902974090697171	-2
+13	21.800000000000001	100.00000003700211	1
+0	47.640683823529415	0	-1
+0.72853562044469145	47.250327205882357	3.2250379390341553	-2
+1.7726788766058841	46.743905181887762	9.170766446629262	-2
+6.7238656771901706	44.235054726352672	66.460961004289885	-2
+5.5699248721896923	46.314500843000502	33.013611570644294	-2
+7.0580818606883042	45.285190928662701	53.729296968603229	-2
+3.6735199900327262	46.828284320467958	18.643862799779324	-2
+4.5676048611545115	47.331923189606385	19.375020373481906	-2
+2.7092783817051984	47.337770344543173	11.495652471175731	-2
+6.6535459896320726	41.599999999999994	93.074089060119704	-2
+6.585744271181599	42.400000000000006	90.167169051455929	-2
+7	42.200000000000003	100.0000000370021	1
+7	41.799999999999997	100.0000000370021	1
+7	42.600000000000001	100.00000003700207	1
+7	43	100.00000003700205	1
+7.2000000000000002	43.64142925029234	82.638961890566833	-2
+7	41	100.0000000370021	1
+7	41.399999999999999	100.00000003700208	1
+8.5999999999999996	37	100.00000003700208	1
+9.7478934336013374	36.282281765395958	81.618132790252247	-2
+9.1999999999999993	36.585744271181596	89.202833557535797	-2
+9	37	100.00000003700208	1
+11.085288708695584	34.521710748248871	38.06524269477876	-2
+10.705499202657306	35.490057563527273	61.895979331605524	-2
+11.463341449224384	34.975017045461641	49.294904554443875	-2
+11.085389478204757	33.931447702175689	23.456715039053293	-2
+10.799999999999999	36.120003793405125	77.667386433405184	-2
+10.399999999999999	36.35857074970766	83.685445401772299	-2
+9.8000000000000007	33	0	0
+10.199999999999999	33	0	0
+10.6	33	0	0
+10.800000000000001	33.414255728818404	10.393131953991551	-2
+13	22.600000000000001	100.00000003700208	1
+13.414255728818404	22.399999999999999	88.154308636979891	-2
+15.764973067778282	26.72392705712069	63.401655302022796	-2
+16.539718789442603	24.951704948972914	49.121787421787261	-2
+16.491994580800498	26.499331031918565	73.559713703289262	-2
+17.035710646086763	25.830728260152284	66.452657273243801	-2
+17.035710646086763	24.169271739847716	33.519695665880427	-2
+13	27.800000000000001	0	0
+13.641429250292335	28	17.089321600918296	-2
+14.09604835597513	28	28.577626961497771	-2
+15.030157525875286	28.018964167097682	50.756952968518739	-2
+14.384730067268304	28.414273924593928	35.134725475914209	-2
+15.731173173306571	27.484098894317654	66.290054434750388	-2
+48.811753676470587	0	0	-1
+48.616575367647059	0.49222081891513836	1.0951130141897785	-2
+48.85982579747737	1.1134217246186977	2.0334349936516101	-2
+49.542811543598326	1.9689595588235294	1.4608591770753299	-2
+49.271464379555297	2.7496727941176471	3.223695374807003	-2
+50	6.262882352941177	0	-1
+50	4.701455882352942	0	-1
+49.155735967894373	3.8406841169392112	5.1176394244734755	-2
+43	7.7999999999999998	100.00000003700208	1
+50	7.824308823529412	0	-1
+46.593380194848812	10.52793086313808	41.113711384483118	-2
+48.691005819639301	10.076063374551451	15.073364615897646	-2
+50	9.385735294117648	0	-1
+44.526357603997717	9.6296023926674952	72.922193992269115	-2
+45.492727167445778	10.809140528917151	56.518525854501824	-2
+43	8.1999999999999993	100.00000003700208	1
+43.346454010367935	8.3999999999999986	93.071802579887304	-2
+43.351965933809325	8.8000000000000007	93.282942429955938	-2
+43.414255728818404	9.1999999999999993	92.339262965722952	-2
+43.64142925029234	9.6000000000000014	88.326779702685329	-2
+33	10.199999999999999	0	0
+33.414255728818404	10.4	10.296100010375747	-2
+36.648034066190675	11.199999999999999	90.95604146869583	-2
+36.585744271181596	11.6	89.166217504955782	-2
+35.527721543976305	11.999999999999995	62.338911062477941	-2
+36.358570749707667	12	82.848367723787788	-2
+37	11	100.00000003700205	1
+33.64142925029234	10.800000000000001	16.05937173931941	-2
+34.024540081606204	11.499886241283843	26.064186028031649	-2
+34.26882682669342	12.115901105682358	32.977249017265521	-2
+35.065991249097848	12.788541823551274	51.660300143754732	-2
+26.282281765395954	17.85210656639866	80.805623038177743	-2
+25.975459918393799	18.100113758716162	73.47332717029883	-2
+27	17.399999999999999	100.00000003700207	1
+26.585744271181596	17.600000000000001	88.163530515154463	-2
+23	17.399999999999999	0	0
+23.414255728818404	17.600000000000001	11.782148636757421	-2
+24.096048355975128	18	28.510013396471404	-2
+23.641429250292333	18	17.046211709662423	-2
+24.384730067268308	18.414273924593928	35.081535760835656	-2
+25.025708670586539	18.813999307310311	50.66289577890899	-2
+27.800000000000001	17	100.00000003700205	1
+28.199999999999999	17	100.00000003700205	1
+28.399999999999999	16.585744271181596	89.264892345866969	-2
+28.800000000000001	16.358570749707667	83.6704693521243	-2
+29.499886241283836	15.975459918393794	74.245532897549197	-2
+30.22894329010968	15.147193266887774	53.665816914868863	-2
+30.152179666742544	14.601856814447967	40.10774639977307	-2
+30.115901105682347	15.73117317330656	68.196124535486732	-2
+29.599999999999998	13.351965933809328	8.8626041179117507	-2
+30	13.414255728818405	10.417440341471414	-2
+30.556070104090569	14.227481314647422	30.820367147497251	-2
+30.399999999999999	13.64142925029234	16.135510603254751	-2
+29.399999999999999	13	0	0
+17.399999999999999	23	0	0
+17.199999999999999	23.414255728818407	13.413559983860397	-2
+13	22.199999999999999	100.00000003700211	1
+0	48.42139705882353	0	-1
+0.45718845640169264	48.031040441176472	1.4613877987916699	-2
+1.631437905465088	47.895751262683667	5.4909810000202297	-2
+7.4840988943176541	44.268826826693413	71.976775681813706	-2
+5.5156267449989649	47.74168175279371	19.308676093382317	-2
+7.4857393733924251	46.946357422986885	33.985265861470616	-2
+8.3069713280437742	45.729624443022509	52.2144394967548	-2
+8.0846732486236803	44.884445843937876	64.344937854144902	-2
+3.6767589180889284	47.854456516846781	12.588149683939974	-2
+4.6308251814858234	48.362772724432169	11.919684206536424	-2
+2.753089530248289	48.445910700108001	6.8795255375669386	-2
+7.4000000000000004	43	100.00000003700211	1
+7.5999999999999996	43.414255728818404	90.111700687060548	-2
+7.8521065663986631	43.717718234604042	84.555914931241446	-2
+10	36.585744271181596	89.414430844855119	-2
+9.6000000000000014	36.648034066190675	90.941780126640353	-2
+9.4000000000000004	37	100.00000003700208	1
+11.557417975548782	34.167444705429709	29.711224339742245	-2
+11.242582024451217	35.832555294570291	70.364200820402132	-2
+12.002529589791866	35.039559945770037	50.998165751905759	-2
+11.706461962307145	35.494789115380691	61.866660360479727	-2
+11.99973113624983	34.364026390179042	35.053269663846365	-2
+11.199999999999999	33.351965933809325	8.9464988399744225	-2
+11.600000000000001	33.64142925029234	16.548597217927945	-2
+10.800000000000001	36.585744271181596	89.454535455030225	-2
+11.199999999999999	36.35857074970766	83.610567674634055	-2
+10.199999999999999	37	100.00000003700211	1
+10.6	37	100.0000000370021	1
+11	33	0	0
+16.358570749707667	27.199999999999999	80.008129847183554	-2
+17.462470361992967	25.033797481855672	50.796984990905258	-2
+17	27	100.0000000370021	1
+17.199999999999999	26.585744271181593	86.529616599096457	-2
+17.559599567629643	25.836213122317552	68.79426809356076	-2
+17.600000000000001	26.35857074970766	82.069185336641425	-2
+17.884098894317656	24.268826826693438	32.890426495287606	-2
+17.600000000000001	23.64142925029234	17.959623147925853	-2
+13	28.199999999999999	0	0
+13.414255728818404	28.399999999999999	10.754942558585904	-2
+13.87999620659488	28.399999999999999	22.641635609529501	-2
+15.975459918393799	28.100113758716162	73.493465786772944	-2
+15.025708670586544	28.813999307310297	50.704742941188044	-2
+14.276100193929453	28.907386047393601	32.209846103340283	-2
+16.282281765395954	27.85210656639866	80.803914281890314	-2
+49.202110294117645	0	0	-1
+49.066994501278081	0.2138352753469045	0.31075994177072136	-2
+49.167483547785807	0.61678328478846756	0.80771969413147604	-2
+49.679004140647066	1.3834246323529413	0.67503310410749007	-2
+49.395227408521919	0.87965229519569488	0.81997032275139059	-2
+50	1.5786029411764706	0	-1
+50	2.3593161764705881	0	-1
+50	3.1400294117647061	0	-1
+47.74515346162903	11.214211844523634	25.634753525971615	-2
+46.480096452308722	11.658277162523868	40.565721399097626	-2
+50	10.947161764705882	0	-1
+43.931447702175689	10.285389478204756	83.004055157828716	-2
+44.364979647368131	11.069125545594222	74.57397861331772	-2
+45.206595605702425	11.930539390746503	57.405065486774141	-2
+43	8.5999999999999996	100.00000003700208	1
+43	9	100.00000003700208	1
+43	9.4000000000000004	100.00000003700202	1
+43	9.8000000000000007	100.00000003700211	1
+43.414255728818404	10	92.429279565067887	-2
+33	10.6	0	0
+37	11.4	100.0000000370021	1
+37	11.800000000000001	100.00000003700205	1
+35.975459918393796	12.69988624128383	70.866904081252613	-2
+37	12.199999999999999	100.00000003700208	1
+36.585744271181596	12.399999999999999	88.063756632242942	-2
+33	11	0	0
+33.414255728818404	11.199999999999999	10.510485114286697	-2
+33.717718234604042	11.747893433601337	18.609627096321983	-2
+34.169271739847716	12.964289353913243	33.811404403362538	-2
+33.64142925029234	12.399999999999999	18.071652386992916	-2
+34.368775620432608	13.914325535799458	42.337431477060733	-2
+35.314688059750793	14.132546071965278	52.865846119165184	-2
+26.648034066190672	18	90.551510884182548	-2
+26.585744271181596	18.399999999999999	89.26477867211112	-2
+25.731173173306562	19.084098894317655	68.10660622939352	-2
+26.358570749707667	18.800000000000001	83.678258274535835	-2
+27	17.800000000000001	100.0000000370021	1
+23	17.800000000000001	0	0
+23.879996206594882	18.399999999999999	22.600565827273542	-2
+23	18.199999999999999	0	0
+23.414255728818404	18.399999999999999	10.734036519998854	-2
+24.276100193929448	18.907386047393601	32.172981550309729	-2
+25.345725538006018	19.593396526328682	58.610832230825679	-2
+24.723971091238958	19.447193361328033	43.178383337142456	-2
+28.600000000000001	17	100.00000003700207	1
+29	17	100.00000003700205	1
+29.199999999999999	16.585744271181596	89.517054543168996	-2
+29.747893433601341	16.28228176539595	81.960390139055448	-2
+30.769547157264689	14.918263315786488	47.996423301240931	-2
+30.705499202657311	15.49005756352725	62.158111177897716	-2
+30.800000000000001	16.120003793405122	77.831207108331256	-2
+30.399999999999999	16.35857074970766	83.864480373535955	-2
+29.800000000000001	13	0	0
+30.199999999999999	13	0	0
+31.116504802974021	14.459273997476519	36.709303434341585	-2
+31.085389478204757	13.931447702175698	23.561166796845317	-2
+30.600000000000001	13	0	0
+30.800000000000001	13.414255728818407	10.470193257547457	-2
+17.800000000000001	23	0	0
+0	48.811753676470587	0	-1
+0.32099585935288649	48.616575367647059	0.67524585719360697	-2
+1.1401742025227373	48.886578275381559	2.0339712247395654	-2
+1.790370917580294	48.990200207395318	2.9102046130766865	-2
+8.1001137587161569	44.024540081606197	79.328430950800367	-2
+5.6933571079902743	48.935661439900151	9.2844172013674058	-2
+6.8286562624443672	48.156448084390341	18.790156073724091	-2
+8.8529693412448047	46.411994921608049	43.508941124581561	-2
+8.6310025460944075	48.351683448852967	18.803022956220019	-2
+8.8695418439586842	45.060851151773704	63.38216526797811	-2
+8.6926139526063988	44.27610019392948	76.245926842014839	-2
+3.6778488849431525	48.873129442888896	6.6706095301429915	-2
+4.701455882352942	50	0	-1
+2.7394000289622897	49.269373639044701	3.2823861495179418	-2
+7.7999999999999998	43	100.0000000370021	1
+8	43.351965933809325	92.44080803108605	-2
+8.3999999999999986	43.414255728818404	91.76436530506308	-2
+9.8000000000000007	37	100.00000003700208	1
+12	33.879996206594875	23.136079126184971	-2
+11.714610521795244	36.068552297824311	75.963102714230189	-2
+12.243258653687795	35.774105006336796	67.833959822556849	-2
+12.541164485259079	34.970552074524356	49.546749738967762	-2
+12.44040043237036	34.163786877682448	31.33638850485578	-2
+11.4	33	0	0
+11.800000000000001	33	0	0
+12	33.414255728818404	11.067727089028454	-2
+11	37	100.00000003700208	1
+11.4	37	100.00000003700208	1
+11.600000000000001	36.648034066190675	90.843943196615257	-2
+17	27.399999999999999	100.00000003700207	1
+16.585744271181596	27.600000000000001	88.135881378082857	-2
+17.998440933431066	25.63881028271015	65.072492801566156	-2
+18.47704205553914	24.865202358698816	46.747716122990084	-2
+17.399999999999999	27	100.00000003700207	1
+18	26.120003793405129	76.886243205381007	-2
+17.800000000000001	27	100.00000003700207	1
+18	26.585744271181596	88.941555028689294	-2
+18.252106566398659	23.71771823460405	18.60533476390156	-2
+18.500113758716164	24.024540081606204	26.109097735540296	-2
+18	23.414255728818404	11.106497705265543	-2
+13	28.600000000000001	0	0
+13.641429250292335	28.800000000000001	16.356105667703577	-2
+16.585744271181596	28.399999999999999	89.269229266604654	-2
+15.731173173306566	29.084098894317655	68.129905444196481	-2
+16.358570749707667	28.800000000000001	83.688960372491707	-2
+15.345725538006031	29.593396526328675	58.636833218300438	-2
+14.723971091238978	29.44719336132804	43.20954375953275	-2
+14.024540081606206	29.499886241283836	25.779840878733154	-2
+16.648034066190672	28	90.547724999867256	-2
+49.397288602941174	0	0	-1
+49.29969944852941	0.11468785993880332	0.12264164434393252	-2
+49.329728801438414	0.30914086183177342	0.32052942209832075	-2
+49.508185104513963	0.5468559512308685	0.41874234112090924	-2
+50	1.1882463235294118	0	-1
+49.710316280867467	1.0090552107494126	0.43119682614829269	-2
+49.677312670794727	0.6700317989443314	0.33146831880193872	-2
+48.140548844271628	12.495315171685816	18.991743122418576	-2
+45.434554065960732	13.19661599765597	46.683274490651307	-2
+47.024154336746662	14.217042873964367	24.308166711784828	-2
+50	12.508588235294118	0	-1
+43.351965933809325	10.399999999999999	93.490272212647909	-2
+43.64142925029234	10.800000000000001	87.934494229245303	-2
+43.72624774187026	11.39480449169613	85.567443689502113	-2
+44.024540081606197	11.700113758716158	79.033515437455904	-2
+44.169271739847716	12.964289353913243	67.953862701933147	-2
+43	10.199999999999999	100.00000003700208	1
+36.648034066190668	12.800000000000001	88.140674224693754	-2
+36.503302407949164	13.464403112629405	74.409558988930044	-2
+37	12.6	100.00000003700207	1
+33	11.4	0	0
+33.351965933809325	11.600000000000001	9.1316761290814021	-2
+33.414255728818404	12	11.137264318838474	-2
+33.414255728818404	12.800000000000001	13.583154669955015	-2
+33.493820655405251	13.493820655405255	26.084794536605749	-2
+33	12.6	0	0
+33	12.199999999999999	0	0
+34.539963825094063	14.984637365899058	50.421602967513486	-2
+33.45615719818138	15.000000000000004	49.809060670516466	-2
+32.964289353913244	14.169271739847691	33.552003475491716	-2
+35.77033367547206	15.325057149862081	46.922973470840894	-2
+36.6724032128215	14.258358018835684	62.581287829117358	-2
+27	18.199999999999999	100.0000000370021	1
+27	18.600000000000001	100.00000003700207	1
+26.28228176539595	19.452106566398658	81.951218623772803	-2
+25.975459918393796	19.700113758716164	74.300643491398404	-2
+27	19	100.00000003700205	1
+26.585744271181596	19.199999999999999	89.528913808558002	-2
+23.641429250292333	18.800000000000001	16.332195595033077	-2
+23	18.600000000000001	0	0
+24.024540081606204	19.499886241283836	25.755171590285233	-2
+25.017402483708011	20.150319261384535	50.456992094668458	-2
+24.268826826693438	20.115901105682344	31.827015880137672	-2
+29.399999999999999	17	100.0000000370021	1
+29.600000000000001	16.648034066190672	91.134330605937777	-2
+30	16.585744271181596	89.58109889482273	-2
+31.254024679918853	15.22863781905906	55.644891127178795	-2
+31.242582024451213	15.832555294570316	70.507195222536396	-2
+30.800000000000001	16.585744271181596	89.53607606749064	-2
+31.199999999999999	16.358570749707667	83.690452092943005	-2
+30.199999999999999	17	100.00000003700207	1
+30.600000000000001	17	100.00000003700205	1
+31.577371264796486	14.718447425539138	43.214213407255272	-2
+31.557417975548784	14.167444705429705	29.72768368063107	-2
+31.199999999999999	13.351965933809328	8.9795622701721971	-2
+31.600000000000001	13.64142925029234	16.561050363093372	-2
+31	13	0	0
+18.199999999999999	23	0	0
+0	49.202110294117645	0	-1
+0.28968371913261065	48.990944789250555	0.43131953382346538	-2
+0.60477259147813123	49.120347704804459	0.82018934985154657	-2
+0.83251645221419668	49.383216715211738	0.80792098933646572	-2
+1.3834246323529413	49.507779181084899	1.0953334073915075	-2
+1.9689595588235296	49.560406448569822	1.3788475564527232	-2
+8.8000000000000007	43.64142925029234	87.88761917829504	-2
+6.262882352941177	50	0	-1
+7.824308823529412	50	0	-1
+9.6345293710067104	45.309711811655376	60.203064881960394	-2
+10.579684124927976	46.808081177924088	38.225561500073319	-2
+9.385735294117648	50	0	-1
+10.166448529411767	48.645579132964443	15.592689159219386	-2
+9.7238304222106819	44.303672117672718	76.671439562947114	-2
+9.2000000000000011	43.879996206594875	83.83504559058558	-2
+3.1400294117647061	50	0	-1
+2.3593161764705886	50	0	-1
+8.1999999999999993	43	100.00000003700208	1
+8.5999999999999996	43	100.00000003700202	1
+12.399999999999999	33.64142925029234	17.981395922664309	-2
+12	36.585744271181596	88.855466159680489	-2
+12.399999999999999	36.35857074970766	81.999336275955841	-2
+12.964289353913243	35.830728260152284	66.560384679750413	-2
+13.56719365619408	35	50.89771903956656	-2
+12.964289353913243	34.169271739847716	33.787609331356094	-2
+12.199999999999999	33	0	0
+11.800000000000001	37	100.00000003700208	1
+17	27.800000000000001	100.0000000370021	1
+18.399999999999999	25.903951644024851	71.970947526112212	-2
+18.800000000000004	25.641696746137409	65.753743582591312	-2
+19.199999999999985	25.019920376080218	50.480638647766554	-2
+19.484098894317654	24.268826826693431	31.829018869489875	-2
+18.399999999999999	26.35857074970766	83.427791136986045	-2
+18.199999999999999	27	100.00000003700207	1
+18.399999999999999	23.351965933809328	9.1383774202316062	-2
+18.800000000000001	23.414255728818404	10.560615117100541	-2
+19.199999999999999	23.641429250292333	16.198358274526385	-2
+13	29	0	0
+13.414255728818404	29.199999999999999	10.4975866384003	-2
+17	28.600000000000001	100.00000003700207	1
+17	28.199999999999999	100.0000000370021	1
+16.28228176539595	29.452106566398662	81.96333666538456	-2
+15.975459918393794	29.700113758716164	74.317478097070122	-2
+17	29	100.00000003700205	1
+16.585744271181596	29.199999999999999	89.535860259448413	-2
+15.017402483708004	30.150319261384535	50.486046781534185	-2
+14.268826826693434	30.115901105682344	31.854585370572469	-2
+13.71771823460405	29.747893433601337	18.062648849608561	-2
+49.592466911764703	0	0	-1
+49.445990889817971	0.15040567736738186	0.12642242507309928	-2
+49.524321539333187	0.33825096901014295	0.24781325007524607	-2
+49.664423582583481	0.4076943146117733	0.21257074209194643	-2
+50	0.79788970588235297	0	-1
+50	0.60271139705882359	0	-1
+49.815807577653082	0.4468586709581247	0.12757458279502445	-2
+50	14.070014705882354	0	-1
+48.54701789025345	14.850727941176471	10.391958920931163	-2
+44.495027424392603	14.075367796487949	48.94190007743579	-2
+45.588693363984831	15.44486689492701	26.318944436322326	-2
+47.25139967812683	16.092265416916597	14.32338957952873	-2
+43	10.6	100.00000003700207	1
+43	11	100.00000003700207	1
+43.346454010367935	11.199999999999999	93.203120375681706	-2
+43.351965933809325	11.600000000000001	92.652878215845192	-2
+43.414255728818404	12	90.460153114292567	-2
+43.64142925029234	12.399999999999999	83.596517123642201	-2
+43.414255728818404	12.800000000000001	86.905909492461717	-2
+43.493820655405251	13.493820655405255	72.24756865616402	-2
+37	13	100.00000003700208	1
+37.200000000000003	13.641429250292335	79.801536302088635	-2
+33	11.800000000000001	0	0
+33	13	0	0
+32.799999999999997	13.4142557288184	13.508617018234297	-2
+33.768232038814631	15.745756847394786	59.680849332290322	-2
+34.94928078050193	16.536596171009677	50.633224534935962	-2
+32.498612583740375	14.876907637134968	47.12855568772693	-2
+32.964289353913237	15.830728260152311	66.57324062823335	-2
+32.440400432370375	14.163786877682433	31.174273705041177	-2
+32.400000000000006	13.641429250292335	17.93271810396277	-2
+37.017440440185858	15.597858021264079	38.340164162840466	-2
+36.488670627476964	16.488670627476964	26.7447433630654	-2
+37.484098894317668	14.268826826693477	65.915424371800484	-2
+37.616818941317938	14.915981359808992	51.685233893750457	-2
+26.648034066190672	19.599999999999998	91.142166165952517	-2
+26.585744271181596	20	89.590079591994694	-2
+25.731173173306566	20.684098894317657	68.176057996302163	-2
+26.35857074970766	20.399999999999999	83.877977284338186	-2
+27	19.399999999999999	100.00000003700207	1
+23	19	0	0
+23.414255728818404	19.199999999999999	10.484636860680302	-2
+23.71771823460405	19.747893433601341	18.044821119083252	-2
+24.521305277943227	20.711957655860122	38.167051453123506	-2
+25.130684347550648	20.891073838178414	53.281370227912646	-2
+23.879996206594878	20.800000000000001	22.189685330697454	-2
+23.64142925029234	20.399999999999999	16.147343325110253	-2
+29.800000000000001	17	100.00000003700208	1
+31.857034725294316	15.193621583277302	54.632996380028082	-2
+31.714610521795244	16.06855229782429	76.004430023980404	-2
+31	17	100.00000003700205	1
+31.399999999999999	17	100.00000003700205	1
+31.600000000000001	16.648034066190672	90.856944633784707	-2
+31.999731136249842	14.364026390179074	34.990100510430352	-2
+32.000000000000007	13.879996206594885	23.095338375486573	-2
+31.399999999999999	13	0	0
+31.800000000000001	13	0	0
+32	13.414255728818405	11.053645304138373	-2
+18.600000000000001	23	0	0
+0	49.397288602941174	0	-1
+0.32268732920530679	49.329968201055685	0.33155693288666743	-2
+0.49181489548599705	49.453144048769182	0.41885078871803094	-2
+0.67027119856144213	49.690859138168371	0.32060871374935351	-2
+0.93300549872193184	49.786164724653091	0.31083148811763767	-2
+1.1882463235294118	50	0	-1
+1.5786029411764708	50	0	-1
+9	43	100.00000003700208	1
+9.1999999999999993	43.414255728818404	92.337970332303513	-2
+10.279789055918407	44.53271085757455	72.562345122977007	-2
+11.104334501052175	45.115990681093258	61.75087874985666	-2
+12.050124213440483	46.336624604351826	41.336797832717522	-2
+11.84407104032185	48.222787362626406	19.210093750938661	-2
+10.947161764705884	50	0	-1
+10.285389478204756	43.931447702175689	83.041300554184119	-2
+9.6000000000000014	43.64142925029234	88.308818054306172	-2
+12.6	33	0	0
+12.800000000000001	33.414255728818404	13.505646609972656	-2
+12.199999999999999	37	100.00000003700211	1
+12.6	37	100.0000000370021	1
+12.800000000000001	36.585744271181596	86.367553184250269	-2
+13.493820655405255	36.506179344594749	73.139495404469102	-2
+14.655021539278335	34.997540657698536	49.449699303294736	-2
+14.365015629638812	33.94907886824015	42.707085061116217	-2
+13.508005419199506	33.500668968081435	26.375585455274198	-2
+18.800000000000001	26.120003793405122	77.656803786733846	-2
+19.199999999999999	25.903951644024872	72.390569603902478	-2
+19.600000000000001	25.641696746137388	65.930632308249216	-2
+20.052557373307142	24.803459638275751	45.101402030930402	-2
+19.85210656639866	23.717718234604046	18.028612611919364	-2
+20.100113758716162	24.024540081606201	25.709270474851998	-2
+18.600000000000001	27	100.00000003700205	1
+18.800000000000001	26.585744271181596	89.435919726281284	-2
+19	23	0	0
+19.399999999999999	23	0	0
+19.600000000000001	23.414255728818404	10.431248699709551	-2
+13	29.399999999999999	0	0
+13.351965933809328	29.600000000000001	8.8778044125691675	-2
+16.648034066190672	29.599999999999998	91.148026578465064	-2
+16.585744271181596	30	89.596782041919553	-2
+15.731173173306576	30.684098894317657	68.196976045796049	-2
+16.35857074970766	30.399999999999999	83.888098984457542	-2
+17	29.399999999999999	100.00000003700207	1
+14.521305277943227	30.711957655860122	38.204230429638422	-2
+15.130684347550654	30.891073838178407	53.316717414332182	-2
+13.879996206594878	30.800000000000001	22.220854370307219	-2
+13.64142925029234	30.399999999999999	16.166705679821924	-2
+13.414255728818405	30	10.435239936498226	-2
+49.690056066176467	0	0	-1
+49.576453429428945	0.13562963678949599	0.090611251949994601	-2
+49.638047493856284	0.078192517465181313	0.044608281803063546	-2
+49.561731617669771	0.21239672134342533	0.14290893331158608	-2
+49.626631459879903	0.25596193101218273	0.14815249658861832	-2
+49.764889630047385	0.26552827494537817	0.097602589434732753	-2
+50	0.40753308823529411	0	-1
+49.894397433029596	0.27569505175587011	0.045040868531652373	-2
+50	15.631441176470588	0	-1
+48.815669743528495	16.994934620830481	5.0570477351411283	-2
+44.029366433720632	15.519974080239692	31.736266744977133	-2
+43.449955718468232	14.573802547527514	50.614479398886488	-2
+44.60139954789458	16.654161104556209	17.57189699626846	-2
+45.71574346739704	17.000823139798857	14.804253812930588	-2
+47.239422564069152	17.876522596277471	8.5713594383850396	-2
+43	11.4	100.0000000370021	1
+43	11.800000000000001	100.00000003700208	1
+43	12.199999999999999	100.00000003700211	1
+43	12.6	100.0000000370021	1
+43	13	100.00000003700205	1
+42.799999999999997	13.4142557288184	85.518590542393738	-2
+42.833837862079612	13.939576851134895	69.793466198985328	-2
+37.399999999999999	13	100.00000003700205	1
+37.599999999999994	13.4142557288184	88.015991541498295	-2
+37.852106566398653	13.71771823460406	80.613443208646487	-2
+32.600000000000001	13	0	0
+33.493820655405251	16.506179344594745	73.844469264067243	-2
+34.169271739847716	17.035710646086756	66.325491612645493	-2
+35.630779556834504	17.163564097295367	36.858026984795487	-2
+34.966202518144343	17.462470361992953	50.602912938840724	-2
+32.799999999999997	16.5857442711816	86.420645150339197	-2
+32.400000000000006	16.358570749707667	81.831867004728693	-2
+32.200000000000003	13	0	0
+37.563686004592746	15.574464838449625	37.20602406622055	-2
+37.599999999999994	16.120003793405136	24.145459287247643	-2
+37.200000000000003	16.358570749707667	20.25603734569842	-2
+37	17	0	0
+36.358570749707667	17.199999999999999	20.248259015660182	-2
+38.100113758716176	14.024540081606212	73.245272769756269	-2
+37.993873313677504	15.458432833115355	39.135559251782794	-2
+38.49081374267729	14.898810949797515	52.31007787934098	-2
+27	19.800000000000001	100.00000003700207	1
+27	20.199999999999999	100.00000003700207	1
+26.28228176539595	21.052106566398663	81.84571880988274	-2
+25.975459918393796	21.300113758716165	74.046868855745501	-2
+27	20.600000000000001	100.00000003700202	1
+26.585744271181593	20.800000000000001	89.537678617667154	-2
+23	19.399999999999999	0	0
+23.351965933809328	19.600000000000001	8.868209000453545	-2
+23.414255728818404	20	10.423873161915935	-2
+24.56446509037049	21.17886058221336	39.323954528761732	-2
+24.096048355975128	21.199999999999999	27.721645190104297	-2
+24.895562229859863	21.601974978151702	47.480200246863951	-2
+23.414255728818404	20.800000000000001	10.471798846712156	-2
+23.641429250292333	21.199999999999999	16.319270624003892	-2
+23	20.199999999999999	0	0
+23	20.600000000000001	0	0
+32	16.585744271181596	88.81414323890057	-2
+31.800000000000001	17	100.0000000370021	1
+0	49.592466911764703	0	-1
+0.18419242234691457	49.553141329041871	0.12760810406459117	-2
+0.33557641741650979	49.592305685388247	0.21262585306523696	-2
+0.47567846066681629	49.661749030989867	0.24787627607924481	-2
+0.70030055147058823	49.885312140061188	0.12267135307236414	-2
+0.55400911018200205	49.84959432263269	0.12645380779108883	-2
+0.79788970588235297	50	0	-1
+9.4000000000000004	43	100.00000003700202	1
+10.757417975548783	44.167444705429709	78.413682878374942	-2
+11.642582024451217	44.167444705429709	76.36687143692383	-2
+12.257034725294391	44.806378416722687	62.02453008757265	-2
+13.328044622017831	47.179832058988389	26.505800898384184	-2
+13.962121437797245	45.802909112662363	37.136609701953525	-2
+12.50858823529412	50	0	-1
+13.289301470588237	48.695242622712101	12.107230780852065	-2
+10	43.414255728818404	92.427878742698041	-2
+10.399999999999999	43.351965933809325	93.484436506874275	-2
+10.800000000000001	43.64142925029234	87.893872134962962	-2
+9.8000000000000007	43	100.00000003700211	1
+13	33	0	0
+13	37	100.00000003700205	1
+13.4142557288184	37.200000000000003	86.299904656195295	-2
+14.169271739847691	37.035710646086756	66.60655480523242	-2
+15.000000000000005	36.164392425359786	50.438150282050728	-2
+15.906751163349407	35.132105312760068	48.753642033482357	-2
+15.314688059750823	34.13254607196528	52.516151493638205	-2
+15.315230061142454	33.264085427017491	55.494713174159763	-2
+14.402141978735935	32.982559559814142	38.424822253168507	-2
+13.641429250292335	32.799999999999997	20.289247755796715	-2
+19.199999999999999	26.358570749707667	83.790820163512635	-2
+19.599999999999998	26.120003793405118	77.867452270130514	-2
+20	25.903951644024872	72.480409706524412	-2
+20.414273924593928	25.615269932731692	65.263172699080883	-2
+20.813999307310311	24.974291329413461	49.373249572696004	-2
+21.084098894317655	24.268826826693438	31.96532197726259	-2
+20	23.351965933809328	8.8524433855260956	-2
+20.399999999999999	23.414255728818404	10.433928875709839	-2
+20.800000000000001	23.641429250292333	16.200602910635585	-2
+19	27	100.00000003700205	1
+19.800000000000001	23	0	0
+13	29.800000000000001	0	0
+17	29.800000000000001	100.00000003700207	1
+17	30.199999999999999	100.00000003700207	1
+16.282281765395954	31.052106566398663	81.855499173763846	-2
+15.975459918393799	31.300113758716162	74.061256460207716	-2
+17	30.600000000000001	100.00000003700207	1
+16.585744271181593	30.800000000000001	89.54340068902323	-2
+14.564465090370497	31.178860582213364	39.37458440203438	-2
+14.096048355975132	31.199999999999999	27.770182084829425	-2
+14.895562229859731	31.601974978151677	47.539831294090433	-2
+13.414255728818404	30.800000000000001	10.488349671985892	-2
+13.641429250292335	31.199999999999999	16.353882809426445	-2
+13	30.199999999999999	0	0
+13	30.600000000000001	0	0
+49.787645220588232	0	0	-1
+49.724304948244125	0.10560256697040669	0.045229106478471372	-2
+49.654537230893261	0.16718548248939588	0.090581284643740434	-2
+49.745825384844828	0.18525376454065984	0.073322308987726986	-2
+49.877225132653379	0.20028741935432859	0.038507197403967595	-2
+50	0.21235477941176467	0	-1
+49.945286211436688	0.16356020220588233	0.013888276880693098	-2
+50	18.75429411764706	0	-1
+48.554468420179539	18.520596116997531	4.4618272515845074	-2
+43.508005419199506	16.499331031918555	16.039166817902146	-2
+42.964289353913237	15.830728260152311	27.464651424939643	-2
+42.655802256147176	15.147864721593532	42.25535232144459	-2
+42.5825595598142	14.402141978735962	59.71814239156577	-2
+44.811299636634054	17.73833130558786	10.550436802524494	-2
+43.641429250292333	17.199999999999999	8.452769633604877	-2
+45.628929818572061	18.164610202791216	9.8238054718131771	-2
+46.078066740125593	19.028882784117172	7.8653027787700402	-2
+48.110759797370712	19.916052659427617	4.8043090105736495	-2
+42.600000000000001	13	100.00000003700205	1
+42.400000000000006	13.641429250292335	80.50763768349745	-2
+37.799999999999997	13	100.00000003700205	1
+38	13.351965933809332	90.454486845581286	-2
+38.400000000000006	13.4142557288184	89.166301834798517	-2
+33	17	100.00000003700207	1
+33.414255728818404	17.199999999999999	86.447997420642579	-2
+34.163786877682448	17.55959956762964	68.711834670414305	-2
+33.64142925029234	17.600000000000001	82.009015547829662	-2
+35.443048677001428	17.867669708824451	39.513008602844423	-2
+36.068552297824311	17.885389478204758	24.559669306714692	-2
+34.361189717289861	17.99844093343107	65.054407466656386	-2
+32.600000000000001	17	100.00000003700207	1
+32.200000000000003	17	100.00000003700208	1
+38	15.903951644024819	28.440981516440317	-2
+37.599999999999994	16.5857442711816	11.82639405415479	-2
+38	16.358570749707653	17.034116036708998	-2
+37.399999999999999	17	0	0
+37	17.399999999999999	0	0
+36.585744271181596	17.600000000000001	11.969301514635525	-2
+39.084098894317634	14.268826826693413	67.862570746144726	-2
+38.799999999999997	13.641429250292335	83.533154089307516	-2
+38.400000000000013	15.641696746137464	34.329405665909533	-2
+39.677042055539076	14.865202358698792	52.922884094431737	-2
+39.199999999999996	15.641696746137423	33.864011450087588	-2
+26.648034066190672	21.199999999999999	91.02113368574831	-2
+26.585744271181596	21.600000000000001	89.212778414889101	-2
+26.358570749707667	22	82.872356581456614	-2
+25.173387972096197	22.407286146343207	53.670827880797724	-2
+27	21	100.00000003700208	1
+23	19.800000000000001	0	0
+24.358303253862612	21.600000000000001	34.445865538308595	-2
+23.879996206594882	21.599999999999998	22.587873964923237	-2
+24.541567166884498	22.00612668632251	39.199810810862907	-2
+23	21	0	0
+23	21.399999999999999	0	0
+23.414255728818404	21.600000000000001	10.724892835048033	-2
+0	49.787645220588232	0	-1
+0.10560256697040668	49.724304948244125	0.045052601497828505	-2
+0.23511036995262155	49.734471725054611	0.097627796615724627	-2
+0.37336854012011522	49.744038068987834	0.14819029279244966	-2
+0.43826838233024634	49.787603278656583	0.14294504385232343	-2
+0.60271139705882359	50	0	-1
+0.42354657057102918	49.864370363210497	0.09063397991647057	-2
+0.40753308823529411	50	0	-1
+11.200000000000001	43.879996206594875	82.84876123697633	-2
+11.600000000000001	43.64142925029234	86.735008825358662	-2
+12.114610521795242	43.931447702175689	79.155604736520957	-2
+13.30749940693792	44.406545322612331	59.733097179917479	-2
+14.84207389880789	47.104429423419845	21.110345265347899	-2
+14.217132893765026	44.281945275230825	49.022908326039257	-2
+16.06371337168515	45.132599183168878	22.679611180153895	-2
+14.070014705882356	50	0	-1
+15.641780402660695	48.456738914863458	9.2848303488392627	-2
+10.199999999999999	43	100.00000003700208	1
+10.6	43	100.00000003700207	1
+11	43	100.00000003700208	1
+11.199999999999999	43.414255728818404	91.845134997295176	-2
+13	32.600000000000001	0	0
+13	37.399999999999999	100.00000003700205	1
+13.641429250292335	37.599999999999994	81.769644807911021	-2
+15	37.368263217424492	49.820217453927405	-2
+14.024540081606212	38.299886241283851	73.588700137540499	-2
+15.830728260152311	37.035710646086763	33.42079652805964	-2
+16.535596887370595	36.503302407949164	25.762709990729043	-2
+16.672403212821504	34.258358018835665	62.570175523295795	-2
+17.067629092256389	35.087162808627824	47.822548207980155	-2
+16.50330240794916	33.464403112629405	74.24562364217185	-2
+15.975459918393796	32.699886241283835	71.322506033175614	-2
+15.173387972096217	32.407286146343395	53.720640928950729	-2
+14.425535161550396	32.436313995407239	37.320241596171826	-2
+13.879996206594868	32.399999999999999	24.220619577819143	-2
+13.4142557288184	32.400000000000006	11.861178487310253	-2
+19.399999999999999	27	100.00000003700207	1
+19.600000000000001	26.585744271181596	89.564124769639051	-2
+20	26.358570749707667	83.866890747421124	-2
+20.399999999999999	26.120003793405118	77.866343163823089	-2
+20.907386047393601	25.723899806070552	67.855105728236282	-2
+21.693444429225721	24.906564021603391	47.736094531672748	-2
+21.452106566398658	23.71771823460405	18.388155018188698	-2
+21.700113758716164	24.024540081606204	26.353012908119673	-2
+20.199999999999999	23	0	0
+20.600000000000001	23	0	0
+21	23	0	0
+21.199999999999999	23.414255728818404	10.570873167333435	-2
+16.648034066190672	31.199999999999999	91.024030183912572	-2
+16.585744271181596	31.599999999999998	89.210918055497331	-2
+16.35857074970766	32	82.85876167214424	-2
+17	31	100.00000003700208	1
+14.358303253862589	31.599999999999994	34.520479739596311	-2
+13.879996206594878	31.599999999999998	22.652447317257494	-2
+14.54156716688456	32.00612668632251	39.308087528358989	-2
+13	31	0	0
+13	31.399999999999999	0	0
+13.414255728818404	31.600000000000001	10.760132288226234	-2
+49.885234374999996	0	0	-1
+49.836439797794114	0.05471378856331055	0.014035004695999744	-2
+49.799712580645668	0.12277486734662746	0.039088340556407856	-2
+49.877050594980268	0.12294940501973545	0.023403851969689315	-2
+50	0.11476562499999997	0	-1
+49.949464752219626	0.090368336397058796	0.0070669329210408197	-2
+50	20.315720588235294	0	-1
+43	17	0	0
+42.799999999999997	16.5857442711816	10.444297171457897	-2
+42.243497117235265	15.773541454585875	28.879557358531351	-2
+42.400000000000006	16.358570749707667	15.378752840829172	-2
+41.880386687649825	14.952358622256915	48.657215377651276	-2
+42.038265664869726	14.423357678242889	61.210262522446541	-2
+42	13.879996206594898	75.426262356444397	-2
+44.713918996454645	18.278575144878243	8.126408074584452	-2
+43.931447702175689	17.885389478204758	6.3435197566919532	-2
+43	17.399999999999999	0	0
+43.414255728818404	17.600000000000001	4.0781141435438348	-2
+45.160403381618991	18.7024091564092	7.8252909944114588	-2
+46.771435830626402	20.21247706427533	6.8189921176359762	-2
+45.147926631548273	19.317899128897523	6.7948431751847638	-2
+45.315784474646193	20.475355023456633	6.7274286949930566	-2
+48.148659153826472	21.682728012316055	5.6600776871552263	-2
+42.200000000000003	13	100.0000000370021	1
+42	13.414255728818407	88.191123673210001	-2
+38.200000000000003	13	100.00000003700205	1
+38.600000000000001	13	100.00000003700205	1
+33	17.399999999999999	100.00000003700205	1
+33.879996206594875	18	76.841360683408027	-2
+33	17.800000000000001	100.00000003700207	1
+33.414255728818404	18	88.914146527119811	-2
+35.832555294570298	18.357417975548781	29.754463251767529	-2
+35.490057563527238	18.894500797342697	37.950554061594282	-2
+34.358303253862601	18.800000000000004	65.653085055910296	-2
+36.648034066190675	18	9.4493894892963848	-2
+36.35857074970766	18.399999999999999	16.537875709802446	-2
+34.096048355975142	18.399999999999999	71.919562499902796	-2
+38.400000000000006	16.120003793405136	22.526184373351839	-2
+37.799999999999997	17	0	0
+38.200000000000003	17	0	0
+38.399999999999999	16.5857442711816	10.698105485469256	-2
+37	17.800000000000001	0	0
+39.452106566398662	13.717718234604046	81.741169324353862	-2
+39.700113758716149	14.024540081606212	73.96318063076491	-2
+39	13	100.00000003700205	1
+39.200000000000003	13.414255728818405	89.416893241745257	-2
+38.799999999999997	15.903951644024868	27.589214928371288	-2
+40.693507584715562	15.007089668999265	48.85259548849735	-2
+40.556730902462689	14.225919675211941	68.525138124109574	-2
+40	15.641696746137326	33.537518639414913	-2
+39.599999999999987	15.903951644024872	27.206919317627108	-2
+39.199999999999996	16.120003793405129	22.003315540565307	-2
+27	21.399999999999999	100.00000003700208	1
+27	21.800000000000001	100.00000003700205	1
+27	22.199999999999999	100.00000003700205	1
+26.585744271181596	22.399999999999999	88.183531225010071	-2
+25.975459918393792	22.699886241283831	71.34992597848391	-2
+24.425535161550449	22.436313995407229	37.129702484946357	-2
+25.233839345566977	23.270751387939733	53.896365943201971	-2
+24.402141978735948	22.98255955981417	38.054730857727606	-2
+24.096048355975128	22	28.455002678146418	-2
+23.641429250292333	22	17.026228153265031	-2
+23	21.800000000000001	0	0
+0	49.885234374999996	0	-1
+0.054713788563310536	49.836439797794114	0.013891861032936138	-2
+0.12277486734662743	49.799712580645668	0.0385171217132559	-2
+0.25417461515516493	49.814746235459339	0.073341115716243022	-2
+0.34546276910672585	49.832814517510606	0.090604256302332195	-2
+0.3619525061437146	49.921807482534817	0.044619510034148505	-2
+0.30994393382352942	50	0	-1
+11.800000000000001	43	100.00000003700207	1
+11.4	43	100.00000003700202	1
+12	43.351965933809325	91.984910382364291	-2
+12.399999999999999	43.414255728818404	89.125709723693348	-2
+12.800000000000001	43.64142925029234	80.437199762943578	-2
+13.511329372523038	43.511329372523036	71.602520831743675	-2
+16.413070093775538	47.119998891943887	13.591568103948617	-2
+14.074388271808346	43.246748939743604	62.4236789699127	-2
+14.81274800164155	43.112084616204527	47.962515763532089	-2
+15.473872882653151	44.086056663154828	32.473062198115286	-2
+17.255165629577284	45.286236958024574	13.651890212887258	-2
+17.01744044018583	44.402141978735948	13.73640069908561	-2
+15.631441176470592	50	0	-1
+17.178055048391919	48.603782749751019	5.8278041277986121	-2
+13	32.200000000000003	0	0
+13	37.799999999999997	100.0000000370021	1
+13.414255728818407	38	88.753471060258832	-2
+15.071945615761239	38.501966643611055	48.180800569871295	-2
+15.731173173306555	37.884098894317674	32.777364672861829	-2
+13.717718234604046	38.547893433601338	81.538084941144149	-2
+14.268826826693413	38.915901105682366	67.862475582345098	-2
+16.5857442711816	37.200000000000003	13.571578001480969	-2
+16.358570749707667	37.599999999999994	17.972085102430988	-2
+17.199999999999999	36.648034066190668	11.846577417438573	-2
+17	37	0	0
+17.300113758716169	35.975459918393796	28.895816763800301	-2
+17.484098894317654	34.268826826693413	66.093844100292515	-2
+17.199999999999999	33.641429250292333	79.816507091017115	-2
+18.159783312637462	35.073849963600168	48.115080241657623	-2
+17	33	100.00000003700205	1
+16.648034066190668	32.799999999999997	88.20671523622967	-2
+16.585744271181593	32.399999999999999	88.137851640443031	-2
+14.096048355975149	32	28.565067348243137	-2
+13.64142925029234	32	17.107760388558724	-2
+19.800000000000001	27	100.00000003700205	1
+20.199999999999999	27	100.00000003700205	1
+20.399999999999999	26.585744271181596	89.562391379865886	-2
+20.800000000000001	26.358570749707667	83.783696635616337	-2
+21.499886241283836	25.975459918393796	73.770019526760549	-2
+22.115901105682344	25.731173173306562	66.888615660119143	-2
+23.289040377869931	25	49.973985771518393	-2
+22.964289353913237	24.169271739847716	33.128169409412124	-2
+21.599999999999998	23.351965933809328	9.1523852405184005	-2
+22	23.414255728818404	11.169964697539299	-2
+22.399999999999999	23.64142925029234	18.051425338098987	-2
+21.399999999999999	23	0	0
+17	31.399999999999999	100.0000000370021	1
+17	31.800000000000001	100.0000000370021	1
+17	32.200000000000003	100.00000003700208	1
+13	31.800000000000001	0	0
+49.934028952205878	0	0	-1
+49.909631663602937	0.050535247780375415	0.0070853485053321936	-2
+50	0.06597104779411761	0	-1
+49.963868038075681	0.036131961924313435	0.002066551503437489	-2
+50	21.877147058823532	0	-1
+42.600000000000001	17	0	0
+41.714417284233022	15.478877308862817	36.350812262781552	-2
+41.714610521795244	16.068552297824294	22.275081159792251	-2
+42.200000000000003	17	0	0
+42	16.585744271181593	9.9297522017121995	-2
+41.557417975548773	14.167444705429686	68.837235969159821	-2
+41.333624494634456	15.02864016986025	47.680534016001623	-2
+41.599999999999994	13.641429250292335	82.573928634609359	-2
+44.170950537403954	18.359393753187735	5.9496731641201155	-2
+44.553135704294981	18.803451442623974	6.2650354322051083	-2
+43.351965933809325	18	2.5023036963475134	-2
+43.64142925029234	18.399999999999999	3.5004812593598582	-2
+43	17.800000000000001	0	0
+46.388224799890729	21.529597188488584	8.6442409763685948	-2
+44.250390508466687	19.305046976637051	4.6892565052430477	-2
+44.402141978735941	19.817440440185827	4.8080066442474791	-2
+44.276100193929452	20.907386047393604	4.9884332572650703	-2
+44.884445843937932	21.51532675137631	7.7722769581052535	-2
+48.773493454635741	22.877848494555469	5.1507017191643953	-2
+46.993198495912878	23.019698031328122	11.849782803313012	-2
+41.799999999999997	13	100.0000000370021	1
+33.64142925029234	18.399999999999999	83.393985114587053	-2
+33	18.199999999999999	100.00000003700207	1
+36.120003793405118	18.800000000000001	22.304691361967581	-2
+35.036206844474044	19.424203693423198	49.069474779071079	-2
+35.731173173306587	19.484098894317654	31.819117278293191	-2
+34.096048355975128	19.199999999999999	72.337520604092646	-2
+33.879996206594882	18.800000000000001	77.608945638682243	-2
+34.361653870299158	19.601809769707163	65.809233719433919	-2
+37	18.199999999999999	0	0
+37	18.600000000000001	0	0
+36.585744271181596	18.800000000000001	10.546576558296708	-2
+38.799999999999997	16.358570749707667	16.231692638377194	-2
+38.600000000000001	17	0	0
+39.599999999999994	13.351965933809325	91.023574068637899	-2
+40	13.414255728818407	89.401795422869625	-2
+40.400000000000006	13.641429250292335	83.502861453529533	-2
+39.399999999999999	13	100.00000003700208	1
+41.092934553516287	14.506417941171399	60.980088176394737	-2
+40.80180976970717	15.638346129700873	33.222964339293817	-2
+41.085389478204746	13.931447702175708	75.609100574422655	-2
+40.400000000000013	15.903951644024872	26.896372311173515	-2
+40	16.1200037934051	21.723168831782132	-2
+39.599999999999994	16.358570749707667	15.936991425147912	-2
+39.199999999999996	16.5857442711816	10.378293123022059	-2
+27	22.600000000000001	100.00000003700208	1
+26.648034066190668	22.800000000000001	88.34926667356531	-2
+26.503302407949167	23.464403112629405	75.043644617091871	-2
+25.913583821239516	23.806637607012885	61.471814277562061	-2
+23.879996206594882	22.399999999999999	24.061332536254959	-2
+24.596724272705043	23.76521165594405	45.062539417971188	-2
+25.314688059750825	24.132546071965269	52.818001149029179	-2
+23.641429250292333	22.800000000000001	20.066097707264607	-2
+23.508005419199502	23.500668968081435	25.868698879133348	-2
+23	22.199999999999999	0	0
+23.414255728818404	22.399999999999999	11.770250774845481	-2
+0	49.934028952205878	0	-1
+0.050535247780375409	49.909631663602937	0.0070687377062494446	-2
+0.12294940501973547	49.877050594980268	0.023409864835659645	-2
+0.20028741935432859	49.877225132653379	0.039098339943570218	-2
+0.27569505175587011	49.894397433029596	0.045240542343961625	-2
+0.2123547794117647	50	0	-1
+12.199999999999999	43	100.00000003700205	1
+12.6	43	100.00000003700202	1
+13	43	100.00000003700208	1
+13.641429250292335	42.799999999999997	78.326454350868588	-2
+17.954217222846747	47.443087138525733	8.0672873538325245	-2
+18.288956663973234	46.144877534316244	9.1554324388583108	-2
+14.226458545414189	42.643497117235306	63.614349186093108	-2
+15.830728260152299	42.964289353913244	27.55929171943016	-2
+15.215321489021211	42.478646254615505	41.377991085490677	-2
+16.499331031918569	43.508005419199499	16.317582286488285	-2
+17.562045272235451	44.423704591677343	10.253643255428912	-2
+18.410128576017403	44.806481139452785	7.8572119687081505	-2
+17.600000000000001	43.879996206594882	7.376882706701628	-2
+17.199999999999999	43.641429250292333	8.266782034505912	-2
+17.192867647058826	50	0	-1
+18.574068530110441	48.63186088772737	4.2377859390317987	-2
+13	38.200000000000003	100.00000003700205	1
+13.351965933809325	38.400000000000006	90.799591418976775	-2
+15.258984841132044	39.088731769317512	43.388061034247748	-2
+15.975459918393797	38.500113758716175	26.023082454895018	-2
+16.282281765395947	38.252106566398666	18.551421857421982	-2
+13.414255728818405	38.799999999999997	89.36692152149439	-2
+13.641429250292335	39.200000000000003	83.668804929909228	-2
+13.879996206594864	39.600000000000001	77.641210725598654	-2
+14.521305277943153	39.511957655860101	61.551669421523812	-2
+17	37.399999999999999	0	0
+17	37.799999999999997	0	0
+16.585744271181593	38	11.091257084995721	-2
+17.399999999999999	37	0	0
+17.600000000000001	36.585744271181596	11.927019488649885	-2
+18	36.358570749707667	17.221639921290336	-2
+17.852106566398664	33.717718234604042	80.67996139720006	-2
+18.100113758716159	34.024540081606197	73.335440426020966	-2
+17.399999999999999	33	100.00000003700207	1
+17.600000000000001	33.414255728818404	88.042186103078095	-2
+18.791616225103574	35.307932378615064	42.345782887642379	-2
+18.699886241283842	35.975459918393796	25.940235000304824	-2
+19.084098894317641	34.26882682669342	68.021791790215815	-2
+17	32.600000000000001	100.00000003700205	1
+20.600000000000001	27	100.00000003700207	1
+21	27	100.00000003700205	1
+21.199999999999999	26.585744271181596	89.411216600347529	-2
+21.747893433601341	26.28228176539595	81.313209254941825	-2
+22.964289353913237	25.830728260152284	66.679383919062445	-2
+22.399999999999999	26.35857074970766	82.030770929598759	-2
+23.687452158301053	25.798023009060682	60.737795618850527	-2
+23.913153482643189	24.205861215937016	40.845288008186806	-2
+24.09024755218892	25.089826662786031	51.204186399014873	-2
+22.800000000000001	23.414255728818407	13.376818641939719	-2
+21.800000000000001	23	0	0
+22.199999999999999	23	0	0
+22.600000000000001	23	0	0
+49.982823529411768	0	0	-1
+50	0.017176470588235265	0	-1
+50	23.438573529411766	0	-1
+41.242582024451217	15.832555294570312	28.204398293509257	-2
+41.599999999999994	16.648034066190668	8.4633363590506914	-2
+41.200000000000003	16.358570749707667	15.513011766355788	-2
+41.799999999999997	17	0	0
+41.399999999999999	13	100.0000000370021	1
+41.200000000000003	13.35196593380933	90.650372003573025	-2
+43.969161407033447	18.8506399314414	4.2406685363260115	-2
+43	18.199999999999999	0	0
+43	18.600000000000001	0	0
+43.414255728818404	18.800000000000001	1.9663724821885131	-2
+45.421011256645464	22.681140828783992	13.06533352818054	-2
+43.717718234604042	19.347893433601339	2.8328014445181671	-2
+43.879996206594882	20.399999999999999	3.32737887867119	-2
+43.641429250292333	20	2.4051842078968151	-2
+44.024540081606204	21.499886241283843	5.1172092176512267	-2
+43.641429250292333	20.800000000000001	2.6378089795163118	-2
+44.26882682669342	22.115901105682358	8.1396432211607497	-2
+48.390511204753238	24.170928332311401	9.3243543552360375	-2
+46.62825291381484	24.58597017141647	20.842522235054833	-2
+33	18.600000000000001	100.00000003700205	1
+33.414255728818404	18.800000000000001	89.415080352921365	-2
+36.358570749707667	19.199999999999999	16.190210035404142	-2
+34.971359830139775	20.133624494634503	50.667860378921247	-2
+36.282281765395958	19.852106566398664	18.019064153915672	-2
+35.975459918393803	20.100113758716159	25.694737455446816	-2
+33.879996206594882	19.599999999999998	77.839660659990258	-2
+33.641429250292333	19.199999999999999	83.762540038730378	-2
+34.167444705429688	20.042582024451217	70.673488666780102	-2
+37	19	0	0
+39	17	0	0
+39.799999999999997	13	100.00000003700205	1
+40.200000000000003	13	100.0000000370021	1
+40.600000000000001	13	100.00000003700205	1
+40.799999999999997	13.4142557288184	89.210346853467556	-2
+40.800000000000004	16.120003793405129	21.446108952997751	-2
+40.400000000000006	16.358570749707667	15.734410257081176	-2
+40	16.585744271181593	10.226860914776939	-2
+39.399999999999999	17	0	0
+39.799999999999997	17	0	0
+27	23	100.0000000370021	1
+27.199999999999999	23.641429250292333	79.9968464625222	-2
+26.672403212821504	24.258358018835665	62.501966602005389	-2
+25.966584659665422	24.486404752278741	54.754427457125033	-2
+24.66251581755656	24.521926321193771	48.566226588192087	-2
+25.746333685191509	25.210618547863806	48.609806055173003	-2
+24.880495273569419	25.249546118020575	49.816985789077293	-2
+23	22.600000000000001	0	0
+23	23	0	0
+0	49.982823529411768	0	-1
+0.036131961924313435	49.963868038075681	0.0020670767664194055	-2
+0.090368336397058796	49.949464752219626	0.0070871573332764067	-2
+0.16356020220588233	49.945286211436688	0.014038552257046337	-2
+0.11476562499999998	50	0	-1
+13	42.600000000000001	100.0000000370021	1
+13.4142557288184	42.400000000000006	87.209068105065299	-2
+13.931447702175735	42.114610521795257	73.72362598916024	-2
+19.294834441320905	47.455093113623228	6.3298460355775052	-2
+19.533324191389077	45.637396501404744	7.1835047628316957	-2
+14.521122691137203	42.114417284232992	58.639541474327281	-2
+16.5857442711816	42.800000000000004	10.51512011290354	-2
+16.358570749707667	42.400000000000006	15.440479770019037	-2
+15.975459918393788	41.700113758716149	24.529533510704251	-2
+14.97135983013975	41.733624494634419	48.51573189813886	-2
+17	43	0	0
+18.011835896235137	44.115893344432166	6.9620512622561579	-2
+18.474915470529147	44.011905013647898	5.1643792970814673	-2
+19.426288022103794	44.551238111284995	5.4043335341902088	-2
+17.600000000000001	43.414255728818404	3.9048203966857615	-2
+18	43.641429250292333	4.4517116247220416	-2
+17.399999999999999	43	0	0
+18.754294117647063	50	0	-1
+19.953552149263018	48.668066376576043	3.6098032096623447	-2
+13	38.600000000000001	100.00000003700208	1
+15.731173173306553	39.484098894317654	31.545632770617804	-2
+15.130684347550597	39.691073838178205	46.351253940327283	-2
+16.585744271181596	38.800000000000004	10.500503308385191	-2
+16.358570749707667	39.200000000000003	16.065345004631041	-2
+16.648034066190668	38.400000000000006	9.1071317192991224	-2
+13	39	100.00000003700205	1
+13	39.399999999999999	100.0000000370021	1
+13.4142557288184	39.599999999999994	89.449495067221051	-2
+14.096048355975165	40	72.10103516254101	-2
+13.641429250292346	40	83.622146794818306	-2
+14.564465090370588	39.978860582213379	60.337178026661078	-2
+17	38.200000000000003	0	0
+17.800000000000001	37	0	0
+18.199999999999999	37	0	0
+18.399999999999999	36.585744271181596	10.81712376747152	-2
+18	33.351965933809325	90.487149140279229	-2
+18.399999999999999	33.414255728818404	89.212642564913779	-2
+18.800000000000001	33.641429250292333	83.61915721394476	-2
+17.800000000000001	33	100.0000000370021	1
+19.635277002996787	34.759883942141791	55.911546713954671	-2
+19.315901105682357	35.73117317330658	31.810053968966294	-2
+18.947893433601337	36.282281765395958	18.149830204551712	-2
+19.452106566398662	33.717718234604042	81.903202527704281	-2
+19.700113758716157	34.024540081606204	74.238327470740771	-2
+21.399999999999999	27	100.0000000370021	1
+21.600000000000001	26.648034066190672	90.829499769401011	-2
+22	26.585744271181596	88.865072523020061	-2
+22.800000000000001	26.585744271181593	86.641616985179596	-2
+23.508005419199502	26.499331031918565	74.236915573509037	-2
+22.199999999999999	27	100.00000003700207	1
+22.600000000000001	27	100.00000003700207	1
+24.241789284987728	26.263581195623622	59.548685638658817	-2
+50	0	0	-1
+50	25	0	-1
+41.399999999999999	17	0	0
+41	17	0	0
+40.799999999999997	16.5857442711816	10.092017752671433	-2
+41	13	100.0000000370021	1
+43	19	0	0
+43.351965933809325	19.199999999999999	1.4700592833710813	-2
+44.169271739847716	22.964289353913241	13.068009909531652	-2
+44.58908335411666	24.195342157873903	26.464454404690656	-2
+43.414255728818404	19.600000000000001	1.6131947222217646	-2
+43.414255728818404	20.399999999999999	1.6086680487372036	-2
+43	19.800000000000001	0	0
+43	20.199999999999999	0	0
+43.414255728818404	21.199999999999999	1.9761600557362391	-2
+43.717718234604042	21.747893433601337	4.2003694217233924	-2
+43	21	0	0
+43	20.600000000000001	0	0
+43.64142925029234	22.399999999999999	5.8254408719590298	-2
+47.2255642191516	25.67959626430649	21.94424166495131	-2
+48.361186573050468	26.192588170537157	13.862197711994124	-2
+45.979477726250771	25.68779862635078	32.556618993559262	-2
+33	19	100.00000003700205	1
+37	19.399999999999999	0	0
+36.585744271181596	19.600000000000001	10.4256294248095	-2
+34.521122691137172	20.51441728423303	61.83351934625707	-2
+35.73117317330658	21.084098894317641	31.913339790967512	-2
+35.016695691082035	21.211006572973762	49.518965727680872	-2
+36.648034066190675	20	8.8464164160554173	-2
+36.585744271181596	20.399999999999999	10.42321007638734	-2
+36.358570749707667	20.800000000000001	16.176974495394763	-2
+33.414255728818404	19.600000000000001	89.550524526590891	-2
+33.641429250292333	20	83.852302663454935	-2
+33	19.399999999999999	100.00000003700207	1
+33.931447702175696	20.514610521795241	76.550486534916004	-2
+40.200000000000003	17	0	0
+40.600000000000001	17	0	0
+27.399999999999999	23	100.00000003700207	1
+27.600000000000001	23.414255728818404	88.123373822485433	-2
+27.85210656639866	23.717718234604046	80.774974613701431	-2
+27.484098894317654	24.268826826693431	66.22374644570084	-2
+26.479484137321577	25.022239865381124	49.533873403818454	-2
+27.262786691421844	24.93756192307357	51.228321475103684	-2
+25.541011820846471	25.93219830255368	45.185375495311668	-2
+26.270441455195851	25.756793573742424	40.006818785844402	-2
+24.99138121440685	26.442825962224831	50.425015840657721	-2
+0	50	0	-1
+0.017176470588235265	50	0	-1
+0.065971047794117624	50	0	-1
+13	42.200000000000003	100.00000003700205	1
+13.351965933809332	42	89.964553005774334	-2
+14.167444705429697	41.642582024451208	68.702621001978599	-2
+13.641429250292335	41.599999999999994	82.608636872487978	-2
+20.784006905829422	47.565542883542385	6.2398259799112905	-2
+20.52415081027344	46.095063849238272	7.2842053880642004	-2
+20.56278114229583	45.274884189624075	6.8050667626749259	-2
+17	42.600000000000001	0	0
+17	42.200000000000003	0	0
+16.585744271181593	42	9.9604180751879454	-2
+16.282281765395954	41.452106566398662	17.282180664649037	-2
+15.731173173306587	41.084098894317634	30.791535228443127	-2
+14.361653870299119	41.201809769707161	64.464487939621506	-2
+15.136712024665131	40.520025871682314	45.79225139383113	-2
+18.399999999999999	43.414255728818404	2.3994311922203462	-2
+19.005195508303885	43.726247741870274	3.185842661949958	-2
+20.114610521795242	43.931447702175689	3.424218258357929	-2
+20.748719017256601	44.475125423962773	5.3167022757374678	-2
+19.600000000000001	43.64142925029234	2.4833600589475839	-2
+17.800000000000001	43	0	0
+18.199999999999999	43	0	0
+20.315720588235298	50	0	-1
+21.995891134100642	48.437993683297321	5.3440517122775422	-2
+16.28228176539595	39.85210656639866	17.766187471564205	-2
+15.975459918393792	40.100113758716169	25.272732114546105	-2
+17	39	0	0
+17	38.600000000000001	0	0
+17	39.399999999999999	0	0
+16.5857442711816	39.600000000000001	10.303402448361391	-2
+13	39.799999999999997	100.00000003700205	1
+14.358303253862539	40.400000000000006	65.299111128620723	-2
+13.879996206594864	40.399999999999999	77.412356648457134	-2
+13	40.200000000000003	100.00000003700205	1
+13.4142557288184	40.400000000000006	89.338857133340596	-2
+18.600000000000001	37	0	0
+18.800000000000001	36.648034066190675	8.9851020087039792	-2
+18.199999999999999	33	100.00000003700207	1
+18.600000000000001	33	100.00000003700207	1
+19	33	100.00000003700205	1
+19.199999999999999	33.414255728818404	89.496613494220185	-2
+20.300877571896805	35.079117838837568	47.972913298556172	-2
+20.684098894317643	34.26882682669342	68.081201173854595	-2
+20.299886241283843	35.975459918393796	25.690293448655449	-2
+19.600000000000001	36.35857074970766	16.11642004176468	-2
+19.199999999999999	36.585744271181596	10.460645398134027	-2
+19.599999999999998	33.351965933809325	91.117717457169221	-2
+20	33.414255728818404	89.561753282658728	-2
+20.399999999999999	33.64142925029234	83.831847690826478	-2
+21.800000000000001	27	100.00000003700208	1
+23	27	100.0000000370021	1
+23.641429250292333	27.199999999999999	79.898241401435271	-2
+24.402141978735941	27.017440440185826	61.657749852657176	-2
+50	26.561426470588238	0	-1
+43	19.399999999999999	0	0
+43.414255728818404	22.800000000000001	5.7564885625955275	-2
+43.493820655405244	23.493820655405241	15.966991983676341	-2
+44.728438878883502	25.423531733835489	40.008712481629075	-2
+43.56719365619449	25.000000000000007	41.888237807384755	-2
+43	21.399999999999999	0	0
+43.351965933809325	21.600000000000001	2.0374538705929379	-2
+43.414255728818404	22	2.9892900665773592	-2
+43	22.600000000000001	0	0
+43	22.199999999999999	0	0
+46.45291126126898	26.87556791203798	34.861677050783975	-2
+48.735788301489734	27.535364282737259	12.831410087811401	-2
+47.416510808467685	27.985787460260749	27.88186444987458	-2
+44.605180689388717	26.653441086392093	56.674904687718232	-2
+37	19.800000000000001	0	0
+34.30367211767269	21.076169577789315	67.115413269269553	-2
+36.282281765395958	21.452106566398662	18.338764525096316	-2
+35.975459918393796	21.700113758716157	26.252975130974363	-2
+34.392696384244729	21.58142322564257	64.673878649493389	-2
+35.035179115988704	21.984819743195683	49.10390512004323	-2
+37	20.199999999999999	0	0
+37	20.600000000000001	0	0
+37	21	0	0
+36.585744271181596	21.199999999999999	10.549729801437225	-2
+33	19.800000000000001	100.00000003700205	1
+33	20.199999999999999	100.0000000370021	1
+33.351965933809325	20.400000000000002	91.122883386922538	-2
+33.414255728818404	20.800000000000001	89.504228536471544	-2
+33.641429250292333	21.199999999999999	83.643470941014868	-2
+27.800000000000001	23	100.0000000370021	1
+28	23.351965933809328	90.534759282351388	-2
+28.399999999999999	23.414255728818404	89.254661645338501	-2
+28.100113758716162	24.024540081606201	73.450883393625276	-2
+28.018964167097685	24.969842474124679	50.662386315021777	-2
+27.017440440185826	25.597858021264059	38.249822223701074	-2
+27.563686004592768	25.574464838449547	37.075811931822955	-2
+25.764945273647339	26.723865677190176	36.568916255641966	-2
+26.488670627476967	26.488670627476967	26.245408705404792	-2
+25.06243807692643	27.262786691421844	48.753099167834236	-2
+13	41.799999999999997	100.0000000370021	1
+13.879996206594869	41.199999999999996	76.824323334144793	-2
+13	41.399999999999999	100.0000000370021	1
+13.4142557288184	41.200000000000003	89.027662404495089	-2
+22.362772268274465	46.91504847015937	10.090109812465313	-2
+21.799045859464172	45.70774247289328	9.6723478427595069	-2
+21.352981915143584	45.051792918643272	7.8536760208129213	-2
+17	41.799999999999997	0	0
+16.648034066190675	41.599999999999994	8.4797154715888929	-2
+16.585744271181596	41.200000000000003	10.026223278328038	-2
+16.358570749707667	40.799999999999997	15.629170056540289	-2
+14.096048355975142	40.799999999999997	71.629476407553469	-2
+18.600000000000001	43	0	0
+18.800000000000001	43.351965933809332	1.7004030878238303	-2
+19.199999999999999	43.346454010367928	1.474637237224641	-2
+20.399999999999999	43.414255728818404	1.6212396169393015	-2
+20	43.351965933809325	1.347347026515024	-2
+20.800000000000001	43.641429250292333	2.6413314995323125	-2
+21.499886241283839	44.024540081606197	5.1289640158913361	-2
+19.800000000000001	43	0	0
+19.399999999999999	43	0	0
+21.877147058823532	50	0	-1
+23.438573529411769	50	0	-1
+23.489162611971459	47.964597250896333	9.7976385144321956	-2
+16.648034066190675	40	8.6971117686075878	-2
+16.5857442711816	40.400000000000006	10.162836765949077	-2
+17	39.799999999999997	0	0
+13.641429250292335	40.799999999999997	83.321974924551995	-2
+13	40.600000000000001	100.00000003700205	1
+19	37	0	0
+19.399999999999999	33	100.00000003700208	1
+21.241504073930852	34.775586669916393	55.389517714863842	-2
+20.915901105682359	35.73117317330658	31.878814410465747	-2
+21.052106566398663	33.717718234604042	81.785401899609937	-2
+21.300113758716158	34.024540081606204	73.946788219408049	-2
+20	36.585744271181596	10.406163648842265	-2
+20.547893433601338	36.282281765395958	18.041630870447044	-2
+19.800000000000001	37	0	0
+19.399999999999999	37	0	0
+19.800000000000001	33	100.00000003700207	1
+20.199999999999999	33	100.00000003700207	1
+20.600000000000001	33	100.00000003700205	1
+20.800000000000001	33.414255728818404	89.506147367243059	-2
+23	27.399999999999999	100.00000003700207	1
+23.414255728818404	27.600000000000001	88.211205201177492	-2
+23.879996206594882	27.599999999999998	75.903194087054331	-2
+24.425535161550453	27.563686004592768	62.886596735419957	-2
+50	28.122852941176472	0	-1
+43	23	0	0
+42.800000000000004	23.4142557288184	10.496390788987407	-2
+42.964289353913244	24.169271739847701	27.458176261231159	-2
+43.508005419199506	26.499331031918555	71.602071419087395	-2
+42.54116448525923	24.970552074524395	45.303662837901733	-2
+42.964289353913237	25.830728260152309	63.074764526885851	-2
+43	21.800000000000001	0	0
+45.94819499552402	27.913952885875542	46.143842920898152	-2
+47.898412310786412	29.517392369118337	23.920101576409714	-2
+46.371764475761175	29.020010179462865	43.001975827621322	-2
+44.806378416722687	27.742965274705618	62.016399239856675	-2
+43.641429250292333	27.199999999999999	80.330248245371379	-2
+33.879996206594882	21.599999999999998	77.362833148827548	-2
+36.648034066190675	21.599999999999998	9.1390765153169564	-2
+36.585744271181596	22	11.179588161424929	-2
+36.35857074970766	22.399999999999999	18.128506150464311	-2
+35.830728260152284	22.964289353913244	33.478005069642442	-2
+34.096048355975128	22	71.438093997009844	-2
+34.425535161550449	22.436313995407229	62.84137512439775	-2
+35.113442147079063	22.739397578099229	47.901221480323017	-2
+37	21.399999999999999	0	0
+33	20.600000000000001	100.00000003700208	1
+33	21	100.00000003700205	1
+33	21.399999999999999	100.00000003700207	1
+33.414255728818404	21.600000000000001	89.245740911695805	-2
+28.199999999999999	23	100.0000000370021	1
+28.600000000000001	23	100.00000003700207	1
+28.800000000000001	23.641429250292333	83.669287440014486	-2
+28.813999307310311	24.974291329413461	50.654493030552651	-2
+29.084098894317655	24.268826826693438	68.098962717890814	-2
+28.414273924593928	25.615269932731692	35.06559654515145	-2
+27.599999999999998	26.120003793405118	24.0847745688746	-2
+27.199999999999999	26.358570749707667	20.116689828418451	-2
+28	25.903951644024872	28.495247242868519	-2
+25.731173173306569	27.484098894317654	33.737712420085877	-2
+26.358570749707667	27.199999999999999	19.887744071909506	-2
+27	27	0	0
+25.030157525875321	28.018964167097685	49.314403208470104	-2
+13	41	100.00000003700205	1
+23.461239012286551	46.425270085508508	15.605993701631306	-2
+22.585120110475376	45.60129937992432	12.730389629528096	-2
+21.995236206598321	44.939138408478442	9.5304643559465063	-2
+22.057693284361697	44.290076988434265	7.8512304645834661	-2
+17	41.399999999999999	0	0
+17	41	0	0
+17	40.600000000000001	0	0
+19	43	0	0
+20.199999999999999	43	0	0
+20.600000000000001	43	0	0
+21	43	0	0
+21.199999999999999	43.414255728818404	1.9690645669841766	-2
+21.805195508303871	43.72624774187026	4.3789011467381833	-2
+21.599999999999998	43.351965933809325	2.0349764969452004	-2
+25.000000000000004	50	0	-1
+24.861874350844804	47.267481527734397	17.940221456649752	-2
+25.541400274206126	48.602882560103666	10.510868969315341	-2
+17	40.200000000000003	0	0
+21.51195765586013	35.478694722056765	38.335787857708873	-2
+22.004435957224018	34.464174625032094	62.398552267179426	-2
+21.599999999999998	36.120003793405118	22.565859891952211	-2
+21.199999999999999	36.358570749707667	16.313663873655894	-2
+21.199999999999999	33.351965933809325	90.998779538818084	-2
+21.600000000000001	33.414255728818404	89.204227982266843	-2
+22	33.641429250292333	82.900143287907355	-2
+20.199999999999999	37	0	0
+20.400000000000002	36.648034066190675	8.8543468574197881	-2
+20.800000000000001	36.585744271181596	10.466499107760288	-2
+21	33	100.00000003700208	1
+23	27.800000000000001	100.00000003700205	1
+23.641429250292333	28	82.949332792772765	-2
+24.096048355975128	28	71.485486119222386	-2
+24.384730067268308	28.414273924593928	64.915363579599315	-2
+50	29.684279411764706	0	-1
+42.600000000000001	23	0	0
+42.400000000000006	23.641429250292333	15.434873748794594	-2
+42.440400432370375	24.16378687768243	27.438644427597719	-2
+43	27	100.00000003700207	1
+42.799999999999997	26.5857442711816	85.389005669637086	-2
+42.152279825524893	25.537914268437554	59.988173299986919	-2
+42.058498585748495	24.856492066917347	43.757867954865432	-2
+42.400000000000006	26.358570749707667	80.624394157920804	-2
+45.207990716726023	28.800000000000018	59.81792688460304	-2
+46.446080540990849	30.202063885406407	42.600659101344448	-2
+47.832002115618778	31.259208207422933	24.165868064412624	-2
+44.80637841672268	29.857034725294348	67.533376002044136	-2
+44.167444705429702	28.357417975548781	76.283996530481801	-2
+43.931447702175689	27.885389478204758	79.101733410152789	-2
+43	27.399999999999999	100.00000003700207	1
+43.414255728818404	27.600000000000001	89.077713456455115	-2
+33.641429250292333	22	82.911161531067734	-2
+37	21.800000000000001	0	0
+37	22.199999999999999	0	0
+37	22.600000000000001	0	0
+36.585744271181596	22.800000000000001	13.447496357294037	-2
+35.927851332951072	24.082753055760701	40.776953779965424	-2
+36.499331031918565	23.508005419199506	25.901470848043051	-2
+35.128879641686829	23.946488135025334	48.727113525680295	-2
+33.879996206594882	22.399999999999999	75.836082216641955	-2
+34.402141978735948	22.98255955981417	61.599206485002476	-2
+33	21.800000000000001	100.00000003700205	1
+29	23	100.00000003700205	1
+29.199999999999999	23.414255728818404	89.523574851519072	-2
+29.452106566398658	23.71771823460405	81.942445102470032	-2
+28.907386047393601	25.723899806070552	32.151489760014798	-2
+29.693444429225721	24.906564021603391	52.330647582925153	-2
+29.700113758716164	24.024540081606204	74.285763654831953	-2
+28.399999999999999	26.120003793405118	22.590367435117528	-2
+27.600000000000001	26.585744271181596	11.788423256960124	-2
+28	26.358570749707667	17.042252477722787	-2
+27.399999999999999	27	0	0
+26.282281765395954	27.85210656639866	19.191119188757686	-2
+25.975459918393799	28.100113758716162	26.523548635156445	-2
+27	27.399999999999999	0	0
+26.585744271181596	27.600000000000001	11.833430065624281	-2
+25.025708670586539	28.813999307310311	49.335165314122669	-2
+23.388027911242677	45.224790102978325	17.872635737464282	-2
+24.188123292485432	45.778468775474018	22.25168780286074	-2
+22.607481273799507	44.714778003682227	12.022656754643048	-2
+22.396502841058783	44.052867219209737	8.3918032712829032	-2
+22.200037541248275	43.688914232829354	5.3532716391122905	-2
+21.399999999999999	43	0	0
+22	43.346454010367935	2.4812471947906252	-2
+21.800000000000001	43	0	0
+26.561426470588238	50	0	-1
+26.195972624709558	47.255074548653454	24.030294931532776	-2
+26.044922623154164	45.929496925694714	35.479651833311436	-2
+27.034597975938546	48.495211609742547	14.238682284362477	-2
+22	35.903951644024872	28.417002813737621	-2
+22.436313995407229	35.574464838449551	36.841571328190959	-2
+22.741860322102031	34.829051228086371	53.036640412195297	-2
+22.699886241283831	34.024540081606204	71.118218619238974	-2
+21.600000000000001	36.585744271181596	10.718921511003447	-2
+22	36.358570749707667	17.019706822597637	-2
+21	37	0	0
+21.399999999999999	37	0	0
+21.399999999999999	33	100.00000003700205	1
+21.800000000000001	33	100.00000003700205	1
+22.199999999999999	33	100.00000003700205	1
+22.399999999999999	33.414255728818404	88.147763669690306	-2
+20.600000000000001	37	0	0
+23	28.199999999999999	100.00000003700205	1
+23.414255728818404	28.399999999999999	89.264181531631436	-2
+23.879996206594882	28.399999999999999	77.396497836531651	-2
+24.276100193929448	28.907386047393601	67.824994970726905	-2
+50	31.245705882352944	0	-1
+42.200000000000003	23	0	0
+42	23.414255728818407	9.9392085809850599	-2
+42	23.8799962065949	21.002300526939365	-2
+41.999731136249835	24.364026390179113	32.384329740262338	-2
+42.600000000000001	27	100.00000003700205	1
+41.66354826123068	25.580622789348052	62.30464533712496	-2
+41.714610521795244	26.068552297824294	74.816784263867504	-2
+41.611692323920437	24.641224279552265	39.344616189185487	-2
+41.333624494634456	25.02864016986025	49.136825336291373	-2
+42.200000000000003	27	100.00000003700208	1
+42	26.585744271181593	88.173406051799361	-2
+44.167444705429688	29.24258202445122	78.181944293516949	-2
+46.121407452745629	31.594168843827926	44.93311475852552	-2
+44.900858871310838	30.850105681287275	65.370403710289978	-2
+50	32.807132352941181	0	-1
+48.139139759718844	33.205568989756678	17.135757457567905	-2
+43.931447702175696	29.714610521795244	82.776512551861018	-2
+43.64142925029234	30.399999999999999	87.924251168421037	-2
+43.879996206594882	28.800000000000001	82.725572479429815	-2
+43.64142925029234	28.399999999999999	86.670525192085833	-2
+43.351965933809325	28	91.952251732320704	-2
+43	27.800000000000001	100.0000000370021	1
+33	22.199999999999999	100.00000003700205	1
+33.414255728818404	22.399999999999999	88.164935532678612	-2
+37	23	0	0
+36.197187025878073	24.831734705741493	47.638618878832105	-2
+36.723927057120697	24.235026932221714	36.463313621601792	-2
+35.352758760195961	24.76354790966694	48.946250012028237	-2
+37.200000000000003	23.641429250292333	19.914567852312256	-2
+34.261585578002723	24.185656407058506	56.01688801716751	-2
+33.641429250292333	22.800000000000001	79.771863403835937	-2
+33.508005419199499	23.500668968081431	73.802759208634114	-2
+29.399999999999999	23	100.00000003700207	1
+29.599999999999998	23.351965933809328	91.138081128620314	-2
+30	23.414255728818404	89.586044706511345	-2
+29.499886241283836	25.975459918393796	25.760100524767513	-2
+28.800000000000001	26.358570749707667	16.325690163683817	-2
+30.5471253607219	24.868116094659658	53.286434820012701	-2
+30.556529463043216	24.226395729262013	69.231493735515684	-2
+30.115901105682344	25.731173173306562	31.826040858040599	-2
+30.399999999999999	23.64142925029234	83.873964292161716	-2
+28.399999999999999	26.585744271181596	10.730204139750237	-2
+27.800000000000001	27	0	0
+28.199999999999999	27	0	0
+26.648034066190672	28	9.4469100406827078	-2
+26.585744271181596	28.399999999999999	10.734154638388748	-2
+25.731173173306562	29.084098894317655	31.892562897925046	-2
+26.358570749707667	28.800000000000001	16.320895934942648	-2
+27	27.800000000000001	0	0
+25.345725538006018	29.593396526328682	41.389128386843659	-2
+24.723971091238958	29.447193361328033	56.820630938167916	-2
+24.189394084667018	44.805477985923666	26.062315739460068	-2
+23.443443504874125	44.294040670190569	17.954557642275446	-2
+25.249994947385893	44.469003231578469	40.061384269965274	-2
+22.804504387155873	44.045915655860036	11.084325381688899	-2
+22.600000002402943	43.692798759538938	7.1752039369055529	-2
+22.399999999999999	43.346410164288635	3.2859791478177485	-2
+22.199999999999999	43	0	0
+28.122852941176475	50	0	-1
+27.050113010261573	46.230176339450274	38.40851759695785	-2
+28.256693011097823	46.761630807789246	36.219274671098582	-2
+26.567776847066359	44.67012171683497	54.598567342219035	-2
+27.190887354465147	45.190465606504048	52.729909705965831	-2
+28.528301844953607	48.394806621320285	17.48578809281226	-2
+22.399999999999999	36.120003793405118	24.043320817229084	-2
+22.98255955981417	35.597858021264052	38.027739844095564	-2
+23.513537363570379	34.385439675653238	59.035605354219733	-2
+22.800000000000001	33.351965933809332	88.284303556176866	-2
+23.464403112629405	33.496697592050836	74.924813192212184	-2
+21.800000000000001	37	0	0
+22.199999999999999	37	0	0
+22.399999999999999	36.585744271181596	11.801759055459035	-2
+22.600000000000001	33	100.00000003700207	1
+23	28.600000000000001	100.00000003700207	1
+23.641429250292333	28.800000000000001	83.666162918298795	-2
+24.024540081606204	29.499886241283836	74.243493053624277	-2
+41.799999999999997	23	0	0
+41.599999999999994	23.641429250292333	15.420627805895824	-2
+41.557417975548773	24.167444705429684	28.036902081441344	-2
+41.242582024451217	25.832555294570312	69.383302793611222	-2
+41.599999999999994	26.648034066190668	90.428526248807856	-2
+41.200000000000003	26.358570749707667	83.077622351282443	-2
+41.033646777620554	24.519831542209513	36.951907843632284	-2
+40.731891615678421	25.040570058256819	50.037897343549133	-2
+40.80180976970717	25.638346129700871	64.945283315722065	-2
+41.799999999999997	27	100.00000003700207	1
+43.641429250292333	29.199999999999999	87.76311784342974	-2
+46.289368489837621	33.442287829300668	35.22413015975156	-2
+44.912440709596225	32.356906179646231	59.76933621661658	-2
+44.243002511078409	31.600000000000001	74.907180253923599	-2
+43.931447702175689	31.085389478204757	81.974418066947564	-2
+50	34.368558823529412	0	-1
+46.950268408497408	34.642327309766678	22.450347165889742	-2
+48.252793444461325	35.066958900500126	11.602690767130657	-2
+43.414255728818404	30	92.248404847923453	-2
+43.351965933809325	29.600000000000001	93.381311667437501	-2
+43	30.600000000000001	100.00000003700205	1
+43	30.199999999999999	100.00000003700207	1
+43.414255728818404	30.800000000000001	92.034502825539391	-2
+43.414255728818404	28.800000000000001	91.783701402700416	-2
+43	28.199999999999999	100.00000003700208	1
+43	28.600000000000001	100.00000003700205	1
+33	22.600000000000001	100.00000003700207	1
+37.399999999999999	23	0	0
+35.767948024470584	25.502010102248867	53.9557777951444	-2
+37.017440440185858	25.597858021264077	61.800233247275813	-2
+37.484098894317654	24.268826826693445	33.90819294413425	-2
+37.616818941317931	24.915981359808974	48.182264584174597	-2
+34.116439649001975	25.073537657307398	49.547338261942095	-2
+34.822470286461503	25.51564256406024	48.803874670578502	-2
+37.600000000000001	23.4142557288184	11.850350149306797	-2
+37.85210656639866	23.71771823460405	19.224882649008794	-2
+33.449955718468203	24.573802547527535	56.864838157971661	-2
+33	23	100.00000003700205	1
+32.800000000000004	23.4142557288184	86.702509381671646	-2
+32.833837862079612	23.939576851134888	72.470630504712076	-2
+29.800000000000001	23	100.00000003700207	1
+30.199999999999999	23	100.00000003700207	1
+29.747893433601341	26.28228176539595	18.047041693774283	-2
+29.199999999999999	26.585744271181596	10.483248827367179	-2
+29	27	0	0
+28.600000000000001	27	0	0
+31.086211821876823	24.519864386973939	61.855204381618123	-2
+30.705499202657311	25.490057563527248	37.883789533464082	-2
+31.420757016406839	25.003924697281388	49.966546685646144	-2
+31.085389478204757	23.931447702175699	76.454804637252863	-2
+30.800000000000001	26.120003793405122	22.198351278657992	-2
+30.399999999999999	26.35857074970766	16.150759430746447	-2
+30.600000000000001	23	100.00000003700202	1
+30.800000000000001	23.414255728818407	89.536101067514963	-2
+27	28.199999999999999	0	0
+27	28.600000000000001	0	0
+26.28228176539595	29.452106566398658	18.049041257695311	-2
+25.975459918393796	29.700113758716164	25.700244691650585	-2
+27	29	0	0
+26.585744271181596	29.199999999999999	10.47097632550264	-2
+25.017402483708008	30.150319261384539	49.543814264178387	-2
+24.268826826693438	30.115901105682344	68.171590762196104	-2
+24.289873010807366	43.906637410059787	29.107289838582112	-2
+23.058755564742842	43.726744973393338	11.469447395803062	-2
+23.455494025483578	43.49391970590306	15.131696630817064	-2
+25.281424611626182	43.356752528491512	48.777642083423018	-2
+26.503302407949164	43.464403112629391	72.670536154319876	-2
+22.800000000000001	43.346410161513781	4.6837974149390442	-2
+22.600000000000001	43	0	0
+29.68427941176471	50	0	-1
+27.906054053975684	45.623397340246179	50.372310706243489	-2
+29.423221117658109	47.001912478941435	35.060816813313536	-2
+29.03198140691789	45.857500834724775	50.223984545493288	-2
+27.25006236820877	44.380821990031244	66.299070035714735	-2
+27.895596140775929	44.787464372705557	63.31149595512543	-2
+29.983959942293538	48.565351090994795	16.066972503280851	-2
+22.800000000000001	36.358570749707667	20.228126446157262	-2
+23.511329372523036	36.488670627476964	27.003866468582675	-2
+24.390990174438322	34.918776093466136	51.195478461526896	-2
+24.293468543356127	33.896591813927159	58.063780811279749	-2
+23	33	100.0000000370021	1
+23.641429250292333	32.799999999999997	79.803309060164267	-2
+24.402141978735933	32.982559559814149	61.740379743166116	-2
+22.600000000000001	37	0	0
+23	29	100.00000003700205	1
+23.414255728818404	29.199999999999999	89.514500783833569	-2
+23.71771823460405	29.747893433601341	81.953980428624618	-2
+41.399999999999999	23	0	0
+41.200000000000003	23.351965933809325	8.5170654068879088	-2
+41.085389478204753	23.931447702175685	22.595036710707131	-2
+40.800000000000004	26.120003793405129	77.202358556490495	-2
+41.399999999999999	27	100.0000000370021	1
+41	27	100.00000003700205	1
+40.799999999999997	26.5857442711816	89.229253566427332	-2
+40.574883365747162	24.183020655312099	28.959222947106685	-2
+39.677042055539076	24.865202358698792	46.232032694347048	-2
+40	25.641696746137324	65.482207950093581	-2
+40.400000000000013	25.903951644024872	71.915977125737882	-2
+43	29	100.00000003700205	1
+43	29.399999999999999	100.0000000370021	1
+45.522038424091512	34.791909928711711	31.724413624985033	-2
+44.539573510478974	33.331829839013189	57.985519989945416	-2
+43.931447702175689	32.114610521795242	79.089448944049224	-2
+43.641429250292333	32.799999999999997	80.362412845183002	-2
+43.64142925029234	31.600000000000001	86.642269179817333	-2
+43.351965933809325	31.199999999999999	92.980267929995051	-2
+50	35.92998529411765	0	-1
+46.600326817416175	35.96687415302786	17.473501689409602	-2
+47.8620305943003	36.907556034629174	8.5701825475311448	-2
+43	29.800000000000001	100.00000003700207	1
+43	31	100.00000003700208	1
+37.799999999999997	23	0	0
+36.488670627476964	26.488670627476964	73.41035944132723	-2
+34.992041200403051	26.445889682965127	50.198314528182429	-2
+35.764945273647342	26.723865677190179	63.383070558291905	-2
+37.563686004592746	25.574464838449625	62.759494108449069	-2
+37.599999999999994	26.120003793405136	75.830418241662954	-2
+37.200000000000003	26.358570749707667	79.788662492420272	-2
+38.100113758716169	24.024540081606208	26.548798747114972	-2
+37.993873313677504	25.458432833115353	60.70881734591768	-2
+38.490813742677297	24.898810949797515	47.376275114847594	-2
+33.299824519556118	25.238084732536834	46.020683439119765	-2
+33.687274327235457	25.798167623488482	39.530624594244728	-2
+34.242454647920979	26.26243293366489	40.420555983263874	-2
+38	23.351965933809325	9.4531056835501772	-2
+38.400000000000006	23.4142557288184	10.714611556479799	-2
+32.582559559814179	24.402141978735941	63.001343098436003	-2
+32.600000000000001	23	100.00000003700208	1
+32.400000000000006	23.641429250292333	81.96493347703408	-2
+30	26.585744271181596	10.425447014588606	-2
+29.600000000000001	26.648034066190672	8.8686651897577029	-2
+29.399999999999999	27	0	0
+31.557417975548788	24.167444705429705	70.283963461524195	-2
+31.242582024451213	25.832555294570316	29.560062430626129	-2
+32.038265664869741	24.423357678242837	63.58411291460979	-2
+31.70463815775561	25.498436991031735	38.105236356402322	-2
+32.342331115747591	25.231626742437015	44.944145988702921	-2
+31.199999999999999	23.351965933809328	91.025028013672355	-2
+31.600000000000001	23.64142925029234	83.444619693419526	-2
+30.800000000000001	26.585744271181596	10.475600436739358	-2
+31.199999999999999	26.358570749707667	16.327225374805806	-2
+30.199999999999999	27	0	0
+30.600000000000001	27	0	0
+31	23	100.00000003700208	1
+26.648034066190672	29.599999999999998	8.8581889999683714	-2
+26.585744271181596	30	10.411130948704132	-2
+25.731173173306576	30.684098894317657	31.829629415174189	-2
+26.35857074970766	30.399999999999999	16.125258297645097	-2
+27	29.399999999999999	0	0
+24.521305277943227	30.711957655860122	61.831298525944767	-2
+25.130684347550652	30.891073838178411	46.722437539976312	-2
+23.879996206594878	30.800000000000001	77.805282829201317	-2
+23.64142925029234	30.399999999999999	83.850103138393223	-2
+24.402141978735923	42.982559559814142	32.161362905741797	-2
+23	43	0	0
+23.641429250292333	42.799999999999997	16.025413377027323	-2
+25.97545991839381	42.699886241283856	68.842221245704735	-2
+25.173387972096297	42.407286146343573	50.46939945381213	-2
+27	43	100.00000003700208	1
+26.648034066190675	42.799999999999997	87.335976840648911	-2
+27.199999999999999	43.641429250292333	80.503722756411676	-2
+31.245705882352944	50	0	-1
+28.588871445751867	45.141055445261166	60.159867893351986	-2
+30.249569489930888	46.118795900951362	47.010627838269599	-2
+31.298826510691434	47.917931737100119	22.820100190503261	-2
+29.852676011304354	45.000729799732973	64.245115267165957	-2
+29.220290411102148	44.686118762549725	68.914884220478839	-2
+27.899886241283841	44.024540081606197	77.283376772571273	-2
+28.53087445440578	44.364979647368131	73.205045875694751	-2
+23	37	0	0
+23.641429250292333	37.200000000000003	20.190364942788406	-2
+24.927995719149198	35.793988190511946	49.443078438381676	-2
+24.402141978735923	37.017440440185858	37.847334840478929	-2
+25.314688059750821	34.13254607196528	47.466213303107359	-2
+25.746333685191491	35.21061854786381	51.309957825085078	-2
+25.233839345566999	33.270751387939825	46.485738715883528	-2
+23	32.600000000000001	100.00000003700208	1
+23.4142557288184	32.399999999999999	88.181212199611593	-2
+23.879996206594868	32.399999999999999	75.859696802843217	-2
+24.425535161550403	32.436313995407239	62.792878637778344	-2
+25.173387972096219	32.407286146343381	46.402282751233187	-2
+23	29.399999999999999	100.0000000370021	1
+23.351965933809328	29.600000000000001	91.131090900203731	-2
+23.414255728818404	30	89.575010563583703	-2
+41	23	0	0
+40.800000000000004	23.4142557288184	10.096438877473945	-2
+40.400000000000006	23.641429250292333	15.73389260443512	-2
+40.400000000000006	26.358570749707667	83.511510941570137	-2
+40.600000000000001	27	100.00000003700207	1
+39.700113758716149	24.024540081606212	25.398290179280121	-2
+39.084098894317634	24.268826826693413	31.683309674243588	-2
+39.199999999999996	25.641696746137423	65.622326722362033	-2
+39.599999999999987	25.903951644024872	72.161512443426403	-2
+40	26.1200037934051	77.55199160516527	-2
+44.145525049555161	35.509883584732009	31.211867197221761	-2
+45.033808243310141	36.265648891890329	20.365566865042123	-2
+43.511329372523036	33.511329372523036	71.170158620514329	-2
+43.338836150188762	34.577880963319615	51.620674720260531	-2
+43.351965933809325	32	91.945879819034076	-2
+43.414255728818404	32.399999999999999	89.084079694117762	-2
+43	32.600000000000001	100.0000000370021	1
+43	33	100.00000003700208	1
+43	31.399999999999999	100.00000003700207	1
+43	31.800000000000001	100.00000003700205	1
+50	37.491411764705887	0	-1
+46.501695219548367	37.698926043648449	9.1685263094719769	-2
+48.659586015037938	38.193406663585066	3.6577753953903196	-2
+38.200000000000003	23	0	0
+37	27	100.00000003700207	1
+36.358570749707667	27.199999999999999	80.033807893168742	-2
+34.402141978735941	27.017440440185826	38.48815243949371	-2
+35.061912303766597	27.264284079767659	51.408993483620797	-2
+35.731173173306587	27.484098894317654	66.214562420283329	-2
+38	25.903951644024819	71.442417729830183	-2
+37.599999999999994	26.5857442711816	88.164139009364703	-2
+38	26.358570749707653	82.894603184572404	-2
+37.399999999999999	27	100.00000003700205	1
+38.799999999999997	23.641429250292333	16.243311544295874	-2
+38.400000000000013	25.641696746137466	65.432557825843659	-2
+32.964289353913237	25.830728260152309	33.504963804956802	-2
+33.508005419199506	26.499331031918555	25.841822736492936	-2
+38.600000000000001	23	0	0
+32.000000000000007	23.879996206594882	76.930507397419305	-2
+32.200000000000003	23	100.00000003700208	1
+32	23.414255728818404	88.928963808926312	-2
+29.800000000000001	27	0	0
+31.714610521795244	26.06855229782429	24.010493823723699	-2
+32.195016765573094	25.775004239216184	32.049417824093567	-2
+31.399999999999999	23	100.00000003700207	1
+31.800000000000001	23	100.00000003700207	1
+31	27	0	0
+31.399999999999999	27	0	0
+31.600000000000001	26.648034066190672	9.1308755318083765	-2
+27	29.800000000000001	0	0
+27	30.199999999999999	0	0
+26.282281765395954	31.052106566398663	18.163302313137674	-2
+25.975459918393799	31.300113758716162	25.968391384782489	-2
+27	30.600000000000001	0	0
+26.585744271181593	30.800000000000001	10.466567909495271	-2
+24.564465090370494	31.17886058221336	60.673203536507692	-2
+24.096048355975128	31.199999999999999	72.269133917047455	-2
+24.895562229859745	31.601974978151674	52.52819951812387	-2
+23.414255728818404	30.800000000000001	89.524848485742012	-2
+23.641429250292333	31.199999999999999	83.671475986930588	-2
+23	30.199999999999999	100.00000003700207	1
+23	30.600000000000001	100.00000003700205	1
+24.425535161550375	42.436313995407254	33.356931004038273	-2
+23.879996206594864	42.400000000000006	21.046661916194736	-2
+23	42.600000000000001	0	0
+23.4142557288184	42.399999999999999	10.070570188005503	-2
+26.585744271181589	42.400000000000006	87.283310392317574	-2
+26.358570749707653	42	81.796795177370768	-2
+24.541567166884647	42.006126686322496	36.536348247348002	-2
+25.97545991839381	41.300113758716144	73.120557701200227	-2
+25.101189050202485	41.509186257322703	50.7503489491708	-2
+27.399999999999999	43	100.00000003700207	1
+27	42.600000000000001	100.00000003700205	1
+27.600000000000001	43.414255728818404	89.095246479734925	-2
+32.807132352941181	50	0	-1
+30.558465506785044	44.973291867417828	64.371851413270022	-2
+31.519899680988722	45.846952088261268	48.747979345214844	-2
+32.891034206903676	47.876302602301649	20.186916054563991	-2
+29.872365317182741	44.294681654565345	76.295497597906476	-2
+29.314610521795249	43.931447702175717	82.5009909539815	-2
+28.20519550830387	43.72624774187026	84.488745349825962	-2
+28	43.351965933809325	91.927000683084799	-2
+28.800000000000001	43.641429250292333	87.332315771088076	-2
+23	37.399999999999999	0	0
+23.4142557288184	37.599999999999994	11.779959496688358	-2
+23.879996206594864	37.599999999999994	24.023604914417742	-2
+25.243087531572094	36.748301721996071	53.403958552135293	-2
+25.798648277841085	36.295945647546823	60.269142773370277	-2
+24.425535161550375	37.563686004592746	36.963881744511838	-2
+25.084018640191026	37.616818941317931	51.522382996421889	-2
+25.966584659665422	34.486404752278737	45.317071083910726	-2
+25.913583821239509	33.806637607012881	38.696899082792321	-2
+26.270441455195854	35.756793573742421	59.644949151555252	-2
+26.47948413732157	35.022239865381124	50.392928720076391	-2
+25.975459918393796	32.699886241283835	28.757868442365154	-2
+23	32.200000000000003	100.00000003700208	1
+23.64142925029234	32	82.93759644043152	-2
+24.096048355975149	32	71.504370458682203	-2
+24.541567166884558	32.00612668632251	60.777850917743642	-2
+26.35857074970766	32	17.163471704333876	-2
+23	29.800000000000001	100.00000003700208	1
+40.600000000000001	23	0	0
+40.200000000000003	23	0	0
+40	23.414255728818407	10.225181978043272	-2
+40.200000000000003	27	100.00000003700208	1
+40	26.585744271181593	89.410440074104443	-2
+39.452106566398662	23.717718234604046	17.868188495352069	-2
+38.799999999999997	25.903951644024868	72.093924014874929	-2
+39.199999999999996	26.120003793405129	77.618723183828479	-2
+39.599999999999994	26.358570749707667	83.662764426788044	-2
+42.982559559814163	35.597858021264074	31.939121161750951	-2
+43.511329372523036	36.488670627476964	15.988665524847931	-2
+45.071017315376274	37.493773304868625	11.235657532080847	-2
+44.366417157335832	37.297280234550747	10.70841448749769	-2
+42.799999999999997	33.641429250292333	77.86253663460019	-2
+42.100113758716162	34.024540081606212	71.299325975151646	-2
+42.080032451567114	34.872743203385376	50.261044402737888	-2
+43	32.200000000000003	100.00000003700208	1
+42.600000000000001	33	100.0000000370021	1
+50	39.052838235294118	0	-1
+45.20795469717492	38.343256993148778	7.3923966012819955	-2
+46.024607200401363	39.184074358818172	5.2228227308362474	-2
+47.961751141178667	39.535991103372766	2.987625918229396	-2
+37	27.399999999999999	100.00000003700207	1
+36.585744271181596	27.600000000000001	88.142270310887284	-2
+36.282281765395958	27.852106566398664	80.800577606835148	-2
+34.423357678242844	27.561734335130271	37.199925160836415	-2
+33.879996206594882	27.599999999999998	24.143640097401494	-2
+33.641429250292333	27.199999999999999	20.158172261399308	-2
+34.697149727443353	28.015973623545367	42.964396317379524	-2
+35.271527534685589	27.861562287364329	56.285106844923149	-2
+35.975459918393803	28.100113758716159	73.498368662683205	-2
+38.400000000000006	26.120003793405136	77.301181428687627	-2
+37.799999999999997	27	100.00000003700208	1
+38.200000000000003	27	100.00000003700207	1
+38.399999999999999	26.5857442711816	89.21634643679819	-2
+39	23	0	0
+39.200000000000003	23.414255728818404	10.386873353502247	-2
+32.799999999999997	26.5857442711816	13.378591938019985	-2
+32.400000000000006	26.358570749707667	17.92835946552869	-2
+33	27	0	0
+32	26.585744271181596	11.112794390039712	-2
+31.800000000000001	27	0	0
+26.648034066190672	31.199999999999999	8.9855818013080135	-2
+26.585744271181596	31.599999999999998	10.802035979875722	-2
+27	31	0	0
+24.358303253862591	31.599999999999994	65.539428202348304	-2
+23.879996206594878	31.599999999999998	77.391435354389017	-2
+23	31	100.00000003700205	1
+23	31.399999999999999	100.00000003700207	1
+23.414255728818404	31.600000000000001	89.262008508098319	-2
+24.096048355975181	42	26.118708358384481	-2
+23.641429250292347	42	15.396945357059069	-2
+23	42.200000000000003	0	0
+27	42.200000000000003	100.00000003700202	1
+27	41.799999999999997	100.00000003700202	1
+26.585744271181589	41.599999999999994	88.681037184265165	-2
+24.358303253862534	41.599999999999987	32.601846351211641	-2
+26.282281765395968	41.052106566398663	81.268682604729236	-2
+25.731173173306615	40.684098894317643	67.4477811097086	-2
+24.980079623919952	40.400000000000077	48.794222431580806	-2
+24.358303253862577	40.800000000000004	33.181640273739973	-2
+27.800000000000001	43	100.00000003700208	1
+34.368558823529412	50	0	-1
+30.474915470529147	44.011905013647898	81.159163831873698	-2
+31.42628802210379	44.551238111284974	69.868897109611424	-2
+32.922371056303888	44.88551062414183	55.967738636582133	-2
+33.291395900866888	46.334690184490853	35.147298091018499	-2
+34.475866240207623	47.717665409451982	17.134764818353151	-2
+30	43.641429250292333	88.072043719769269	-2
+29.600000000000001	43.414255728818404	92.219543482261727	-2
+29.199999999999999	43.351965933809332	93.243784936455612	-2
+28.399999999999999	43.346454010367935	92.730218156579895	-2
+28.199999999999999	43	100.0000000370021	1
+29	43	100.00000003700208	1
+28.600000000000001	43	100.00000003700205	1
+23	37.799999999999997	0	0
+23.641429250292347	38	16.971823485668462	-2
+24.096048355975181	38	28.332906691151017	-2
+25.731173173306555	37.484098894317654	66.215506700942285	-2
+26.488670627476964	36.488670627476964	73.995423389979436	-2
+26.358570749707667	37.200000000000003	79.649369428377099	-2
+24.541567166884647	37.993873313677504	39.001252272381862	-2
+25.975459918393792	38.100113758716169	73.311403382202471	-2
+25.101189050202485	38.490813742677297	52.267936768696266	-2
+26.672403212821504	34.258358018835665	37.523076529324648	-2
+26.50330240794916	33.464403112629405	25.030003690247668	-2
+27.017440440185826	35.597858021264059	61.663376367020255	-2
+27.262786691421841	34.937561923073559	48.738631952138732	-2
+26.648034066190668	32.799999999999997	11.688518928095675	-2
+26.585744271181593	32.399999999999999	11.850366792142765	-2
+23	31.800000000000001	100.00000003700207	1
+27	31.800000000000001	0	0
+27	32.200000000000003	0	0
+39.799999999999997	23	0	0
+39.599999999999994	23.351965933809325	8.7520148271377849	-2
+39.799999999999997	27	100.00000003700208	1
+38.799999999999997	26.358570749707667	83.568462219211298	-2
+39.199999999999996	26.5857442711816	89.432981380078715	-2
+39.399999999999999	27	100.00000003700208	1
+42.400000000000006	36.120003793405125	20.900524068745167	-2
+42.799999999999997	36.358570749707667	15.837570872782928	-2
+41.876169577789319	35.696327882327246	31.101243906025868	-2
+43	37	0	0
+43.641429250292333	37.200000000000003	7.9514604078307647	-2
+44.355971032079914	38.463665537692727	5.2527037012165714	-2
+43.931447702175731	37.88538947820475	5.9054832116462075	-2
+42.400000000000006	33.414255728818404	87.023594551709223	-2
+41.852106566398668	33.71771823460405	80.154153422574268	-2
+41.484098894317647	34.268826826693427	66.477388509140638	-2
+41.384039828048309	34.865580772620312	51.674757819731461	-2
+41.320210944081573	35.46728914242545	37.094129234494204	-2
+42.200000000000003	33	100.00000003700207	1
+50	40.614264705882356	0	-1
+44.853842368482923	39.127462860160904	4.5631203156348725	-2
+46.16788395496809	40.347417354257637	3.1252877564110291	-2
+44.844853542588517	40.459804383541503	2.3689901273563549	-2
+47.64741196193183	41.229679569458384	1.7427303958027247	-2
+37	27.800000000000001	100.0000000370021	1
+36.648034066190675	28	90.548919258565178	-2
+36.585744271181596	28.399999999999999	89.273109822700974	-2
+34.167444705429688	28.042582024451217	30.205510794173644	-2
+33.414255728818404	27.600000000000001	11.813848253006936	-2
+33.641429250292333	28	17.076193790650901	-2
+33	27.399999999999999	0	0
+35.017632138041762	28.399419009695368	50.473777565603555	-2
+34.532710857574585	28.520210944081587	38.665210392593472	-2
+35.505904904737811	28.505856996174245	62.328232882556364	-2
+36.358570749707667	28.800000000000001	83.699019560696229	-2
+38.600000000000001	27	100.00000003700208	1
+39.399999999999999	23	0	0
+32.600000000000001	27	0	0
+32.200000000000003	27	0	0
+27	31.399999999999999	0	0
+23.879996206594864	41.599999999999994	21.159917769102897	-2
+23	41.799999999999997	0	0
+23.4142557288184	41.599999999999994	9.9808333901657598	-2
+27	41.399999999999999	100.0000000370021	1
+26.648034066190675	41.200000000000003	90.694189392905201	-2
+24.096048355975132	41.200000000000003	26.544421977026502	-2
+26.5857442711816	40.800000000000004	89.245567166431741	-2
+26.358570749707667	40.400000000000006	83.53696862327601	-2
+25.975459918393788	39.700113758716149	73.994335495160016	-2
+25.134797641301208	39.677042055539076	52.944301211987664	-2
+24.358303253862676	40	33.564559983764354	-2
+24.096048355975128	40.400000000000013	26.922276737315194	-2
+23.879996206594871	40.800000000000004	21.47177868872874	-2
+35.92998529411765	50	0	-1
+30.399999999999999	43.414255728818404	92.220610002232121	-2
+31.005195508303885	43.726247741870274	85.892433407198126	-2
+31.600000000000001	43.64142925029234	86.481440882650148	-2
+32.114610521795257	43.931447702175717	78.806226523526675	-2
+33.811410625177736	44.932589824125003	47.197404936886727	-2
+33.273906441350469	44.222873642498406	63.435321552780685	-2
+34.28731654139758	45.906577485381789	32.972211999839018	-2
+36.205031064372456	47.682828373469782	11.502392792548228	-2
+35.892192245677485	46.340911904744125	19.191486756025533	-2
+29.800000000000001	43	100.00000003700205	1
+30.199999999999999	43	100.00000003700205	1
+29.399999999999999	43	100.00000003700207	1
+23	38.200000000000003	0	0
+23.4142557288184	38.399999999999999	10.670306746226009	-2
+23.879996206594864	38.400000000000006	22.469512890035325	-2
+24.358303253862534	38.400000000000013	34.254778929683347	-2
+26.28228176539595	37.85210656639866	80.65716201094493	-2
+27	37	100.00000003700207	1
+27.199999999999999	36.358570749707667	79.919890141356888	-2
+27	37.399999999999999	100.00000003700208	1
+26.5857442711816	37.600000000000001	87.986981129026958	-2
+26.5857442711816	38.400000000000006	89.182576506543569	-2
+25.731173173306587	39.084098894317634	67.872817271503024	-2
+26.358570749707667	38.799999999999997	83.551368622432619	-2
+24.358303253862577	39.199999999999996	33.849694568951435	-2
+27.484098894317654	34.268826826693413	33.772729456263214	-2
+27.199999999999999	33.641429250292333	20.019779177598885	-2
+27	33	0	0
+27.599999999999998	36.120003793405118	75.913596027104887	-2
+27.563686004592768	35.574464838449543	62.890853883214071	-2
+28.018964167097689	34.969842474124668	49.321481149930499	-2
+27	32.600000000000001	0	0
+39	27	100.00000003700207	1
+42.399999999999999	36.585744271181596	9.9971243215239856	-2
+42	36.358570749707653	15.350602528759524	-2
+42.600000000000001	37	0	0
+41.314610521795231	36.068552297824311	22.52015169516072	-2
+43	37.399999999999999	0	0
+43.414255728818404	37.599999999999994	3.8091961468974449	-2
+44.024540081606212	39.099886241283841	2.9965669973018243	-2
+43.641429250292333	38.400000000000006	3.0308354776058519	-2
+43.351965933809332	38	2.279304820504783	-2
+42	33.351965933809325	89.906335571635452	-2
+41.600000000000001	33.414255728818404	88.707499175709032	-2
+41.200000000000003	33.641429250292333	83.064198125125785	-2
+40.800000000000004	33.879996206594882	77.222885329246211	-2
+40.894500797342687	34.509942436472755	61.117946740867445	-2
+40.840345301716276	35.112145615277306	46.175239317736597	-2
+40.842582024451218	35.832555294570319	28.482877367528243	-2
+41.799999999999997	33	100.00000003700208	1
+50	42.175691176470593	0	-1
+44.268826826693413	39.715901105682349	2.6052021281766997	-2
+45.143188437688998	41.191833965475496	1.8874198071019666	-2
+46.103853449454007	41.994412763662929	1.5542191217945289	-2
+44.355971032079928	41.263665537692717	1.2992458175720412	-2
+43.931447702175689	40.685389478204769	1.2117466224099473	-2
+46.732834828308015	43.364325622573531	0.92767843446134723	-2
+48.146613661846608	43.10527680023602	0.73288838526143152	-2
+37	28.199999999999999	100.00000003700207	1
+37	28.600000000000001	100.00000003700207	1
+33.931447702175696	28.514610521795241	23.807914883700271	-2
+33	27.800000000000001	0	0
+33	28.199999999999999	0	0
+33.351965933809325	28.400000000000002	9.1504863735904127	-2
+35.22194593209359	29.057651149321313	55.490670582152383	-2
+34.752827065353301	29.257499480005073	43.903513123937621	-2
+34.30367211767269	29.076169577789315	32.811232737186984	-2
+35.73117317330658	29.084098894317641	68.121193499702315	-2
+37	29	100.00000003700205	1
+36.585744271181596	29.199999999999999	89.534009929979391	-2
+36.282281765395958	29.452106566398662	81.949741601034347	-2
+23.641429250292333	41.200000000000003	15.540267400130654	-2
+23	41.399999999999999	0	0
+27	41	100.0000000370021	1
+27	40.600000000000001	100.00000003700208	1
+27	40.200000000000003	100.00000003700208	1
+26.585744271181593	40	89.418964016749868	-2
+26.282281765395954	39.452106566398662	81.759698559656613	-2
+24.096048355975128	39.599999999999987	27.20995618126652	-2
+23.8799962065949	40	21.735616944617608	-2
+23.641429250292333	40.400000000000006	15.748647109413973	-2
+23.4142557288184	40.799999999999997	10.10499728482726	-2
+37.491411764705887	50	0	-1
+37.504684828314389	48.140548844271734	6.3338265059036436	-2
+30.600000000000001	43	100.00000003700207	1
+30.800000000000001	43.351965933809332	93.201920548809724	-2
+31.199999999999999	43.346454010367928	93.047908266232824	-2
+31.800000000000001	43	100.00000003700205	1
+31.399999999999999	43	100.00000003700211	1
+32	43.351965933809332	91.873716661898555	-2
+32.400000000000006	43.414255728818404	89.067595939454094	-2
+32.799999999999997	43.641429250292333	80.502523365723377	-2
+34.83850987982315	44.973129945854907	35.281032106524933	-2
+34.228307475770059	44.145948341579967	50.302186801048663	-2
+33.511329372523036	43.511329372523036	71.802231966167568	-2
+37.1039983676011	46.638574705415216	11.762598801888196	-2
+36.795252696831177	45.429544792296547	15.485858356410844	-2
+35.802617940766524	44.616658309974802	25.990504711687681	-2
+23	38.600000000000001	0	0
+23.641429250292333	38.799999999999997	16.206275804984127	-2
+24.096048355975132	38.799999999999997	27.550559712720549	-2
+26.648034066190675	38	90.464827367611491	-2
+27.399999999999999	37	100.00000003700207	1
+27.600000000000001	36.585744271181596	88.218919732768697	-2
+27	37.799999999999997	100.0000000370021	1
+27	38.600000000000001	100.00000003700207	1
+27	38.200000000000003	100.00000003700207	1
+27	39	100.0000000370021	1
+26.585744271181596	39.200000000000003	89.428322922075438	-2
+23.879996206594871	39.199999999999996	21.9892549735514	-2
+27.852106566398664	33.717718234604042	19.225486545630076	-2
+28.100113758716159	34.024540081606197	26.545413265160583	-2
+27.399999999999999	33	0	0
+27.600000000000001	33.414255728818404	11.88140672207822	-2
+28	35.903951644024872	71.492726730197305	-2
+28	36.358570749707667	82.955655500558322	-2
+28.414273924593932	35.615269932731692	64.923904560810399	-2
+28.813999307310311	34.974291329413454	49.336220003938436	-2
+42.200000000000003	37	0	0
+41.799999999999997	37	0	0
+41.599999999999994	36.585744271181589	9.973892531131515	-2
+41.200000000000003	36.648034066190675	8.533271948031258	-2
+40.799999999999997	36.358570749707667	15.652875239355714	-2
+43	37.799999999999997	0	0
+43.414255728818404	38.799999999999997	1.5736424991813112	-2
+43.71771823460405	39.347893433601328	1.9021034265487453	-2
+43	38.600000000000001	0	0
+43	38.200000000000003	0	0
+41.399999999999999	33	100.0000000370021	1
+41	33	100.0000000370021	1
+40.800000000000004	33.414255728818404	89.232517585672284	-2
+40.357417975548785	34.167444705429688	70.166687718226342	-2
+40.400000000000006	33.641429250292333	83.525773589616591	-2
+40.348498946372843	34.773789113443414	54.926393845553292	-2
+40.305499202657309	35.490057563527245	37.175586855003537	-2
+40.400000000000006	36.120003793405125	21.612302817485045	-2
+50	43.737117647058824	0	-1
+43.641429250292347	40	1.2360916082714275	-2
+44.853842368482916	41.927462860160894	1.2787403945873308	-2
+45.285812349255629	42.941945744891378	1.0074060354720544	-2
+44.024540081606212	41.899886241283838	0.80642214784178123	-2
+43.641429250292333	41.200000000000003	0.68170715440527785	-2
+43.351965933809325	40.799999999999997	0.4514725597181013	-2
+43.414255728818411	40.400000000000006	0.65845508285173393	-2
+46.558636203494011	44.535596483640461	0.69247281415525519	-2
+47.741681752794371	44.484373255001785	0.53372577865664239	-2
+48.935661439900535	44.306642892010025	0.29154222465250279	-2
+33.414255728818404	28.800000000000001	10.567400622642239	-2
+33.641429250292333	29.199999999999999	16.201511203196272	-2
+33	28.600000000000001	0	0
+35.131541275296975	29.559486644716234	53.275946739053026	-2
+34.392696384244729	29.58142322564257	34.926235475940345	-2
+33.879996206594882	29.599999999999998	22.11920858470484	-2
+35.975459918393796	29.700113758716157	74.28661917215571	-2
+37	29.399999999999999	100.00000003700208	1
+36.648034066190675	29.599999999999998	91.140745079238215	-2
+36.585744271181596	30	89.582697448244929	-2
+23	41	0	0
+27	39.799999999999997	100.00000003700205	1
+26.648034066190675	39.599999999999994	91.034429656356025	-2
+23.641429250292333	39.599999999999994	15.936581352071535	-2
+23.414255728818407	40	10.231770386459374	-2
+23	40.200000000000003	0	0
+23	40.600000000000001	0	0
+39.052838235294118	50	0	-1
+38.785788155476354	47.745153461628938	4.6954902850175628	-2
+38.341722837476063	46.480096452308807	7.4139649768978488	-2
+31	43	100.00000003700208	1
+32.200000000000003	43	100.00000003700208	1
+32.600000000000001	43	100.0000000370021	1
+33	43	100.00000003700208	1
+35	43.579124308506024	41.395199898307531	-2
+34.402141978735926	42.982559559814163	57.423123258532279	-2
+33.641429250292333	42.799999999999997	78.108472708458862	-2
+38.069460609253447	45.206595605702468	8.4879077559692551	-2
+37.03571064608677	44.169271739847694	12.138545496482184	-2
+36.491994580800494	43.500668968081442	15.865338732260172	-2
+23	39	0	0
+23.4142557288184	39.199999999999996	10.370501783931477	-2
+27.800000000000001	37	100.00000003700205	1
+27	39.399999999999999	100.00000003700208	1
+28	33.351965933809325	9.4658802439422338	-2
+28.399999999999999	33.414255728818404	10.744347342416464	-2
+29.084098894317641	34.26882682669342	31.895396426028551	-2
+28.800000000000001	33.641429250292333	16.328229075649791	-2
+27.800000000000001	33	0	0
+28.399999999999999	36.120003793405118	77.403099675786905	-2
+28.199999999999999	37	100.00000003700205	1
+28.399999999999999	36.585744271181596	89.267415463796297	-2
+28.907386047393604	35.723899806070548	67.840637751532725	-2
+29.693444429225668	34.906564021603337	47.661283941678683	-2
+41.399999999999999	37	0	0
+41	37	0	0
+40.600000000000001	37	0	0
+40.399999999999999	36.585744271181596	10.171823854505869	-2
+43	39	0	0
+43.351965933809325	39.200000000000003	1.0359868504955627	-2
+43.414255728818411	39.599999999999994	0.98699683890404422	-2
+40.600000000000001	33	100.0000000370021	1
+39.885389478204758	33.931447702175703	76.298028015562437	-2
+39.742965274705668	34.806378416722687	54.380094043550301	-2
+40.200000000000003	33	100.00000003700205	1
+40	33.351965933809325	91.005667320112821	-2
+39.715901105682349	35.731173173306587	31.452374637643384	-2
+40	36.358570749707653	15.843964852177839	-2
+50	45.298544117647062	0	-1
+43	40.200000000000003	0	0
+43	39.799999999999997	0	0
+44.268826826693427	42.515901105682353	0.81196285049105554	-2
+44.235054726352651	43.276134322809817	0.73304715034979506	-2
+44.249562131185236	44.551870894026642	0.75494540961123013	-2
+43.414255728818404	41.599999999999994	0.38258984694557469	-2
+43.71771823460405	42.147893433601332	0.53962493747662899	-2
+43	41.399999999999999	0	0
+43	41	0	0
+43	40.600000000000001	0	0
+47.331923189608062	45.432395138845855	0.46634113207181244	-2
+45.541510661811785	45.631024675329407	0.62309774709430077	-2
+48.362772724433086	45.36917481851453	0.31391894209574051	-2
+33	29	0	0
+33	29.399999999999999	0	0
+33.414255728818404	29.600000000000001	10.429643918483043	-2
+34.536097763116828	29.997459258493983	38.468919532136816	-2
+35.772077846401139	30.555883565729111	69.161644903184566	-2
+35.092704023580538	30.483836126189551	52.280839873122041	-2
+34.096048355975128	30	27.499924841233252	-2
+33.641429250292333	30	16.121550653733326	-2
+36.35857074970766	30.399999999999999	83.860402804124391	-2
+37	29.800000000000001	100.00000003700207	1
+37	30.199999999999999	100.00000003700207	1
+23	39.399999999999999	0	0
+23	39.799999999999997	0	0
+40.614264705882356	50	0	-1
+39.923936625448931	48.691005819638946	1.926444000195463	-2
+39.472069136861897	46.593380194848891	4.5236790687706057	-2
+39.190859471082788	45.492727167445821	5.0453534638146538	-2
+33	42.600000000000001	100.0000000370021	1
+35.597858021264074	42.982559559814163	31.813650772293578	-2
+35	42.734539373184788	45.207766473459536	-2
+33.879996206594875	42.400000000000006	73.979044943547748	-2
+34.425535161550414	42.436313995407254	59.815861709162526	-2
+33.414255728818404	42.399999999999999	87.280731788965028	-2
+38.299886241283836	44.024540081606212	4.6958732264145073	-2
+38.930874454405782	44.364979647368173	4.0270608956675318	-2
+37.200000000000003	43.414255728818404	5.4940076295537654	-2
+37.599999999999994	43.641429250292333	5.5903075836946741	-2
+37	43	0	0
+36.358570749707667	42.799999999999997	15.800321956402518	-2
+28.199999999999999	33	0	0
+28.600000000000001	33	0	0
+29.452106566398662	33.717718234604042	18.054268314480961	-2
+29.700113758716157	34.024540081606204	25.709373746603475	-2
+29	33	0	0
+29.199999999999999	33.414255728818404	10.474648562853556	-2
+28.800000000000001	36.358570749707667	83.670036876707826	-2
+28.600000000000001	37	100.00000003700207	1
+29.499886241283843	35.975459918393796	74.233133217810206	-2
+30.54491398276279	34.868424504357193	46.710954811550799	-2
+30.556490021360972	34.226488940276141	30.763387760466355	-2
+30.115901105682358	35.73117317330658	68.164423856855407	-2
+40.200000000000003	37	0	0
+43	39.399999999999999	0	0
+39.600000000000001	33.414255728818404	89.448600968045255	-2
+39.146862591775268	34.375204351419448	65.229729240862952	-2
+39.200000000000003	33.641429250292333	83.675038141536092	-2
+39.169591137193343	35.252391986779458	43.509045703543748	-2
+39.799999999999997	33	100.00000003700208	1
+39.347893433601328	36.28228176539595	17.911511830760329	-2
+39.099886241283841	35.975459918393788	25.647610899274039	-2
+39.799999999999997	37	0	0
+39.599999999999994	36.585744271181589	10.299569566100885	-2
+50	46.859970588235299	0	-1
+48.87312944288913	46.322151115057366	0.16660196728596491	-2
+43.641429250292333	42.799999999999997	0.45305348202607182	-2
+43.511329372523036	43.511329372523036	0.53669415446678304	-2
+43.47299510039732	45.687625417811077	0.93084824883051587	-2
+42.982559559814163	44.402141978735926	0.77520628783999335	-2
+43	41.799999999999997	0	0
+43.351965933809325	42	0.28189546716075492	-2
+43.414255728818404	42.399999999999999	0.30619274370982325	-2
+46.828284320469542	46.326480009966595	0.41779635109308444	-2
+47.854456516847499	46.323241081911121	0.30100589351787549	-2
+45.060688095823551	47.244255455324833	0.51612354120279014	-2
+46.235975274087721	47.164459640296812	0.38946437879604456	-2
+33	29.800000000000001	0	0
+34.358303253862616	30.400000000000002	34.056233017979146	-2
+35.545115972644489	31.118699627648287	63.387727153374577	-2
+36.068552297824311	31.085389478204757	76.419976781557253	-2
+35.021292722920784	31.14523932664061	50.49493526300251	-2
+33.879996206594882	30.399999999999999	22.117001623812396	-2
+33	30.199999999999999	0	0
+33.414255728818404	30.399999999999999	10.427705237307963	-2
+37	30.600000000000001	100.00000003700205	1
+36.585744271181596	30.800000000000001	89.522391197674608	-2
+42.175691176470593	50	0	-1
+41.364525460403961	48.767805539459658	1.0136963999765176	-2
+40.982470361754565	47.376680710424672	2.1170838059174888	-2
+40.301721404220196	45.817369190979498	3.1599198728514537	-2
+40.370397607332521	44.526357603997681	2.1295330773608665	-2
+33	42.200000000000003	100.00000003700208	1
+35.576642321757191	42.438265664869746	32.968544564755767	-2
+36.120003793405125	42.400000000000006	20.832859355783732	-2
+35.302850272556512	41.984026376454651	40.017846584931014	-2
+34.096048355975171	42	69.617158125221096	-2
+33.641429250292347	42	81.821867109198138	-2
+34.392696384244701	41.581423225642546	63.041444839282718	-2
+38	43.414255728818404	2.749401955261356	-2
+38.605195508303886	43.726247741870274	2.9078305140105272	-2
+38.400000000000006	43.351965933809332	1.6982006235573428	-2
+39.714610521795251	43.93144770217571	1.9909813426117411	-2
+39.200000000000003	43.641429250292333	1.8474371371160299	-2
+37.399999999999999	43	0	0
+37.799999999999997	43	0	0
+37	42.600000000000001	0	0
+36.585744271181596	42.400000000000006	9.963296787087911	-2
+29.599999999999998	33.351965933809325	8.8602780196761248	-2
+30	33.414255728818404	10.411868044366415	-2
+30.399999999999999	33.64142925029234	16.122575132200101	-2
+29.399999999999999	33	0	0
+29	37	100.00000003700205	1
+29.199999999999999	36.585744271181596	89.513882310632056	-2
+29.747893433601337	36.282281765395958	81.94751245237974	-2
+31.085288708695586	34.521710748248871	38.176004631607697	-2
+30.705499202657315	35.490057563527238	62.101336396464617	-2
+31.463341449224355	34.975017045461662	49.29829444012011	-2
+31.085389478204757	33.931447702175689	23.540581236510775	-2
+30.800000000000001	36.120003793405118	77.788135827871855	-2
+30.399999999999999	36.35857074970766	83.841410167241008	-2
+39.399999999999999	33	100.0000000370021	1
+38.500113758716175	34.024540081606204	73.756147875517584	-2
+38.464627218029939	34.833896016465424	53.911527174563474	-2
+39	33	100.0000000370021	1
+38.800000000000004	33.414255728818404	89.371081001447934	-2
+38.463665537692727	35.644028967920086	34.259589538394415	-2
+39.200000000000003	36.648034066190675	8.8229436509356951	-2
+38.799999999999997	36.585744271181596	10.516828379755024	-2
+38.400000000000006	36.358570749707667	16.515298317892647	-2
+39.399999999999999	37	0	0
+50	47.640683823529415	0	-1
+49.269373639044744	47.260599971037784	0.079635694970683624	-2
+48.445910700108129	47.246910469751647	0.16450143112675988	-2
+43	42.600000000000001	0	0
+43	43	0	0
+42.799999999999997	43.641429250292333	0.45856988012501587	-2
+42.683450026894292	47.337441232348567	1.0667207411827568	-2
+42.099671399494632	45.604098750557313	1.4308988133459402	-2
+42.400000000000006	43.879996206594875	0.62148100241100313	-2
+41.730874454405786	44.364979647368131	1.1045022329132013	-2
+43	42.200000000000003	0	0
+47.337770344543294	47.290721618294057	0.26792183956967092	-2
+44.109260836443219	48.483014093568812	0.43301577768063082	-2
+45.641882723600808	48.181672186888768	0.31866923973608396	-2
+46.743905181887918	48.227321123393374	0.21965457104703903	-2
+34.096048355975128	30.800000000000001	27.585197754225419	-2
+34.358303253862601	31.199999999999996	34.202911404999867	-2
+35.350870553764572	31.55948663530895	58.43166762072363	-2
+35.832555294570291	31.557417975548784	70.232655874968529	-2
+36.648034066190675	31.199999999999999	91.006235958524684	-2
+36.35857074970766	31.600000000000001	83.394697021984669	-2
+34.541567166884555	31.606126686322511	38.888931099730065	-2
+33.641429250292333	30.800000000000001	16.194203858176714	-2
+33	30.600000000000001	0	0
+37	31	100.00000003700208	1
+43.737117647058824	50	0	-1
+42.748747154996074	48.739655211369829	0.57899666193551258	-2
+41.091975418509172	44.794175205708186	1.7691979045026733	-2
+40.400000000000006	43.641429250292333	0.98681208942654963	-2
+41.099886241283848	44.024540081606197	1.0995840579498755	-2
+33	41.799999999999997	100.00000003700208	1
+35.83255529457027	41.957417975548786	27.634270726161333	-2
+36.358570749707653	42	15.280234240565274	-2
+34.825608913595431	41.244675523786178	52.802283878870092	-2
+35.467289142425479	41.479789055918395	36.786628906666081	-2
+33.879996206594875	41.599999999999994	76.229120886676654	-2
+33.414255728818404	41.599999999999994	88.695249793495975	-2
+34.303672117672697	41.076169577789308	66.068962651948411	-2
+38.200000000000003	43	0	0
+38.799999999999997	43.346454010367928	1.2798975710703067	-2
+38.600000000000001	43	0	0
+40	43.414255728818404	0.79098678309029147	-2
+39.599999999999994	43.351965933809332	0.84059330071241234	-2
+39.399999999999999	43	0	0
+39	43	0	0
+37	42.200000000000003	0	0
+29.800000000000001	33	0	0
+30.199999999999999	33	0	0
+30.600000000000001	33	0	0
+30.800000000000001	33.414255728818404	10.461950163482836	-2
+29.399999999999999	37	100.00000003700207	1
+29.600000000000001	36.648034066190675	91.128600442772367	-2
+30	36.585744271181596	89.570586615051866	-2
+31.557417975548784	34.167444705429709	29.71371531566632	-2
+31.24258202445122	35.832555294570312	70.419381158927592	-2
+32.002529589791891	35.039559945770016	50.826671246510422	-2
+31.706461962307124	35.494789115380698	61.811874965698394	-2
+31.999731136249839	34.364026390179063	34.944680122324826	-2
+31.199999999999999	33.351965933809325	8.9740077801975193	-2
+31.600000000000001	33.64142925029234	16.555425290575904	-2
+30.800000000000001	36.585744271181596	89.516446503841891	-2
+31.199999999999999	36.358570749707667	83.653670325471353	-2
+30.199999999999999	37	100.00000003700207	1
+30.600000000000001	37	100.00000003700205	1
+38.252106566398659	33.717718234604057	81.303797250778089	-2
+37.884098894317674	34.268826826693463	66.972009674821592	-2
+37.823533109689315	35.378174017765005	41.316862439257712	-2
+38.600000000000001	33	100.00000003700207	1
+38.400000000000006	33.351965933809332	90.813176873556031	-2
+37.88538947820475	36.068552297824269	24.578116936953283	-2
+39	37	0	0
+38.600000000000001	37	0	0
+38.200000000000003	37	0	0
+38	36.648034066190668	9.425911828889614	-2
+50	48.42139705882353	0	-1
+49.56040644856985	48.031040441176472	0.033126087621197502	-2
+48.990200207395191	48.209629082419987	0.069574754705388028	-2
+47.895751262683874	48.368562094538774	0.13040345329620476	-2
+42.600000000000001	43	0	0
+42.400000000000006	43.414255728818404	0.30716244556867517	-2
+42	43.641429250292347	0.51379971490184828	-2
+41.405195508303876	43.72624774187026	0.7080908257113212	-2
+45.298544117647062	50	0	-1
+46.159315883059584	49.155735967893726	0.12713383630935557	-2
+47.250327205882357	49.271464379555319	0.077705866864184917	-2
+33.879996206594882	31.199999999999999	22.314680284947748	-2
+34.096048355975149	31.600000000000005	27.965632727923886	-2
+35.173387972096251	32.007286146343318	53.881272899793274	-2
+36.120003793405118	32.000000000000007	76.780503551799981	-2
+37	31.399999999999999	100.00000003700207	1
+37	31.800000000000001	100.00000003700207	1
+36.585744271181596	32	88.905768521512158	-2
+34.425535161550442	32.036313995407248	36.492396445524626	-2
+33	31	0	0
+33.414255728818404	31.199999999999999	10.553909789667845	-2
+40.200000000000003	43	0	0
+40.600000000000001	43	0	0
+40.800000000000004	43.414255728818404	0.53786001724339727	-2
+41.200000000000003	43.351965933809325	0.37793162807597452	-2
+33	41.399999999999999	100.0000000370021	1
+36.068552297824318	41.485389478204759	22.343928521809865	-2
+37	41.799999999999997	0	0
+36.648034066190675	41.599999999999994	8.4346059385123322	-2
+35.098292606655257	40.768801720857667	46.514323156472102	-2
+34.532710857574521	40.520210944081605	60.81189671971795	-2
+35.696327882327303	40.923830422210692	31.686868869637539	-2
+33.641429250292333	41.200000000000003	83.003676813032669	-2
+33.931447702175682	40.514610521795241	76.034062337711646	-2
+39.799999999999997	43	0	0
+31	33	0	0
+29.800000000000001	37	100.00000003700207	1
+32.000000000000007	33.879996206594882	23.090105354450198	-2
+31.714610521795244	36.068552297824304	75.937505429904434	-2
+32.243258653687811	35.774105006336775	67.680937353410044	-2
+32.541164485259152	34.970552074524349	49.125559060126719	-2
+32.440400432370367	34.163786877682426	31.160698031645222	-2
+31.399999999999999	33	0	0
+31.800000000000001	33	0	0
+32	33.414255728818404	11.059716796704841	-2
+31	37	100.00000003700205	1
+31.399999999999999	37	100.0000000370021	1
+31.600000000000001	36.648034066190675	90.84750106319926	-2
+38	33.414255728818404	88.842011030401068	-2
+37.599999999999994	33.641429250292333	81.964905383220668	-2
+37.140152140345172	35.262248047241698	44.993184148207419	-2
+37.03571064608677	34.169271739847694	66.62655697805215	-2
+38.200000000000003	33	100.0000000370021	1
+37.599999999999994	36.585744271181596	11.887025546551099	-2
+37.200000000000003	36.358570749707667	19.985288094916349	-2
+37.799999999999997	37	0	0
+50	48.811753676470587	0	-1
+49.507779181085127	48.616575367647059	0.026193591588488729	-2
+48.886578275383528	48.859825797477988	0.048508570814693765	-2
+48.031040441176472	49.54281154359829	0.034957301620634401	-2
+42.200000000000003	43	0	0
+41.799999999999997	43	0	0
+41.599999999999994	43.346454010367928	0.31951350364175901	-2
+46.859970588235299	50	0	-1
+47.640683823529415	50	0	-1
+33.64142925029234	31.600000000000001	16.560402454393287	-2
+33.879996206594882	32.000000000000007	23.097139050696647	-2
+35.836213122317574	32.440400432370367	68.820326820826338	-2
+35.1964877382607	32.695675991481494	53.914947450141767	-2
+34.402141978735941	32.582559559814179	36.89207173404683	-2
+36.358570749707667	32.400000000000006	82.011723984362192	-2
+37	32.200000000000003	100.00000003700208	1
+33	31.399999999999999	0	0
+41	43	0	0
+41.399999999999999	43	0	0
+33	41	100.0000000370021	1
+36.585744271181596	41.200000000000003	10.004398069754622	-2
+36.358570749707667	40.799999999999997	15.616132638348706	-2
+37	41.399999999999999	0	0
+35.607149304781345	40.418451967092146	34.169605682290253	-2
+35.259228656828846	39.962729606769088	43.005635670368143	-2
+34.16744470542973	40.042582024451214	70.247717041499939	-2
+34.509942436472713	39.505499202657298	61.823226453476408	-2
+36.120003793405125	40.400000000000006	21.580562301568111	-2
+33.414255728818404	40.799999999999997	89.190473068674834	-2
+33.351965933809325	40.400000000000006	90.934328907789052	-2
+33.641429250292347	40	83.612995000459946	-2
+32.400000000000006	33.641429250292333	17.969511293622535	-2
+32	36.585744271181596	88.840100884569949	-2
+32.400000000000006	36.358570749707667	81.957885768051639	-2
+32.96428935391323	35.830728260152306	66.227162119899347	-2
+32.964289353913237	34.169271739847701	33.484683714911398	-2
+33.567193656194306	35.000000000000007	49.164789339579336	-2
+32.200000000000003	33	0	0
+31.800000000000001	37	100.00000003700207	1
+37.799999999999997	33	100.0000000370021	1
+37.399999999999999	33	100.0000000370021	1
+37.200000000000003	33.414255728818404	86.431747293292972	-2
+36.736509764400353	35.834077626233309	35.064957127965236	-2
+36.41882994512595	35.181458090122945	47.284015401537296	-2
+35.782886404025973	34.7160426589978	52.025992911404423	-2
+36.506179344594756	33.493820655405251	73.592683930642693	-2
+37.399999999999999	37	0	0
+37	37	0	0
+36.488670627476964	36.488670627476964	26.673247881437838	-2
+50	49.202110294117645	0	-1
+49.786164724653062	49.066994501277975	0.0074252287278616909	-2
+49.383216715212079	49.167483547786702	0.019285806721170889	-2
+49.120347704804992	49.395227408521812	0.019572201759221815	-2
+48.616575367647059	49.679004140647152	0.016131065694554247	-2
+48.42139705882353	50	0	-1
+33	31.800000000000001	0	0
+33.414255728818404	32	11.0928135594921	-2
+33.641429250292333	32.400000000000006	18.110180404439109	-2
+35.830728260152299	32.964289353913237	66.394360208185205	-2
+35.274598468164839	33.394323658315486	54.455425111143974	-2
+34.573802547527521	33.449955718468196	42.530044363310637	-2
+33.939576851134888	32.833837862079605	27.622407254084511	-2
+37	32.600000000000001	100.0000000370021	1
+36.585744271181596	32.800000000000004	86.419469131010572	-2
+33	40.600000000000001	100.00000003700208	1
+37	41	0	0
+37	40.600000000000001	0	0
+36.585744271181596	40.400000000000006	10.155198954784392	-2
+35.83255529457027	39.957417975548786	28.824302380251368	-2
+35.287888114701246	39.390095096418406	42.535652077903379	-2
+33.879996206594875	39.599999999999994	77.628651298767153	-2
+34.268826826693427	38.915901105682359	67.854907711469394	-2
+36.358570749707653	40	15.82678515729077	-2
+33	40.200000000000003	100.0000000370021	1
+33	39.799999999999997	100.00000003700208	1
+33.414255728818404	39.599999999999994	89.443897404211143	-2
+32.600000000000001	33	0	0
+32.800000000000004	33.414255728818404	13.636114103650579	-2
+32.200000000000003	37	100.00000003700208	1
+32.600000000000001	37	100.0000000370021	1
+32.799999999999997	36.585744271181596	86.444398934623194	-2
+33.493820655405244	36.506179344594749	74.006964269286669	-2
+34.243594732569903	36.245350702829107	60.513458312695469	-2
+33.493820655405251	33.493820655405244	26.916323519685402	-2
+34.49046722842936	35.333106134203923	51.653359336606343	-2
+35.013410584436109	34.545917193347648	50.115577178324187	-2
+37	33	100.0000000370021	1
+35.768585298230022	35.503971075396898	46.477411356790903	-2
+37	37.399999999999999	0	0
+36.358570749707667	37.200000000000003	19.939972505938641	-2
+35.764945273647349	36.723865677190183	36.551875203117774	-2
+50	49.397288602941174	0	-1
+49.885312140061131	49.29969944852941	0.0029291746990804239	-2
+49.690859138168292	49.329728801438584	0.0076543602891460446	-2
+49.453144048769346	49.508185104514148	0.009997412886315931	-2
+48.990944789250541	49.710316280867239	0.01029694693159627	-2
+49.329968201055799	49.677312670794592	0.0079136409499934585	-2
+48.811753676470587	50	0	-1
+33	32.200000000000003	0	0
+33	32.600000000000001	0	0
+33.414255728818404	32.799999999999997	13.496722281418297	-2
+37	40.200000000000003	0	0
+36.068552297824318	39.485389478204759	23.161700277445128	-2
+35.975459918393788	38.100113758716162	26.473485126947157	-2
+36.358570749707667	38.799999999999997	16.275175103103603	-2
+35.006839281683675	38.266790431467641	49.866962006016486	-2
+33.641429250292333	39.200000000000003	83.661078651601073	-2
+34.024540081606212	38.299886241283843	73.553785955625798	-2
+33.71771823460405	38.547893433601338	81.524161526364793	-2
+37	39.799999999999997	0	0
+36.648034066190675	39.599999999999994	8.7470290075329995	-2
+33	39.399999999999999	100.0000000370021	1
+33	33	0	0
+33	37	100.0000000370021	1
+33.414255728818404	37.199999999999996	86.4682292982273	-2
+34.169271739847701	37.035710646086763	66.737533786768736	-2
+35.026111485697832	36.111708350905964	49.764250015196822	-2
+35.004467456485671	37.0709494542469	49.800048380188713	-2
+37	37.799999999999997	0	0
+36.585744271181596	37.600000000000001	11.839361138928076	-2
+36.28228176539595	37.852106566398668	19.165173925177413	-2
+35.731173173306573	37.484098894317647	33.65075030176498	-2
+50	49.592466911764703	0	-1
+49.849594322632633	49.445990889818042	0.0030189639415360808	-2
+49.661749030989874	49.524321539333251	0.0059171110235167546	-2
+49.59230568538829	49.664423582583524	0.0050753003408707262	-2
+49.202110294117645	50	0	-1
+49.397288602941174	50	0	-1
+49.55314132904185	49.815807577653054	0.0030458950880621976	-2
+36.585744271181596	39.200000000000003	10.397833753697135	-2
+36.585744271181596	38.400000000000006	10.711042357967406	-2
+37	38.600000000000001	0	0
+37	39	0	0
+33	39	100.0000000370021	1
+33.414255728818404	38.799999999999997	89.361387196946666	-2
+33.414255728818404	38	88.773633435471112	-2
+33.641429250292333	37.599999999999994	81.84505074824078	-2
+33.351965933809325	38.400000000000006	90.800354988454885	-2
+37	39.399999999999999	0	0
+33	37.399999999999999	100.0000000370021	1
+37	38.200000000000003	0	0
+36.648034066190675	38	9.4355116545911812	-2
+50	49.690056066176467	0	-1
+49.864370363210476	49.576453429428994	0.0021636512492335014	-2
+49.92180748253481	49.638047493856277	0.0010651590731629462	-2
+49.787603278656569	49.5617316176698	0.003412373417737351	-2
+49.744038068987834	49.626631459879924	0.0035374608626166002	-2
+49.73447172505464	49.764889630047399	0.002330401865269604	-2
+49.592466911764703	50	0	-1
+49.724304948244125	49.894397433029596	0.0010754036763680076	-2
+33	38.600000000000001	100.00000003700208	1
+33	37.799999999999997	100.00000003700208	1
+33	38.200000000000003	100.00000003700208	1
+50	49.787645220588232	0	-1
+49.894397433029596	49.724304948244125	0.0010799515880622612	-2
+49.832814517510599	49.65453723089329	0.0021628676653111414	-2
+49.814746235459353	49.745825384844842	0.0017507233118379815	-2
+49.799712580645661	49.877225132653393	0.00091941904007301889	-2
+49.787645220588232	50	0	-1
+49.836439797794114	49.945286211436688	0.00033160563973163779	-2
+50	49.885234374999996	0	-1
+49.945286211436688	49.836439797794114	0.00033511236700714504	-2
+49.877225132653393	49.799712580645661	0.00093332535488264306	-2
+49.877050594980247	49.877050594980247	0.00055881419430390113	-2
+49.885234374999996	50	0	-1
+49.909631663602937	49.949464752219612	0.00016873483159935177	-2
+50	49.934028952205878	0	-1
+49.949464752219612	49.909631663602937	0.00016917792757155137	-2
+49.934028952205878	50	0	-1
+49.963868038075688	49.963868038075688	4.9342437649581177e-05	-2
+50	49.982823529411768	0	-1
+49.982823529411768	50	0	-1
+50	50	0	-1
+7039
+0	1	2	0
+1	4	2	0
+3	4	1	0
+5	2	4	0
+3	7	4	0
+6	7	3	0
+8	5	4	0
+8	4	7	0
+5	8	9	0
+7	6	11	0
+10	11	6	0
+12	8	7	0
+12	7	11	0
+9	8	13	0
+13	8	12	0
+14	9	13	0
+16	11	10	0
+11	17	12	0
+15	16	10	0
+13	12	18	0
+11	16	17	0
+14	13	19	0
+12	17	18	0
+13	18	19	0
+14	19	20	0
+22	16	15	0
+23	17	16	0
+22	15	21	0
+17	24	18	0
+19	18	24	0
+25	20	19	0
+16	22	23	0
+19	24	26	0
+23	24	17	0
+29	22	21	0
+19	26	25	0
+27	20	25	0
+23	22	30	0
+24	23	31	0
+28	29	21	0
+26	24	31	0
+30	22	29	0
+32	25	26	0
+30	31	23	0
+32	27	25	0
+33	26	31	0
+33	32	26	0
+28	37	29	0
+27	32	35	0
+34	27	35	0
+29	38	30	0
+35	32	33	0
+36	37	28	0
+40	31	30	0
+33	31	40	0
+29	37	39	0
+39	38	29	0
+40	35	33	0
+38	40	30	0
+34	35	42	0
+42	41	34	0
+37	36	45	0
+35	40	43	0
+42	35	43	0
+38	43	40	0
+45	39	37	0
+46	38	39	0
+45	36	44	0
+46	43	38	0
+39	45	47	0
+39	47	46	0
+42	49	41	0
+42	43	49	0
+48	41	49	0
+49	43	46	0
+51	45	44	0
+51	47	45	0
+44	50	51	0
+52	46	47	0
+49	46	52	0
+48	49	52	0
+47	53	52	0
+54	47	51	0
+54	53	47	0
+52	55	48	0
+57	51	50	0
+54	51	57	0
+52	53	58	0
+56	57	50	0
+55	52	58	0
+60	53	54	0
+53	59	58	0
+54	57	61	0
+59	53	60	0
+60	54	62	0
+55	58	63	0
+56	64	57	0
+62	54	61	0
+59	63	58	0
+57	64	61	0
+56	65	64	0
+67	59	60	0
+66	63	59	0
+62	68	60	0
+61	69	62	0
+59	67	66	0
+61	64	70	0
+60	68	67	0
+65	70	64	0
+70	69	61	0
+62	71	68	0
+71	62	69	0
+66	67	74	0
+70	65	73	0
+67	68	75	0
+72	73	65	0
+71	76	68	0
+74	67	75	0
+77	69	70	0
+78	71	69	0
+68	76	75	0
+70	73	77	0
+77	78	69	0
+72	80	73	0
+76	71	78	0
+81	77	73	0
+80	72	79	0
+74	75	83	0
+73	80	81	0
+84	75	76	0
+74	83	82	0
+85	76	78	0
+77	86	78	0
+83	75	84	0
+81	86	77	0
+76	85	84	0
+80	79	89	0
+87	85	78	0
+81	80	89	0
+78	86	87	0
+79	88	89	0
+82	83	93	0
+86	81	91	0
+89	90	81	0
+93	83	84	0
+91	81	90	0
+84	85	94	0
+95	85	87	0
+82	93	92	0
+86	96	87	0
+94	93	84	0
+96	86	91	0
+95	94	85	0
+89	100	90	0
+88	100	89	0
+95	87	97	0
+96	98	87	0
+87	98	97	0
+91	90	101	0
+100	88	99	0
+91	103	96	0
+93	105	92	0
+90	100	101	0
+106	93	94	0
+102	91	101	0
+94	95	106	0
+102	103	91	0
+107	95	97	0
+105	104	92	0
+96	110	98	0
+106	105	93	0
+97	98	111	0
+96	103	109	0
+95	108	106	0
+95	107	108	0
+114	100	99	0
+107	97	111	0
+96	109	110	0
+100	116	101	0
+112	98	110	0
+117	102	101	0
+112	111	98	0
+102	119	103	0
+114	99	113	0
+100	114	115	0
+100	115	116	0
+105	123	104	0
+103	121	109	0
+116	117	101	0
+106	124	105	0
+102	117	118	0
+102	118	119	0
+106	108	125	0
+107	127	108	0
+119	120	103	0
+111	126	107	0
+120	121	103	0
+109	129	110	0
+123	122	104	0
+123	105	124	0
+130	112	110	0
+112	131	111	0
+125	124	106	0
+121	129	109	0
+126	127	107	0
+134	114	113	0
+125	108	128	0
+134	115	114	0
+128	108	127	0
+115	136	116	0
+126	111	132	0
+130	110	129	0
+137	117	116	0
+139	118	117	0
+131	132	111	0
+140	119	118	0
+134	113	133	0
+142	120	119	0
+134	135	115	0
+143	121	120	0
+115	135	136	0
+116	136	137	0
+123	147	122	0
+117	137	138	0
+121	144	129	0
+139	117	138	0
+123	124	148	0
+118	139	140	0
+125	149	124	0
+119	140	141	0
+142	119	141	0
+130	129	144	0
+128	151	125	0
+120	142	143	0
+126	153	127	0
+145	121	143	0
+127	154	128	0
+152	126	132	0
+145	144	121	0
+122	147	146	0
+148	147	123	0
+131	156	132	0
+148	124	149	0
+150	149	125	0
+134	133	158	0
+151	150	125	0
+135	134	159	0
+153	126	152	0
+135	162	136	0
+128	155	151	0
+153	154	127	0
+136	163	137	0
+154	155	128	0
+137	163	138	0
+132	156	152	0
+139	138	165	0
+139	168	140	0
+158	133	157	0
+169	141	140	0
+134	158	159	0
+171	142	141	0
+159	161	135	0
+135	161	160	0
+172	143	142	0
+160	162	135	0
+143	172	145	0
+164	136	162	0
+136	164	163	0
+146	147	174	0
+166	138	163	0
+166	165	138	0
+175	147	148	0
+165	167	139	0
+148	149	176	0
+139	167	168	0
+150	177	149	0
+168	170	140	0
+140	170	169	0
+179	150	151	0
+141	169	171	0
+172	142	171	0
+151	155	180	0
+181	153	152	0
+181	152	156	0
+153	182	154	0
+164	166	163	0
+154	184	155	0
+173	146	174	0
+174	147	175	0
+175	148	176	0
+186	158	157	0
+177	176	149	0
+159	158	187	0
+177	150	178	0
+178	150	179	0
+161	159	187	0
+160	161	189	0
+160	188	162	0
+180	179	151	0
+182	153	181	0
+164	162	192	0
+155	184	180	0
+183	154	182	0
+184	154	183	0
+194	166	164	0
+165	196	167	0
+166	197	165	0
+157	185	186	0
+187	158	186	0
+168	167	199	0
+170	168	199	0
+189	188	160	0
+187	191	161	0
+189	161	190	0
+190	161	191	0
+162	188	193	0
+193	192	162	0
+201	173	174	0
+164	192	194	0
+174	175	203	0
+204	175	176	0
+165	195	196	0
+195	165	197	0
+205	176	177	0
+166	194	198	0
+198	197	166	0
+206	177	178	0
+199	167	196	0
+207	178	179	0
+180	210	179	0
+173	201	200	0
+213	180	184	0
+174	202	201	0
+174	203	202	0
+213	184	183	0
+204	203	175	0
+205	204	176	0
+215	186	185	0
+206	205	177	0
+216	187	186	0
+178	207	208	0
+209	206	178	0
+187	216	191	0
+208	209	178	0
+219	188	189	0
+211	207	179	0
+188	217	193	0
+190	221	189	0
+211	179	210	0
+210	180	212	0
+223	190	191	0
+212	180	213	0
+192	193	226	0
+192	226	194	0
+215	185	214	0
+186	215	216	0
+194	228	198	0
+197	230	195	0
+218	217	188	0
+198	230	197	0
+219	218	188	0
+221	220	189	0
+189	220	222	0
+219	189	222	0
+225	191	216	0
+200	201	232	0
+224	221	190	0
+201	202	233	0
+217	227	193	0
+190	223	224	0
+225	223	191	0
+202	203	234	0
+203	204	235	0
+193	227	226	0
+205	237	204	0
+206	237	205	0
+226	229	194	0
+229	228	194	0
+206	209	238	0
+239	208	207	0
+228	230	198	0
+207	211	239	0
+242	209	208	0
+231	200	232	0
+233	232	201	0
+210	245	211	0
+212	245	210	0
+233	202	234	0
+203	236	234	0
+236	203	235	0
+235	204	237	0
+248	215	214	0
+250	216	215	0
+238	237	206	0
+227	229	226	0
+251	217	218	0
+241	208	239	0
+241	240	208	0
+219	252	218	0
+208	240	242	0
+216	250	225	0
+209	244	238	0
+209	242	243	0
+219	222	253	0
+220	221	254	0
+209	243	244	0
+211	246	239	0
+220	255	222	0
+257	221	224	0
+246	211	245	0
+225	260	223	0
+224	223	261	0
+247	248	214	0
+215	248	249	0
+250	215	249	0
+251	218	252	0
+252	219	253	0
+239	246	241	0
+254	256	220	0
+231	232	267	0
+220	256	255	0
+221	257	254	0
+222	258	253	0
+232	233	268	0
+233	234	269	0
+259	222	255	0
+250	264	225	0
+222	259	258	0
+234	236	271	0
+262	257	224	0
+273	236	235	0
+260	261	223	0
+237	273	235	0
+224	261	263	0
+238	273	237	0
+260	225	264	0
+262	224	263	0
+238	244	273	0
+276	242	240	0
+242	276	243	0
+231	266	265	0
+243	277	244	0
+266	231	267	0
+268	267	232	0
+233	270	268	0
+269	270	233	0
+234	272	269	0
+247	281	248	0
+234	271	272	0
+248	281	249	0
+282	250	249	0
+271	236	275	0
+274	236	273	0
+275	236	274	0
+285	251	252	0
+287	252	253	0
+279	273	244	0
+277	243	276	0
+258	287	253	0
+288	256	254	0
+284	264	250	0
+277	278	244	0
+288	254	257	0
+289	255	256	0
+278	279	244	0
+259	255	290	0
+281	247	280	0
+258	259	294	0
+281	283	249	0
+283	282	249	0
+284	250	282	0
+261	260	297	0
+298	260	264	0
+285	252	286	0
+263	261	299	0
+287	286	252	0
+262	263	301	0
+279	274	273	0
+303	265	266	0
+289	290	255	0
+288	291	256	0
+289	256	292	0
+267	304	266	0
+287	258	293	0
+267	268	304	0
+256	291	292	0
+306	268	270	0
+296	259	290	0
+293	258	294	0
+307	270	269	0
+284	298	264	0
+259	295	294	0
+272	307	269	0
+259	296	295	0
+308	272	271	0
+297	260	298	0
+271	275	309	0
+261	297	300	0
+300	299	261	0
+314	275	274	0
+301	263	299	0
+313	274	279	0
+279	278	313	0
+302	265	303	0
+266	304	303	0
+305	304	268	0
+281	280	318	0
+268	306	305	0
+307	306	270	0
+283	281	319	0
+283	321	282	0
+284	282	322	0
+309	308	271	0
+272	310	307	0
+311	272	308	0
+310	272	312	0
+311	312	272	0
+326	285	286	0
+327	286	287	0
+316	309	275	0
+274	313	314	0
+315	275	314	0
+316	275	315	0
+284	325	298	0
+287	293	327	0
+289	329	290	0
+292	328	289	0
+292	291	331	0
+317	318	280	0
+290	330	296	0
+281	318	319	0
+294	332	293	0
+334	294	295	0
+321	320	282	0
+282	320	322	0
+319	324	283	0
+335	295	296	0
+323	321	283	0
+324	323	283	0
+322	325	284	0
+338	297	298	0
+297	338	300	0
+300	339	299	0
+326	286	327	0
+301	299	339	0
+329	289	328	0
+302	303	343	0
+290	329	330	0
+331	328	292	0
+303	304	344	0
+327	293	332	0
+345	304	305	0
+305	306	346	0
+332	294	333	0
+306	307	347	0
+294	334	333	0
+298	325	338	0
+336	296	330	0
+310	347	307	0
+334	295	335	0
+349	308	309	0
+308	348	311	0
+335	296	337	0
+336	337	296	0
+312	352	310	0
+309	316	350	0
+312	311	354	0
+300	340	339	0
+300	338	341	0
+300	341	340	0
+313	356	314	0
+315	314	358	0
+343	342	302	0
+344	343	303	0
+359	316	315	0
+304	345	344	0
+346	345	305	0
+363	318	317	0
+347	346	306	0
+363	319	318	0
+349	348	308	0
+365	322	320	0
+319	364	324	0
+366	320	321	0
+347	310	352	0
+309	351	349	0
+350	351	309	0
+311	348	353	0
+323	368	321	0
+322	369	325	0
+311	353	354	0
+371	323	324	0
+352	312	355	0
+354	355	312	0
+350	316	360	0
+357	314	356	0
+326	327	374	0
+357	358	314	0
+338	325	369	0
+358	359	315	0
+376	329	328	0
+332	375	327	0
+331	376	328	0
+377	330	329	0
+316	359	361	0
+361	360	316	0
+363	317	362	0
+333	380	332	0
+330	379	336	0
+346	347	352	0
+363	364	319	0
+341	338	369	0
+334	381	333	0
+334	335	383	0
+320	367	365	0
+320	366	367	0
+365	370	322	0
+321	368	366	0
+385	335	337	0
+336	387	337	0
+370	369	322	0
+373	324	364	0
+323	371	368	0
+372	371	324	0
+324	373	372	0
+389	340	341	0
+374	327	375	0
+342	343	392	0
+344	393	343	0
+377	329	376	0
+345	393	344	0
+377	378	330	0
+346	395	345	0
+332	380	375	0
+330	378	379	0
+380	333	381	0
+352	397	346	0
+399	348	349	0
+381	334	382	0
+382	334	383	0
+351	400	349	0
+341	369	390	0
+386	336	379	0
+351	350	401	0
+384	383	335	0
+335	385	384	0
+397	352	355	0
+387	336	386	0
+403	354	353	0
+388	385	337	0
+360	401	350	0
+387	388	337	0
+355	354	404	0
+390	389	341	0
+356	407	357	0
+408	358	357	0
+392	391	342	0
+358	409	359	0
+392	343	393	0
+359	410	361	0
+360	361	412	0
+394	345	395	0
+393	345	396	0
+394	396	345	0
+398	395	346	0
+363	362	415	0
+346	397	398	0
+416	364	363	0
+399	349	400	0
+419	365	367	0
+420	367	366	0
+402	400	351	0
+365	419	370	0
+401	402	351	0
+417	373	364	0
+421	366	368	0
+397	355	406	0
+403	404	354	0
+424	368	371	0
+355	404	405	0
+369	370	425	0
+405	406	355	0
+371	372	429	0
+407	408	357	0
+401	360	412	0
+409	358	408	0
+430	372	373	0
+409	411	359	0
+359	411	410	0
+432	374	375	0
+410	413	361	0
+390	369	425	0
+361	413	412	0
+432	375	380	0
+379	378	433	0
+414	415	362	0
+415	416	363	0
+381	435	380	0
+418	364	416	0
+379	433	386	0
+382	436	381	0
+417	364	418	0
+383	437	382	0
+438	383	384	0
+421	420	366	0
+385	439	384	0
+367	422	419	0
+420	423	367	0
+423	422	367	0
+424	421	368	0
+385	388	440	0
+442	387	386	0
+419	426	370	0
+443	388	387	0
+373	417	431	0
+370	427	425	0
+371	428	424	0
+370	426	427	0
+389	390	446	0
+429	428	371	0
+392	448	391	0
+430	429	372	0
+430	373	431	0
+393	451	392	0
+393	396	451	0
+395	452	394	0
+453	396	394	0
+434	432	380	0
+454	395	398	0
+434	380	435	0
+456	398	397	0
+436	435	381	0
+382	437	436	0
+438	437	383	0
+400	459	399	0
+406	456	397	0
+402	459	400	0
+425	446	390	0
+438	384	439	0
+442	386	433	0
+460	402	401	0
+441	439	385	0
+440	441	385	0
+426	419	422	0
+403	463	404	0
+463	405	404	0
+443	387	442	0
+460	401	412	0
+445	440	388	0
+443	444	388	0
+464	406	405	0
+388	444	445	0
+466	408	407	0
+466	409	408	0
+449	447	391	0
+467	411	409	0
+391	448	449	0
+392	450	448	0
+469	410	411	0
+413	410	468	0
+451	450	392	0
+425	427	446	0
+412	413	473	0
+453	394	452	0
+395	454	452	0
+396	455	451	0
+453	455	396	0
+415	414	476	0
+477	416	415	0
+454	398	458	0
+398	456	457	0
+418	416	477	0
+418	478	417	0
+398	457	458	0
+459	402	461	0
+460	462	402	0
+461	402	462	0
+420	421	485	0
+479	431	417	0
+423	420	484	0
+465	456	406	0
+421	424	486	0
+405	463	464	0
+406	464	465	0
+424	428	488	0
+467	409	466	0
+472	460	412	0
+428	429	489	0
+468	410	469	0
+467	470	411	0
+491	429	430	0
+411	471	469	0
+431	491	430	0
+471	411	470	0
+413	468	474	0
+473	472	412	0
+474	473	413	0
+493	434	435	0
+493	435	436	0
+475	476	414	0
+477	415	476	0
+437	495	436	0
+438	496	437	0
+497	438	439	0
+478	480	417	0
+417	480	479	0
+418	482	478	0
+477	483	418	0
+498	439	441	0
+481	482	418	0
+481	418	483	0
+440	501	441	0
+445	500	440	0
+485	484	420	0
+485	421	486	0
+445	444	504	0
+424	487	486	0
+488	487	424	0
+479	492	431	0
+449	506	447	0
+507	449	448	0
+488	428	489	0
+507	448	450	0
+489	429	490	0
+490	429	491	0
+451	511	450	0
+491	431	492	0
+451	455	511	0
+452	513	453	0
+452	454	512	0
+494	493	436	0
+494	436	495	0
+455	453	515	0
+495	437	496	0
+518	454	458	0
+496	438	497	0
+456	521	457	0
+497	439	499	0
+439	498	499	0
+483	477	476	0
+457	522	458	0
+501	440	500	0
+521	456	465	0
+498	441	503	0
+441	501	502	0
+460	523	462	0
+503	441	502	0
+461	462	524	0
+445	504	500	0
+523	460	472	0
+506	505	447	0
+525	468	469	0
+449	509	506	0
+507	508	449	0
+508	509	449	0
+526	469	471	0
+507	450	510	0
+468	525	474	0
+470	528	471	0
+450	511	510	0
+473	529	472	0
+530	473	474	0
+514	452	512	0
+514	513	452	0
+513	516	453	0
+512	454	517	0
+453	516	515	0
+476	475	534	0
+455	520	511	0
+517	454	518	0
+515	519	455	0
+478	536	480	0
+519	520	455	0
+535	483	476	0
+482	537	478	0
+479	480	539	0
+518	458	522	0
+522	457	521	0
+542	482	481	0
+483	541	481	0
+538	492	479	0
+523	524	462	0
+484	485	545	0
+486	545	485	0
+486	487	545	0
+525	469	527	0
+469	526	527	0
+523	472	529	0
+471	528	526	0
+546	489	490	0
+491	548	490	0
+474	525	532	0
+529	473	530	0
+491	492	549	0
+531	530	474	0
+532	531	474	0
+494	495	551	0
+533	534	475	0
+496	551	495	0
+534	535	476	0
+553	496	497	0
+554	497	499	0
+537	536	478	0
+499	498	556	0
+539	538	479	0
+498	503	555	0
+540	480	536	0
+540	539	480	0
+500	558	501	0
+543	537	482	0
+558	500	504	0
+559	502	501	0
+535	544	483	0
+541	542	481	0
+561	503	502	0
+543	482	542	0
+541	483	544	0
+564	505	506	0
+509	565	506	0
+538	550	492	0
+567	508	507	0
+566	507	510	0
+547	546	490	0
+548	547	490	0
+568	509	508	0
+549	548	491	0
+549	492	550	0
+511	573	510	0
+552	551	496	0
+514	512	575	0
+553	552	496	0
+513	514	576	0
+517	575	512	0
+497	554	553	0
+511	520	574	0
+576	516	513	0
+555	556	498	0
+516	578	515	0
+554	499	557	0
+557	499	556	0
+515	578	519	0
+559	501	558	0
+559	560	502	0
+555	503	563	0
+582	520	519	0
+502	560	561	0
+503	561	562	0
+562	563	503	0
+584	524	523	0
+565	564	506	0
+529	585	523	0
+527	586	525	0
+507	566	567	0
+587	527	526	0
+587	526	528	0
+525	586	532	0
+508	567	569	0
+509	571	565	0
+508	569	568	0
+568	570	509	0
+572	566	510	0
+530	590	529	0
+509	570	571	0
+591	530	531	0
+510	573	572	0
+531	532	593	0
+574	573	511	0
+596	534	533	0
+577	514	575	0
+597	535	534	0
+514	577	576	0
+537	598	536	0
+580	516	576	0
+516	579	578	0
+598	540	536	0
+580	579	516	0
+597	544	535	0
+583	574	520	0
+581	519	578	0
+601	538	539	0
+543	600	537	0
+519	581	582	0
+540	603	539	0
+582	583	520	0
+542	541	606	0
+538	602	550	0
+605	541	544	0
+523	585	584	0
+543	542	607	0
+589	586	527	0
+527	587	588	0
+547	611	546	0
+529	590	585	0
+527	588	589	0
+612	547	548	0
+548	549	613	0
+590	530	591	0
+586	594	532	0
+614	549	550	0
+592	591	531	0
+531	593	592	0
+594	593	532	0
+553	616	552	0
+596	533	595	0
+553	554	617	0
+596	597	534	0
+618	554	557	0
+556	555	619	0
+556	620	557	0
+576	577	580	0
+537	599	598	0
+599	537	600	0
+563	619	555	0
+581	578	579	0
+601	602	538	0
+604	601	539	0
+561	560	624	0
+604	539	603	0
+561	624	562	0
+563	562	625	0
+543	608	600	0
+544	597	610	0
+541	605	606	0
+542	606	607	0
+630	564	565	0
+605	544	610	0
+609	543	607	0
+608	543	609	0
+566	631	567	0
+630	565	571	0
+602	615	550	0
+569	567	633	0
+612	611	547	0
+572	632	566	0
+570	568	634	0
+569	635	568	0
+613	612	548	0
+613	549	614	0
+570	638	571	0
+615	614	550	0
+573	640	572	0
+553	617	616	0
+641	573	574	0
+618	617	554	0
+619	621	556	0
+618	557	622	0
+556	621	620	0
+574	583	642	0
+620	623	557	0
+623	622	557	0
+582	643	583	0
+628	619	563	0
+624	626	562	0
+625	562	626	0
+625	627	563	0
+584	585	646	0
+628	563	627	0
+590	646	585	0
+586	589	647	0
+564	630	629	0
+589	588	648	0
+594	586	647	0
+631	566	632	0
+591	650	590	0
+567	631	633	0
+592	652	591	0
+635	634	568	0
+593	653	592	0
+569	633	637	0
+569	636	635	0
+571	639	630	0
+638	570	634	0
+569	637	636	0
+593	594	656	0
+632	572	640	0
+639	571	638	0
+660	596	595	0
+597	596	661	0
+640	573	641	0
+574	642	641	0
+663	599	600	0
+601	665	602	0
+662	610	597	0
+664	601	604	0
+642	583	645	0
+644	583	643	0
+608	663	600	0
+644	645	583	0
+604	603	668	0
+605	669	606	0
+615	602	666	0
+607	606	671	0
+648	647	589	0
+670	605	610	0
+646	590	649	0
+671	609	607	0
+649	590	650	0
+609	672	608	0
+651	650	591	0
+651	591	652	0
+654	652	592	0
+647	657	594	0
+653	654	592	0
+611	612	677	0
+593	655	653	0
+593	656	655	0
+613	679	612	0
+614	679	613	0
+658	656	594	0
+657	658	594	0
+680	614	615	0
+659	660	595	0
+616	617	682	0
+596	660	661	0
+618	682	617	0
+662	597	661	0
+622	682	618	0
+619	683	621	0
+684	620	621	0
+620	684	623	0
+683	619	628	0
+665	601	664	0
+665	667	602	0
+667	666	602	0
+668	664	604	0
+624	687	626	0
+626	688	625	0
+625	689	627	0
+663	608	672	0
+605	670	669	0
+669	671	606	0
+628	627	693	0
+610	662	676	0
+609	671	674	0
+672	609	673	0
+610	675	670	0
+609	674	673	0
+698	629	630	0
+675	610	676	0
+666	681	615	0
+631	632	699	0
+633	631	700	0
+698	630	639	0
+677	612	678	0
+679	678	612	0
+633	700	637	0
+634	635	703	0
+680	679	614	0
+702	632	640	0
+638	634	704	0
+680	615	681	0
+636	705	635	0
+637	706	636	0
+638	709	639	0
+621	683	686	0
+685	684	621	0
+685	621	686	0
+640	641	712	0
+642	713	641	0
+645	714	642	0
+643	715	644	0
+688	689	625	0
+626	687	690	0
+716	645	644	0
+626	691	688	0
+683	628	696	0
+690	691	626	0
+627	689	692	0
+692	693	627	0
+648	718	647	0
+628	693	695	0
+628	695	694	0
+694	696	628	0
+650	720	649	0
+651	720	650	0
+647	719	657	0
+651	652	721	0
+629	698	697	0
+654	723	652	0
+631	699	700	0
+654	653	724	0
+701	699	632	0
+724	653	655	0
+701	632	702	0
+656	726	655	0
+703	704	634	0
+727	656	658	0
+705	703	635	0
+657	729	658	0
+707	637	700	0
+705	636	706	0
+698	639	710	0
+637	708	706	0
+732	660	659	0
+709	638	704	0
+707	708	637	0
+640	711	702	0
+661	660	733	0
+661	735	662	0
+639	709	710	0
+712	711	640	0
+736	665	664	0
+712	641	713	0
+664	668	736	0
+642	714	713	0
+665	737	667	0
+666	667	738	0
+662	735	676	0
+715	716	644	0
+645	717	714	0
+717	645	716	0
+742	669	670	0
+742	671	669	0
+719	647	718	0
+739	681	666	0
+671	742	674	0
+675	743	670	0
+673	674	745	0
+651	721	720	0
+722	721	652	0
+722	652	723	0
+676	747	675	0
+685	686	730	0
+725	723	654	0
+725	654	724	0
+719	728	657	0
+726	724	655	0
+677	678	750	0
+678	679	751	0
+726	656	727	0
+680	751	679	0
+752	680	681	0
+729	657	728	0
+730	727	658	0
+658	729	730	0
+732	659	731	0
+683	755	686	0
+756	684	685	0
+733	660	732	0
+733	734	661	0
+661	734	735	0
+757	690	687	0
+696	755	683	0
+759	689	688	0
+691	758	688	0
+737	665	736	0
+760	692	689	0
+690	761	691	0
+727	730	686	0
+738	739	666	0
+737	740	667	0
+741	738	667	0
+693	692	763	0
+741	667	740	0
+764	695	693	0
+696	694	765	0
+695	766	694	0
+670	744	742	0
+744	670	743	0
+748	676	735	0
+674	742	746	0
+745	674	746	0
+743	675	747	0
+770	697	698	0
+755	727	686	0
+699	772	700	0
+756	685	730	0
+772	699	701	0
+747	676	749	0
+753	681	739	0
+749	676	748	0
+774	701	702	0
+696	726	755	0
+751	750	678	0
+698	710	771	0
+707	700	773	0
+704	703	776	0
+751	680	752	0
+703	705	777	0
+752	681	754	0
+681	753	754	0
+711	775	702	0
+726	696	768	0
+705	706	780	0
+709	704	778	0
+706	708	782	0
+778	710	709	0
+783	708	707	0
+759	688	758	0
+757	761	690	0
+726	727	755	0
+759	760	689	0
+711	712	786	0
+691	762	758	0
+788	712	713	0
+762	691	761	0
+692	760	763	0
+714	789	713	0
+693	763	764	0
+717	791	714	0
+792	716	715	0
+694	766	765	0
+792	717	716	0
+764	767	695	0
+695	767	766	0
+696	765	768	0
+718	794	719	0
+770	769	697	0
+770	698	771	0
+722	723	795	0
+719	794	728	0
+725	795	723	0
+700	772	773	0
+725	724	796	0
+796	724	726	0
+775	774	702	0
+728	799	729	0
+776	703	777	0
+729	800	730	0
+776	779	704	0
+779	778	704	0
+777	705	781	0
+783	707	773	0
+731	802	732	0
+705	780	781	0
+785	771	710	0
+782	780	706	0
+803	733	732	0
+733	806	734	0
+778	785	710	0
+787	775	711	0
+784	782	708	0
+783	784	708	0
+735	734	807	0
+786	787	711	0
+738	809	739	0
+786	712	788	0
+800	756	730	0
+741	808	738	0
+726	768	796	0
+748	735	807	0
+789	788	713	0
+741	740	811	0
+789	714	790	0
+790	714	791	0
+812	742	744	0
+743	813	744	0
+746	742	812	0
+793	791	717	0
+753	739	810	0
+793	717	792	0
+814	743	747	0
+745	746	817	0
+749	814	747	0
+749	748	818	0
+795	725	797	0
+796	798	725	0
+797	725	798	0
+799	728	794	0
+821	750	751	0
+822	751	752	0
+800	729	799	0
+823	752	754	0
+754	753	825	0
+801	802	731	0
+732	802	804	0
+803	732	804	0
+803	805	733	0
+733	805	806	0
+807	734	806	0
+757	829	761	0
+831	759	758	0
+758	762	830	0
+829	762	761	0
+759	834	760	0
+809	738	808	0
+739	809	810	0
+760	835	763	0
+741	811	808	0
+763	839	764	0
+814	813	743	0
+744	815	812	0
+764	841	767	0
+816	744	813	0
+765	766	843	0
+807	819	748	0
+812	817	746	0
+768	765	842	0
+815	744	816	0
+844	766	767	0
+814	749	820	0
+748	819	818	0
+749	818	820	0
+824	753	810	0
+769	770	850	0
+770	771	851	0
+822	821	751	0
+752	823	822	0
+774	775	853	0
+824	826	753	0
+753	826	825	0
+828	823	754	0
+754	825	827	0
+777	855	776	0
+852	771	785	0
+779	776	854	0
+754	827	828	0
+768	848	796	0
+856	777	781	0
+787	853	775	0
+779	858	778	0
+831	758	830	0
+778	858	785	0
+780	860	781	0
+759	831	832	0
+861	780	782	0
+832	833	759	0
+759	833	834	0
+782	784	861	0
+837	762	829	0
+837	830	762	0
+836	760	834	0
+836	835	760	0
+838	763	835	0
+787	786	865	0
+788	865	786	0
+763	838	839	0
+848	798	796	0
+839	840	764	0
+817	812	815	0
+868	788	789	0
+764	840	841	0
+790	869	789	0
+843	842	765	0
+870	790	791	0
+843	766	845	0
+767	841	846	0
+766	844	845	0
+793	872	791	0
+767	846	844	0
+842	847	768	0
+847	848	768	0
+769	850	849	0
+798	874	797	0
+851	850	770	0
+852	851	771	0
+801	876	802	0
+802	876	804	0
+855	854	776	0
+804	878	803	0
+877	805	803	0
+855	777	857	0
+777	856	857	0
+881	806	805	0
+859	779	854	0
+806	882	807	0
+859	858	779	0
+781	862	856	0
+785	863	852	0
+780	861	860	0
+808	885	809	0
+781	860	862	0
+885	808	811	0
+809	886	810	0
+853	787	866	0
+864	785	858	0
+807	884	819	0
+864	863	785	0
+813	814	889	0
+813	889	816	0
+865	867	787	0
+798	848	874	0
+866	787	867	0
+868	865	788	0
+888	824	810	0
+820	890	814	0
+868	789	869	0
+818	819	891	0
+871	869	790	0
+820	818	892	0
+870	871	790	0
+870	791	873	0
+873	791	872	0
+822	896	821	0
+822	823	897	0
+828	898	823	0
+824	900	826	0
+825	826	901	0
+876	801	875	0
+827	825	902	0
+877	803	878	0
+827	904	828	0
+876	879	804	0
+804	880	878	0
+805	877	881	0
+880	804	879	0
+848	847	874	0
+806	881	883	0
+910	831	830	0
+883	882	806	0
+882	884	807	0
+832	831	911	0
+837	908	830	0
+913	833	832	0
+885	886	809	0
+859	864	858	0
+833	914	834	0
+886	887	810	0
+888	810	887	0
+836	834	916	0
+835	836	918	0
+838	835	918	0
+814	890	889	0
+919	839	838	0
+894	819	884	0
+919	840	839	0
+892	818	891	0
+819	893	891	0
+922	841	840	0
+890	820	895	0
+893	819	894	0
+820	892	895	0
+846	841	923	0
+899	824	888	0
+926	842	843	0
+926	843	845	0
+822	897	896	0
+927	845	844	0
+927	844	846	0
+898	897	823	0
+900	824	899	0
+902	825	901	0
+900	903	826	0
+901	826	903	0
+850	932	849	0
+898	828	907	0
+905	827	902	0
+933	850	851	0
+905	904	827	0
+851	852	933	0
+904	906	828	0
+906	907	828	0
+855	936	854	0
+908	909	830	0
+934	852	863	0
+909	910	830	0
+857	938	855	0
+854	937	859	0
+856	940	857	0
+910	912	831	0
+911	831	912	0
+832	911	913	0
+940	856	862	0
+915	833	913	0
+915	914	833	0
+864	859	942	0
+834	914	917	0
+834	917	916	0
+836	916	918	0
+943	863	864	0
+867	865	945	0
+868	945	865	0
+946	866	867	0
+919	920	840	0
+840	920	921	0
+922	840	921	0
+947	868	869	0
+924	923	841	0
+841	922	925	0
+949	869	871	0
+925	924	841	0
+870	952	871	0
+873	951	870	0
+928	926	845	0
+930	846	923	0
+872	954	873	0
+927	929	845	0
+929	928	845	0
+927	846	930	0
+875	956	876	0
+879	876	956	0
+932	931	849	0
+957	877	878	0
+850	933	932	0
+879	956	880	0
+958	881	877	0
+959	878	880	0
+935	933	852	0
+852	934	935	0
+936	937	854	0
+881	964	883	0
+855	939	936	0
+965	882	883	0
+855	938	939	0
+882	966	884	0
+938	857	940	0
+937	941	859	0
+934	863	944	0
+859	941	942	0
+888	887	969	0
+968	894	884	0
+864	942	943	0
+863	943	944	0
+891	970	892	0
+893	970	891	0
+888	969	899	0
+895	892	970	0
+945	946	867	0
+945	868	947	0
+896	897	972	0
+947	869	950	0
+869	949	948	0
+898	972	897	0
+869	948	950	0
+899	973	900	0
+871	953	949	0
+952	870	951	0
+871	952	953	0
+907	972	898	0
+900	974	903	0
+873	954	951	0
+975	902	901	0
+903	976	901	0
+875	955	956	0
+902	979	905	0
+958	877	957	0
+904	905	983	0
+904	982	906	0
+960	957	878	0
+878	959	960	0
+880	956	963	0
+880	962	959	0
+985	909	908	0
+881	958	964	0
+880	961	962	0
+880	963	961	0
+909	986	910	0
+910	987	912	0
+912	989	911	0
+913	911	988	0
+882	965	966	0
+883	964	967	0
+965	883	967	0
+884	966	968	0
+992	915	913	0
+914	915	994	0
+993	917	914	0
+971	894	968	0
+921	920	996	0
+997	922	921	0
+973	899	969	0
+925	922	998	0
+999	923	924	0
+900	973	974	0
+924	925	1000	0
+930	923	999	0
+975	901	976	0
+902	975	978	0
+977	902	978	0
+974	980	903	0
+977	979	902	0
+929	927	1003	0
+1003	927	930	0
+903	981	976	0
+929	1004	928	0
+903	980	981	0
+905	979	984	0
+904	983	982	0
+931	932	1007	0
+983	905	984	0
+1008	932	933	0
+935	1008	933	0
+1009	935	934	0
+985	986	909	0
+987	910	986	0
+1013	937	936	0
+944	1009	934	0
+1012	936	939	0
+988	911	989	0
+912	987	990	0
+989	912	990	0
+941	937	1014	0
+991	913	988	0
+913	991	992	0
+942	941	1016	0
+993	914	994	0
+943	942	1017	0
+995	915	992	0
+994	915	995	0
+1018	944	943	0
+1021	946	945	0
+996	997	921	0
+1022	945	947	0
+922	997	998	0
+1023	947	950	0
+949	1024	948	0
+950	948	1025	0
+1001	999	924	0
+924	1000	1001	0
+998	1002	925	0
+925	1002	1000	0
+1027	949	953	0
+951	1030	952	0
+999	1005	930	0
+1030	951	954	0
+1031	953	952	0
+1003	1004	929	0
+1003	930	1005	0
+1007	1006	931	0
+1035	956	955	0
+932	1008	1007	0
+1037	958	957	0
+1009	1010	935	0
+960	1037	957	0
+935	1011	1008	0
+1036	963	956	0
+1010	1011	935	0
+960	959	1040	0
+958	1039	964	0
+1040	959	962	0
+1013	936	1012	0
+1013	1014	937	0
+962	961	1043	0
+963	1042	961	0
+1039	967	964	0
+1015	941	1014	0
+941	1015	1016	0
+1020	1009	944	0
+1016	1017	942	0
+943	1017	1018	0
+965	1048	966	0
+1048	965	967	0
+1019	944	1018	0
+1020	944	1019	0
+966	1050	968	0
+1021	945	1022	0
+971	968	1053	0
+947	1023	1022	0
+1024	1026	948	0
+1025	948	1026	0
+1027	1024	949	0
+1029	1023	950	0
+1025	1028	950	0
+1056	975	976	0
+1028	1029	950	0
+975	1055	978	0
+1027	953	1033	0
+1031	952	1030	0
+981	1057	976	0
+977	1059	979	0
+978	1060	977	0
+1031	1032	953	0
+1033	953	1032	0
+1034	1035	955	0
+981	980	1064	0
+984	979	1063	0
+1035	1036	956	0
+982	983	1065	0
+984	1065	983	0
+958	1037	1038	0
+958	1038	1039	0
+986	985	1066	0
+960	1041	1037	0
+1066	987	986	0
+960	1040	1041	0
+987	1067	990	0
+988	989	1068	0
+1042	1043	961	0
+1036	1047	963	0
+1045	1040	962	0
+988	1069	991	0
+1044	962	1043	0
+1070	989	990	0
+962	1044	1045	0
+1042	963	1046	0
+1046	963	1047	0
+991	1074	992	0
+1039	1052	967	0
+966	1048	1049	0
+995	992	1076	0
+1049	1050	966	0
+994	1078	993	0
+1048	967	1051	0
+1078	994	995	0
+1051	967	1052	0
+1050	1053	968	0
+1079	997	996	0
+1079	998	997	0
+1054	971	1053	0
+998	1081	1002	0
+999	1001	1082	0
+1000	1084	1001	0
+1002	1083	1000	0
+999	1082	1005	0
+1055	975	1056	0
+1058	1056	976	0
+1058	976	1057	0
+1004	1003	1087	0
+1061	978	1055	0
+977	1060	1059	0
+1005	1088	1003	0
+1060	978	1061	0
+1059	1062	979	0
+981	1064	1057	0
+1062	1063	979	0
+1006	1007	1092	0
+1007	1008	1094	0
+1063	1065	984	0
+1094	1008	1011	0
+1095	1010	1009	0
+1011	1010	1096	0
+987	1066	1067	0
+1020	1095	1009	0
+1100	1013	1012	0
+1069	988	1068	0
+1014	1013	1100	0
+1068	989	1071	0
+1067	1072	990	0
+1014	1101	1015	0
+1070	1071	989	0
+1073	1070	990	0
+1015	1103	1016	0
+1072	1073	990	0
+1075	991	1069	0
+1104	1017	1016	0
+1104	1018	1017	0
+1075	1074	991	0
+1019	1018	1104	0
+1077	992	1074	0
+1077	1076	992	0
+1020	1019	1106	0
+1078	995	1076	0
+1022	1109	1021	0
+1022	1023	1110	0
+998	1079	1080	0
+1081	998	1080	0
+1024	1112	1026	0
+1029	1111	1023	0
+1024	1027	1112	0
+1025	1026	1113	0
+1025	1113	1028	0
+1083	1084	1000	0
+1001	1085	1082	0
+1002	1081	1086	0
+1085	1001	1084	0
+1002	1086	1083	0
+1028	1119	1029	0
+1033	1117	1027	0
+1082	1090	1005	0
+1087	1003	1088	0
+1089	1088	1005	0
+1089	1005	1090	0
+1032	1123	1033	0
+1093	1091	1006	0
+1092	1093	1006	0
+1094	1092	1007	0
+1034	1125	1035	0
+1036	1035	1125	0
+1037	1127	1038	0
+1097	1010	1095	0
+1097	1096	1010	0
+1011	1098	1094	0
+1128	1039	1038	0
+1037	1041	1127	0
+1099	1011	1096	0
+1011	1099	1098	0
+1036	1126	1047	0
+1131	1041	1040	0
+1014	1100	1101	0
+1131	1040	1045	0
+1102	1015	1101	0
+1133	1043	1042	0
+1132	1042	1046	0
+1015	1102	1103	0
+1039	1130	1052	0
+1134	1044	1043	0
+1104	1016	1103	0
+1095	1020	1108	0
+1045	1044	1137	0
+1019	1104	1103	0
+1019	1103	1105	0
+1105	1106	1019	0
+1139	1046	1047	0
+1020	1106	1107	0
+1049	1048	1141	0
+1108	1020	1107	0
+1051	1141	1048	0
+1110	1109	1022	0
+1050	1049	1142	0
+1111	1110	1023	0
+1050	1143	1053	0
+1052	1144	1051	0
+1054	1053	1143	0
+1112	1114	1026	0
+1115	1113	1026	0
+1026	1114	1116	0
+1112	1027	1118	0
+1026	1116	1115	0
+1120	1028	1113	0
+1055	1056	1150	0
+1111	1029	1121	0
+1027	1117	1118	0
+1058	1152	1056	0
+1120	1119	1028	0
+1061	1055	1151	0
+1153	1058	1057	0
+1122	1029	1119	0
+1122	1121	1029	0
+1117	1033	1123	0
+1057	1064	1153	0
+1060	1156	1059	0
+1059	1156	1062	0
+1158	1060	1061	0
+1034	1124	1125	0
+1126	1036	1125	0
+1038	1127	1129	0
+1129	1128	1038	0
+1039	1128	1130	0
+1068	1160	1069	0
+1127	1041	1131	0
+1071	1161	1068	0
+1070	1165	1071	0
+1073	1164	1070	0
+1132	1133	1042	0
+1075	1069	1163	0
+1103	1102	1105	0
+1133	1135	1043	0
+1167	1073	1072	0
+1135	1134	1043	0
+1047	1126	1140	0
+1134	1136	1044	0
+1138	1131	1045	0
+1044	1136	1137	0
+1046	1139	1132	0
+1074	1075	1169	0
+1077	1074	1168	0
+1138	1045	1137	0
+1047	1140	1139	0
+1130	1147	1052	0
+1081	1080	1171	0
+1142	1049	1141	0
+1050	1142	1143	0
+1051	1145	1141	0
+1171	1086	1081	0
+1085	1172	1082	0
+1144	1146	1051	0
+1174	1084	1083	0
+1173	1083	1086	0
+1146	1145	1051	0
+1082	1172	1090	0
+1085	1084	1175	0
+1148	1144	1052	0
+1054	1143	1149	0
+1052	1147	1148	0
+1088	1180	1087	0
+1055	1150	1151	0
+1089	1180	1088	0
+1152	1150	1056	0
+1089	1090	1181	0
+1154	1152	1058	0
+1058	1153	1155	0
+1155	1154	1058	0
+1093	1185	1091	0
+1159	1061	1151	0
+1186	1093	1092	0
+1092	1094	1186	0
+1157	1156	1060	0
+1158	1157	1060	0
+1159	1158	1061	0
+1094	1098	1188	0
+1095	1189	1097	0
+1096	1097	1190	0
+1099	1096	1190	0
+1191	1098	1099	0
+1161	1160	1068	0
+1162	1069	1160	0
+1095	1108	1189	0
+1163	1069	1162	0
+1129	1127	1138	0
+1138	1127	1131	0
+1071	1166	1161	0
+1165	1070	1164	0
+1071	1165	1166	0
+1167	1164	1073	0
+1105	1195	1106	0
+1075	1163	1170	0
+1106	1197	1107	0
+1168	1074	1169	0
+1107	1198	1108	0
+1170	1169	1075	0
+1109	1110	1201	0
+1111	1201	1110	0
+1114	1112	1202	0
+1173	1174	1083	0
+1113	1115	1203	0
+1118	1202	1112	0
+1121	1201	1111	0
+1172	1085	1177	0
+1116	1114	1204	0
+1084	1174	1176	0
+1084	1176	1175	0
+1171	1178	1086	0
+1205	1115	1116	0
+1113	1203	1120	0
+1177	1085	1175	0
+1179	1173	1086	0
+1208	1118	1117	0
+1086	1178	1179	0
+1172	1183	1090	0
+1208	1117	1123	0
+1211	1119	1120	0
+1181	1180	1089	0
+1119	1211	1122	0
+1182	1181	1090	0
+1183	1182	1090	0
+1184	1091	1185	0
+1214	1125	1124	0
+1093	1187	1185	0
+1125	1216	1126	0
+1093	1186	1187	0
+1186	1094	1188	0
+1218	1128	1129	0
+1128	1218	1130	0
+1189	1190	1097	0
+1192	1188	1098	0
+1098	1191	1192	0
+1099	1190	1193	0
+1140	1126	1217	0
+1191	1099	1194	0
+1099	1193	1194	0
+1133	1132	1222	0
+1138	1220	1129	0
+1133	1224	1135	0
+1139	1221	1132	0
+1135	1225	1134	0
+1137	1220	1138	0
+1136	1134	1226	0
+1196	1106	1195	0
+1189	1108	1200	0
+1196	1197	1106	0
+1137	1136	1229	0
+1197	1199	1107	0
+1107	1199	1198	0
+1200	1108	1198	0
+1140	1232	1139	0
+1142	1141	1235	0
+1114	1202	1204	0
+1143	1142	1236	0
+1145	1235	1141	0
+1205	1203	1115	0
+1116	1204	1206	0
+1207	1205	1116	0
+1116	1206	1207	0
+1149	1143	1237	0
+1144	1239	1146	0
+1238	1144	1148	0
+1210	1202	1118	0
+1146	1240	1145	0
+1118	1208	1209	0
+1203	1213	1120	0
+1118	1209	1210	0
+1148	1147	1243	0
+1211	1120	1212	0
+1212	1120	1213	0
+1246	1151	1150	0
+1245	1150	1152	0
+1215	1214	1124	0
+1152	1154	1248	0
+1214	1216	1125	0
+1151	1247	1159	0
+1153	1249	1155	0
+1216	1217	1126	0
+1155	1251	1154	0
+1219	1218	1129	0
+1219	1129	1220	0
+1255	1157	1158	0
+1159	1256	1158	0
+1222	1132	1221	0
+1223	1133	1222	0
+1133	1223	1224	0
+1161	1260	1160	0
+1162	1160	1259	0
+1256	1161	1166	0
+1225	1226	1134	0
+1227	1135	1224	0
+1162	1261	1163	0
+1135	1228	1225	0
+1137	1231	1220	0
+1228	1135	1227	0
+1140	1217	1234	0
+1230	1136	1226	0
+1232	1221	1139	0
+1265	1165	1164	0
+1230	1229	1136	0
+1167	1265	1164	0
+1263	1170	1163	0
+1231	1137	1229	0
+1165	1266	1166	0
+1232	1140	1233	0
+1169	1269	1168	0
+1140	1234	1233	0
+1269	1169	1170	0
+1235	1236	1142	0
+1236	1237	1143	0
+1173	1272	1174	0
+1177	1270	1172	0
+1235	1145	1241	0
+1239	1144	1238	0
+1271	1173	1179	0
+1174	1274	1176	0
+1270	1183	1172	0
+1175	1176	1275	0
+1241	1145	1240	0
+1275	1177	1175	0
+1239	1242	1146	0
+1146	1242	1240	0
+1148	1243	1238	0
+1237	1244	1149	0
+1179	1178	1278	0
+1150	1245	1246	0
+1246	1247	1151	0
+1183	1279	1182	0
+1245	1152	1248	0
+1184	1185	1281	0
+1154	1250	1248	0
+1282	1185	1187	0
+1250	1154	1251	0
+1187	1186	1283	0
+1252	1155	1249	0
+1188	1283	1186	0
+1251	1155	1253	0
+1252	1253	1155	0
+1257	1159	1247	0
+1285	1188	1192	0
+1254	1157	1255	0
+1287	1190	1189	0
+1158	1256	1255	0
+1231	1219	1220	0
+1190	1288	1193	0
+1159	1258	1256	0
+1290	1192	1191	0
+1159	1257	1258	0
+1191	1194	1289	0
+1256	1258	1161	0
+1200	1286	1189	0
+1161	1258	1260	0
+1259	1160	1260	0
+1194	1193	1294	0
+1262	1162	1259	0
+1261	1162	1262	0
+1195	1296	1196	0
+1163	1261	1264	0
+1163	1264	1263	0
+1256	1166	1268	0
+1297	1197	1196	0
+1197	1298	1199	0
+1266	1165	1265	0
+1199	1299	1198	0
+1300	1200	1198	0
+1266	1267	1166	0
+1268	1166	1267	0
+1170	1263	1269	0
+1202	1304	1204	0
+1306	1203	1205	0
+1272	1173	1271	0
+1202	1210	1304	0
+1206	1204	1308	0
+1205	1207	1306	0
+1272	1273	1174	0
+1305	1213	1203	0
+1274	1174	1273	0
+1207	1206	1309	0
+1177	1277	1270	0
+1176	1274	1276	0
+1176	1276	1275	0
+1278	1271	1179	0
+1275	1277	1177	0
+1313	1210	1209	0
+1270	1279	1183	0
+1213	1314	1212	0
+1215	1315	1214	0
+1281	1280	1184	0
+1214	1315	1216	0
+1282	1281	1185	0
+1216	1318	1217	0
+1284	1282	1187	0
+1283	1284	1187	0
+1188	1285	1283	0
+1189	1286	1287	0
+1221	1320	1222	0
+1287	1288	1190	0
+1222	1322	1223	0
+1192	1292	1285	0
+1217	1319	1234	0
+1291	1191	1289	0
+1324	1224	1223	0
+1291	1290	1191	0
+1321	1221	1232	0
+1192	1290	1293	0
+1227	1224	1324	0
+1288	1294	1193	0
+1325	1226	1225	0
+1293	1292	1192	0
+1254	1255	1268	0
+1289	1194	1295	0
+1325	1225	1228	0
+1256	1268	1255	0
+1226	1325	1230	0
+1294	1295	1194	0
+1196	1296	1297	0
+1254	1268	1267	0
+1303	1286	1200	0
+1232	1233	1326	0
+1298	1197	1297	0
+1327	1233	1234	0
+1299	1300	1198	0
+1299	1199	1301	0
+1298	1302	1199	0
+1330	1236	1235	0
+1301	1199	1302	0
+1303	1200	1300	0
+1331	1237	1236	0
+1235	1241	1330	0
+1238	1333	1239	0
+1237	1331	1244	0
+1333	1238	1243	0
+1305	1203	1306	0
+1239	1334	1242	0
+1304	1307	1204	0
+1336	1241	1240	0
+1242	1335	1240	0
+1204	1307	1308	0
+1310	1206	1308	0
+1207	1311	1306	0
+1310	1309	1206	0
+1304	1210	1313	0
+1309	1312	1207	0
+1207	1312	1311	0
+1314	1213	1305	0
+1245	1342	1246	0
+1245	1248	1343	0
+1247	1246	1345	0
+1347	1248	1250	0
+1215	1317	1315	0
+1316	1317	1215	0
+1216	1315	1318	0
+1247	1345	1257	0
+1249	1348	1252	0
+1251	1350	1250	0
+1318	1319	1217	0
+1253	1351	1251	0
+1252	1352	1253	0
+1321	1320	1221	0
+1323	1222	1320	0
+1322	1222	1323	0
+1258	1257	1354	0
+1324	1223	1322	0
+1354	1260	1258	0
+1259	1260	1355	0
+1259	1355	1262	0
+1262	1356	1261	0
+1326	1321	1232	0
+1356	1264	1261	0
+1319	1328	1234	0
+1233	1327	1326	0
+1329	1327	1234	0
+1328	1329	1234	0
+1330	1332	1236	0
+1331	1236	1332	0
+1361	1272	1271	0
+1334	1239	1333	0
+1277	1360	1270	0
+1362	1273	1272	0
+1279	1270	1359	0
+1330	1241	1337	0
+1278	1361	1271	0
+1335	1336	1240	0
+1365	1274	1273	0
+1241	1336	1338	0
+1334	1339	1242	0
+1338	1337	1241	0
+1244	1331	1341	0
+1367	1276	1274	0
+1340	1335	1242	0
+1369	1275	1276	0
+1368	1277	1275	0
+1242	1339	1340	0
+1342	1245	1343	0
+1246	1342	1346	0
+1281	1373	1280	0
+1345	1246	1344	0
+1282	1373	1281	0
+1346	1344	1246	0
+1248	1347	1343	0
+1374	1282	1284	0
+1376	1284	1283	0
+1376	1283	1285	0
+1347	1250	1349	0
+1349	1250	1350	0
+1251	1351	1350	0
+1348	1352	1252	0
+1286	1381	1287	0
+1354	1257	1345	0
+1292	1379	1285	0
+1253	1353	1351	0
+1353	1253	1352	0
+1383	1288	1287	0
+1289	1384	1291	0
+1290	1291	1385	0
+1385	1293	1290	0
+1289	1295	1384	0
+1260	1354	1355	0
+1303	1382	1286	0
+1388	1292	1293	0
+1356	1262	1357	0
+1355	1358	1262	0
+1357	1262	1358	0
+1391	1297	1296	0
+1298	1297	1391	0
+1359	1270	1360	0
+1392	1302	1298	0
+1393	1300	1299	0
+1301	1394	1299	0
+1362	1272	1361	0
+1362	1363	1273	0
+1300	1395	1303	0
+1396	1301	1302	0
+1364	1273	1363	0
+1365	1273	1364	0
+1331	1332	1341	0
+1365	1366	1274	0
+1367	1274	1366	0
+1277	1371	1360	0
+1307	1304	1401	0
+1275	1369	1368	0
+1402	1305	1306	0
+1370	1276	1367	0
+1276	1370	1369	0
+1368	1371	1277	0
+1313	1400	1304	0
+1308	1307	1404	0
+1403	1306	1311	0
+1305	1402	1314	0
+1310	1308	1405	0
+1280	1373	1372	0
+1309	1310	1407	0
+1309	1406	1312	0
+1282	1375	1373	0
+1282	1374	1375	0
+1312	1409	1311	0
+1378	1374	1284	0
+1376	1377	1284	0
+1284	1377	1378	0
+1285	1380	1376	0
+1380	1285	1379	0
+1317	1412	1315	0
+1412	1318	1315	0
+1414	1317	1316	0
+1382	1381	1286	0
+1383	1287	1381	0
+1318	1416	1319	0
+1292	1387	1379	0
+1320	1321	1420	0
+1386	1291	1384	0
+1323	1320	1419	0
+1291	1386	1385	0
+1417	1328	1319	0
+1292	1388	1387	0
+1390	1293	1385	0
+1421	1321	1326	0
+1293	1389	1388	0
+1390	1389	1293	0
+1327	1423	1326	0
+1327	1329	1424	0
+1303	1395	1382	0
+1392	1298	1391	0
+1329	1328	1426	0
+1393	1299	1394	0
+1393	1395	1300	0
+1332	1330	1429	0
+1392	1398	1302	0
+1397	1394	1301	0
+1396	1397	1301	0
+1337	1429	1330	0
+1396	1302	1399	0
+1399	1302	1398	0
+1430	1341	1332	0
+1335	1433	1336	0
+1400	1401	1304	0
+1340	1432	1335	0
+1434	1338	1336	0
+1403	1402	1306	0
+1338	1437	1337	0
+1401	1404	1307	0
+1404	1405	1308	0
+1340	1339	1439	0
+1309	1407	1406	0
+1405	1408	1310	0
+1311	1409	1403	0
+1440	1342	1343	0
+1407	1310	1408	0
+1342	1440	1346	0
+1406	1411	1312	0
+1343	1347	1441	0
+1409	1312	1410	0
+1344	1442	1345	0
+1346	1443	1344	0
+1380	1377	1376	0
+1410	1312	1411	0
+1354	1345	1442	0
+1349	1445	1347	0
+1316	1413	1414	0
+1415	1412	1317	0
+1416	1318	1412	0
+1317	1414	1415	0
+1447	1352	1348	0
+1449	1349	1350	0
+1351	1450	1350	0
+1447	1353	1352	0
+1319	1416	1418	0
+1417	1319	1418	0
+1351	1353	1452	0
+1419	1320	1420	0
+1385	1386	1390	0
+1421	1420	1321	0
+1454	1355	1354	0
+1355	1454	1358	0
+1326	1422	1421	0
+1455	1357	1358	0
+1425	1328	1417	0
+1423	1422	1326	0
+1423	1327	1424	0
+1456	1359	1360	0
+1328	1425	1426	0
+1329	1427	1424	0
+1426	1428	1329	0
+1364	1363	1457	0
+1329	1428	1427	0
+1371	1456	1360	0
+1364	1458	1365	0
+1365	1459	1366	0
+1429	1431	1332	0
+1460	1367	1366	0
+1430	1332	1431	0
+1367	1461	1370	0
+1433	1335	1432	0
+1369	1464	1368	0
+1429	1337	1436	0
+1371	1368	1464	0
+1369	1370	1465	0
+1336	1433	1435	0
+1336	1435	1434	0
+1438	1338	1434	0
+1337	1437	1436	0
+1340	1439	1432	0
+1438	1437	1338	0
+1470	1372	1373	0
+1470	1373	1375	0
+1375	1374	1472	0
+1441	1440	1343	0
+1374	1378	1471	0
+1442	1344	1443	0
+1444	1346	1440	0
+1378	1377	1475	0
+1380	1474	1377	0
+1443	1346	1444	0
+1441	1347	1446	0
+1347	1445	1446	0
+1380	1379	1481	0
+1445	1349	1448	0
+1387	1479	1379	0
+1483	1381	1382	0
+1448	1349	1449	0
+1381	1483	1383	0
+1450	1449	1350	0
+1454	1354	1442	0
+1450	1351	1451	0
+1453	1353	1447	0
+1351	1452	1451	0
+1453	1452	1353	0
+1388	1486	1387	0
+1395	1485	1382	0
+1486	1388	1389	0
+1455	1358	1454	0
+1463	1405	1404	0
+1487	1393	1394	0
+1393	1488	1395	0
+1457	1458	1364	0
+1490	1394	1397	0
+1459	1365	1458	0
+1366	1459	1460	0
+1396	1493	1397	0
+1399	1492	1396	0
+1367	1460	1462	0
+1463	1461	1367	0
+1398	1495	1399	0
+1462	1463	1367	0
+1466	1456	1371	0
+1461	1465	1370	0
+1400	1496	1401	0
+1464	1369	1465	0
+1401	1496	1404	0
+1464	1467	1371	0
+1467	1466	1371	0
+1498	1408	1405	0
+1468	1372	1469	0
+1372	1470	1469	0
+1499	1406	1407	0
+1500	1407	1408	0
+1411	1406	1499	0
+1472	1374	1471	0
+1375	1473	1470	0
+1375	1472	1473	0
+1502	1409	1410	0
+1411	1504	1410	0
+1378	1478	1471	0
+1377	1474	1476	0
+1377	1476	1475	0
+1378	1475	1477	0
+1378	1477	1478	0
+1507	1412	1415	0
+1507	1416	1412	0
+1414	1413	1509	0
+1482	1474	1380	0
+1379	1479	1480	0
+1414	1510	1415	0
+1379	1480	1481	0
+1416	1507	1418	0
+1380	1481	1482	0
+1417	1418	1513	0
+1382	1484	1483	0
+1484	1382	1485	0
+1479	1387	1486	0
+1425	1417	1512	0
+1515	1419	1420	0
+1515	1420	1421	0
+1421	1422	1515	0
+1516	1423	1424	0
+1463	1404	1497	0
+1463	1498	1405	0
+1488	1393	1487	0
+1485	1395	1488	0
+1427	1517	1424	0
+1426	1425	1519	0
+1487	1394	1491	0
+1394	1490	1489	0
+1394	1489	1491	0
+1521	1428	1426	0
+1428	1523	1427	0
+1397	1494	1490	0
+1493	1396	1492	0
+1397	1493	1494	0
+1399	1495	1492	0
+1429	1526	1431	0
+1431	1527	1430	0
+1436	1526	1429	0
+1432	1528	1433	0
+1435	1433	1529	0
+1496	1497	1404	0
+1435	1530	1434	0
+1528	1432	1439	0
+1434	1531	1438	0
+1407	1500	1499	0
+1498	1501	1408	0
+1437	1534	1436	0
+1408	1501	1500	0
+1535	1437	1438	0
+1503	1502	1410	0
+1411	1499	1506	0
+1504	1503	1410	0
+1538	1440	1441	0
+1505	1504	1411	0
+1444	1440	1537	0
+1411	1506	1505	0
+1462	1498	1463	0
+1541	1442	1443	0
+1539	1441	1446	0
+1443	1444	1543	0
+1508	1509	1413	0
+1510	1414	1509	0
+1415	1511	1507	0
+1445	1545	1446	0
+1415	1510	1511	0
+1454	1442	1540	0
+1448	1546	1445	0
+1514	1418	1507	0
+1513	1512	1417	0
+1513	1418	1514	0
+1449	1548	1448	0
+1549	1449	1450	0
+1454	1540	1455	0
+1451	1550	1450	0
+1551	1451	1452	0
+1425	1512	1518	0
+1516	1424	1517	0
+1453	1553	1452	0
+1501	1498	1462	0
+1425	1518	1520	0
+1425	1520	1519	0
+1522	1426	1519	0
+1523	1517	1427	0
+1521	1426	1522	0
+1457	1555	1458	0
+1555	1459	1458	0
+1525	1428	1521	0
+1524	1523	1428	0
+1556	1460	1459	0
+1525	1524	1428	0
+1558	1462	1460	0
+1463	1559	1461	0
+1527	1431	1526	0
+1465	1461	1559	0
+1464	1465	1560	0
+1529	1433	1528	0
+1560	1467	1464	0
+1467	1561	1466	0
+1530	1531	1434	0
+1529	1532	1435	0
+1534	1526	1436	0
+1435	1533	1530	0
+1533	1435	1532	0
+1468	1469	1563	0
+1564	1469	1470	0
+1438	1531	1536	0
+1534	1437	1535	0
+1470	1473	1564	0
+1471	1566	1472	0
+1535	1438	1536	0
+1472	1568	1473	0
+1478	1565	1471	0
+1440	1538	1537	0
+1441	1539	1538	0
+1497	1559	1463	0
+1501	1462	1558	0
+1571	1476	1474	0
+1476	1572	1475	0
+1541	1540	1442	0
+1475	1572	1477	0
+1537	1544	1444	0
+1443	1542	1541	0
+1474	1482	1571	0
+1543	1542	1443	0
+1543	1444	1544	0
+1576	1478	1477	0
+1507	1511	1514	0
+1547	1539	1446	0
+1546	1545	1445	0
+1547	1446	1545	0
+1481	1480	1578	0
+1482	1481	1578	0
+1448	1548	1546	0
+1549	1548	1449	0
+1549	1450	1550	0
+1484	1485	1580	0
+1552	1550	1451	0
+1488	1580	1485	0
+1551	1552	1451	0
+1452	1554	1551	0
+1582	1488	1487	0
+1554	1452	1553	0
+1581	1487	1491	0
+1584	1489	1490	0
+1491	1489	1585	0
+1556	1459	1555	0
+1587	1490	1494	0
+1556	1557	1460	0
+1460	1557	1558	0
+1492	1590	1493	0
+1590	1492	1495	0
+1591	1494	1493	0
+1559	1560	1465	0
+1496	1594	1497	0
+1560	1561	1467	0
+1468	1563	1562	0
+1500	1596	1499	0
+1563	1469	1564	0
+1501	1597	1500	0
+1596	1506	1499	0
+1567	1471	1565	0
+1567	1566	1471	0
+1503	1601	1502	0
+1566	1569	1472	0
+1564	1473	1570	0
+1569	1568	1472	0
+1602	1503	1504	0
+1568	1570	1473	0
+1505	1603	1504	0
+1505	1506	1604	0
+1565	1478	1577	0
+1476	1573	1572	0
+1574	1476	1571	0
+1574	1573	1476	0
+1575	1477	1572	0
+1509	1508	1608	0
+1608	1510	1509	0
+1575	1576	1477	0
+1511	1510	1609	0
+1478	1576	1577	0
+1482	1579	1571	0
+1511	1611	1514	0
+1513	1613	1512	0
+1578	1579	1482	0
+1514	1614	1513	0
+1518	1512	1612	0
+1615	1516	1517	0
+1487	1581	1582	0
+1583	1580	1488	0
+1595	1559	1497	0
+1582	1583	1488	0
+1616	1520	1518	0
+1615	1517	1523	0
+1618	1519	1520	0
+1519	1617	1522	0
+1558	1600	1501	0
+1584	1586	1489	0
+1585	1489	1586	0
+1589	1581	1491	0
+1587	1584	1490	0
+1521	1522	1620	0
+1585	1588	1491	0
+1620	1525	1521	0
+1588	1589	1491	0
+1623	1523	1524	0
+1624	1524	1525	0
+1587	1494	1593	0
+1591	1493	1590	0
+1591	1592	1494	0
+1593	1494	1592	0
+1526	1627	1527	0
+1595	1497	1594	0
+1534	1628	1526	0
+1530	1630	1531	0
+1629	1530	1533	0
+1500	1598	1596	0
+1500	1597	1599	0
+1598	1500	1599	0
+1501	1600	1597	0
+1533	1532	1633	0
+1536	1531	1631	0
+1534	1535	1634	0
+1536	1635	1535	0
+1602	1601	1503	0
+1606	1506	1596	0
+1603	1602	1504	0
+1638	1537	1538	0
+1603	1505	1605	0
+1605	1505	1604	0
+1559	1595	1560	0
+1606	1604	1506	0
+1539	1640	1538	0
+1537	1639	1544	0
+1572	1573	1575	0
+1642	1540	1541	0
+1508	1607	1608	0
+1571	1579	1574	0
+1542	1643	1541	0
+1609	1510	1608	0
+1542	1543	1644	0
+1511	1609	1610	0
+1611	1511	1610	0
+1646	1543	1544	0
+1612	1512	1613	0
+1611	1614	1514	0
+1546	1648	1545	0
+1545	1648	1547	0
+1613	1513	1614	0
+1548	1650	1546	0
+1518	1612	1616	0
+1549	1651	1548	0
+1652	1549	1550	0
+1618	1617	1519	0
+1616	1619	1520	0
+1552	1654	1550	0
+1618	1520	1619	0
+1621	1522	1617	0
+1523	1622	1615	0
+1551	1657	1552	0
+1554	1656	1551	0
+1621	1620	1522	0
+1553	1660	1554	0
+1622	1523	1623	0
+1524	1624	1623	0
+1525	1620	1626	0
+1624	1525	1625	0
+1525	1626	1625	0
+1557	1662	1558	0
+1526	1628	1627	0
+1561	1560	1663	0
+1630	1530	1629	0
+1563	1665	1562	0
+1666	1563	1564	0
+1630	1632	1531	0
+1631	1531	1632	0
+1633	1629	1533	0
+1534	1634	1628	0
+1667	1567	1565	0
+1570	1666	1564	0
+1669	1566	1567	0
+1566	1668	1569	0
+1634	1535	1635	0
+1536	1631	1637	0
+1635	1536	1636	0
+1667	1565	1577	0
+1636	1536	1637	0
+1568	1569	1672	0
+1570	1568	1672	0
+1638	1639	1537	0
+1641	1638	1538	0
+1663	1560	1595	0
+1641	1538	1640	0
+1600	1558	1662	0
+1576	1675	1577	0
+1643	1642	1541	0
+1645	1643	1542	0
+1639	1647	1544	0
+1644	1645	1542	0
+1644	1543	1646	0
+1647	1646	1544	0
+1582	1581	1679	0
+1648	1546	1649	0
+1583	1582	1680	0
+1649	1546	1650	0
+1678	1581	1589	0
+1650	1548	1651	0
+1681	1586	1584	0
+1663	1595	1594	0
+1651	1549	1652	0
+1584	1587	1681	0
+1586	1682	1585	0
+1682	1588	1585	0
+1654	1653	1550	0
+1652	1550	1655	0
+1550	1653	1655	0
+1654	1552	1658	0
+1657	1551	1656	0
+1588	1688	1589	0
+1593	1686	1587	0
+1552	1657	1659	0
+1552	1659	1658	0
+1660	1656	1554	0
+1592	1692	1593	0
+1661	1662	1557	0
+1596	1598	1693	0
+1599	1597	1694	0
+1664	1562	1665	0
+1597	1600	1694	0
+1696	1598	1599	0
+1665	1563	1666	0
+1693	1606	1596	0
+1566	1669	1668	0
+1601	1602	1701	0
+1567	1667	1671	0
+1670	1669	1567	0
+1603	1703	1602	0
+1567	1671	1670	0
+1674	1666	1570	0
+1673	1569	1668	0
+1605	1703	1603	0
+1606	1704	1604	0
+1672	1569	1673	0
+1705	1605	1604	0
+1570	1672	1674	0
+1577	1677	1667	0
+1607	1709	1608	0
+1609	1608	1710	0
+1675	1676	1577	0
+1677	1577	1676	0
+1610	1609	1711	0
+1611	1610	1714	0
+1678	1679	1581	0
+1715	1614	1611	0
+1680	1582	1679	0
+1715	1613	1614	0
+1617	1618	1716	0
+1681	1685	1586	0
+1682	1586	1684	0
+1586	1683	1684	0
+1685	1683	1586	0
+1621	1617	1717	0
+1618	1619	1718	0
+1687	1681	1587	0
+1678	1589	1690	0
+1689	1588	1682	0
+1587	1686	1687	0
+1620	1621	1720	0
+1700	1600	1662	0
+1719	1626	1620	0
+1689	1688	1588	0
+1623	1722	1622	0
+1691	1589	1688	0
+1722	1623	1624	0
+1691	1690	1589	0
+1686	1593	1692	0
+1723	1624	1625	0
+1626	1724	1625	0
+1627	1628	1727	0
+1695	1693	1598	0
+1728	1630	1629	0
+1696	1695	1598	0
+1634	1727	1628	0
+1599	1694	1697	0
+1629	1633	1728	0
+1630	1729	1632	0
+1696	1599	1698	0
+1631	1632	1730	0
+1600	1699	1694	0
+1698	1599	1697	0
+1631	1730	1637	0
+1600	1700	1699	0
+1734	1634	1635	0
+1701	1602	1702	0
+1735	1635	1636	0
+1707	1606	1693	0
+1703	1702	1602	0
+1636	1637	1736	0
+1704	1705	1604	0
+1706	1703	1605	0
+1706	1605	1705	0
+1707	1704	1606	0
+1638	1741	1639	0
+1641	1740	1638	0
+1700	1662	1661	0
+1607	1708	1709	0
+1641	1640	1744	0
+1709	1710	1608	0
+1647	1639	1742	0
+1643	1745	1642	0
+1712	1609	1710	0
+1712	1711	1609	0
+1645	1745	1643	0
+1610	1711	1713	0
+1644	1746	1645	0
+1646	1746	1644	0
+1713	1714	1610	0
+1715	1611	1714	0
+1749	1646	1647	0
+1716	1717	1617	0
+1752	1649	1650	0
+1716	1618	1718	0
+1752	1650	1651	0
+1754	1651	1652	0
+1717	1721	1621	0
+1720	1719	1620	0
+1755	1652	1655	0
+1720	1621	1721	0
+1653	1654	1756	0
+1655	1653	1757	0
+1756	1654	1658	0
+1723	1722	1624	0
+1719	1726	1626	0
+1625	1724	1723	0
+1760	1657	1656	0
+1626	1725	1724	0
+1656	1660	1760	0
+1725	1626	1726	0
+1761	1659	1657	0
+1763	1658	1659	0
+1729	1630	1728	0
+1729	1731	1632	0
+1632	1732	1730	0
+1733	1727	1634	0
+1732	1632	1731	0
+1665	1768	1664	0
+1666	1769	1665	0
+1634	1734	1733	0
+1635	1735	1734	0
+1739	1637	1730	0
+1636	1737	1735	0
+1667	1771	1671	0
+1737	1636	1736	0
+1674	1770	1666	0
+1773	1668	1669	0
+1637	1738	1736	0
+1772	1673	1668	0
+1669	1670	1774	0
+1739	1738	1637	0
+1677	1771	1667	0
+1671	1776	1670	0
+1741	1638	1740	0
+1639	1741	1743	0
+1672	1673	1778	0
+1743	1742	1639	0
+1674	1672	1778	0
+1744	1740	1641	0
+1661	1766	1700	0
+1675	1781	1676	0
+1782	1677	1676	0
+1745	1645	1747	0
+1746	1748	1645	0
+1750	1647	1742	0
+1747	1645	1748	0
+1784	1679	1678	0
+1749	1746	1646	0
+1679	1784	1680	0
+1749	1647	1751	0
+1647	1750	1751	0
+1685	1681	1785	0
+1690	1784	1678	0
+1682	1684	1786	0
+1687	1785	1681	0
+1787	1684	1683	0
+1753	1752	1651	0
+1683	1685	1788	0
+1682	1786	1689	0
+1651	1754	1753	0
+1652	1755	1754	0
+1790	1687	1686	0
+1653	1756	1757	0
+1790	1686	1692	0
+1759	1755	1655	0
+1688	1689	1793	0
+1757	1758	1655	0
+1758	1759	1655	0
+1691	1688	1793	0
+1658	1762	1756	0
+1658	1763	1762	0
+1761	1657	1760	0
+1761	1764	1659	0
+1695	1796	1693	0
+1765	1763	1659	0
+1765	1659	1764	0
+1694	1798	1697	0
+1696	1800	1695	0
+1799	1694	1699	0
+1696	1698	1800	0
+1707	1693	1797	0
+1801	1698	1697	0
+1768	1767	1664	0
+1665	1769	1768	0
+1699	1700	1804	0
+1666	1770	1769	0
+1807	1701	1702	0
+1703	1808	1702	0
+1668	1773	1772	0
+1706	1808	1703	0
+1669	1775	1773	0
+1669	1774	1775	0
+1705	1704	1810	0
+1777	1671	1771	0
+1707	1809	1704	0
+1776	1774	1670	0
+1777	1776	1671	0
+1780	1770	1674	0
+1706	1705	1813	0
+1779	1673	1772	0
+1779	1778	1673	0
+1677	1783	1771	0
+1778	1780	1674	0
+1817	1709	1708	0
+1709	1818	1710	0
+1676	1781	1782	0
+1710	1819	1712	0
+1783	1677	1782	0
+1711	1712	1821	0
+1711	1820	1713	0
+1717	1716	1823	0
+1786	1684	1787	0
+1718	1823	1716	0
+1787	1683	1788	0
+1785	1789	1685	0
+1824	1721	1717	0
+1788	1685	1789	0
+1792	1785	1687	0
+1828	1719	1720	0
+1687	1790	1791	0
+1687	1791	1792	0
+1786	1795	1689	0
+1720	1721	1830	0
+1806	1700	1766	0
+1719	1827	1726	0
+1793	1689	1794	0
+1794	1689	1795	0
+1726	1832	1725	0
+1693	1796	1797	0
+1694	1799	1798	0
+1732	1833	1730	0
+1798	1801	1697	0
+1732	1731	1835	0
+1802	1800	1698	0
+1801	1803	1698	0
+1802	1698	1803	0
+1799	1699	1805	0
+1739	1730	1834	0
+1733	1734	1836	0
+1734	1735	1837	0
+1804	1805	1699	0
+1806	1804	1700	0
+1737	1838	1735	0
+1737	1736	1839	0
+1840	1736	1738	0
+1807	1702	1808	0
+1797	1815	1707	0
+1738	1739	1843	0
+1704	1809	1811	0
+1811	1810	1704	0
+1812	1705	1810	0
+1808	1706	1814	0
+1848	1741	1740	0
+1705	1812	1813	0
+1809	1707	1815	0
+1740	1744	1848	0
+1741	1849	1743	0
+1814	1706	1813	0
+1742	1743	1850	0
+1817	1708	1816	0
+1851	1750	1742	0
+1817	1818	1709	0
+1710	1818	1819	0
+1748	1746	1854	0
+1749	1854	1746	0
+1855	1747	1748	0
+1821	1820	1711	0
+1712	1819	1822	0
+1822	1821	1712	0
+1856	1749	1751	0
+1857	1751	1750	0
+1717	1823	1825	0
+1754	1859	1753	0
+1717	1825	1824	0
+1823	1718	1826	0
+1754	1755	1860	0
+1827	1719	1828	0
+1861	1755	1759	0
+1757	1756	1862	0
+1721	1824	1831	0
+1720	1829	1828	0
+1863	1758	1757	0
+1829	1720	1830	0
+1756	1762	1862	0
+1758	1864	1759	0
+1830	1721	1831	0
+1827	1832	1726	0
+1762	1763	1869	0
+1834	1730	1833	0
+1763	1765	1870	0
+1732	1835	1833	0
+1764	1872	1765	0
+1836	1734	1837	0
+1875	1767	1768	0
+1838	1837	1735	0
+1876	1768	1769	0
+1736	1840	1839	0
+1838	1737	1842	0
+1839	1841	1737	0
+1769	1770	1878	0
+1841	1842	1737	0
+1739	1834	1847	0
+1738	1845	1840	0
+1844	1738	1843	0
+1881	1772	1773	0
+1845	1738	1844	0
+1846	1843	1739	0
+1771	1880	1777	0
+1770	1780	1879	0
+1882	1773	1775	0
+1779	1772	1881	0
+1847	1846	1739	0
+1884	1775	1774	0
+1883	1774	1776	0
+1783	1880	1771	0
+1849	1741	1848	0
+1887	1776	1777	0
+1850	1851	1742	0
+1849	1852	1743	0
+1766	1873	1806	0
+1853	1850	1743	0
+1889	1778	1779	0
+1780	1778	1889	0
+1853	1743	1852	0
+1891	1782	1781	0
+1891	1783	1782	0
+1855	1748	1854	0
+1854	1749	1856	0
+1851	1857	1750	0
+1858	1856	1751	0
+1858	1751	1857	0
+1789	1785	1893	0
+1895	1786	1787	0
+1785	1792	1893	0
+1787	1788	1896	0
+1859	1754	1860	0
+1898	1788	1789	0
+1894	1795	1786	0
+1861	1860	1755	0
+1863	1757	1862	0
+1899	1792	1791	0
+1865	1758	1863	0
+1861	1759	1866	0
+1865	1864	1758	0
+1795	1900	1794	0
+1867	1759	1864	0
+1867	1866	1759	0
+1862	1762	1868	0
+1797	1796	1901	0
+1762	1869	1868	0
+1798	1799	1903	0
+1801	1798	1902	0
+1871	1869	1763	0
+1763	1870	1871	0
+1872	1870	1765	0
+1905	1799	1805	0
+1906	1803	1801	0
+1907	1802	1803	0
+1901	1815	1797	0
+1767	1875	1874	0
+1804	1909	1805	0
+1908	1804	1806	0
+1768	1876	1875	0
+1876	1769	1877	0
+1877	1769	1878	0
+1911	1807	1808	0
+1878	1770	1879	0
+1913	1811	1809	0
+1912	1808	1814	0
+1810	1811	1915	0
+1881	1773	1882	0
+1914	1809	1815	0
+1916	1812	1810	0
+1883	1884	1774	0
+1775	1885	1882	0
+1919	1813	1812	0
+1888	1777	1880	0
+1884	1886	1775	0
+1887	1883	1776	0
+1886	1885	1775	0
+1920	1814	1813	0
+1780	1890	1879	0
+1887	1777	1888	0
+1783	1892	1880	0
+1816	1923	1817	0
+1817	1923	1818	0
+1889	1890	1780	0
+1819	1818	1924	0
+1822	1819	1925	0
+1892	1783	1891	0
+1820	1821	1926	0
+1926	1821	1822	0
+1786	1895	1894	0
+1823	1930	1825	0
+1896	1895	1787	0
+1823	1826	1929	0
+1893	1898	1789	0
+1897	1896	1788	0
+1825	1932	1824	0
+1788	1898	1897	0
+1893	1792	1899	0
+1931	1831	1824	0
+1873	1908	1806	0
+1828	1934	1827	0
+1795	1894	1900	0
+1832	1827	1934	0
+1936	1828	1829	0
+1937	1829	1830	0
+1939	1830	1831	0
+1902	1798	1903	0
+1799	1904	1903	0
+1799	1905	1904	0
+1942	1834	1833	0
+1902	1906	1801	0
+1942	1833	1835	0
+1906	1907	1803	0
+1837	1944	1836	0
+1837	1838	1944	0
+1805	1910	1905	0
+1909	1804	1908	0
+1944	1838	1842	0
+1840	1945	1839	0
+1909	1910	1805	0
+1834	1943	1847	0
+1841	1839	1945	0
+1901	1914	1815	0
+1840	1845	1946	0
+1912	1911	1808	0
+1843	1947	1844	0
+1913	1809	1914	0
+1843	1846	1948	0
+1844	1949	1845	0
+1915	1916	1810	0
+1913	1917	1811	0
+1918	1915	1811	0
+1811	1917	1918	0
+1847	1953	1846	0
+1916	1919	1812	0
+1814	1921	1912	0
+1920	1813	1919	0
+1921	1814	1920	0
+1850	1958	1851	0
+1853	1957	1850	0
+1922	1923	1816	0
+1923	1924	1818	0
+1853	1852	1961	0
+1959	1857	1851	0
+1819	1924	1925	0
+1962	1855	1854	0
+1963	1854	1856	0
+1926	1822	1927	0
+1925	1928	1822	0
+1822	1928	1927	0
+1964	1856	1858	0
+1857	1965	1858	0
+1930	1823	1929	0
+1931	1824	1932	0
+1859	1860	1969	0
+1930	1933	1825	0
+1825	1933	1932	0
+1861	1969	1860	0
+1862	1970	1863	0
+1866	1969	1861	0
+1935	1934	1828	0
+1935	1828	1936	0
+1863	1971	1865	0
+1868	1970	1862	0
+1864	1865	1972	0
+1829	1937	1936	0
+1972	1867	1864	0
+1931	1941	1831	0
+1937	1830	1938	0
+1939	1938	1830	0
+1940	1939	1831	0
+1941	1940	1831	0
+1975	1868	1869	0
+1871	1976	1869	0
+1977	1871	1870	0
+1977	1870	1872	0
+1834	1942	1943	0
+1874	1875	1982	0
+1945	1840	1946	0
+1982	1875	1876	0
+1877	1983	1876	0
+1948	1947	1843	0
+1985	1877	1878	0
+1844	1947	1950	0
+1952	1946	1845	0
+1950	1949	1844	0
+1879	1987	1878	0
+1951	1845	1949	0
+1847	1943	1955	0
+1952	1845	1951	0
+1948	1846	1954	0
+1953	1954	1846	0
+1987	1879	1890	0
+1956	1953	1847	0
+1989	1888	1880	0
+1956	1847	1955	0
+1884	1883	1991	0
+1990	1883	1887	0
+1988	1880	1892	0
+1980	1908	1873	0
+1886	1884	1993	0
+1885	1886	1994	0
+1958	1850	1957	0
+1851	1958	1960	0
+1959	1851	1960	0
+1961	1957	1853	0
+1996	1887	1888	0
+1963	1962	1854	0
+1959	1966	1857	0
+1856	1964	1963	0
+1965	1857	1966	0
+1895	1999	1894	0
+1893	1998	1898	0
+1899	1997	1893	0
+1964	1858	1968	0
+1965	1967	1858	0
+1895	1896	2001	0
+1967	1968	1858	0
+1894	1999	1900	0
+1897	2002	1896	0
+1980	1909	1908	0
+1898	2004	1897	0
+1863	1970	1971	0
+1973	1972	1865	0
+1971	1974	1865	0
+1903	2006	1902	0
+1973	1865	1974	0
+1868	1975	1970	0
+1902	2006	1906	0
+1904	2008	1903	0
+2009	1904	1905	0
+1976	1975	1869	0
+2010	1905	1910	0
+2012	1907	1906	0
+1871	1977	1978	0
+1979	1976	1871	0
+1871	1978	1979	0
+2014	1910	1909	0
+1874	1982	1981	0
+1912	2017	1911	0
+1876	1983	1982	0
+1877	1984	1983	0
+1985	1984	1877	0
+1986	1985	1878	0
+1912	1921	2018	0
+1915	2020	1916	0
+1987	1986	1878	0
+1918	2019	1915	0
+2021	1919	1916	0
+1989	1880	1988	0
+1918	1917	2023	0
+1919	2024	1920	0
+1991	1883	1990	0
+1991	1992	1884	0
+1921	1920	2027	0
+1950	1970	1949	0
+1884	1992	1993	0
+1887	1995	1990	0
+1888	1989	1996	0
+1993	1994	1886	0
+1922	2030	1923	0
+1949	1975	1951	0
+1995	1887	1996	0
+1976	1952	1951	0
+1924	1923	2032	0
+1924	2033	1925	0
+2034	1928	1925	0
+1998	1893	1997	0
+1928	2035	1927	0
+1949	1970	1975	0
+2000	1999	1895	0
+1930	1929	2037	0
+2001	2000	1895	0
+1896	2002	2001	0
+1933	1930	2038	0
+1998	2005	1898	0
+2039	1931	1932	0
+1976	1951	1975	0
+1897	2003	2002	0
+2014	1909	1980	0
+2004	2003	1897	0
+1976	1979	1952	0
+1933	2042	1932	0
+2004	1898	2005	0
+2040	1941	1931	0
+1936	2044	1935	0
+1903	2007	2006	0
+1937	2044	1936	0
+1903	2008	2007	0
+1938	2045	1937	0
+2008	1904	2009	0
+1939	2046	1938	0
+2006	2013	1906	0
+2009	1905	2011	0
+2047	1939	1940	0
+2010	2011	1905	0
+2048	1940	1941	0
+2012	1906	2013	0
+2016	2010	1910	0
+1942	2051	1943	0
+2014	2015	1910	0
+2016	1910	2015	0
+1946	2054	1945	0
+1912	2018	2017	0
+1955	1943	2053	0
+2056	1947	1948	0
+1947	2055	1950	0
+2054	1946	1952	0
+2020	1915	2019	0
+1916	2020	2022	0
+2021	1916	2022	0
+1948	1954	2057	0
+2023	2019	1918	0
+2021	2025	1919	0
+2028	2018	1921	0
+2024	1919	2025	0
+2024	2026	1920	0
+1954	1953	2064	0
+1953	1956	2062	0
+2026	2027	1920	0
+1921	2027	2028	0
+2067	1956	1955	0
+1950	2060	1970	0
+1922	2029	2031	0
+2030	1922	2031	0
+2070	1958	1957	0
+1923	2030	2032	0
+1957	1961	2070	0
+1958	2071	1960	0
+2032	2033	1924	0
+2072	1959	1960	0
+2034	1925	2033	0
+2061	1952	1979	0
+2036	1928	2034	0
+2073	1966	1959	0
+1928	2036	2035	0
+1970	2060	1971	0
+1963	2076	1962	0
+1963	1964	2077	0
+1930	2037	2038	0
+1966	2079	1965	0
+1968	2078	1964	0
+2040	1931	2039	0
+1967	1965	2080	0
+1932	2041	2039	0
+1933	2038	2043	0
+1932	2042	2041	0
+1967	2082	1968	0
+1979	1978	2061	0
+2043	2042	1933	0
+2044	1937	2045	0
+1938	2046	2045	0
+2050	1941	2040	0
+2086	1974	1971	0
+2047	2046	1939	0
+1974	2087	1973	0
+1940	2048	2047	0
+2049	2048	1941	0
+2049	1941	2050	0
+2052	1943	2051	0
+2052	2053	1943	0
+1982	2089	1981	0
+1982	1983	2090	0
+1947	2056	2055	0
+1983	1984	2091	0
+2092	1984	1985	0
+1948	2058	2056	0
+2058	1948	2057	0
+1950	2055	2059	0
+1986	2094	1985	0
+2061	2054	1952	0
+1950	2059	2060	0
+1989	1988	2095	0
+2053	2067	1955	0
+1954	2066	2057	0
+1991	1990	2096	0
+2062	2063	1953	0
+2095	1996	1989	0
+1953	2063	2064	0
+1991	2098	1992	0
+1995	2096	1990	0
+2065	1954	2064	0
+2099	1993	1992	0
+1954	2065	2066	0
+2062	1956	2068	0
+1993	2101	1994	0
+1956	2067	2069	0
+1956	2069	2068	0
+1996	2103	1995	0
+2070	2071	1958	0
+1997	2107	1998	0
+2072	2073	1959	0
+2071	2074	1960	0
+2072	1960	2075	0
+2075	1960	2074	0
+2108	2000	2001	0
+2005	1998	2107	0
+2108	2001	2002	0
+2002	2003	2111	0
+1963	2077	2076	0
+2060	2086	1971	0
+2078	2077	1964	0
+1966	2073	2081	0
+2003	2004	2113	0
+2079	2080	1965	0
+2005	2115	2004	0
+1966	2081	2079	0
+2078	1968	2084	0
+2083	1967	2080	0
+2007	2117	2006	0
+2082	1967	2083	0
+2008	2118	2007	0
+2085	1968	2082	0
+2006	2117	2013	0
+2008	2009	2120	0
+2085	2084	1968	0
+2122	2009	2011	0
+2010	2124	2011	0
+1974	2086	2087	0
+2016	2123	2010	0
+2126	2012	2013	0
+2089	2088	1981	0
+2015	2127	2016	0
+2090	2089	1982	0
+2017	2018	2128	0
+1983	2091	2090	0
+2093	2091	1984	0
+2129	2020	2019	0
+2092	2093	1984	0
+2092	1985	2094	0
+2019	2023	2129	0
+2130	2022	2020	0
+2028	2128	2018	0
+2131	2021	2022	0
+2132	2025	2021	0
+2025	2135	2024	0
+2097	1991	2096	0
+2097	2098	1991	0
+2136	2026	2024	0
+2098	2100	1992	0
+2026	2138	2027	0
+1992	2100	2099	0
+1993	2099	2102	0
+2028	2027	2140	0
+1995	2105	2096	0
+2101	1993	2102	0
+2106	1996	2095	0
+2103	2104	1995	0
+2031	2029	2143	0
+1995	2104	2105	0
+2030	2031	2144	0
+2106	2103	1996	0
+2032	2030	2144	0
+2032	2144	2033	0
+2145	2034	2033	0
+2034	2146	2036	0
+2035	2036	2147	0
+2109	2108	2002	0
+2002	2110	2109	0
+2111	2110	2002	0
+2037	2149	2038	0
+2111	2003	2112	0
+2107	2116	2005	0
+2112	2003	2113	0
+2039	2041	2151	0
+2152	2040	2039	0
+2114	2113	2004	0
+2038	2150	2043	0
+2114	2004	2115	0
+2005	2116	2115	0
+2155	2041	2042	0
+2157	2042	2043	0
+2117	2007	2118	0
+2154	2050	2040	0
+2118	2008	2119	0
+2119	2008	2120	0
+2121	2120	2009	0
+2009	2122	2121	0
+2126	2013	2117	0
+2049	2160	2048	0
+2124	2010	2123	0
+2122	2011	2125	0
+2011	2124	2125	0
+2161	2049	2050	0
+2051	2162	2052	0
+2127	2123	2016	0
+2052	2163	2053	0
+2056	2166	2055	0
+2130	2020	2129	0
+2165	2059	2055	0
+2167	2056	2058	0
+2053	2164	2067	0
+2131	2132	2021	0
+2169	2058	2057	0
+2130	2133	2022	0
+2022	2134	2131	0
+2022	2133	2134	0
+2060	2059	2172	0
+2057	2066	2170	0
+2025	2132	2137	0
+2135	2136	2024	0
+2140	2128	2028	0
+2025	2137	2135	0
+2063	2062	2174	0
+2136	2139	2026	0
+2063	2175	2064	0
+2026	2139	2138	0
+2174	2062	2068	0
+2141	2027	2138	0
+2177	2065	2064	0
+2141	2140	2027	0
+2065	2178	2066	0
+2142	2143	2029	0
+2067	2180	2069	0
+2143	2144	2031	0
+2068	2069	2182	0
+2086	2060	2173	0
+2033	2144	2145	0
+2034	2145	2146	0
+2148	2036	2146	0
+2072	2186	2073	0
+2036	2148	2147	0
+2075	2185	2072	0
+2150	2038	2149	0
+2075	2074	2189	0
+2039	2151	2152	0
+2188	2081	2073	0
+2076	2077	2190	0
+2153	2040	2152	0
+2078	2190	2077	0
+2086	2173	2087	0
+2040	2153	2154	0
+2151	2041	2156	0
+2191	2080	2079	0
+2081	2191	2079	0
+2084	2190	2078	0
+2041	2155	2156	0
+2150	2159	2043	0
+2157	2155	2042	0
+2192	2083	2080	0
+2043	2158	2157	0
+2194	2082	2083	0
+2043	2159	2158	0
+2194	2085	2082	0
+2161	2050	2154	0
+2049	2161	2160	0
+2089	2198	2088	0
+2162	2163	2052	0
+2199	2089	2090	0
+2164	2053	2163	0
+2091	2200	2090	0
+2091	2093	2201	0
+2166	2165	2055	0
+2202	2093	2092	0
+2092	2094	2202	0
+2166	2056	2168	0
+2167	2168	2056	0
+2059	2165	2172	0
+2171	2167	2058	0
+2057	2170	2169	0
+2058	2169	2171	0
+2096	2205	2097	0
+2098	2097	2207	0
+2172	2173	2060	0
+2208	2100	2098	0
+2105	2205	2096	0
+2209	2099	2100	0
+2102	2099	2209	0
+2067	2164	2181	0
+2174	2176	2063	0
+2176	2175	2063	0
+2179	2170	2066	0
+2102	2212	2101	0
+2177	2064	2175	0
+2104	2103	2214	0
+2179	2066	2178	0
+2106	2214	2103	0
+2215	2105	2104	0
+2182	2174	2068	0
+2067	2181	2180	0
+2143	2145	2144	0
+2069	2180	2183	0
+2182	2069	2184	0
+2069	2183	2184	0
+2219	2108	2109	0
+2110	2220	2109	0
+2218	2116	2107	0
+2111	2221	2110	0
+2186	2072	2185	0
+2073	2186	2187	0
+2224	2111	2112	0
+2073	2187	2188	0
+2189	2185	2075	0
+2225	2112	2113	0
+2114	2227	2113	0
+2149	2159	2150	0
+2229	2114	2115	0
+2081	2188	2193	0
+2115	2116	2231	0
+2192	2080	2191	0
+2191	2081	2193	0
+2118	2234	2117	0
+2192	2196	2083	0
+2119	2235	2118	0
+2195	2194	2083	0
+2195	2083	2196	0
+2120	2236	2119	0
+2233	2126	2117	0
+2237	2120	2121	0
+2122	2238	2121	0
+2198	2197	2088	0
+2239	2122	2125	0
+2198	2089	2199	0
+2241	2124	2123	0
+2090	2200	2199	0
+2241	2123	2127	0
+2242	2125	2124	0
+2200	2091	2201	0
+2093	2203	2201	0
+2229	2137	2132	0
+2093	2202	2204	0
+2204	2203	2093	0
+2205	2206	2097	0
+2131	2246	2132	0
+2206	2207	2097	0
+2134	2245	2131	0
+2207	2208	2098	0
+2134	2133	2248	0
+2208	2210	2100	0
+2135	2249	2136	0
+2211	2209	2100	0
+2137	2249	2135	0
+2210	2211	2100	0
+2213	2102	2209	0
+2250	2139	2136	0
+2213	2212	2102	0
+2105	2217	2205	0
+2252	2138	2139	0
+2252	2141	2138	0
+2215	2104	2214	0
+2105	2215	2216	0
+2105	2216	2217	0
+2142	2256	2143	0
+2143	2257	2145	0
+2146	2145	2257	0
+2220	2219	2109	0
+2148	2146	2258	0
+2110	2222	2220	0
+2110	2221	2222	0
+2147	2148	2259	0
+2223	2221	2111	0
+2111	2224	2223	0
+2226	2224	2112	0
+2226	2112	2225	0
+2113	2227	2225	0
+2218	2232	2116	0
+2227	2114	2228	0
+2263	2152	2151	0
+2152	2264	2153	0
+2159	2149	2261	0
+2262	2151	2156	0
+2114	2229	2228	0
+2266	2154	2153	0
+2115	2230	2229	0
+2231	2230	2115	0
+2232	2231	2116	0
+2157	2269	2155	0
+2156	2155	2270	0
+2268	2161	2154	0
+2234	2233	2117	0
+2235	2234	2118	0
+2158	2273	2157	0
+2235	2119	2236	0
+2158	2159	2274	0
+2237	2236	2120	0
+2237	2121	2238	0
+2278	2160	2161	0
+2240	2238	2122	0
+2239	2240	2122	0
+2280	2163	2162	0
+2280	2164	2163	0
+2242	2124	2241	0
+2132	2247	2229	0
+2239	2125	2244	0
+2242	2243	2125	0
+2244	2125	2243	0
+2165	2166	2282	0
+2166	2168	2282	0
+2137	2229	2251	0
+2167	2283	2168	0
+2283	2167	2171	0
+2246	2131	2245	0
+2286	2169	2170	0
+2132	2246	2247	0
+2281	2181	2164	0
+2134	2248	2245	0
+2169	2288	2171	0
+2205	2217	2206	0
+2250	2136	2249	0
+2249	2137	2251	0
+2179	2289	2170	0
+2174	2292	2176	0
+2250	2254	2139	0
+2253	2252	2139	0
+2176	2293	2175	0
+2175	2293	2177	0
+2253	2139	2254	0
+2182	2292	2174	0
+2179	2178	2296	0
+2256	2142	2255	0
+2256	2257	2143	0
+2297	2180	2181	0
+2183	2180	2298	0
+2258	2146	2257	0
+2258	2260	2148	0
+2182	2184	2301	0
+2260	2259	2148	0
+2184	2183	2304	0
+2151	2262	2263	0
+2307	2186	2185	0
+2152	2263	2265	0
+2185	2189	2307	0
+2152	2265	2264	0
+2186	2308	2187	0
+2266	2153	2264	0
+2311	2188	2187	0
+2267	2154	2266	0
+2271	2262	2156	0
+2267	2268	2154	0
+2312	2193	2188	0
+2270	2155	2269	0
+2261	2277	2159	0
+2192	2191	2315	0
+2156	2270	2272	0
+2269	2157	2273	0
+2271	2156	2272	0
+2315	2191	2193	0
+2196	2192	2316	0
+2228	2229	2247	0
+2275	2273	2158	0
+2268	2279	2161	0
+2274	2276	2158	0
+2317	2195	2196	0
+2275	2158	2276	0
+2274	2159	2277	0
+2230	2251	2229	0
+2319	2197	2198	0
+2199	2320	2198	0
+2161	2279	2278	0
+2321	2199	2200	0
+2201	2322	2200	0
+2281	2164	2280	0
+2201	2203	2322	0
+2203	2204	2323	0
+2284	2282	2168	0
+2283	2285	2168	0
+2168	2285	2284	0
+2206	2327	2207	0
+2169	2286	2287	0
+2329	2208	2207	0
+2287	2288	2169	0
+2171	2291	2283	0
+2286	2170	2290	0
+2330	2210	2208	0
+2326	2206	2217	0
+2170	2289	2290	0
+2171	2288	2291	0
+2211	2331	2209	0
+2331	2213	2209	0
+2211	2210	2334	0
+2216	2326	2217	0
+2281	2299	2181	0
+2213	2337	2212	0
+2293	2176	2294	0
+2292	2295	2176	0
+2296	2289	2179	0
+2294	2176	2295	0
+2256	2258	2257	0
+2297	2298	2180	0
+2182	2301	2292	0
+2300	2297	2181	0
+2340	2219	2220	0
+2300	2181	2299	0
+2341	2220	2222	0
+2183	2298	2303	0
+2221	2342	2222	0
+2343	2221	2223	0
+2303	2302	2183	0
+2302	2304	2183	0
+2218	2339	2232	0
+2184	2306	2301	0
+2184	2304	2305	0
+2223	2224	2346	0
+2306	2184	2305	0
+2224	2226	2350	0
+2308	2186	2307	0
+2351	2226	2225	0
+2227	2352	2225	0
+2308	2309	2187	0
+2187	2309	2310	0
+2311	2187	2310	0
+2227	2228	2355	0
+2188	2311	2313	0
+2314	2312	2188	0
+2314	2188	2313	0
+2357	2230	2231	0
+2315	2193	2312	0
+2231	2232	2358	0
+2315	2316	2192	0
+2233	2234	2359	0
+2235	2359	2234	0
+2317	2196	2316	0
+2228	2247	2356	0
+2236	2361	2235	0
+2197	2319	2318	0
+2237	2362	2236	0
+2319	2198	2320	0
+2363	2237	2238	0
+2230	2357	2251	0
+2321	2320	2199	0
+2321	2200	2322	0
+2366	2238	2240	0
+2239	2368	2240	0
+2203	2323	2322	0
+2244	2367	2239	0
+2204	2324	2323	0
+2357	2250	2249	0
+2243	2370	2244	0
+2251	2357	2249	0
+2325	2206	2326	0
+2206	2325	2327	0
+2207	2327	2328	0
+2254	2250	2358	0
+2371	2246	2245	0
+2207	2328	2329	0
+2371	2245	2248	0
+2372	2247	2246	0
+2330	2208	2329	0
+2210	2330	2332	0
+2333	2210	2332	0
+2334	2210	2333	0
+2211	2335	2331	0
+2253	2254	2374	0
+2334	2336	2211	0
+2336	2335	2211	0
+2331	2338	2213	0
+2255	2376	2256	0
+2337	2213	2338	0
+2256	2376	2258	0
+2376	2260	2258	0
+2259	2260	2377	0
+2341	2340	2220	0
+2263	2262	2380	0
+2342	2221	2343	0
+2222	2344	2341	0
+2265	2263	2380	0
+2222	2342	2345	0
+2266	2264	2381	0
+2344	2222	2345	0
+2265	2382	2264	0
+2347	2343	2223	0
+2346	2347	2223	0
+2277	2261	2379	0
+2385	2267	2266	0
+2224	2349	2346	0
+2267	2385	2268	0
+2224	2348	2349	0
+2350	2348	2224	0
+2269	2388	2270	0
+2225	2352	2351	0
+2339	2358	2232	0
+2353	2350	2226	0
+2353	2226	2351	0
+2389	2269	2273	0
+2272	2270	2390	0
+2227	2354	2352	0
+2279	2268	2387	0
+2271	2272	2392	0
+2355	2354	2227	0
+2389	2273	2275	0
+2356	2355	2228	0
+2276	2274	2393	0
+2393	2274	2277	0
+2357	2231	2358	0
+2275	2276	2395	0
+2359	2235	2360	0
+2360	2235	2361	0
+2278	2279	2400	0
+2361	2236	2362	0
+2362	2237	2363	0
+2363	2238	2364	0
+2358	2250	2357	0
+2365	2364	2238	0
+2285	2283	2401	0
+2366	2365	2238	0
+2284	2285	2402	0
+2368	2239	2367	0
+2291	2401	2283	0
+2366	2240	2369	0
+2287	2286	2403	0
+2373	2356	2247	0
+2240	2368	2369	0
+2290	2403	2286	0
+2287	2404	2288	0
+2370	2367	2244	0
+2288	2407	2291	0
+2358	2374	2254	0
+2409	2290	2289	0
+2372	2246	2371	0
+2372	2373	2247	0
+2409	2289	2296	0
+2292	2412	2295	0
+2413	2294	2295	0
+2301	2412	2292	0
+2376	2255	2375	0
+2297	2415	2298	0
+2414	2297	2300	0
+2378	2260	2376	0
+2377	2260	2378	0
+2299	2417	2300	0
+2298	2416	2303	0
+2412	2301	2306	0
+2418	2302	2303	0
+2419	2304	2302	0
+2264	2382	2381	0
+2380	2383	2265	0
+2382	2265	2384	0
+2422	2305	2304	0
+2384	2265	2383	0
+2386	2266	2381	0
+2423	2306	2305	0
+2266	2386	2385	0
+2387	2268	2385	0
+2310	2309	2425	0
+2389	2388	2269	0
+2310	2426	2311	0
+2270	2388	2391	0
+2270	2391	2390	0
+2311	2428	2313	0
+2392	2272	2390	0
+2379	2398	2277	0
+2312	2314	2429	0
+2312	2429	2315	0
+2314	2313	2430	0
+2275	2394	2389	0
+2315	2429	2316	0
+2395	2394	2275	0
+2387	2400	2279	0
+2393	2397	2276	0
+2434	2317	2316	0
+2276	2396	2395	0
+2399	2393	2277	0
+2396	2276	2397	0
+2339	2374	2358	0
+2437	2318	2319	0
+2399	2277	2398	0
+2319	2320	2438	0
+2320	2321	2439	0
+2440	2321	2322	0
+2440	2322	2323	0
+2323	2324	2440	0
+2401	2402	2285	0
+2442	2327	2325	0
+2287	2403	2405	0
+2404	2287	2405	0
+2328	2327	2442	0
+2291	2407	2401	0
+2328	2443	2329	0
+2288	2404	2408	0
+2407	2288	2406	0
+2288	2408	2406	0
+2329	2444	2330	0
+2290	2411	2403	0
+2386	2302	2418	0
+2445	2332	2330	0
+2386	2419	2302	0
+2290	2409	2410	0
+2290	2410	2411	0
+2335	2447	2331	0
+2448	2333	2332	0
+2331	2446	2338	0
+2333	2449	2334	0
+2413	2295	2412	0
+2334	2451	2336	0
+2452	2335	2336	0
+2415	2297	2414	0
+2415	2416	2298	0
+2376	2375	2378	0
+2337	2338	2456	0
+2417	2414	2300	0
+2303	2416	2420	0
+2341	2458	2340	0
+2420	2418	2303	0
+2306	2424	2412	0
+2419	2421	2304	0
+2341	2344	2459	0
+2342	2343	2461	0
+2460	2345	2342	0
+2422	2304	2421	0
+2423	2305	2422	0
+2347	2462	2343	0
+2423	2424	2306	0
+2344	2345	2464	0
+2467	2347	2346	0
+2426	2310	2425	0
+2346	2349	2467	0
+2427	2311	2426	0
+2311	2427	2428	0
+2349	2348	2470	0
+2471	2348	2350	0
+2431	2313	2428	0
+2430	2313	2431	0
+2432	2429	2314	0
+2353	2472	2350	0
+2473	2351	2352	0
+2433	2314	2430	0
+2353	2351	2474	0
+2433	2432	2314	0
+2429	2435	2316	0
+2354	2475	2352	0
+2435	2434	2316	0
+2418	2385	2386	0
+2480	2354	2355	0
+2355	2356	2480	0
+2437	2436	2318	0
+2385	2420	2387	0
+2437	2319	2438	0
+2438	2320	2439	0
+2321	2440	2439	0
+2481	2360	2361	0
+2361	2362	2481	0
+2441	2440	2324	0
+2483	2362	2363	0
+2356	2373	2480	0
+2484	2363	2364	0
+2442	2443	2328	0
+2364	2365	2485	0
+2443	2444	2329	0
+2488	2365	2366	0
+2444	2445	2330	0
+2420	2385	2418	0
+2331	2447	2446	0
+2445	2448	2332	0
+2366	2369	2490	0
+2491	2368	2367	0
+2367	2370	2491	0
+2492	2369	2368	0
+2333	2448	2450	0
+2450	2449	2333	0
+2334	2449	2451	0
+2335	2453	2447	0
+2335	2452	2453	0
+2446	2457	2338	0
+2336	2454	2452	0
+2336	2451	2455	0
+2455	2454	2336	0
+2375	2494	2378	0
+2495	2377	2378	0
+2338	2457	2456	0
+2458	2341	2459	0
+2381	2382	2497	0
+2461	2460	2342	0
+2384	2498	2382	0
+2386	2381	2497	0
+2462	2461	2343	0
+2463	2459	2344	0
+2384	2383	2500	0
+2463	2344	2464	0
+2466	2345	2460	0
+2379	2496	2398	0
+2465	2464	2345	0
+2466	2465	2345	0
+2469	2462	2347	0
+2503	2388	2389	0
+2388	2503	2391	0
+2467	2468	2347	0
+2347	2468	2469	0
+2391	2504	2390	0
+2392	2390	2504	0
+2389	2394	2503	0
+2433	2488	2366	0
+2387	2501	2400	0
+2433	2366	2490	0
+2348	2471	2470	0
+2471	2350	2472	0
+2429	2432	2435	0
+2395	2508	2394	0
+2507	2397	2393	0
+2473	2474	2351	0
+2399	2507	2393	0
+2509	2395	2396	0
+2476	2473	2352	0
+2497	2419	2386	0
+2352	2475	2476	0
+2353	2478	2472	0
+2511	2396	2397	0
+2479	2353	2474	0
+2477	2478	2353	0
+2353	2479	2477	0
+2420	2502	2387	0
+2399	2398	2514	0
+2516	2402	2401	0
+2407	2517	2401	0
+2482	2481	2362	0
+2518	2405	2403	0
+2482	2362	2483	0
+2519	2404	2405	0
+2363	2484	2483	0
+2519	2408	2404	0
+2403	2411	2518	0
+2486	2484	2364	0
+2485	2486	2364	0
+2406	2523	2407	0
+2408	2522	2406	0
+2485	2365	2487	0
+2489	2487	2365	0
+2488	2489	2365	0
+2411	2410	2525	0
+2430	2488	2433	0
+2526	2413	2412	0
+2492	2368	2491	0
+2369	2493	2490	0
+2492	2493	2369	0
+2527	2415	2414	0
+2527	2414	2417	0
+2528	2416	2415	0
+2526	2412	2424	0
+2420	2416	2530	0
+2378	2494	2495	0
+2421	2419	2531	0
+2421	2532	2422	0
+2422	2533	2423	0
+2497	2382	2499	0
+2382	2498	2499	0
+2423	2534	2424	0
+2498	2384	2500	0
+2426	2425	2536	0
+2426	2536	2427	0
+2501	2387	2502	0
+2538	2428	2427	0
+2428	2539	2431	0
+2391	2503	2506	0
+2504	2391	2505	0
+2431	2540	2430	0
+2506	2505	2391	0
+2503	2394	2508	0
+2398	2496	2514	0
+2544	2432	2433	0
+2432	2543	2435	0
+2435	2543	2434	0
+2395	2510	2508	0
+2509	2510	2395	0
+2509	2396	2512	0
+2397	2507	2513	0
+2437	2546	2436	0
+2512	2396	2511	0
+2399	2515	2507	0
+2513	2511	2397	0
+2438	2547	2437	0
+2438	2439	2548	0
+2548	2439	2440	0
+2515	2399	2514	0
+2441	2548	2440	0
+2516	2401	2517	0
+2444	2550	2445	0
+2405	2518	2520	0
+2448	2445	2552	0
+2519	2405	2521	0
+2520	2521	2405	0
+2553	2446	2447	0
+2523	2517	2407	0
+2531	2419	2497	0
+2524	2408	2519	0
+2523	2406	2522	0
+2530	2502	2420	0
+2555	2450	2448	0
+2522	2408	2524	0
+2525	2518	2411	0
+2453	2554	2447	0
+2450	2557	2449	0
+2556	2451	2449	0
+2446	2553	2457	0
+2488	2430	2540	0
+2561	2453	2452	0
+2455	2451	2560	0
+2490	2544	2433	0
+2561	2452	2454	0
+2528	2415	2527	0
+2454	2455	2564	0
+2528	2529	2416	0
+2530	2416	2529	0
+2457	2567	2456	0
+2424	2534	2526	0
+2421	2531	2532	0
+2459	2569	2458	0
+2533	2422	2532	0
+2461	2570	2460	0
+2463	2569	2459	0
+2535	2423	2533	0
+2534	2423	2535	0
+2462	2572	2461	0
+2466	2460	2571	0
+2427	2536	2537	0
+2463	2464	2575	0
+2538	2427	2537	0
+2539	2428	2538	0
+2469	2574	2462	0
+2465	2577	2464	0
+2578	2465	2466	0
+2539	2541	2431	0
+2540	2431	2542	0
+2431	2541	2542	0
+2540	2489	2488	0
+2506	2503	2508	0
+2469	2468	2581	0
+2544	2543	2432	0
+2471	2582	2470	0
+2471	2472	2582	0
+2493	2544	2490	0
+2497	2499	2531	0
+2436	2546	2545	0
+2547	2546	2437	0
+2473	2586	2474	0
+2548	2547	2438	0
+2584	2472	2478	0
+2476	2585	2473	0
+2549	2548	2441	0
+2588	2476	2475	0
+2479	2474	2587	0
+2477	2479	2589	0
+2590	2478	2477	0
+2550	2551	2445	0
+2552	2445	2551	0
+2554	2553	2447	0
+2448	2552	2555	0
+2483	2594	2482	0
+2483	2484	2595	0
+2449	2557	2556	0
+2559	2450	2555	0
+2450	2558	2557	0
+2486	2596	2484	0
+2558	2450	2559	0
+2556	2560	2451	0
+2597	2486	2485	0
+2554	2453	2563	0
+2485	2487	2598	0
+2542	2489	2540	0
+2561	2562	2453	0
+2489	2601	2487	0
+2553	2568	2457	0
+2563	2453	2562	0
+2454	2565	2561	0
+2560	2566	2455	0
+2565	2454	2564	0
+2455	2566	2564	0
+2602	2495	2494	0
+2567	2457	2568	0
+2604	2499	2498	0
+2570	2571	2460	0
+2498	2500	2604	0
+2570	2461	2573	0
+2461	2572	2573	0
+2575	2569	2463	0
+2572	2462	2574	0
+2501	2502	2607	0
+2514	2496	2603	0
+2576	2575	2464	0
+2571	2580	2466	0
+2577	2576	2464	0
+2608	2505	2506	0
+2577	2465	2579	0
+2578	2579	2465	0
+2506	2508	2609	0
+2469	2581	2574	0
+2578	2466	2580	0
+2508	2510	2612	0
+2610	2513	2507	0
+2489	2542	2601	0
+2509	2613	2510	0
+2611	2507	2515	0
+2509	2512	2613	0
+2531	2499	2606	0
+2472	2583	2582	0
+2616	2512	2511	0
+2502	2530	2607	0
+2472	2584	2583	0
+2617	2511	2513	0
+2586	2473	2585	0
+2549	2547	2548	0
+2474	2586	2587	0
+2588	2585	2476	0
+2514	2621	2515	0
+2478	2591	2584	0
+2477	2589	2590	0
+2516	2517	2624	0
+2592	2479	2587	0
+2591	2478	2590	0
+2589	2479	2593	0
+2624	2517	2523	0
+2626	2520	2518	0
+2592	2593	2479	0
+2529	2607	2530	0
+2525	2625	2518	0
+2521	2628	2519	0
+2531	2606	2532	0
+2627	2524	2519	0
+2595	2594	2483	0
+2520	2631	2521	0
+2596	2595	2484	0
+2522	2633	2523	0
+2522	2524	2634	0
+2485	2598	2597	0
+2596	2486	2599	0
+2600	2486	2597	0
+2600	2599	2486	0
+2598	2487	2601	0
+2532	2637	2533	0
+2562	2561	2565	0
+2637	2535	2533	0
+2605	2499	2604	0
+2499	2605	2606	0
+2536	2639	2537	0
+2538	2537	2642	0
+2539	2538	2643	0
+2541	2539	2643	0
+2609	2608	2506	0
+2610	2507	2611	0
+2541	2645	2542	0
+2612	2609	2508	0
+2510	2614	2612	0
+2615	2510	2613	0
+2622	2514	2603	0
+2510	2615	2614	0
+2545	2546	2649	0
+2620	2513	2610	0
+2650	2546	2547	0
+2512	2619	2613	0
+2617	2616	2511	0
+2549	2650	2547	0
+2512	2616	2618	0
+2623	2611	2515	0
+2619	2512	2618	0
+2620	2617	2513	0
+2651	2551	2550	0
+2551	2652	2552	0
+2514	2622	2621	0
+2621	2623	2515	0
+2653	2555	2552	0
+2554	2656	2553	0
+2555	2653	2559	0
+2626	2518	2625	0
+2556	2557	2658	0
+2563	2657	2554	0
+2556	2658	2560	0
+2629	2627	2519	0
+2660	2557	2558	0
+2553	2655	2568	0
+2626	2630	2520	0
+2638	2532	2606	0
+2519	2628	2629	0
+2559	2662	2558	0
+2631	2520	2630	0
+2521	2632	2628	0
+2635	2624	2523	0
+2521	2631	2632	0
+2524	2627	2636	0
+2522	2634	2633	0
+2647	2601	2542	0
+2523	2633	2635	0
+2562	2666	2563	0
+2665	2562	2565	0
+2634	2524	2636	0
+2670	2565	2564	0
+2670	2564	2566	0
+2638	2637	2532	0
+2567	2568	2672	0
+2580	2571	2664	0
+2675	2571	2570	0
+2640	2537	2639	0
+2674	2570	2573	0
+2640	2641	2537	0
+2642	2537	2641	0
+2676	2573	2572	0
+2574	2677	2572	0
+2644	2538	2642	0
+2538	2644	2643	0
+2541	2643	2646	0
+2677	2574	2581	0
+2645	2541	2646	0
+2577	2680	2576	0
+2542	2645	2647	0
+2579	2680	2577	0
+2580	2681	2578	0
+2578	2682	2579	0
+2648	2545	2649	0
+2546	2650	2649	0
+2619	2615	2613	0
+2606	2605	2638	0
+2685	2583	2584	0
+2651	2652	2551	0
+2552	2652	2654	0
+2687	2586	2585	0
+2654	2653	2552	0
+2588	2687	2585	0
+2688	2587	2586	0
+2584	2591	2686	0
+2656	2655	2553	0
+2554	2657	2656	0
+2690	2592	2587	0
+2590	2589	2691	0
+2593	2692	2589	0
+2659	2658	2557	0
+2694	2591	2590	0
+2653	2663	2559	0
+2659	2557	2660	0
+2661	2660	2558	0
+2661	2558	2662	0
+2592	2697	2593	0
+2559	2664	2662	0
+2559	2663	2664	0
+2563	2668	2657	0
+2594	2595	2699	0
+2596	2699	2595	0
+2562	2665	2666	0
+2599	2699	2596	0
+2598	2700	2597	0
+2655	2673	2568	0
+2700	2600	2597	0
+2669	2563	2666	0
+2563	2667	2668	0
+2667	2563	2669	0
+2598	2601	2702	0
+2665	2565	2671	0
+2670	2671	2565	0
+2675	2664	2571	0
+2568	2673	2672	0
+2674	2675	2570	0
+2608	2609	2704	0
+2580	2664	2681	0
+2612	2704	2609	0
+2572	2677	2676	0
+2679	2674	2573	0
+2611	2706	2610	0
+2676	2678	2573	0
+2622	2603	2703	0
+2612	2614	2704	0
+2573	2678	2679	0
+2705	2620	2610	0
+2611	2623	2707	0
+2681	2682	2578	0
+2680	2579	2683	0
+2616	2617	2710	0
+2618	2616	2709	0
+2682	2684	2579	0
+2683	2579	2684	0
+2617	2620	2711	0
+2647	2702	2601	0
+2685	2584	2686	0
+2714	2621	2622	0
+2714	2623	2621	0
+2688	2586	2687	0
+2688	2689	2587	0
+2689	2690	2587	0
+2626	2625	2718	0
+2691	2589	2692	0
+2695	2686	2591	0
+2718	2630	2626	0
+2693	2590	2691	0
+2629	2719	2627	0
+2590	2693	2694	0
+2690	2696	2592	0
+2721	2629	2628	0
+2695	2591	2694	0
+2632	2720	2628	0
+2719	2636	2627	0
+2692	2593	2698	0
+2697	2592	2696	0
+2724	2631	2630	0
+2631	2725	2632	0
+2593	2697	2698	0
+2634	2728	2633	0
+2633	2728	2635	0
+2598	2701	2700	0
+2636	2730	2634	0
+2701	2598	2702	0
+2662	2664	2675	0
+2681	2664	2663	0
+2639	2733	2640	0
+2640	2734	2641	0
+2641	2736	2642	0
+2610	2706	2705	0
+2642	2737	2644	0
+2738	2643	2644	0
+2611	2708	2706	0
+2708	2611	2707	0
+2646	2643	2738	0
+2740	2645	2646	0
+2645	2740	2647	0
+2709	2616	2710	0
+2620	2705	2712	0
+2710	2617	2711	0
+2622	2703	2715	0
+2620	2713	2711	0
+2620	2712	2713	0
+2652	2651	2743	0
+2717	2707	2623	0
+2743	2654	2652	0
+2744	2653	2654	0
+2622	2716	2714	0
+2716	2622	2715	0
+2714	2717	2623	0
+2747	2655	2656	0
+2744	2663	2653	0
+2748	2656	2657	0
+2659	2660	2750	0
+2720	2721	2628	0
+2719	2629	2722	0
+2660	2661	2751	0
+2630	2718	2724	0
+2721	2723	2629	0
+2722	2629	2723	0
+2657	2668	2749	0
+2747	2673	2655	0
+2661	2662	2753	0
+2632	2727	2720	0
+2725	2631	2724	0
+2725	2726	2632	0
+2727	2632	2726	0
+2719	2732	2636	0
+2666	2665	2756	0
+2675	2753	2662	0
+2728	2634	2729	0
+2755	2665	2671	0
+2702	2647	2742	0
+2757	2669	2666	0
+2729	2634	2730	0
+2760	2668	2667	0
+2667	2669	2759	0
+2731	2730	2636	0
+2681	2663	2754	0
+2731	2636	2732	0
+2733	2734	2640	0
+2673	2764	2672	0
+2735	2641	2734	0
+2641	2735	2736	0
+2642	2736	2737	0
+2674	2768	2675	0
+2681	2754	2682	0
+2679	2767	2674	0
+2739	2644	2737	0
+2738	2644	2739	0
+2646	2738	2741	0
+2679	2678	2769	0
+2741	2740	2646	0
+2742	2647	2740	0
+2682	2770	2684	0
+2771	2683	2684	0
+2745	2654	2743	0
+2686	2772	2685	0
+2744	2654	2746	0
+2745	2746	2654	0
+2747	2656	2748	0
+2773	2690	2689	0
+2772	2686	2695	0
+2748	2657	2749	0
+2691	2692	2774	0
+2773	2696	2690	0
+2691	2775	2693	0
+2750	2660	2751	0
+2663	2744	2754	0
+2751	2661	2752	0
+2693	2778	2694	0
+2776	2692	2698	0
+2661	2753	2752	0
+2695	2694	2781	0
+2782	2697	2696	0
+2755	2756	2665	0
+2697	2783	2698	0
+2668	2761	2749	0
+2666	2756	2757	0
+2758	2667	2759	0
+2760	2667	2758	0
+2673	2747	2766	0
+2786	2700	2701	0
+2763	2669	2757	0
+2761	2668	2760	0
+2669	2762	2759	0
+2702	2788	2701	0
+2763	2762	2669	0
+2675	2768	2753	0
+2705	2706	2791	0
+2673	2765	2764	0
+2766	2765	2673	0
+2754	2770	2682	0
+2793	2706	2708	0
+2791	2712	2705	0
+2715	2703	2790	0
+2768	2674	2767	0
+2708	2707	2794	0
+2769	2767	2679	0
+2797	2709	2710	0
+2797	2710	2711	0
+2707	2717	2794	0
+2711	2713	2797	0
+2684	2770	2771	0
+2798	2717	2714	0
+2716	2798	2714	0
+2702	2742	2789	0
+2799	2716	2715	0
+2775	2691	2774	0
+2774	2692	2777	0
+2803	2719	2722	0
+2776	2777	2692	0
+2720	2805	2721	0
+2779	2693	2775	0
+2772	2695	2781	0
+2779	2778	2693	0
+2696	2773	2782	0
+2723	2721	2807	0
+2727	2804	2720	0
+2780	2694	2778	0
+2722	2723	2809	0
+2732	2719	2803	0
+2780	2781	2694	0
+2785	2776	2698	0
+2744	2746	2770	0
+2697	2782	2783	0
+2727	2726	2811	0
+2783	2784	2698	0
+2784	2785	2698	0
+2770	2754	2744	0
+2730	2812	2729	0
+2730	2731	2812	0
+2787	2786	2701	0
+2788	2787	2701	0
+2732	2813	2731	0
+2789	2788	2702	0
+2816	2734	2733	0
+2816	2735	2734	0
+2792	2791	2706	0
+2736	2735	2818	0
+2793	2792	2706	0
+2736	2819	2737	0
+2795	2793	2708	0
+2821	2739	2737	0
+2796	2708	2794	0
+2739	2822	2738	0
+2795	2708	2796	0
+2823	2741	2738	0
+2799	2715	2790	0
+2826	2740	2741	0
+2740	2825	2742	0
+2802	2794	2717	0
+2716	2800	2798	0
+2799	2800	2716	0
+2717	2798	2801	0
+2829	2746	2745	0
+2802	2717	2801	0
+2831	2747	2748	0
+2805	2720	2804	0
+2832	2748	2749	0
+2721	2805	2806	0
+2808	2803	2722	0
+2721	2806	2807	0
+2750	2751	2834	0
+2834	2751	2752	0
+2808	2722	2809	0
+2807	2810	2723	0
+2752	2753	2835	0
+2723	2810	2809	0
+2811	2804	2727	0
+2766	2747	2830	0
+2833	2749	2761	0
+2829	2770	2746	0
+2837	2756	2755	0
+2756	2837	2757	0
+2803	2815	2732	0
+2759	2838	2758	0
+2812	2731	2813	0
+2836	2753	2768	0
+2839	2760	2758	0
+2757	2837	2763	0
+2789	2742	2828	0
+2838	2759	2762	0
+2814	2813	2732	0
+2732	2815	2814	0
+2761	2760	2841	0
+2817	2735	2816	0
+2829	2771	2770	0
+2817	2818	2735	0
+2820	2736	2818	0
+2766	2844	2765	0
+2819	2736	2820	0
+2819	2821	2737	0
+2847	2768	2767	0
+2769	2847	2767	0
+2738	2822	2823	0
+2824	2739	2821	0
+2822	2739	2824	0
+2740	2826	2825	0
+2827	2741	2823	0
+2741	2827	2826	0
+2825	2828	2742	0
+2774	2848	2775	0
+2777	2849	2774	0
+2779	2775	2851	0
+2776	2853	2777	0
+2831	2830	2747	0
+2831	2748	2832	0
+2778	2779	2856	0
+2852	2776	2785	0
+2780	2778	2855	0
+2749	2833	2832	0
+2752	2835	2834	0
+2836	2835	2753	0
+2858	2785	2784	0
+2787	2859	2786	0
+2839	2758	2838	0
+2860	2787	2788	0
+2761	2842	2833	0
+2861	2788	2789	0
+2760	2839	2840	0
+2766	2830	2845	0
+2841	2760	2840	0
+2843	2761	2841	0
+2843	2842	2761	0
+2864	2791	2792	0
+2792	2793	2865	0
+2836	2768	2847	0
+2799	2790	2863	0
+2793	2795	2866	0
+2766	2846	2844	0
+2766	2845	2846	0
+2868	2796	2794	0
+2795	2796	2869	0
+2794	2802	2867	0
+2872	2798	2800	0
+2849	2848	2774	0
+2872	2801	2798	0
+2850	2775	2848	0
+2800	2799	2873	0
+2851	2775	2850	0
+2862	2789	2828	0
+2802	2801	2877	0
+2777	2854	2849	0
+2853	2776	2852	0
+2853	2854	2777	0
+2779	2851	2857	0
+2855	2778	2856	0
+2881	2805	2804	0
+2808	2880	2803	0
+2857	2856	2779	0
+2806	2805	2882	0
+2858	2852	2785	0
+2804	2811	2881	0
+2806	2884	2807	0
+2803	2880	2815	0
+2887	2810	2807	0
+2888	2808	2809	0
+2860	2859	2787	0
+2889	2809	2810	0
+2861	2860	2788	0
+2861	2789	2862	0
+2814	2815	2890	0
+2865	2864	2792	0
+2865	2793	2866	0
+2817	2891	2818	0
+2794	2867	2868	0
+2893	2820	2818	0
+2870	2866	2795	0
+2820	2895	2819	0
+2870	2795	2869	0
+2894	2821	2819	0
+2796	2868	2871	0
+2863	2874	2799	0
+2871	2869	2796	0
+2821	2897	2824	0
+2822	2898	2823	0
+2824	2899	2822	0
+2873	2799	2874	0
+2875	2872	2800	0
+2802	2878	2867	0
+2873	2875	2800	0
+2801	2872	2876	0
+2900	2827	2823	0
+2901	2825	2826	0
+2876	2877	2801	0
+2825	2902	2828	0
+2827	2903	2826	0
+2877	2879	2802	0
+2878	2802	2879	0
+2906	2830	2831	0
+2882	2805	2881	0
+2882	2883	2806	0
+2832	2908	2831	0
+2884	2806	2883	0
+2908	2832	2833	0
+2888	2880	2808	0
+2807	2884	2886	0
+2886	2885	2807	0
+2807	2885	2887	0
+2830	2907	2845	0
+2910	2833	2842	0
+2880	2890	2815	0
+2888	2809	2889	0
+2887	2889	2810	0
+2840	2911	2841	0
+2905	2862	2828	0
+2843	2841	2911	0
+2842	2843	2912	0
+2892	2818	2891	0
+2893	2818	2892	0
+2844	2846	2914	0
+2845	2915	2846	0
+2894	2819	2895	0
+2893	2896	2820	0
+2896	2895	2820	0
+2894	2897	2821	0
+2850	2848	2918	0
+2849	2919	2848	0
+2899	2898	2822	0
+2899	2824	2897	0
+2898	2900	2823	0
+2850	2922	2851	0
+2921	2849	2854	0
+2901	2902	2825	0
+2904	2901	2826	0
+2926	2853	2852	0
+2924	2857	2851	0
+2904	2826	2903	0
+2853	2927	2854	0
+2902	2905	2828	0
+2858	2926	2852	0
+2856	2930	2855	0
+2906	2907	2830	0
+2930	2856	2857	0
+2906	2831	2908	0
+2833	2909	2908	0
+2859	2860	2931	0
+2833	2910	2909	0
+2861	2933	2860	0
+2862	2933	2861	0
+2912	2910	2842	0
+2936	2864	2865	0
+2913	2843	2911	0
+2845	2907	2916	0
+2913	2912	2843	0
+2866	2938	2865	0
+2935	2874	2863	0
+2939	2866	2870	0
+2940	2868	2867	0
+2916	2915	2845	0
+2914	2846	2917	0
+2846	2915	2917	0
+2940	2871	2868	0
+2941	2870	2869	0
+2871	2942	2869	0
+2918	2848	2919	0
+2849	2920	2919	0
+2921	2920	2849	0
+2923	2850	2918	0
+2947	2872	2875	0
+2922	2850	2923	0
+2947	2876	2872	0
+2873	2874	2948	0
+2875	2873	2949	0
+2851	2922	2925	0
+2851	2925	2924	0
+2934	2862	2905	0
+2921	2854	2929	0
+2927	2853	2926	0
+2877	2876	2955	0
+2927	2928	2854	0
+2929	2854	2928	0
+2857	2924	2930	0
+2877	2956	2879	0
+2957	2878	2879	0
+2931	2860	2932	0
+2933	2932	2860	0
+2888	2959	2880	0
+2884	2883	2960	0
+2890	2880	2958	0
+2934	2933	2862	0
+2884	2960	2886	0
+2885	2886	2962	0
+2963	2887	2885	0
+2865	2937	2936	0
+2938	2937	2865	0
+2965	2889	2887	0
+2938	2866	2939	0
+2889	2966	2888	0
+2891	2968	2892	0
+2943	2939	2870	0
+2941	2869	2942	0
+2892	2969	2893	0
+2870	2941	2944	0
+2940	2945	2871	0
+2944	2943	2870	0
+2893	2970	2896	0
+2946	2942	2871	0
+2874	2935	2950	0
+2971	2894	2895	0
+2945	2946	2871	0
+2894	2972	2897	0
+2974	2895	2896	0
+2949	2873	2948	0
+2948	2874	2951	0
+2897	2977	2899	0
+2952	2947	2875	0
+2874	2950	2951	0
+2899	2978	2898	0
+2900	2898	2978	0
+2875	2949	2953	0
+2876	2947	2954	0
+2875	2953	2952	0
+2901	2981	2902	0
+2954	2955	2876	0
+2904	2980	2901	0
+2955	2956	2877	0
+2905	2902	2982	0
+2904	2903	2984	0
+2956	2957	2879	0
+2958	2880	2959	0
+2907	2906	2987	0
+2906	2908	2988	0
+2908	2909	2990	0
+2961	2885	2962	0
+2885	2961	2963	0
+2964	2886	2960	0
+2991	2909	2910	0
+2964	2962	2886	0
+2907	2989	2916	0
+2888	2966	2959	0
+2992	2910	2912	0
+2963	2965	2887	0
+2912	2913	2993	0
+2889	2965	2967	0
+2889	2967	2966	0
+2934	2905	2986	0
+2914	2917	2994	0
+2915	2916	2995	0
+2996	2917	2915	0
+2968	2969	2892	0
+2970	2893	2969	0
+2918	2919	3000	0
+2972	2894	2971	0
+3001	2919	2920	0
+2918	3000	2923	0
+2971	2895	2975	0
+2896	2970	2976	0
+2895	2974	2973	0
+3002	2920	2921	0
+2895	2973	2975	0
+2977	2897	2972	0
+2896	2976	2974	0
+2923	3005	2922	0
+3005	2925	2922	0
+2921	2929	3003	0
+2979	2899	2977	0
+2978	2899	2979	0
+2981	2901	2980	0
+3008	2929	2928	0
+2902	2981	2983	0
+2983	2982	2902	0
+2984	2980	2904	0
+3009	2931	2932	0
+2985	2905	2982	0
+2932	2933	3010	0
+2905	2985	2986	0
+2934	3010	2933	0
+2987	2906	2988	0
+2989	2907	2987	0
+2936	2937	3012	0
+2990	2988	2908	0
+2937	2938	3013	0
+2990	2909	2991	0
+3014	2938	2939	0
+2992	2991	2910	0
+3014	2939	2943	0
+2912	2993	2992	0
+2941	2942	3015	0
+3015	2944	2941	0
+2916	2989	2997	0
+2946	3016	2942	0
+2943	2944	3018	0
+2915	2995	2996	0
+2998	2995	2916	0
+2917	2999	2994	0
+2998	2916	2997	0
+2946	2945	3021	0
+2917	2996	2999	0
+2919	3001	3000	0
+2949	2948	3024	0
+3022	2947	2952	0
+3023	2948	2951	0
+3002	3001	2920	0
+2954	2947	3022	0
+3002	2921	3004	0
+3027	2951	2950	0
+3004	2921	3003	0
+2953	2949	3026	0
+3000	3007	2923	0
+3011	2934	2986	0
+3005	2923	3006	0
+3030	2952	2953	0
+3006	2923	3007	0
+3008	3003	2929	0
+2954	3035	2955	0
+2955	3036	2956	0
+2957	2956	3036	0
+3009	2932	3010	0
+2958	2959	3038	0
+3010	2934	3011	0
+3013	3012	2937	0
+2966	3038	2959	0
+2960	3039	2964	0
+2961	3040	2963	0
+3041	2961	2962	0
+3013	2938	3014	0
+2962	2964	3042	0
+2963	3044	2965	0
+3015	2942	3017	0
+3014	2943	3018	0
+2942	3016	3017	0
+3015	3020	2944	0
+3048	2967	2965	0
+2944	3019	3018	0
+3049	2966	2967	0
+3021	3016	2946	0
+2944	3020	3019	0
+2969	2968	3052	0
+3052	2970	2969	0
+3023	3024	2948	0
+3055	2972	2971	0
+3025	2949	3024	0
+3053	2976	2970	0
+3054	2971	2975	0
+3025	3026	2949	0
+2951	3028	3023	0
+2974	3058	2973	0
+2952	3031	3022	0
+2972	3057	2977	0
+2975	2973	3059	0
+3027	3029	2951	0
+2951	3029	3028	0
+3061	2974	2976	0
+3035	2954	3022	0
+3031	2952	3030	0
+3057	2979	2977	0
+2953	3026	3034	0
+3033	3030	2953	0
+2953	3032	3033	0
+3032	2953	3034	0
+3037	2955	3035	0
+3066	2981	2980	0
+3036	2955	3037	0
+2980	2984	3066	0
+2981	3067	2983	0
+2982	2983	3068	0
+3069	2985	2982	0
+3041	3040	2961	0
+3072	2986	2985	0
+3043	3041	2962	0
+3043	2962	3042	0
+3040	3045	2963	0
+2987	2988	3074	0
+3046	2964	3039	0
+2987	3074	2989	0
+3044	2963	3045	0
+2990	3075	2988	0
+3049	3038	2966	0
+3042	2964	3047	0
+2991	3075	2990	0
+3044	3048	2965	0
+3046	3047	2964	0
+2992	3079	2991	0
+2989	3078	2997	0
+3080	2992	2993	0
+2967	3050	3049	0
+3048	3051	2967	0
+3050	2967	3051	0
+3073	3011	2986	0
+2995	3082	2996	0
+2999	3081	2994	0
+2998	3082	2995	0
+3053	2970	3052	0
+2999	2996	3083	0
+2998	2997	3085	0
+2971	3054	3055	0
+3056	2972	3055	0
+3056	3057	2972	0
+3001	3088	3000	0
+3058	3060	2973	0
+3063	3054	2975	0
+3059	2973	3060	0
+3053	3064	2976	0
+3001	3002	3090	0
+3061	3058	2974	0
+3000	3088	3007	0
+3059	3062	2975	0
+3004	3091	3002	0
+3003	3092	3004	0
+3062	3063	2975	0
+3065	3061	2976	0
+3008	3092	3003	0
+3065	2976	3064	0
+3095	3006	3007	0
+3067	2981	3066	0
+3096	3009	3010	0
+3097	3010	3011	0
+3068	3069	2982	0
+3067	3070	2983	0
+3071	3068	2983	0
+3013	3099	3012	0
+3071	2983	3070	0
+3069	3072	2985	0
+3013	3014	3101	0
+3073	2986	3072	0
+3014	3018	3101	0
+3015	3017	3102	0
+3103	3017	3016	0
+3102	3020	3015	0
+3076	3074	2988	0
+2988	3075	3076	0
+3074	3077	2989	0
+3016	3021	3103	0
+3019	3106	3018	0
+3078	2989	3077	0
+3075	2991	3079	0
+3020	3108	3019	0
+3079	2992	3080	0
+3113	3024	3023	0
+3078	3085	2997	0
+3084	2996	3082	0
+3025	3024	3114	0
+3084	3083	2996	0
+3023	3028	3112	0
+3111	3022	3031	0
+3086	3082	2998	0
+3087	3081	2999	0
+3026	3025	3116	0
+3110	3035	3022	0
+3085	3086	2998	0
+3083	3087	2999	0
+3029	3027	3118	0
+3119	3028	3029	0
+3117	3034	3026	0
+3089	3088	3001	0
+3089	3001	3090	0
+3110	3037	3035	0
+3030	3121	3031	0
+3098	3011	3073	0
+3002	3091	3090	0
+3033	3121	3030	0
+3122	3032	3034	0
+3091	3004	3094	0
+3004	3092	3093	0
+3095	3007	3088	0
+3004	3093	3094	0
+3097	3096	3010	0
+3124	3040	3041	0
+3011	3098	3097	0
+3039	3123	3046	0
+3040	3125	3045	0
+3041	3043	3127	0
+3099	3013	3100	0
+3101	3100	3013	0
+3130	3043	3042	0
+3047	3130	3042	0
+3134	3044	3045	0
+3102	3017	3105	0
+3104	3017	3103	0
+3101	3018	3106	0
+3044	3133	3048	0
+3017	3104	3105	0
+3046	3136	3047	0
+3076	3075	3079	0
+3109	3020	3102	0
+3107	3106	3019	0
+3019	3108	3107	0
+3138	3051	3048	0
+3020	3109	3108	0
+3139	3049	3050	0
+3140	3050	3051	0
+3022	3111	3110	0
+3112	3113	3023	0
+3055	3054	3142	0
+3024	3113	3115	0
+3024	3115	3114	0
+3055	3143	3056	0
+3025	3114	3116	0
+3063	3141	3054	0
+3117	3026	3116	0
+3112	3028	3119	0
+3058	3144	3060	0
+3121	3111	3031	0
+3058	3061	3144	0
+3059	3060	3145	0
+3145	3062	3059	0
+3120	3029	3118	0
+3120	3119	3029	0
+3117	3122	3034	0
+3061	3065	3149	0
+3062	3151	3063	0
+3064	3155	3065	0
+3126	3040	3124	0
+3126	3125	3040	0
+3124	3041	3129	0
+3068	3157	3069	0
+3071	3156	3068	0
+3127	3128	3041	0
+3041	3128	3129	0
+3158	3072	3069	0
+3127	3043	3131	0
+3071	3070	3160	0
+3123	3136	3046	0
+3043	3130	3132	0
+3045	3125	3135	0
+3072	3161	3073	0
+3043	3132	3131	0
+3134	3133	3044	0
+3135	3134	3045	0
+3047	3137	3130	0
+3076	3165	3074	0
+3077	3074	3165	0
+3133	3138	3048	0
+3137	3047	3136	0
+3166	3076	3079	0
+3168	3078	3077	0
+3166	3079	3080	0
+3138	3140	3051	0
+3139	3050	3140	0
+3085	3078	3172	0
+3098	3073	3164	0
+3141	3142	3054	0
+3142	3143	3055	0
+3174	3084	3082	0
+3173	3081	3087	0
+3083	3084	3175	0
+3174	3082	3086	0
+3087	3083	3176	0
+3085	3179	3086	0
+3144	3146	3060	0
+3147	3145	3060	0
+3060	3146	3148	0
+3060	3148	3147	0
+3144	3061	3150	0
+3141	3063	3153	0
+3088	3089	3181	0
+3152	3062	3145	0
+3061	3149	3150	0
+3089	3090	3183	0
+3088	3181	3095	0
+3152	3151	3062	0
+3185	3090	3091	0
+3154	3063	3151	0
+3155	3149	3065	0
+3154	3153	3063	0
+3187	3091	3094	0
+3092	3188	3093	0
+3094	3093	3190	0
+3157	3068	3156	0
+3069	3157	3159	0
+3158	3069	3159	0
+3097	3193	3096	0
+3160	3156	3071	0
+3097	3098	3194	0
+3158	3162	3072	0
+3161	3072	3162	0
+3099	3100	3196	0
+3161	3163	3073	0
+3197	3100	3101	0
+3163	3164	3073	0
+3101	3106	3198	0
+3102	3105	3199	0
+3076	3167	3165	0
+3200	3105	3104	0
+3167	3076	3166	0
+3109	3102	3199	0
+3169	3077	3165	0
+3077	3169	3168	0
+3107	3201	3106	0
+3078	3168	3171	0
+3203	3107	3108	0
+3138	3133	3148	0
+3171	3170	3078	0
+3078	3170	3172	0
+3205	3108	3109	0
+3113	3112	3206	0
+3138	3148	3146	0
+3175	3176	3083	0
+3208	3115	3113	0
+3084	3177	3175	0
+3179	3085	3172	0
+3178	3084	3174	0
+3173	3087	3176	0
+3119	3207	3112	0
+3178	3177	3084	0
+3116	3114	3210	0
+3180	3174	3086	0
+3114	3115	3211	0
+3132	3202	3107	0
+3132	3107	3203	0
+3180	3086	3179	0
+3116	3214	3117	0
+3089	3182	3181	0
+3122	3117	3214	0
+3120	3118	3216	0
+3184	3182	3089	0
+3183	3184	3089	0
+3120	3217	3119	0
+3164	3195	3098	0
+3183	3090	3186	0
+3185	3186	3090	0
+3091	3187	3185	0
+3130	3202	3132	0
+3188	3189	3093	0
+3221	3126	3124	0
+3189	3190	3093	0
+3094	3192	3187	0
+3220	3124	3129	0
+3126	3223	3125	0
+3190	3191	3094	0
+3094	3191	3192	0
+3219	3136	3123	0
+3128	3127	3225	0
+3125	3222	3135	0
+3225	3127	3131	0
+3128	3226	3129	0
+3097	3194	3193	0
+3195	3194	3098	0
+3219	3137	3136	0
+3100	3197	3196	0
+3131	3132	3230	0
+3130	3137	3229	0
+3101	3198	3197	0
+3231	3133	3134	0
+3134	3135	3232	0
+3105	3200	3199	0
+3201	3198	3106	0
+3107	3202	3201	0
+3148	3133	3231	0
+3234	3140	3138	0
+3109	3199	3205	0
+3235	3139	3140	0
+3203	3108	3204	0
+3205	3204	3108	0
+3146	3234	3138	0
+3141	3237	3142	0
+3143	3142	3237	0
+3146	3144	3234	0
+3206	3112	3207	0
+3150	3234	3144	0
+3113	3206	3209	0
+3145	3147	3238	0
+3113	3209	3208	0
+3153	3237	3141	0
+3178	3174	3180	0
+3239	3147	3148	0
+3145	3238	3152	0
+3210	3114	3211	0
+3115	3208	3213	0
+3212	3211	3115	0
+3240	3150	3149	0
+3115	3213	3212	0
+3215	3116	3210	0
+3217	3207	3119	0
+3240	3149	3155	0
+3242	3151	3152	0
+3215	3214	3116	0
+3151	3242	3154	0
+3216	3218	3120	0
+3120	3218	3217	0
+3245	3157	3156	0
+3130	3229	3202	0
+3156	3160	3245	0
+3157	3246	3159	0
+3247	3158	3159	0
+3220	3221	3124	0
+3230	3132	3203	0
+3248	3162	3158	0
+3222	3125	3223	0
+3126	3221	3224	0
+3223	3126	3224	0
+3162	3251	3161	0
+3252	3163	3161	0
+3228	3220	3129	0
+3225	3227	3128	0
+3163	3254	3164	0
+3227	3226	3128	0
+3226	3228	3129	0
+3230	3225	3131	0
+3233	3137	3219	0
+3135	3222	3232	0
+3167	3259	3165	0
+3165	3258	3169	0
+3166	3260	3167	0
+3134	3232	3231	0
+3233	3229	3137	0
+3168	3169	3263	0
+3262	3171	3168	0
+3171	3268	3170	0
+3172	3170	3267	0
+3234	3236	3140	0
+3140	3236	3235	0
+3195	3164	3256	0
+3231	3239	3148	0
+3176	3270	3173	0
+3236	3234	3150	0
+3179	3172	3269	0
+3177	3271	3175	0
+3175	3272	3176	0
+3239	3238	3147	0
+3150	3241	3236	0
+3178	3274	3177	0
+3150	3240	3241	0
+3178	3180	3275	0
+3238	3244	3152	0
+3276	3180	3179	0
+3152	3243	3242	0
+3243	3152	3244	0
+3279	3181	3182	0
+3184	3281	3182	0
+3245	3246	3157	0
+3184	3183	3282	0
+3186	3283	3183	0
+3247	3248	3158	0
+3246	3249	3159	0
+3247	3159	3250	0
+3185	3286	3186	0
+3250	3159	3249	0
+3185	3187	3287	0
+3162	3248	3253	0
+3251	3252	3161	0
+3162	3253	3251	0
+3188	3291	3189	0
+3290	3187	3192	0
+3252	3255	3163	0
+3190	3189	3292	0
+3163	3255	3254	0
+3293	3191	3190	0
+3257	3164	3254	0
+3191	3294	3192	0
+3257	3256	3164	0
+3259	3258	3165	0
+3193	3194	3296	0
+3195	3296	3194	0
+3261	3259	3167	0
+3260	3261	3167	0
+3297	3196	3197	0
+3258	3264	3169	0
+3197	3198	3297	0
+3192	3253	3248	0
+3168	3263	3262	0
+3265	3263	3169	0
+3299	3198	3201	0
+3200	3300	3199	0
+3266	3169	3264	0
+3169	3266	3265	0
+3171	3262	3268	0
+3302	3201	3202	0
+3301	3205	3199	0
+3269	3172	3267	0
+3304	3203	3204	0
+3235	3236	3241	0
+3305	3204	3205	0
+3175	3271	3272	0
+3273	3270	3176	0
+3206	3207	3307	0
+3306	3209	3206	0
+3273	3176	3272	0
+3271	3177	3274	0
+3179	3269	3277	0
+3208	3209	3310	0
+3178	3275	3274	0
+3310	3213	3208	0
+3277	3276	3179	0
+3207	3217	3308	0
+3302	3202	3229	0
+3278	3275	3180	0
+3180	3276	3278	0
+3313	3210	3211	0
+3248	3295	3192	0
+3230	3203	3303	0
+3211	3212	3313	0
+3210	3313	3215	0
+3253	3192	3294	0
+3280	3279	3182	0
+3281	3280	3182	0
+3256	3296	3195	0
+3183	3283	3282	0
+3218	3216	3315	0
+3284	3281	3184	0
+3285	3184	3282	0
+3184	3285	3284	0
+3217	3218	3318	0
+3283	3186	3288	0
+3287	3286	3185	0
+3220	3319	3221	0
+3286	3289	3186	0
+3186	3289	3288	0
+3290	3287	3187	0
+3224	3221	3321	0
+3222	3223	3322	0
+3291	3292	3189	0
+3326	3223	3224	0
+3293	3190	3292	0
+3290	3192	3295	0
+3191	3293	3294	0
+3324	3232	3222	0
+3225	3328	3227	0
+3227	3329	3226	0
+3230	3328	3225	0
+3228	3226	3329	0
+3298	3297	3198	0
+3233	3332	3229	0
+3298	3198	3299	0
+3334	3231	3232	0
+3301	3199	3300	0
+3302	3299	3201	0
+3239	3231	3335	0
+3203	3304	3303	0
+3205	3301	3305	0
+3335	3238	3239	0
+3305	3304	3204	0
+3307	3306	3206	0
+3337	3244	3238	0
+3207	3309	3307	0
+3207	3308	3309	0
+3244	3338	3243	0
+3209	3306	3312	0
+3209	3311	3310	0
+3209	3312	3311	0
+3247	3340	3248	0
+3250	3339	3247	0
+3314	3213	3310	0
+3250	3249	3341	0
+3308	3217	3316	0
+3251	3342	3252	0
+3253	3342	3251	0
+3343	3255	3252	0
+3316	3217	3317	0
+3315	3318	3218	0
+3217	3318	3317	0
+3344	3254	3255	0
+3320	3221	3319	0
+3344	3257	3254	0
+3230	3303	3328	0
+3320	3321	3221	0
+3333	3302	3229	0
+3347	3258	3259	0
+3322	3323	3222	0
+3259	3261	3348	0
+3258	3347	3264	0
+3222	3323	3324	0
+3260	3349	3261	0
+3322	3223	3325	0
+3321	3327	3224	0
+3223	3326	3325	0
+3263	3350	3262	0
+3326	3224	3327	0
+3262	3350	3268	0
+3352	3263	3265	0
+3353	3266	3264	0
+3248	3340	3295	0
+3330	3329	3227	0
+3355	3265	3266	0
+3328	3331	3227	0
+3330	3227	3331	0
+3342	3253	3294	0
+3232	3324	3336	0
+3358	3269	3267	0
+3333	3229	3332	0
+3231	3334	3335	0
+3273	3359	3270	0
+3232	3336	3334	0
+3269	3358	3277	0
+3271	3361	3272	0
+3274	3360	3271	0
+3273	3272	3363	0
+3238	3335	3337	0
+3365	3274	3275	0
+3338	3244	3337	0
+3367	3275	3278	0
+3276	3277	3368	0
+3368	3278	3276	0
+3340	3247	3339	0
+3292	3343	3293	0
+3294	3293	3342	0
+3250	3341	3339	0
+3280	3372	3279	0
+3373	3280	3281	0
+3343	3252	3342	0
+3281	3284	3374	0
+3283	3375	3282	0
+3285	3282	3375	0
+3345	3344	3255	0
+3343	3346	3255	0
+3345	3255	3346	0
+3376	3283	3288	0
+3284	3285	3378	0
+3286	3287	3381	0
+3347	3259	3348	0
+3289	3286	3381	0
+3349	3348	3261	0
+3290	3382	3287	0
+3289	3383	3288	0
+3264	3347	3353	0
+3351	3350	3263	0
+3352	3351	3263	0
+3291	3387	3292	0
+3354	3352	3265	0
+3295	3386	3290	0
+3354	3265	3355	0
+3266	3353	3357	0
+3266	3356	3355	0
+3293	3343	3342	0
+3357	3356	3266	0
+3346	3343	3292	0
+3298	3299	3390	0
+3361	3271	3360	0
+3299	3302	3391	0
+3300	3392	3301	0
+3361	3362	3272	0
+3364	3359	3273	0
+3272	3362	3363	0
+3392	3305	3301	0
+3360	3274	3365	0
+3393	3303	3304	0
+3363	3364	3273	0
+3305	3394	3304	0
+3358	3369	3277	0
+3275	3366	3365	0
+3275	3367	3366	0
+3397	3306	3307	0
+3277	3369	3368	0
+3278	3370	3367	0
+3400	3307	3309	0
+3306	3398	3312	0
+3371	3278	3368	0
+3308	3401	3309	0
+3371	3370	3278	0
+3340	3388	3295	0
+3303	3393	3328	0
+3311	3403	3310	0
+3373	3372	3280	0
+3316	3401	3308	0
+3292	3387	3346	0
+3391	3302	3333	0
+3403	3314	3310	0
+3374	3373	3281	0
+3312	3405	3311	0
+3283	3377	3375	0
+3374	3284	3378	0
+3377	3283	3376	0
+3379	3285	3375	0
+3318	3315	3409	0
+3285	3380	3378	0
+3316	3317	3410	0
+3285	3379	3380	0
+3318	3411	3317	0
+3288	3383	3376	0
+3381	3287	3382	0
+3328	3393	3331	0
+3320	3319	3414	0
+3289	3381	3384	0
+3383	3289	3384	0
+3320	3415	3321	0
+3290	3385	3382	0
+3386	3385	3290	0
+3322	3417	3323	0
+3417	3322	3325	0
+3321	3416	3327	0
+3323	3418	3324	0
+3295	3389	3386	0
+3388	3389	3295	0
+3326	3421	3325	0
+3423	3326	3327	0
+3345	3346	3387	0
+3390	3299	3391	0
+3420	3336	3324	0
+3425	3330	3331	0
+3304	3394	3393	0
+3332	3426	3333	0
+3395	3305	3392	0
+3394	3305	3395	0
+3427	3335	3334	0
+3336	3427	3334	0
+3397	3396	3306	0
+3396	3398	3306	0
+3337	3335	3428	0
+3397	3307	3399	0
+3337	3428	3338	0
+3307	3400	3399	0
+3339	3429	3340	0
+3368	3369	3371	0
+3429	3339	3341	0
+3402	3400	3309	0
+3401	3402	3309	0
+3407	3312	3398	0
+3404	3403	3311	0
+3404	3311	3405	0
+3312	3406	3405	0
+3348	3430	3347	0
+3312	3407	3406	0
+3314	3403	3408	0
+3401	3316	3410	0
+3349	3431	3348	0
+3347	3430	3353	0
+3351	3352	3433	0
+3317	3412	3410	0
+3412	3317	3411	0
+3409	3413	3318	0
+3352	3354	3434	0
+3318	3413	3411	0
+3357	3353	3435	0
+3354	3355	3437	0
+3414	3415	3320	0
+3393	3425	3331	0
+3439	3355	3356	0
+3426	3391	3333	0
+3416	3321	3415	0
+3440	3356	3357	0
+3388	3340	3429	0
+3323	3417	3419	0
+3323	3419	3418	0
+3418	3420	3324	0
+3417	3325	3422	0
+3359	3364	3443	0
+3361	3360	3445	0
+3327	3416	3424	0
+3422	3325	3421	0
+3365	3444	3360	0
+3362	3361	3447	0
+3421	3326	3423	0
+3363	3362	3448	0
+3423	3327	3424	0
+3363	3450	3364	0
+3453	3365	3366	0
+3367	3455	3366	0
+3427	3428	3335	0
+3455	3367	3370	0
+3372	3373	3456	0
+3374	3458	3373	0
+3390	3391	3426	0
+3432	3430	3348	0
+3348	3431	3432	0
+3459	3374	3378	0
+3460	3375	3377	0
+3376	3461	3377	0
+3460	3379	3375	0
+3378	3380	3459	0
+3430	3435	3353	0
+3433	3352	3434	0
+3376	3383	3462	0
+3434	3354	3436	0
+3379	3466	3380	0
+3437	3436	3354	0
+3438	3437	3355	0
+3355	3439	3438	0
+3381	3382	3470	0
+3442	3357	3435	0
+3384	3381	3469	0
+3439	3356	3440	0
+3471	3382	3385	0
+3440	3357	3441	0
+3357	3442	3441	0
+3383	3384	3473	0
+3386	3475	3385	0
+3360	3444	3445	0
+3386	3389	3475	0
+3445	3446	3361	0
+3447	3361	3446	0
+3449	3362	3447	0
+3443	3364	3451	0
+3448	3362	3449	0
+3448	3450	3363	0
+3444	3365	3454	0
+3476	3393	3394	0
+3476	3394	3395	0
+3450	3452	3364	0
+3364	3452	3451	0
+3397	3477	3396	0
+3398	3396	3478	0
+3365	3453	3454	0
+3453	3366	3455	0
+3399	3479	3397	0
+3481	3399	3400	0
+3402	3482	3400	0
+3480	3407	3398	0
+3380	3466	3439	0
+3456	3373	3457	0
+3380	3439	3468	0
+3401	3484	3402	0
+3458	3457	3373	0
+3459	3458	3374	0
+3403	3404	3486	0
+3410	3483	3401	0
+3476	3425	3393	0
+3488	3404	3405	0
+3408	3403	3486	0
+3461	3376	3462	0
+3464	3460	3377	0
+3461	3463	3377	0
+3405	3406	3490	0
+3464	3377	3463	0
+3460	3465	3379	0
+3491	3406	3407	0
+3459	3380	3468	0
+3379	3465	3467	0
+3466	3379	3467	0
+3413	3409	3494	0
+3495	3410	3412	0
+3383	3472	3462	0
+3411	3496	3412	0
+3470	3469	3381	0
+3411	3413	3497	0
+3382	3471	3470	0
+3469	3474	3384	0
+3473	3472	3383	0
+3415	3414	3502	0
+3473	3384	3474	0
+3385	3475	3471	0
+3502	3416	3415	0
+3419	3417	3504	0
+3419	3505	3418	0
+3422	3504	3417	0
+3416	3503	3424	0
+3418	3505	3420	0
+3439	3466	3438	0
+3468	3439	3440	0
+3396	3477	3478	0
+3421	3508	3422	0
+3508	3421	3423	0
+3477	3397	3479	0
+3478	3480	3398	0
+3424	3511	3423	0
+3482	3481	3400	0
+3401	3483	3484	0
+3402	3485	3482	0
+3485	3402	3484	0
+3487	3486	3404	0
+3430	3432	3515	0
+3487	3404	3488	0
+3407	3480	3492	0
+3516	3432	3431	0
+3430	3515	3435	0
+3405	3489	3488	0
+3489	3405	3490	0
+3517	3433	3434	0
+3517	3434	3436	0
+3490	3406	3491	0
+3493	3408	3486	0
+3483	3410	3495	0
+3491	3407	3492	0
+3436	3437	3518	0
+3435	3515	3442	0
+3520	3437	3438	0
+3523	3440	3441	0
+3411	3497	3496	0
+3499	3495	3412	0
+3498	3412	3496	0
+3524	3441	3442	0
+3413	3494	3501	0
+3498	3499	3412	0
+3413	3500	3497	0
+3500	3413	3501	0
+3445	3444	3529	0
+3527	3443	3451	0
+3530	3446	3445	0
+3503	3416	3502	0
+3521	3438	3466	0
+3446	3533	3447	0
+3528	3444	3454	0
+3440	3522	3468	0
+3505	3419	3506	0
+3504	3507	3419	0
+3535	3449	3447	0
+3506	3419	3507	0
+3448	3449	3537	0
+3536	3450	3448	0
+3510	3504	3422	0
+3536	3452	3450	0
+3503	3512	3424	0
+3509	3422	3508	0
+3510	3422	3509	0
+3451	3452	3539	0
+3511	3508	3423	0
+3513	3424	3512	0
+3424	3514	3511	0
+3424	3513	3514	0
+3521	3466	3467	0
+3542	3456	3457	0
+3458	3543	3457	0
+3459	3544	3458	0
+3516	3515	3432	0
+3493	3486	3487	0
+3464	3545	3460	0
+3546	3461	3462	0
+3465	3460	3545	0
+3436	3518	3517	0
+3459	3468	3544	0
+3519	3518	3437	0
+3464	3463	3548	0
+3520	3519	3437	0
+3521	3520	3438	0
+3465	3549	3467	0
+3472	3547	3462	0
+3515	3525	3442	0
+3522	3440	3523	0
+3441	3524	3523	0
+3442	3525	3524	0
+3469	3470	3554	0
+3526	3443	3527	0
+3471	3556	3470	0
+3469	3555	3474	0
+3528	3529	3444	0
+3472	3473	3558	0
+3445	3529	3530	0
+3560	3473	3474	0
+3532	3446	3530	0
+3532	3531	3446	0
+3446	3531	3533	0
+3533	3534	3447	0
+3535	3447	3534	0
+3539	3527	3451	0
+3562	3478	3477	0
+3562	3477	3479	0
+3536	3448	3537	0
+3538	3449	3535	0
+3480	3478	3564	0
+3449	3538	3537	0
+3541	3452	3536	0
+3481	3482	3567	0
+3540	3539	3452	0
+3452	3541	3540	0
+3482	3485	3567	0
+3483	3568	3484	0
+3480	3566	3492	0
+3552	3521	3467	0
+3484	3571	3485	0
+3542	3457	3543	0
+3553	3468	3522	0
+3544	3543	3458	0
+3569	3483	3495	0
+3572	3487	3488	0
+3489	3574	3488	0
+3493	3487	3572	0
+3490	3575	3489	0
+3546	3462	3547	0
+3548	3545	3464	0
+3490	3491	3577	0
+3550	3465	3545	0
+3491	3492	3578	0
+3549	3465	3550	0
+3468	3553	3544	0
+3549	3551	3467	0
+3552	3467	3551	0
+3499	3581	3495	0
+3497	3582	3496	0
+3494	3580	3501	0
+3582	3498	3496	0
+3554	3555	3469	0
+3559	3547	3472	0
+3497	3500	3583	0
+3557	3554	3470	0
+3499	3498	3585	0
+3557	3470	3556	0
+3558	3559	3472	0
+3555	3561	3474	0
+3500	3501	3589	0
+3558	3473	3560	0
+3561	3560	3474	0
+3591	3507	3504	0
+3563	3478	3562	0
+3564	3478	3563	0
+3507	3593	3506	0
+3510	3592	3504	0
+3564	3565	3480	0
+3480	3565	3566	0
+3508	3594	3509	0
+3594	3508	3511	0
+3510	3509	3595	0
+3569	3568	3483	0
+3484	3568	3570	0
+3514	3597	3511	0
+3567	3485	3571	0
+3513	3512	3598	0
+3571	3484	3570	0
+3513	3599	3514	0
+3516	3601	3515	0
+3573	3572	3488	0
+3573	3488	3574	0
+3566	3579	3492	0
+3574	3489	3576	0
+3576	3489	3575	0
+3543	3544	3553	0
+3519	3520	3602	0
+3515	3601	3525	0
+3490	3577	3575	0
+3545	3548	3550	0
+3520	3521	3603	0
+3581	3569	3495	0
+3577	3491	3578	0
+3492	3579	3578	0
+3604	3522	3523	0
+3523	3524	3605	0
+3525	3607	3524	0
+3527	3608	3526	0
+3583	3582	3497	0
+3582	3584	3498	0
+3585	3498	3584	0
+3499	3587	3581	0
+3528	3611	3529	0
+3529	3611	3530	0
+3586	3499	3585	0
+3583	3500	3588	0
+3501	3580	3590	0
+3499	3586	3587	0
+3530	3611	3532	0
+3610	3527	3539	0
+3612	3533	3531	0
+3603	3521	3552	0
+3589	3588	3500	0
+3612	3534	3533	0
+3553	3522	3604	0
+3501	3590	3589	0
+3535	3534	3613	0
+3591	3504	3592	0
+3535	3614	3538	0
+3536	3537	3615	0
+3507	3591	3593	0
+3537	3538	3616	0
+3541	3536	3615	0
+3539	3540	3618	0
+3592	3510	3596	0
+3595	3509	3594	0
+3619	3540	3541	0
+3596	3510	3595	0
+3511	3597	3594	0
+3621	3542	3543	0
+3598	3599	3513	0
+3514	3600	3597	0
+3600	3514	3599	0
+3547	3623	3546	0
+3553	3622	3543	0
+3602	3520	3603	0
+3552	3551	3624	0
+3559	3623	3547	0
+3523	3605	3604	0
+3525	3601	3607	0
+3606	3605	3524	0
+3554	3626	3555	0
+3557	3625	3554	0
+3607	3606	3524	0
+3556	3629	3557	0
+3561	3555	3627	0
+3608	3527	3609	0
+3610	3609	3527	0
+3558	3630	3559	0
+3560	3630	3558	0
+3633	3560	3561	0
+3534	3612	3613	0
+3613	3614	3535	0
+3564	3563	3635	0
+3635	3565	3564	0
+3539	3618	3610	0
+3636	3566	3565	0
+3616	3615	3537	0
+3614	3617	3538	0
+3616	3538	3617	0
+3541	3615	3620	0
+3639	3570	3568	0
+3619	3618	3540	0
+3568	3569	3640	0
+3604	3622	3553	0
+3624	3603	3552	0
+3619	3541	3620	0
+3579	3566	3638	0
+3621	3543	3622	0
+3573	3574	3642	0
+3641	3569	3581	0
+3574	3576	3642	0
+3575	3643	3576	0
+3577	3644	3575	0
+3578	3644	3577	0
+3578	3579	3647	0
+3626	3554	3625	0
+3555	3626	3628	0
+3627	3555	3628	0
+3629	3625	3557	0
+3623	3559	3631	0
+3583	3652	3582	0
+3650	3581	3587	0
+3652	3584	3582	0
+3649	3590	3580	0
+3630	3632	3559	0
+3627	3634	3561	0
+3631	3559	3632	0
+3633	3630	3560	0
+3584	3655	3585	0
+3583	3588	3654	0
+3633	3561	3634	0
+3603	3624	3602	0
+3585	3658	3586	0
+3586	3659	3587	0
+3565	3635	3636	0
+3589	3660	3588	0
+3636	3637	3566	0
+3590	3662	3589	0
+3638	3566	3637	0
+3592	3663	3591	0
+3639	3568	3640	0
+3593	3591	3663	0
+3641	3640	3569	0
+3596	3665	3592	0
+3595	3594	3666	0
+3667	3594	3597	0
+3669	3596	3595	0
+3644	3643	3575	0
+3576	3645	3642	0
+3579	3638	3648	0
+3643	3646	3576	0
+3645	3576	3646	0
+3597	3600	3671	0
+3599	3598	3672	0
+3647	3644	3578	0
+3672	3600	3599	0
+3581	3651	3641	0
+3579	3648	3647	0
+3651	3581	3650	0
+3675	3604	3605	0
+3606	3675	3605	0
+3652	3583	3653	0
+3583	3654	3653	0
+3656	3584	3652	0
+3609	3677	3608	0
+3656	3655	3584	0
+3650	3587	3659	0
+3609	3610	3678	0
+3655	3657	3585	0
+3674	3622	3604	0
+3585	3657	3658	0
+3649	3662	3590	0
+3588	3661	3654	0
+3659	3586	3658	0
+3610	3618	3679	0
+3660	3661	3588	0
+3589	3662	3660	0
+3614	3680	3617	0
+3682	3615	3616	0
+3681	3620	3615	0
+3683	3616	3617	0
+3674	3621	3622	0
+3664	3663	3592	0
+3665	3664	3592	0
+3686	3618	3619	0
+3620	3688	3619	0
+3594	3668	3666	0
+3667	3668	3594	0
+3595	3666	3669	0
+3596	3670	3665	0
+3669	3670	3596	0
+3671	3667	3597	0
+3692	3626	3625	0
+3671	3600	3673	0
+3673	3600	3672	0
+3692	3625	3629	0
+3693	3628	3626	0
+3694	3627	3628	0
+3674	3604	3675	0
+3695	3634	3627	0
+3632	3630	3698	0
+3633	3698	3630	0
+3677	3676	3608	0
+3699	3631	3632	0
+3678	3677	3609	0
+3700	3633	3634	0
+3679	3678	3610	0
+3615	3682	3681	0
+3638	3637	3704	0
+3680	3685	3617	0
+3616	3684	3682	0
+3684	3616	3683	0
+3687	3679	3618	0
+3640	3705	3639	0
+3685	3683	3617	0
+3705	3640	3641	0
+3704	3648	3638	0
+3687	3618	3686	0
+3691	3620	3681	0
+3689	3686	3619	0
+3643	3644	3707	0
+3646	3643	3706	0
+3688	3689	3619	0
+3651	3705	3641	0
+3620	3690	3688	0
+3644	3647	3709	0
+3691	3690	3620	0
+3710	3645	3646	0
+3648	3711	3647	0
+3693	3626	3692	0
+3694	3695	3627	0
+3693	3696	3628	0
+3694	3628	3697	0
+3697	3628	3696	0
+3652	3653	3717	0
+3717	3656	3652	0
+3718	3653	3654	0
+3649	3716	3662	0
+3699	3632	3698	0
+3698	3633	3700	0
+3702	3634	3695	0
+3657	3655	3721	0
+3655	3656	3722	0
+3661	3719	3654	0
+3634	3702	3701	0
+3700	3634	3703	0
+3634	3701	3703	0
+3660	3724	3661	0
+3725	3660	3662	0
+3664	3665	3728	0
+3706	3643	3708	0
+3643	3707	3708	0
+3707	3644	3709	0
+3710	3646	3706	0
+3670	3728	3665	0
+3729	3666	3668	0
+3666	3729	3669	0
+3713	3648	3704	0
+3730	3668	3667	0
+3647	3712	3709	0
+3671	3731	3667	0
+3711	3712	3647	0
+3733	3670	3669	0
+3714	3711	3648	0
+3714	3648	3713	0
+3673	3736	3671	0
+3715	3716	3649	0
+3653	3718	3717	0
+3677	3739	3676	0
+3720	3718	3654	0
+3719	3720	3654	0
+3677	3678	3740	0
+3723	3656	3717	0
+3679	3741	3678	0
+3721	3655	3722	0
+3723	3722	3656	0
+3716	3725	3662	0
+3726	3719	3661	0
+3681	3682	3744	0
+3742	3679	3687	0
+3743	3685	3680	0
+3724	3660	3725	0
+3661	3724	3727	0
+3682	3684	3746	0
+3684	3683	3747	0
+3726	3661	3727	0
+3683	3685	3748	0
+3745	3691	3681	0
+3751	3687	3686	0
+3689	3750	3686	0
+3667	3731	3730	0
+3668	3732	3729	0
+3668	3730	3732	0
+3729	3733	3669	0
+3689	3688	3755	0
+3728	3670	3734	0
+3755	3688	3690	0
+3757	3690	3691	0
+3733	3735	3670	0
+3737	3731	3671	0
+3734	3670	3735	0
+3737	3671	3736	0
+3694	3760	3695	0
+3697	3759	3694	0
+3738	3676	3739	0
+3696	3762	3697	0
+3677	3740	3739	0
+3695	3761	3702	0
+3740	3678	3741	0
+3763	3699	3698	0
+3764	3698	3700	0
+3679	3742	3741	0
+3765	3700	3703	0
+3766	3701	3702	0
+3744	3745	3681	0
+3703	3701	3767	0
+3682	3746	3744	0
+3743	3748	3685	0
+3748	3747	3683	0
+3749	3746	3684	0
+3684	3747	3749	0
+3687	3753	3742	0
+3772	3706	3708	0
+3772	3710	3706	0
+3708	3707	3773	0
+3752	3686	3750	0
+3752	3751	3686	0
+3707	3709	3774	0
+3687	3751	3754	0
+3754	3753	3687	0
+3745	3758	3691	0
+3750	3689	3756	0
+3777	3709	3712	0
+3755	3756	3689	0
+3711	3779	3712	0
+3714	3778	3711	0
+3757	3691	3758	0
+3714	3713	3781	0
+3760	3694	3759	0
+3783	3716	3715	0
+3695	3760	3761	0
+3762	3759	3697	0
+3718	3786	3717	0
+3718	3720	3787	0
+3698	3764	3763	0
+3717	3785	3723	0
+3784	3725	3716	0
+3720	3719	3789	0
+3700	3765	3764	0
+3769	3702	3761	0
+3788	3719	3726	0
+3766	3768	3701	0
+3792	3721	3722	0
+3767	3701	3768	0
+3792	3722	3723	0
+3769	3766	3702	0
+3771	3765	3703	0
+3767	3770	3703	0
+3793	3724	3725	0
+3770	3771	3703	0
+3724	3793	3727	0
+3726	3727	3795	0
+3774	3773	3707	0
+3775	3772	3708	0
+3773	3776	3708	0
+3733	3729	3797	0
+3798	3729	3732	0
+3776	3775	3708	0
+3774	3709	3777	0
+3800	3730	3731	0
+3732	3730	3799	0
+3788	3739	3740	0
+3779	3711	3778	0
+3777	3712	3780	0
+3737	3801	3731	0
+3741	3789	3740	0
+3712	3779	3780	0
+3733	3804	3735	0
+3781	3778	3714	0
+3734	3735	3805	0
+3737	3736	3806	0
+3715	3782	3783	0
+3716	3783	3784	0
+3738	3739	3808	0
+3786	3785	3717	0
+3786	3718	3787	0
+3809	3741	3742	0
+3719	3788	3789	0
+3720	3790	3787	0
+3789	3791	3720	0
+3723	3785	3792	0
+3720	3791	3790	0
+3813	3745	3744	0
+3793	3725	3784	0
+3743	3812	3748	0
+3744	3746	3813	0
+3753	3810	3742	0
+3788	3726	3794	0
+3749	3815	3746	0
+3748	3817	3747	0
+3747	3817	3749	0
+3795	3794	3726	0
+3796	3727	3793	0
+3758	3745	3814	0
+3789	3788	3740	0
+3795	3727	3796	0
+3750	3820	3752	0
+3729	3798	3797	0
+3751	3752	3821	0
+3821	3754	3751	0
+3750	3756	3820	0
+3730	3800	3799	0
+3824	3753	3754	0
+3800	3731	3802	0
+3732	3803	3798	0
+3797	3804	3733	0
+3731	3801	3802	0
+3799	3803	3732	0
+3788	3808	3739	0
+3809	3789	3741	0
+3758	3827	3757	0
+3806	3801	3737	0
+3804	3805	3735	0
+3828	3760	3759	0
+3759	3762	3828	0
+3829	3761	3760	0
+3808	3807	3738	0
+3764	3832	3763	0
+3831	3769	3761	0
+3742	3811	3809	0
+3764	3765	3833	0
+3811	3742	3810	0
+3835	3768	3766	0
+3834	3765	3771	0
+3769	3835	3766	0
+3768	3836	3767	0
+3813	3814	3745	0
+3836	3770	3767	0
+3816	3813	3746	0
+3746	3815	3816	0
+3770	3842	3771	0
+3748	3812	3818	0
+3815	3749	3819	0
+3818	3817	3748	0
+3819	3749	3817	0
+3753	3823	3810	0
+3809	3791	3789	0
+3788	3794	3808	0
+3822	3752	3820	0
+3773	3774	3847	0
+3846	3776	3773	0
+3752	3822	3821	0
+3814	3827	3758	0
+3774	3777	3848	0
+3753	3824	3823	0
+3849	3775	3776	0
+3826	3754	3821	0
+3754	3825	3824	0
+3826	3825	3754	0
+3777	3780	3851	0
+3852	3779	3778	0
+3808	3794	3807	0
+3811	3791	3809	0
+3778	3781	3852	0
+3853	3780	3779	0
+3829	3760	3828	0
+3829	3830	3761	0
+3831	3761	3830	0
+3783	3782	3857	0
+3783	3858	3784	0
+3832	3764	3833	0
+3834	3833	3765	0
+3860	3786	3787	0
+3784	3859	3793	0
+3790	3861	3787	0
+3769	3831	3840	0
+3835	3839	3768	0
+3836	3768	3838	0
+3768	3837	3838	0
+3791	3862	3790	0
+3839	3837	3768	0
+3841	3835	3769	0
+3793	3859	3796	0
+3843	3770	3836	0
+3834	3771	3844	0
+3769	3840	3841	0
+3795	3864	3794	0
+3843	3842	3770	0
+3796	3865	3795	0
+3845	3771	3842	0
+3845	3844	3771	0
+3798	3867	3797	0
+3807	3794	3864	0
+3811	3863	3791	0
+3846	3773	3847	0
+3797	3867	3804	0
+3799	3800	3869	0
+3821	3822	3826	0
+3868	3798	3803	0
+3774	3848	3847	0
+3803	3799	3869	0
+3800	3802	3870	0
+3776	3846	3850	0
+3871	3802	3801	0
+3849	3776	3850	0
+3851	3848	3777	0
+3871	3801	3806	0
+3779	3852	3853	0
+3875	3805	3804	0
+3780	3855	3851	0
+3780	3853	3854	0
+3780	3854	3855	0
+3856	3857	3782	0
+3858	3783	3857	0
+3811	3810	3879	0
+3784	3858	3859	0
+3787	3861	3860	0
+3814	3813	3882	0
+3823	3877	3810	0
+3882	3813	3816	0
+3881	3818	3812	0
+3862	3861	3790	0
+3885	3816	3815	0
+3791	3863	3862	0
+3819	3886	3815	0
+3859	3866	3796	0
+3817	3818	3888	0
+3817	3888	3819	0
+3864	3795	3865	0
+3814	3883	3827	0
+3866	3865	3796	0
+3798	3868	3867	0
+3824	3890	3823	0
+3870	3869	3800	0
+3890	3824	3825	0
+3802	3871	3872	0
+3873	3870	3802	0
+3803	3874	3868	0
+3874	3803	3869	0
+3802	3872	3873	0
+3867	3876	3804	0
+3830	3891	3831	0
+3880	3863	3811	0
+3804	3876	3875	0
+3832	3833	3892	0
+3834	3892	3833	0
+3891	3840	3831	0
+3810	3877	3878	0
+3839	3835	3893	0
+3810	3878	3879	0
+3836	3838	3894	0
+3841	3893	3835	0
+3895	3838	3837	0
+3844	3892	3834	0
+3811	3879	3880	0
+3837	3839	3896	0
+3836	3894	3843	0
+3898	3841	3840	0
+3882	3884	3814	0
+3883	3814	3884	0
+3882	3816	3887	0
+3842	3843	3901	0
+3885	3815	3886	0
+3888	3818	3881	0
+3887	3816	3885	0
+3901	3845	3842	0
+3877	3823	3890	0
+3886	3819	3889	0
+3819	3888	3889	0
+3905	3846	3847	0
+3904	3850	3846	0
+3847	3848	3906	0
+3848	3851	3906	0
+3850	3908	3849	0
+3851	3855	3909	0
+3911	3855	3854	0
+3857	3856	3913	0
+3894	3838	3895	0
+3895	3837	3896	0
+3913	3858	3857	0
+3893	3897	3839	0
+3898	3840	3891	0
+3859	3858	3914	0
+3896	3839	3897	0
+3900	3893	3841	0
+3861	3916	3860	0
+3841	3898	3899	0
+3862	3916	3861	0
+3841	3899	3900	0
+3866	3859	3915	0
+3894	3903	3843	0
+3918	3862	3863	0
+3902	3901	3843	0
+3902	3843	3903	0
+3919	3864	3865	0
+3919	3865	3866	0
+3904	3846	3905	0
+3921	3867	3868	0
+3907	3905	3847	0
+3847	3906	3907	0
+3863	3880	3918	0
+3908	3850	3904	0
+3869	3870	3923	0
+3874	3922	3868	0
+3867	3921	3876	0
+3906	3851	3910	0
+3874	3869	3925	0
+3870	3873	3926	0
+3851	3909	3910	0
+3873	3872	3927	0
+3855	3911	3909	0
+3875	3876	3928	0
+3856	3912	3913	0
+3914	3858	3913	0
+3879	3878	3929	0
+3929	3880	3879	0
+3859	3914	3915	0
+3917	3916	3862	0
+3917	3862	3918	0
+3932	3884	3882	0
+3881	3931	3888	0
+3883	3884	3934	0
+3866	3915	3920	0
+3887	3933	3882	0
+3919	3866	3920	0
+3936	3885	3886	0
+3885	3935	3887	0
+3922	3921	3868	0
+3889	3937	3886	0
+3923	3924	3869	0
+3940	3889	3888	0
+3925	3869	3924	0
+3926	3923	3870	0
+3874	3925	3922	0
+3921	3928	3876	0
+3927	3926	3873	0
+3880	3930	3918	0
+3897	3893	3943	0
+3945	3894	3895	0
+3893	3900	3943	0
+3895	3896	3946	0
+3929	3930	3880	0
+3947	3896	3897	0
+3944	3903	3894	0
+3932	3882	3933	0
+3949	3900	3899	0
+3934	3884	3932	0
+3903	3950	3902	0
+3885	3936	3935	0
+3933	3887	3939	0
+3931	3940	3888	0
+3938	3936	3886	0
+3951	3904	3905	0
+3886	3937	3938	0
+3935	3939	3887	0
+3908	3904	3951	0
+3918	3930	3917	0
+3953	3905	3907	0
+3907	3906	3955	0
+3889	3942	3937	0
+3940	3941	3889	0
+3910	3954	3906	0
+3889	3941	3942	0
+3958	3910	3909	0
+3911	3958	3909	0
+3945	3944	3894	0
+3946	3945	3895	0
+3943	3947	3897	0
+3912	3962	3913	0
+3896	3948	3946	0
+3913	3963	3914	0
+3896	3947	3948	0
+3943	3900	3949	0
+3915	3914	3965	0
+3903	3944	3950	0
+3966	3920	3915	0
+3952	3951	3905	0
+3953	3952	3905	0
+3922	3968	3921	0
+3955	3906	3954	0
+3969	3922	3925	0
+3967	3928	3921	0
+3970	3924	3923	0
+3953	3907	3957	0
+3907	3955	3956	0
+3926	3970	3923	0
+3907	3956	3957	0
+3925	3924	3972	0
+3954	3910	3960	0
+3927	3974	3926	0
+3958	3959	3910	0
+3959	3960	3910	0
+3912	3961	3962	0
+3962	3963	3913	0
+3964	3914	3963	0
+3932	3933	3977	0
+3964	3965	3914	0
+3932	3977	3934	0
+3915	3965	3966	0
+3976	3940	3931	0
+3936	3980	3935	0
+3939	3979	3933	0
+3935	3980	3939	0
+3936	3938	3981	0
+3967	3921	3968	0
+3938	3937	3982	0
+3941	3940	3976	0
+3942	3982	3937	0
+3968	3922	3969	0
+3924	3970	3971	0
+3973	3969	3925	0
+3971	3972	3924	0
+3985	3942	3941	0
+3925	3972	3973	0
+3970	3926	3975	0
+3974	3975	3926	0
+3943	3989	3947	0
+3944	3945	3990	0
+3949	3988	3943	0
+3945	3946	3992	0
+3971	3957	3956	0
+3944	3990	3950	0
+3978	3977	3933	0
+3946	3948	3994	0
+3995	3948	3947	0
+3979	3978	3933	0
+3936	3981	3980	0
+3970	3957	3971	0
+3984	3979	3939	0
+3941	3976	3985	0
+3938	3983	3981	0
+3970	3975	3957	0
+3952	3953	3998	0
+3938	3982	3983	0
+3984	3939	3980	0
+3955	3954	3999	0
+3998	3953	3957	0
+3956	3955	3999	0
+3987	3982	3942	0
+3942	3985	3986	0
+3960	3999	3954	0
+3942	3986	3987	0
+3972	3948	3995	0
+3948	3972	3997	0
+3988	3989	3943	0
+3960	3959	4001	0
+3971	3956	3997	0
+3991	3990	3945	0
+4004	3962	3961	0
+3945	3992	3991	0
+3962	4005	3963	0
+3975	3998	3957	0
+3992	3946	3993	0
+3995	3947	3989	0
+3963	4006	3964	0
+3946	3994	3993	0
+3965	3964	4007	0
+3994	3948	3996	0
+3965	4009	3966	0
+3997	3972	3971	0
+3973	3972	3995	0
+3948	3997	3996	0
+3967	3968	4010	0
+4010	3968	3969	0
+3975	3974	3998	0
+3956	3999	3997	0
+3969	3973	4012	0
+3959	4000	4001	0
+4002	3999	3960	0
+4002	3960	4001	0
+4004	3961	4003	0
+3979	4013	3978	0
+4004	4005	3962	0
+3963	4005	4006	0
+3980	3981	4014	0
+3984	4013	3979	0
+3980	4014	3984	0
+3964	4006	4008	0
+4008	4007	3964	0
+3995	4012	3973	0
+3981	3983	4017	0
+4007	4009	3965	0
+3983	3982	4018	0
+3982	3987	4018	0
+4011	4010	3969	0
+3996	3997	3999	0
+4012	4011	3969	0
+3987	3986	4023	0
+3989	3988	4024	0
+3991	3992	4025	0
+3989	4024	3995	0
+4025	3992	3993	0
+3981	4016	4014	0
+3981	4015	4016	0
+3981	4017	4015	0
+3993	3994	4027	0
+3984	4021	4013	0
+3996	4028	3994	0
+4017	3983	4019	0
+4014	4022	3984	0
+3983	4018	4020	0
+4020	4019	3983	0
+3999	4028	3996	0
+4021	3984	4022	0
+4018	3987	4023	0
+3999	4002	4028	0
+3995	4024	4012	0
+4031	4001	4000	0
+4033	4002	4001	0
+4003	4035	4004	0
+4004	4035	4005	0
+3993	4026	4025	0
+4027	4026	3993	0
+4011	4012	4024	0
+4006	4005	4036	0
+4029	4027	3994	0
+4028	4029	3994	0
+4008	4006	4037	0
+4038	4007	4008	0
+4009	4007	4038	0
+4029	4028	4002	0
+4031	4000	4030	0
+4017	4019	4027	0
+4033	4029	4002	0
+4001	4031	4032	0
+4033	4015	4017	0
+4033	4001	4032	0
+4014	4016	4041	0
+4034	4035	4003	0
+4015	4042	4016	0
+4029	4017	4027	0
+4035	4036	4005	0
+4041	4022	4014	0
+4006	4036	4037	0
+4017	4029	4033	0
+4032	4015	4033	0
+4018	4046	4020	0
+4038	4008	4039	0
+4037	4040	4008	0
+4019	4020	4047	0
+4023	4045	4018	0
+4008	4040	4039	0
+4032	4042	4015	0
+4021	4022	4050	0
+4019	4048	4027	0
+4042	4043	4016	0
+4026	4027	4048	0
+4041	4016	4044	0
+4025	4026	4051	0
+4043	4044	4016	0
+4046	4018	4045	0
+4050	4022	4041	0
+4030	4053	4031	0
+4047	4048	4019	0
+4046	4049	4020	0
+4031	4053	4032	0
+4047	4020	4049	0
+4034	4055	4035	0
+4026	4048	4051	0
+4042	4032	4053	0
+4036	4035	4057	0
+4036	4058	4037	0
+4041	4044	4050	0
+4052	4053	4030	0
+4059	4040	4037	0
+4043	4042	4052	0
+4040	4060	4039	0
+4034	4054	4056	0
+4055	4034	4056	0
+4052	4042	4053	0
+4035	4055	4057	0
+4058	4036	4057	0
+4062	4046	4045	0
+4059	4037	4058	0
+4049	4046	4062	0
+4048	4047	4063	0
+4061	4040	4059	0
+4064	4047	4049	0
+4040	4061	4060	0
+4063	4051	4048	0
+4063	4047	4064	0
+4049	4062	4064	0
+4056	4054	4066	0
+4055	4056	4067	0
+4057	4055	4067	0
+4057	4067	4058	0
+4065	4066	4054	0
+4068	4059	4058	0
+4066	4067	4056	0
+4059	4069	4061	0
+4060	4061	4070	0
+4067	4068	4058	0
+4068	4069	4059	0
+4061	4069	4071	0
+4066	4068	4067	0
+4071	4070	4061	0
+4065	4073	4066	0
+4068	4066	4074	0
+4073	4065	4072	0
+4069	4068	4074	0
+4073	4074	4066	0
+4071	4069	4075	0
+4070	4071	4076	0
+4075	4069	4074	0
+4075	4074	4073	0
+4075	4077	4071	0
+4076	4071	4077	0
+4072	4079	4073	0
+4075	4073	4079	0
+4079	4072	4078	0
+4077	4075	4079	0
+4076	4077	4080	0
+4081	4077	4079	0
+4080	4077	4081	0
+4079	4078	4081	0
+4078	4082	4081	0
+4083	4080	4081	0
+4081	4082	4083	0
+4082	4084	4083	0
+2
+0	-1.8080523987007136e-09
+100.00000003700208	2.2532264574435061e-09
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/cfemm/bin/epproc-test"
+  "/root/repo/cfemm/bin/epproc-test.pdb"
+  "CMakeFiles/epproc-test.dir/main.cpp.o"
+  "CMakeFiles/epproc-test.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/epproc-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
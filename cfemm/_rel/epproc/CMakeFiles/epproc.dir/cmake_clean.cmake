@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/epproc.dir/CSPointVals.cpp.o"
+  "CMakeFiles/epproc.dir/CSPointVals.cpp.o.d"
+  "CMakeFiles/epproc.dir/epproc.cpp.o"
+  "CMakeFiles/epproc.dir/epproc.cpp.o.d"
+  "libepproc.a"
+  "libepproc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/epproc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
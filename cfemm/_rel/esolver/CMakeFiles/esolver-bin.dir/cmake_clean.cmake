@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/cfemm/bin/esolver"
+  "/root/repo/cfemm/bin/esolver.pdb"
+  "CMakeFiles/esolver-bin.dir/main.cpp.o"
+  "CMakeFiles/esolver-bin.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/esolver-bin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
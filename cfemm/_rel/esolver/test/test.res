@@ -0,0 +1,5906 @@
+[Format]      =  1
+[Precision]   =  1e-008
+[MinAngle]    =  30
+[Depth]       =  1
+[LengthUnits] =  meters
+[ProblemType] =  axisymmetric
+[Coordinates] =  cartesian
+[Comment]     =  "Add comments here."
+[PointProps]   = 0
+[BdryProps]   = 0
+[BlockProps]  = 2
+  <BeginBlock>
+    <BlockName> = "mat1"
+    <ex> = 4
+    <ey> = 4
+    <qv> = 0
+  <EndBlock>
+  <BeginBlock>
+    <BlockName> = "air"
+    <ex> = 1
+    <ey> = 1
+    <qv> = 0
+  <EndBlock>
+[ConductorProps]  = 2
+  <BeginConductor>
+    <ConductorName> = "m1t"
+    <Vc> = 50
+    <qc> = 0
+    <ConductorType> = 1
+  <EndConductor>
+  <BeginConductor>
+    <ConductorName> = "b1segm"
+    <Vc> = 0
+    <qc> = 0
+    <ConductorType> = 1
+  <EndConductor>
+[NumPoints] = 14
+0	-0.40000000000000002	0	2	2
+0.050000000000000003	-0.40000000000000002	0	2	2
+0.050000000000000003	0.40000000000000002	0	2	2
+0	0.40000000000000002	0	2	2
+0.17999999999999999	-0.29999999999999999	0	4	1
+0.20000000000000001	-0.29999999999999999	0	4	1
+0.20499999999999999	-0.29999999999999999	0	4	1
+0.20499999999999999	0.20000000000000001	0	4	1
+0.20000000000000001	0.20000000000000001	0	4	1
+0.17999999999999999	0.20000000000000001	0	4	1
+0.17499999999999999	0.20000000000000001	0	4	1
+0.17499999999999999	-0.29999999999999999	0	4	1
+0	-1	0	3	0
+0	1	0	3	0
+[NumSegments] = 10
+0	1	-1	0	0	2	2
+1	2	-1	0	0	2	2
+2	3	-1	0	0	2	2
+3	0	-1	0	0	3	0
+4	5	-1	0	0	4	1
+6	7	-1	0	0	4	1
+8	9	-1	0	0	4	1
+10	11	-1	0	0	4	1
+12	0	-1	0	0	0	0
+3	13	-1	0	0	0	0
+[NumArcSegments] = 5
+5	6	49.2486367043279	18	0	0	4	1
+7	8	49.2486367043279	18	0	0	4	1
+9	10	49.248636704328199	18	0	0	4	1
+11	4	49.248636704328199	18	0	0	4	1
+12	13	180	5	0	0	0	0
+[NumHoles] = 2
+0.029999999999999999	0	2
+0.19	-0.040000000000000001	4
+[NumBlockLabels] = 1
+0.90000000000000002	0	1	0.033333333333333333	3	0
+[Solution]
+2040
+0	-0.40000000000000002	0	1
+0	-0.40078800000000003	0.40008892672288388	-2
+0.00078800000000000018	-0.40000000000000002	0	1
+0	-0.40312559375000001	1.5857278412935816	-2
+0.001657615623075921	-0.40165761562307595	0.84196006797006384	-2
+0.0038145000000000006	-0.40000000000000002	0	1
+0	-0.40546318750000004	2.7670470278926032	-2
+0.0025139078425679101	-0.40429439062500006	2.1803433614331822	-2
+0.0053277500000000009	-0.40280244335766852	1.4292162002020889	-2
+0.0068410000000000016	-0.40000000000000002	0	1
+0	-0.41013837500000005	5.1029725476762833	-2
+0.0026154823763429136	-0.40780078125000008	3.9448493003439151	-2
+0.0052053714854993927	-0.40597108976224938	3.0353191076590074	-2
+0.009867500000000003	-0.40344401547539216	1.780930142367287	-2
+0.012894000000000003	-0.40000000000000002	0	1
+0	-0.41481356250000001	7.3672336942901753	-2
+0.0033365844519652895	-0.41123960635416301	5.6608137365152889	-2
+0.0068444710290566507	-0.41103901208019106	5.5982516482287057	-2
+0.016903480660939964	-0.40657522180272049	3.5026671915103647	-2
+0.025000000000000005	-0.40000000000000002	0	1
+0	-0.41948875000000002	9.5522622976848819	-2
+0.0053975381422793796	-0.416508144758023	8.2171316966725136	-2
+0.014891158768895676	-0.41609384111107922	8.2872793318577216	-2
+0.032141266099203251	-0.40687307327719607	4.3531899718136087	-2
+0.030439336545104639	-0.41704574992652782	9.9067599885977291	-2
+0.037106000000000007	-0.40000000000000002	0	1
+0	-0.42883912499999999	13.592801042860989	-2
+0.0061034494438503622	-0.42416393750000003	11.719723721035232	-2
+0.016411748990123789	-0.42656926126054595	13.123832955261168	-2
+0.037621314945542501	-0.40964310846049573	6.6097596580434619	-2
+0.040132500000000008	-0.40403971842434339	3.0602662786194639	-2
+0.041587633267344	-0.4159031893142191	10.918503442021665	-2
+0.037063701812481073	-0.42672174190293927	15.184290389571464	-2
+0.043159000000000003	-0.40000000000000002	0	1
+0	-0.43818950000000001	17.162393621240344	-2
+0.0084234522248486602	-0.4335143125	15.59425804561738	-2
+0.020452355899954359	-0.43928347675406088	18.301295314391858	-2
+0.043703640179599101	-0.40880087926239084	7.1146730344139231	-2
+0.045073849972790972	-0.4030091420592069	2.8706743810624782	-2
+0.048531398681488799	-0.41331390076360552	11.233522095074584	-2
+0.047969842206249239	-0.42241324592004448	15.394365659428034	-2
+0.034022219896607434	-0.43996385308646158	19.643854162458172	-2
+0.046960482820519941	-0.43581590499697642	19.995292992130544	-2
+0.046185500000000004	-0.40000000000000002	0	1
+0	-0.45689025000000005	22.799581703842104	-2
+0.009838228020522451	-0.44598937560623103	19.923289991174595	-2
+0.026546390035038989	-0.45340337710791173	22.901147087710381	-2
+0.049290344872793712	-0.40674894715358678	7.3136203267880866	-2
+0.047698750000000005	-0.40116507005338942	1.4643927354304653	-2
+0.048551434699955466	-0.40316794042635828	3.9655160731300882	-2
+0.053872734419874044	-0.40942227542798509	11.090780203181184	-2
+0.055369468145400877	-0.41708793241645364	15.194622912862139	-2
+0.056220625713239852	-0.42607425060419307	18.645868157571012	-2
+0.043861897270298753	-0.44840327223332943	23.040540841706331	-2
+0.056163732053425904	-0.45186347825362122	25.339170318408499	-2
+0.061275232142374916	-0.44015106041720098	23.427887415742266	-2
+0.049212000000000006	-0.40000000000000002	0	1
+0	-0.47559100000000004	26.720086352684326	-2
+0.013844326318557306	-0.4594949715590757	23.766986231976173	-2
+0.047166118753708935	-0.46093823002118911	26.213349520203685	-2
+0.029800879154866629	-0.47647840321134749	27.878833512961773	-2
+0.050717650027208988	-0.40338258451415537	5.3283235599147227	-2
+0.054122997514202166	-0.40412299751420233	8.1565044232107251	-2
+0.049606000000000004	-0.40126361562307589	2.2169213068053657	-2
+0.057356918621747792	-0.40542159567683006	10.892477175655465	-2
+0.062030209054418681	-0.41300907970362827	16.004888764831101	-2
+0.065240577194010885	-0.42572949117919795	20.801993307355506	-2
+0.074117736979691456	-0.45272733194735004	27.795029824899231	-2
+0.066216953460717737	-0.47082918502054971	29.437414460258982	-2
+0.085922269459794295	-0.43917205441338808	27.650027092176273	-2
+0.050000000000000003	-0.40000000000000002	0	1
+0	-0.51299250000000007	31.961268074934818	-2
+0.052988462231526444	-0.50575301709577425	32.666965145914254	-2
+0.051007318863870388	-0.40100731886387042	3.2238100450109655	-2
+0.05338258451415541	-0.4007176500272091	5.5424323623052185	-2
+0.056760386280691029	-0.39929243705272566	7.9490131316694486	-2
+0.067019717054166594	-0.40014781455866066	14.625240343371399	-2
+0.080635869855391687	-0.41507871756470027	22.69682771365569	-2
+0.10175688198502732	-0.46487912422727884	32.304961064963543	-2
+0.088293783803883266	-0.49357922164440626	33.410747180165664	-2
+0.096694901866467675	-0.42418177338249113	27.713174914237015	-2
+0.10772369076600785	-0.44347348347697035	31.253854438690919	-2
+0.050000000000000003	-0.39921200000000001	0	1
+0.051263615623075923	-0.39960600000000002	2.3193299477366196	-2
+0	-0.55039400000000005	35.250975544900079	-2
+0.029543740565111797	-0.53169325000000001	34.315071329671056	-2
+0.062575637522688188	-0.53798264232411153	35.392585398813296	-2
+0.093528275307426439	-0.52484502889589213	35.703859698313956	-2
+0.053171156693687091	-0.3985453040201119	4.2839092048442495	-2
+0.059064638778996884	-0.39361311730223286	8.220067556594131	-2
+0.053090380317364995	-0.39498150622279093	3.3475571570247711	-2
+0.080677582791825866	-0.39635834698215622	19.743739283508923	-2
+0.067286333639116153	-0.39171380102465325	13.130991421143738	-2
+0.095646519021637011	-0.40575193269502874	25.50246474052668	-2
+0.13906579662176125	-0.46374451805967981	35.546383186409983	-2
+0.12798451293576948	-0.50300531819176375	36.32166824228608	-2
+0.1129895783167036	-0.414010110501145	29.976511520290671	-2
+0.13646055848958522	-0.43340726174273936	34.263844051505309	-2
+0.050000000000000003	-0.39609315625000002	0	1
+0.051179466613876491	-0.39765257812499999	1.6205192370931198	-2
+0	-0.58779550000000003	37.220977038715773	-2
+0.03791622320322624	-0.57760743972591588	37.061199564313711	-2
+0.062640986270383683	-0.56550876675172757	36.871120224939666	-2
+0.087561429280178266	-0.55381845808775265	36.888724264225196	-2
+0.11974601493650225	-0.52810798554089755	36.910785185410489	-2
+0.060132416517377996	-0.387238855381353	8.0824547050766427	-2
+0.054222704272811513	-0.38985546874999999	3.7848739856018474	-2
+0.050000000000000003	-0.39297431250000003	0	1
+0.085099626693733527	-0.37961846597447207	20.086372009965629	-2
+0.067785706730509529	-0.37953932098791698	12.059078940315262	-2
+0.10973222805463412	-0.39507947724021519	28.36165544814266	-2
+0.17009270751457534	-0.44579956354643546	37.574931992681464	-2
+0.17336210198638577	-0.48724767679842979	38.222361021627933	-2
+0.14918273381927469	-0.52386564636790278	37.92310380576928	-2
+0.1417175579359623	-0.39932139452933313	34.321918809243961	-2
+0.1683515627232991	-0.40999929808863689	37.414868010463735	-2
+0	-0.625197	38.507585804398701	-2
+0.032576425266716946	-0.61225239409452814	38.262678408698136	-2
+0.067029756421101983	-0.60579063910286723	38.365837759459424	-2
+0.099119080244790575	-0.58104865373208914	38.095568510922242	-2
+0.13473748660141149	-0.54986281338773235	38.086403513889387	-2
+0.057112646157259341	-0.38152463178521068	5.5393848435116393	-2
+0.050000000000000003	-0.386736625	0	1
+0.078025414745524518	-0.36381550379222155	16.419180825007725	-2
+0.10690372618202679	-0.36037296871747482	26.742449774320807	-2
+0.060663673843635718	-0.37093308767245026	7.5000876454530276	-2
+0.13291573416186628	-0.36286759095537963	33.183091924726888	-2
+0.19007593032347297	-0.42688520713973915	38.942710723625673	-2
+0.21041487254329733	-0.46838694440492712	39.716841076533463	-2
+0.1793232655458897	-0.51747589402618577	38.88554485879876	-2
+0.20981065831806303	-0.51302623452159479	39.80829744039216	-2
+0.18364846858847794	-0.56002824011092123	39.551296858035144	-2
+0.1644238010848873	-0.38157465167139026	37.718399695143596	-2
+0.19519136704428747	-0.39984977891555662	39.845173693647652	-2
+0	-0.66259849999999998	39.384537303116879	-2
+0.031693863337663823	-0.65871477471126194	39.387101444580281	-2
+0.05503687206335027	-0.63692743345498604	39.030128033645475	-2
+0.096026245125636067	-0.61021762595835272	38.827100116453117	-2
+0.12085221293327414	-0.59810150965979036	38.93104414726475	-2
+0.14636088087290641	-0.57932630311038269	39.024031880533428	-2
+0.050000000000000003	-0.37426125000000005	0	1
+0.064537940872342783	-0.35554818750000006	9.4244780776653929	-2
+0.08453892403705679	-0.33805369500907972	18.971177931476181	-2
+0.12434161831932865	-0.33818293505800429	32.263568511725175	-2
+0.050000000000000003	-0.36178587500000003	0	1
+0.1573615904569276	-0.35363461693536347	38.068016478141438	-2
+0.22280564873599742	-0.41907640785330469	40.702086303266604	-2
+0.23807048375225909	-0.47846594570077089	40.604164367823358	-2
+0.23770820217037789	-0.44903317738859372	40.85158077540153	-2
+0.22207260757825559	-0.54858235630898833	40.309520891985741	-2
+0.25509671802588585	-0.50247691079846013	40.937070264561143	-2
+0.25251435891644375	-0.53203268954526217	40.863308545122536	-2
+0.20318880107413989	-0.5811091921239675	40.159553587646343	-2
+0.17876646064298901	-0.59626770192181866	39.895495132127557	-2
+0.18588295234658958	-0.36233861291255448	40.815784068974708	-2
+0.20885205662497933	-0.36369566823268851	42.205528091953035	-2
+0.24183572350076116	-0.39132630752724351	42.191680883400743	-2
+0	-0.69999999999999996	39.98492247795501	-2
+0.024690379576305276	-0.68614633006947068	39.824864010504555	-2
+0.06296104777550067	-0.66519146157378573	39.627943665792074	-2
+0.10432239583563349	-0.63835245229881243	39.486220404623907	-2
+0.14529057189730019	-0.61098155480301786	39.543231126131118	-2
+0.050000000000000003	-0.34931050000000002	0	1
+0.063959867326128669	-0.33683512500000007	8.7882684906494397	-2
+0.078241238782166794	-0.30892525732575044	16.345960010599747	-2
+0.11755854112099154	-0.3107882724442394	31.464373626018762	-2
+0.14458064030197321	-0.31851418661824232	38.411077640220682	-2
+0.18015435713912939	-0.34005398710365858	42.177723015547414	-2
+0.16839658919980297	-0.32950636539490119	41.950367843066743	-2
+0.25240719783505328	-0.41897600409660168	41.715480491249231	-2
+0.27333927305882022	-0.47149891545568695	41.475461245644404	-2
+0.27682000123758566	-0.43571747416369788	41.951800231794252	-2
+0.2476002246477918	-0.56129125957678783	40.813526531056382	-2
+0.231675706848259	-0.58494681259022474	40.650866561147282	-2
+0.28664097272443251	-0.50019252468182818	41.503981626681785	-2
+0.27453202556058293	-0.55191823684594243	41.193512379213651	-2
+0.21208786004337016	-0.62269978524850322	40.598314536053408	-2
+0.17267892743345353	-0.62785566982228869	40.142284409275639	-2
+0.19587289020258691	-0.34161127608104724	43.236086886153167	-2
+0.21565994099767788	-0.33900089453266041	44.227107577459556	-2
+0.23040113729990919	-0.3498458935127518	43.731718153905973	-2
+0.27050901606244632	-0.35826501072090833	43.728194413399066	-2
+0.28612672544514312	-0.39597579552238021	42.822972122071299	-2
+0	-0.73740149999999993	40.417275873883277	-2
+0.028083502959185089	-0.73014856860301447	40.373306522495838	-2
+0.044581612695201084	-0.70629274064743286	40.148438703869111	-2
+0.085544847233270244	-0.68394299079858722	40.037129557429473	-2
+0.11522916939850776	-0.6695069260891503	40.043748812961937	-2
+0.14090529249725733	-0.64876335722257095	40.018724054695063	-2
+0.050000000000000003	-0.32435975000000006	0	1
+0.050000000000000003	-0.29940900000000004	0	1
+0.089457406984359472	-0.27667728852325618	22.144448889879985	-2
+0.12296960989106218	-0.28320922371632939	34.22565593565777	-2
+0.14170344404254362	-0.29640400128162242	39.335499731336832	-2
+0.15623911288012232	-0.30096829843177869	43.061592652482084	-2
+0.1641452972938891	-0.31070378509872904	43.830738086772669	-2
+0.18059201303902483	-0.32426456381021973	44.280948633618983	-2
+0.1754516275362179	-0.31826219888318741	44.68280813592785	-2
+0.30069207489592414	-0.45609970802370392	42.053320300753022	-2
+0.31401151814784456	-0.48487743388301902	41.977762091021447	-2
+0.32001226866931004	-0.41959306013609443	42.733599793214921	-2
+0.27512852306530272	-0.59701067841346123	41.240171411505038	-2
+0.24631633998967317	-0.6165009853802087	40.967078690711034	-2
+0.31389347636303927	-0.51624118412255304	41.795683378598874	-2
+0.3029520335966927	-0.54372150590240287	41.579694576533235	-2
+0.29266871298714353	-0.5742284849525221	41.418696202243574	-2
+0.18562325532639296	-0.65730566391496037	40.54807538164664	-2
+0.22390452612579145	-0.65915874875745273	40.920805360439779	-2
+0.16121881218256898	-0.6637422602283265	40.375702865778095	-2
+0.19498607983806504	-0.32167249381198559	45.689516002926403	-2
+0.20859867823688402	-0.32623610811767817	45.387891778046246	-2
+0.22443605803495797	-0.33254460163434141	44.846321274313631	-2
+0.21710491698291812	-0.32448492923926125	45.587328113853019	-2
+0.24229383357211484	-0.32854251165988813	44.997833323177709	-2
+0.26717012118669109	-0.3331811775300505	44.634218659398265	-2
+0.30906332941974357	-0.34036893203307783	44.197335600880393	-2
+0.32329081867026394	-0.37877131057049829	43.39687817214935	-2
+0	-0.77480299999999991	40.727242058786054	-2
+0.043786022195033525	-0.7545354306798735	40.624085085708515	-2
+0.080229203650164491	-0.72291447827109079	40.442734606648777	-2
+0.1108363464992341	-0.69821152886947557	40.339252555407896	-2
+0.13897805719357018	-0.6726404222368072	40.271149676854861	-2
+0.050000000000000003	-0.27445825000000001	0	1
+0.075866182558312942	-0.25417922185459524	16.084808995132725	-2
+0.11955206036887002	-0.2605513541722585	33.84701086043227	-2
+0.1430640008047297	-0.27219676936584558	40.88886562093726	-2
+0.15625731270214449	-0.2918980736224418	43.877271920480929	-2
+0.16413053072233613	-0.29640159972228425	45.895660694116735	-2
+0.1653275500810488	-0.30169598099205064	45.601997451172394	-2
+0.1732303179070824	-0.31067815435758989	45.793751531285068	-2
+0.17090574926820501	-0.30463463807628782	46.703950991837758	-2
+0.18762266979476819	-0.3154819822416452	46.386141694767126	-2
+0.18138514642710857	-0.31304249569180004	46.405838863609397	-2
+0.33193427156347477	-0.45913886995739672	42.370850165137455	-2
+0.34112800363171647	-0.48465025342857099	42.250398347798772	-2
+0.33987238429248273	-0.51110268681179827	42.080382679849222	-2
+0.34688552833676534	-0.43966181089588302	42.682543702182322	-2
+0.35453648496913198	-0.41633031348581084	42.976173707861811	-2
+0.30901091603728525	-0.59547065173221103	41.570299583281958	-2
+0.28662674181974229	-0.64504972495155777	41.411240609929905	-2
+0.31372360016007733	-0.62185412872799306	41.610706307271506	-2
+0.25484700553330647	-0.65024320779702438	41.15777294401822	-2
+0.3324778709890035	-0.54195850243781574	41.885072266328571	-2
+0.32130555580122006	-0.57165596964104604	41.709954386443947	-2
+0.20354246317914709	-0.67579205423305155	40.82945973831341	-2
+0.17902178450246925	-0.68163250320706326	40.670916256315927	-2
+0.25434861470671449	-0.6824406534889661	41.244254573480383	-2
+0.22669129741170552	-0.68706042193811656	41.063077129932509	-2
+0.15618503397358377	-0.69230289927583055	40.578943365075169	-2
+0.19244595519471375	-0.31239402369216074	47.231722202945363	-2
+0.19999215991321409	-0.31474449147583944	46.91832439568681	-2
+0.21129147883890184	-0.31803305648676206	46.384678563407974	-2
+0.22532611340154368	-0.3216858839528961	45.709466451789588	-2
+0.21585470270611112	-0.31070378509872937	47.062061420830069	-2
+0.23475579135284513	-0.31055554634232863	46.267571941087681	-2
+0.25921921100206857	-0.30915764877646829	45.696635460810668	-2
+0.28267393297139182	-0.31472248759997989	45.079081207812735	-2
+0.3350755090048198	-0.31330133778009256	44.532944084062919	-2
+0.34501506644558327	-0.34888608967374629	43.908714633662015	-2
+0.30055308780344925	-0.29855377595429716	45.219101339030495	-2
+0.35908412520053967	-0.38195174465075737	43.414627973630964	-2
+0	-0.81220450000000011	40.946503706510661	-2
+0.031880955947238158	-0.78186426874608772	40.80128284487283	-2
+0.072643131073301351	-0.75098240051394272	40.656832011298476	-2
+0.061672920535481679	-0.78084699868037233	40.834034729983202	-2
+0.12353629372525347	-0.72432593972357995	40.639194654280587	-2
+0.10074824704022874	-0.75842949475651689	40.792095350856748	-2
+0.050000000000000003	-0.24950750000000002	0	1
+0.050000000000000003	-0.22455675000000003	0	1
+0.088565230022536162	-0.2311657784197661	22.317981688398724	-2
+0.14551604232438872	-0.25676999474687412	41.973197390085836	-2
+0.13111165766879773	-0.23483963358285725	38.010749317374298	-2
+0.15843841032859057	-0.2655455453234849	45.511827362328368	-2
+0.16511653569675738	-0.2809082889272852	47.08256615307269	-2
+0.16524637093599359	-0.2906872303650786	46.705563606031738	-2
+0.16875676867559752	-0.29813815161208296	47.261540219914878	-2
+0.16892390596501025	-0.29520108156370506	47.638338039436704	-2
+0.17017116015922315	-0.30071765002720907	47.351229210554557	-2
+0.17488513271978598	-0.30441801886905034	47.814633647087724	-2
+0.17854376792563967	-0.30697748451288487	47.604299299653135	-2
+0.17373638437692407	-0.30182930005441816	48.436010808973101	-2
+0.19	-0.30721552263122476	48.272340261727052	-2
+0.18488045008162726	-0.30732929652218555	48.034611480152144	-2
+0.36013860388815139	-0.46531240262125639	42.535595218761642	-2
+0.36424656426169288	-0.50074859763661306	42.32395912496925	-2
+0.3636047875263051	-0.53310403891135749	42.163721003800468	-2
+0.37110880539310831	-0.43564574846631249	42.847985434149486	-2
+0.38711220421849163	-0.40443958002619085	43.191935174203103	-2
+0.33432603597262106	-0.59345893708303221	41.781191940643097	-2
+0.32085011458548141	-0.65680392426712808	41.661009693273741	-2
+0.29052566538028868	-0.67654799237414631	41.482441388525608	-2
+0.34861601253192809	-0.61445176593253736	41.858183606341825	-2
+0.35671635558988402	-0.56802739500728439	42.001391053604983	-2
+0.20266831048177583	-0.70152297909254113	40.960836236951515	-2
+0.17728806651807372	-0.70769477649121726	40.828595386974733	-2
+0.26304111708092243	-0.70740869372509496	41.364033722603132	-2
+0.22632256984857818	-0.71363088169204802	41.158218151960398	-2
+0.15179604928603452	-0.72048301103365386	40.75974737782564	-2
+0.19511954991837274	-0.30732929652218555	48.334418316349513	-2
+0.20145623207436034	-0.30697748451288487	48.377195549287691	-2
+0.20676968209291743	-0.31067815435758944	47.512661625352855	-2
+0.20909425073179497	-0.30463463807628788	48.309060374428007	-2
+0.21467244991895118	-0.30169598099205064	48.111246545633016	-2
+0.22376088711987763	-0.30096829843177858	47.467842683091902	-2
+0.23829655595745597	-0.29640400128162209	46.921093267808281	-2
+0.26081773546016213	-0.28299635764612913	46.537753149267289	-2
+0.28723601541952432	-0.27404410640496474	46.013160558672254	-2
+0.34919071397564622	-0.28853807568130496	44.765643204987576	-2
+0.37186186914776975	-0.30581455924432172	44.353170638841611	-2
+0.37586666059109802	-0.35528502797042799	43.728493320184825	-2
+0.33319759902133983	-0.26494404179135655	45.308129864295445	-2
+0.30749406287038605	-0.25574234294189219	45.895884461099925	-2
+0.39332993138509914	-0.37715344302238052	43.465816579115383	-2
+0	-0.84960599999999997	41.105040153310995	-2
+0.025077706407452466	-0.8293010248696725	41.039329028627733	-2
+0.047724086461379253	-0.80909399659407444	40.964534458420466	-2
+0.08869829446474288	-0.79763595060924541	40.980627138601193	-2
+0.14275414374868167	-0.75981991123231973	40.949602892842002	-2
+0.12311259809614072	-0.78928633407418702	41.026940269132034	-2
+0.050000000000000003	-0.19960600000000001	0	1
+0.081246012044288038	-0.20076692857293568	19.005075059816065	-2
+0.11232920843135252	-0.20415749286025336	31.89973726788331	-2
+0.15542753375284235	-0.24469687499999998	44.918710577420484	-2
+0.15746678749097545	-0.22133324999999998	45.58404941285432	-2
+0.1454781566828876	-0.19018174999999998	42.397247904194479	-2
+0.17499999999999999	-0.26806049999999998	49.99999999320891	0
+0.17499999999999999	-0.25248474999999998	49.999999993208917	0
+0.17499999999999999	-0.28363624999999998	49.999999993208903	0
+0.17078123703255449	-0.28888047254341942	48.605292248543684	-2
+0.17167694642197184	-0.2984943499727909	48.376605217895616	-2
+0.17280668759338455	-0.29337109374999998	49.172565412978038	-2
+0.17307550011386591	-0.29629154687499998	49.164197489126231	-2
+0.17373638437692407	-0.29960599999999998	49.167554450914409	-2
+0.17541126059419734	-0.30163516470179219	49.09522162656372	-2
+0.17749999999999999	-0.30263616852935094	48.968099080229287	-2
+0.18150565002720906	-0.30363626761362733	48.867228303333391	-2
+0.17499999999999999	-0.29999999999999999	49.999999993208924	0
+0.187697	-0.30264180129461332	49.325962834750506	-2
+0.192303	-0.30264180129461332	49.37562962546297	-2
+0.18420265002720912	-0.30237265199055141	49.328759153941469	-2
+0.38723269172418695	-0.45533706945560587	42.756256443172383	-2
+0.40128150946529167	-0.47836383092859114	42.658147539604535	-2
+0.39192648083489007	-0.50366372150505223	42.470441741385329	-2
+0.39143760301031139	-0.53149242480111214	42.337475914879747	-2
+0.3992070008367003	-0.55826740146258447	42.281947050954074	-2
+0.39589472319453678	-0.42986767686224236	42.981088795072409	-2
+0.42279670625570825	-0.42980399291881738	43.036790803611481	-2
+0.41983902914882099	-0.38612345637033674	43.369129665135198	-2
+0.35862407433553528	-0.59227914124724179	41.956254681996398	-2
+0.33940718932148195	-0.68786894353728756	41.770915162326816	-2
+0.3122290730882063	-0.6997062425114039	41.63194501556687	-2
+0.34842339879107265	-0.6614078398656511	41.8238989324228	-2
+0.28836410877804775	-0.70821295927151084	41.511505998239812	-2
+0.37587458248660666	-0.62424187183446267	42.005073763786214	-2
+0.38573993407958312	-0.59701044426461292	42.105048665261947	-2
+0.17489263990190396	-0.73472170385253988	40.961211710261878	-2
+0.19987511694589732	-0.74530795493656432	41.137387743376664	-2
+0.24792809259136694	-0.72910106845762856	41.33146508433574	-2
+0.2761121944112494	-0.73038932835913362	41.478729461188223	-2
+0.22450450781333875	-0.7389921027536217	41.237416928174099	-2
+0.19579734997279089	-0.30237265199055141	49.452429099513971	-2
+0.19849434997279095	-0.30363626761362733	49.160976457359141	-2
+0.205114867280214	-0.30441801886905029	48.735399959862079	-2
+0.20250000000000001	-0.30263616852935094	49.351780927496968	-2
+0.20626361562307591	-0.30182930005441816	49.1754369874321	-2
+0.20982883984077683	-0.30071765002720907	48.768979686778614	-2
+0.21124323132440245	-0.29813815161208296	48.832370126519372	-2
+0.21586946927766382	-0.29640159972228425	48.418389888221355	-2
+0.22374268729785526	-0.29189807362244186	47.998058236738196	-2
+0.23693599919527014	-0.27219676936584591	47.814472470791337	-2
+0.28173470001993317	-0.24669810400661793	46.641462614718726	-2
+0.23991451856088467	-0.24421716740822205	48.168975513854299	-2
+0.3607586877278573	-0.2634793249252404	44.936353535532263	-2
+0.39652930208340192	-0.32281669675530716	44.01280040059121	-2
+0.38823039631049228	-0.26082146229952224	44.659401855483367	-2
+0.41029655444731927	-0.29175759088137476	44.212914193332736	-2
+0.40706302294804464	-0.35086300938856002	43.693730115337097	-2
+0.34582535334106368	-0.24252001781580237	45.363936109959056	-2
+0.30402673190847507	-0.22441242321650801	46.36303332979999	-2
+0.33510142793193243	-0.21912569255870376	45.777738259565652	-2
+0	-0.88700749999999995	41.212449992327478	-2
+0.021356355089232278	-0.86830674999999991	41.170559908445114	-2
+0.04461032706658364	-0.85253159204880513	41.136148597231525	-2
+0.064975338943058292	-0.83545413982162353	41.099827221490308	-2
+0.090673399394776102	-0.84223519964443005	41.158569652698191	-2
+0.10629760331546563	-0.81919991336921416	41.105872393505287	-2
+0.17534458068655234	-0.7684263489175488	41.117213014906632	-2
+0.15759368971307414	-0.79735570279926149	41.161916508356619	-2
+0.13156446639432245	-0.83087577702423954	41.201240893742245	-2
+0.050000000000000003	-0.14970450000000002	0	1
+0.066571604394470463	-0.17465525000000001	11.283414428122791	-2
+0.10113666243264645	-0.16259202038425891	27.91362620843018	-2
+0.12814936190694134	-0.16860502559288348	37.462779164492865	-2
+0.17499999999999999	-0.23690899999999998	49.999999993208924	0
+0.17499999999999999	-0.20575749999999998	49.999999993208931	0
+0.17499999999999999	-0.17460599999999998	49.999999993208938	0
+0.17499999999999999	-0.29142412499999998	49.999999993208917	0
+0.17400323085423333	-0.29823851562499998	49.47557216593998	-2
+0.17499999999999999	-0.29531806249999998	49.99999999320891	0
+0.17499999999999999	-0.29726503124999998	49.999999993208924	0
+0.17499999999999999	-0.29921199999999998	49.999999993208931	0
+0.17664338621436382	-0.30048418019518225	49.999999993208924	0
+0.17835661378563619	-0.30048418019518225	49.999999993208917	0
+0.180394	-0.30126361562307591	49.607246307518849	-2
+0.1819395	-0.30105227507254467	49.680917303516715	-2
+0.19	-0.29999999999999999	49.99999999320891	0
+0.185394	-0.29999999999999999	49.999999993208938	0
+0.194606	-0.29999999999999999	49.999999993208924	0
+0.183091	-0.29999999999999999	49.999999993208931	0
+0.42798717536978365	-0.47456798682560214	42.768568368852662	-2
+0.41580999199334162	-0.51795545419957245	42.509491505852246	-2
+0.42442421344403425	-0.54507838227782257	42.438107674765881	-2
+0.41591768827680414	-0.59061663032977529	42.2649420197043	-2
+0.43999498585394037	-0.56889873251240985	42.421658329315264	-2
+0.43750595026329181	-0.40686760438190561	43.210479861671956	-2
+0.440875042889675	-0.45039069512510282	42.939214091712401	-2
+0.44240711638733843	-0.35617004430774146	43.562710540912995	-2
+0.46157031321252456	-0.39408690744322483	43.286275416767715	-2
+0.32902310305391902	-0.71563479308992806	41.724120662525998	-2
+0.36544684001996075	-0.70203609711495696	41.888834159552594	-2
+0.30702802209531144	-0.72284413284098448	41.623213186290513	-2
+0.37514508141597352	-0.65319603626262335	41.966608034839346	-2
+0.40340829662798094	-0.61881402073381042	42.149072955806531	-2
+0.22231774320627329	-0.7816450581432427	41.345422361758935	-2
+0.27546088722683909	-0.75859533849738014	41.520130806644445	-2
+0.24783896996797092	-0.76157096601468566	41.403971536823356	-2
+0.29995138639739921	-0.74547893187992964	41.610829558447442	-2
+0.196909	-0.29999999999999999	49.99999999320891	0
+0.1980605	-0.30105227507254467	49.759932015755886	-2
+0.19960600000000001	-0.30126361562307591	49.719886679017165	-2
+0.20458873940580266	-0.30163516470179219	49.490174315372457	-2
+0.20164338621436384	-0.30048418019518225	49.999999993208938	0
+0.20335661378563619	-0.30048418019518225	49.999999993208917	0
+0.20499999999999999	-0.29999999999999999	49.999999993208917	0
+0.20626361562307591	-0.29960599999999998	49.594372845727136	-2
+0.20832305357802813	-0.2984943499727909	49.270287302038959	-2
+0.21107609403498973	-0.29520108156370506	49.049681902073083	-2
+0.21475362906400636	-0.2906872303650786	48.820415309334145	-2
+0.21488346430324257	-0.28090828892728525	49.065330930484713	-2
+0.2215615896714094	-0.26554554532348495	48.847973829195709	-2
+0.25368554720363745	-0.21558014054560246	47.931641211650991	-2
+0.28004208225839428	-0.21323678800475349	47.099799470224518	-2
+0.22159199061668208	-0.24469687499999998	49.069181137004541	-2
+0.2224345909140191	-0.22133324999999998	49.156826795089891	-2
+0.37117650652310824	-0.22785512818640774	45.13327757027006	-2
+0.42645720789280112	-0.32418614242421845	43.856365481430821	-2
+0.40356565907148706	-0.23199408196069979	44.716993800462234	-2
+0.44212484008754699	-0.27099898736966321	44.141280721098212	-2
+0.44762066172592563	-0.29888993989186585	43.93629290598907	-2
+0.31371558498450036	-0.18739238654093374	46.443508958144612	-2
+0.35944132248550992	-0.19744543210157409	45.516173636031922	-2
+0	-0.90570824999999999	41.250185828401058	-2
+0.025709094398477843	-0.89635787499999997	41.238359372744625	-2
+0.058625319212549681	-0.87688693676525487	41.217231866183653	-2
+0.088234930538994727	-0.86893379279480309	41.229285036340769	-2
+0.11686060529184637	-0.85722406617824842	41.24563883038519	-2
+0.19218090682797626	-0.79866762621984644	41.27830489259221	-2
+0.15720410226440967	-0.82391940479565395	41.243026108428467	-2
+0.14679243249402998	-0.85409135879644305	41.293831336117208	-2
+0.050000000000000003	-0.099803000000000003	0	1
+0.079884956195339085	-0.13708445042398451	18.392144931787413	-2
+0.11232324487200207	-0.136718819697838	32.167548939343625	-2
+0.139694630501878	-0.14345449999999998	40.901350667944037	-2
+0.17499999999999999	-0.14345449999999998	49.999999993208938	0
+0.17999999999999999	-0.29999999999999999	49.99999999320891	0
+0.180788	-0.29999999999999999	49.999999993208924	0
+0.4427388972860411	-0.5021107902035401	42.676466617254981	-2
+0.45440029743567101	-0.47312405075322328	42.842783118142783	-2
+0.4515892418117432	-0.53218195970639814	42.581320876220353	-2
+0.44498770546798627	-0.60093708601378393	42.353792729362084	-2
+0.47215165169186601	-0.56473553825661527	42.535006192793013	-2
+0.46693150451861271	-0.44192314704073993	43.017180923113273	-2
+0.4764633511361438	-0.35429854175674003	43.499359989236808	-2
+0.45943410669314849	-0.32474630866404708	43.720701337340643	-2
+0.49560962925540947	-0.42313079836457301	43.122545262459589	-2
+0.50273598840224287	-0.36879314751209674	43.375109889679315	-2
+0.51611471631558936	-0.39565119480410743	43.23755347719586	-2
+0.34320673831690923	-0.73392639380578462	41.789000433027489	-2
+0.32161239973754874	-0.73982748564039169	41.700211635557508	-2
+0.39012137000652647	-0.68940451013324866	42.000914531098573	-2
+0.40029875318542119	-0.71518842549465844	42.016786604564608	-2
+0.37730556697812723	-0.75330627435940645	41.914136583669517	-2
+0.40388972505388204	-0.6653457940614308	42.080050165235669	-2
+0.42193995190628047	-0.63988876236060221	42.189717997287609	-2
+0.24202653540188762	-0.80111536873774014	41.455486214441983	-2
+0.22633662923372266	-0.82394859735066928	41.442155007857359	-2
+0.29024323529426665	-0.77973538326057168	41.602441664372563	-2
+0.2648493171042095	-0.78427060386523995	41.512258582043238	-2
+0.31418274315470218	-0.76801589820903771	41.685702103103225	-2
+0.199212	-0.29999999999999999	49.999999993208945	0
+0.20000000000000001	-0.29999999999999999	49.999999993208917	0
+0.20499999999999999	-0.29921199999999998	49.999999993208924	0
+0.20599676914576664	-0.29823851562499998	49.756751882373408	-2
+0.20692449988613407	-0.29629154687499998	49.637467245440973	-2
+0.20719331240661543	-0.29337109374999998	49.665233152381809	-2
+0.20921876296744549	-0.28888047254341942	49.488537950887682	-2
+0.20499999999999999	-0.28363624999999998	49.99999999320891	0
+0.20499999999999999	-0.26806049999999998	49.999999993208931	0
+0.20499999999999999	-0.25248474999999998	49.999999993208924	0
+0.26473538633061394	-0.19165292132156159	47.718625589349806	-2
+0.23458993788885082	-0.19018174999999998	48.791940836409665	-2
+0.27966375484436523	-0.16993300930412905	47.406148453514945	-2
+0.20499999999999999	-0.23690899999999998	49.999999993208938	0
+0.20499999999999999	-0.20575749999999998	49.999999993208938	0
+0.4025907299003707	-0.19457685133244806	44.940829759763503	-2
+0.43256737885445457	-0.21699113589074029	44.521287370874987	-2
+0.46354886666870077	-0.23935810923792072	44.16356858866223	-2
+0.4757396487500824	-0.27068602236277894	43.943051859863871	-2
+0.47601497579737823	-0.3002582295133791	43.791988643432269	-2
+0.34174055825690941	-0.16893935430505905	45.992409508833624	-2
+0.31042116169335127	-0.15188153503885643	46.706160674216939	-2
+0.37529518317890515	-0.16896527652821622	45.429008611905317	-2
+0	-0.92440900000000004	41.280424261033993	-2
+0.022167327530261512	-0.92348430002951087	41.282939656109548	-2
+0.045200820040227872	-0.912697244132326	41.276864071942583	-2
+0.081178049621387083	-0.89479808165578789	41.274879455301779	-2
+0.10868606424344611	-0.8862690786814682	41.292924143980215	-2
+0.1485041865655698	-0.88180280203843753	41.348058746540957	-2
+0.19702488779583063	-0.82783663100590577	41.3615294220197	-2
+0.17309710877198664	-0.8452077674918177	41.333887697149301	-2
+0.17932324728119189	-0.87965675893834261	41.403431442627266	-2
+0.050000000000000003	-0.049901500000000001	0	1
+0.099791360129735635	-0.11146978000839911	27.567938554476708	-2
+0.080586853382050253	-0.081347660809634334	18.652876909205894	-2
+0.13326790313494499	-0.11058883132408309	39.025353248831856	-2
+0.17499999999999999	-0.11230299999999999	49.999999993208917	0
+0.47648225130899374	-0.48768857209053579	42.816418917168768	-2
+0.49872736582308852	-0.4591669774205831	42.966790003863878	-2
+0.48543388721816261	-0.53357494380144943	42.664100093693079	-2
+0.46503862666743268	-0.63909576998132622	42.3386225486962	-2
+0.47936500017034633	-0.59844014767227549	42.466424466402827	-2
+0.50012025754296618	-0.57092192855238122	42.587831335825733	-2
+0.50699296687204409	-0.3390909051855166	43.498907127836496	-2
+0.52834805920325467	-0.43331816366360604	43.080284360445383	-2
+0.5524941952059923	-0.3607684026197947	43.322492649932954	-2
+0.55509148708968981	-0.40381249417088116	43.174097199102938	-2
+0.33855529128418893	-0.75936647402472501	41.772853667362	-2
+0.4303060473327886	-0.68196051854596496	42.15660597758076	-2
+0.41430042572932579	-0.74970788028574065	42.036140822622976	-2
+0.43638705995808913	-0.7244228018884441	42.126907454381872	-2
+0.38162817559496953	-0.79788948995136533	41.908711021035892	-2
+0.40824547473597339	-0.78638083465812014	41.991915206087718	-2
+0.35528641450408299	-0.78576342781845987	41.831759734305166	-2
+0.46314882191525125	-0.67306847771097589	42.275340982333944	-2
+0.26726863124792122	-0.81253316544970522	41.554492459406674	-2
+0.24363323439141032	-0.84708810267658097	41.519131442593078	-2
+0.21495590883258653	-0.85058385088005273	41.447713555353509	-2
+0.28932984447084892	-0.80354122100886904	41.618742672064876	-2
+0.31138005839722677	-0.79452233751391599	41.686816015073362	-2
+0.20499999999999999	-0.29726503124999998	49.999999993208924	0
+0.20499999999999999	-0.29531806249999998	49.999999993208917	0
+0.20499999999999999	-0.29142412499999998	49.999999993208924	0
+0.2519761351698076	-0.16859186596100112	48.238142698720026	-2
+0.20499999999999999	-0.17460599999999998	49.999999993208917	0
+0.27738171390113953	-0.13081561916900825	47.595820727964572	-2
+0.43479146874491137	-0.18276427590412647	44.638136787836594	-2
+0.40748152725985037	-0.16201357431438157	45.0110995159691	-2
+0.45845404501070697	-0.20148758143369014	44.358348814362486	-2
+0.48754983192761608	-0.22940663526003324	44.045083283069069	-2
+0.50357531522471077	-0.28953354157427336	43.729862295783391	-2
+0.508869833882032	-0.24425707917110651	43.872235709862537	-2
+0.33813150361873584	-0.13828458665750468	46.173423416295819	-2
+0.31373758812881636	-0.12360528464993717	46.714850328248346	-2
+0.39416754767307938	-0.12694382686428596	45.274957383594014	-2
+0.35855943889832131	-0.11514502064774693	45.850761516084653	-2
+0.013608358767073352	-0.94359604375614392	41.304134499941007	-2
+0	-0.96181050000000001	41.318556205845603	-2
+0.026555665279194948	-0.94489646184975407	41.308297631493716	-2
+0.047310899659760035	-0.93804383988273998	41.309964741913412	-2
+0.075167059861541374	-0.922963712525527	41.310801746083378	-2
+0.10196254354647469	-0.93551147989364591	41.349946488459537	-2
+0.13194401820946428	-0.91389226902233189	41.362923850490617	-2
+0.17654332709287882	-0.91042512009273746	41.429573900912779	-2
+0.20464937004467296	-0.90692853894120107	41.477117843036424	-2
+0.21021290387987104	-0.87915764011847686	41.468431426775005	-2
+0.050000000000000003	0	0	1
+0.083175119951755666	-0.048231527774329111	19.908145251170094	-2
+0.077278681245010875	-0.016762083693127032	17.152830353980825	-2
+0.11589196957485638	-0.086797790630009794	33.304454929859112	-2
+0.11511696599702322	-0.057347220960714575	33.058825288991414	-2
+0.15188887272733387	-0.078748060573507084	44.265706791701589	-2
+0.17499999999999999	-0.049999999999999989	49.999999993208924	0
+0.51671177135853807	-0.48451652432709763	42.88651098502433	-2
+0.51407249046130077	-0.51548542109747941	42.777708960255652	-2
+0.5440266271106996	-0.46968625035566702	42.957105001647044	-2
+0.51284703014022937	-0.54525982424655128	42.686510644012579	-2
+0.50341395825123425	-0.64230010688958838	42.436619818675901	-2
+0.51497994339801267	-0.60371595299607994	42.54220879649958	-2
+0.52876106130511569	-0.57045427696862905	42.648283088186986	-2
+0.53583252416259208	-0.32910985644809421	43.467330624153291	-2
+0.56703239780080683	-0.44180209957446498	43.049640492403881	-2
+0.5659341817617195	-0.33413296389254543	43.382717367808034	-2
+0.57001263227998533	-0.38131174190288497	43.232742697583717	-2
+0.59326289101292196	-0.346100481825451	43.298440163685434	-2
+0.59011655066343693	-0.41963495705297688	43.106827903841186	-2
+0.46510808369556295	-0.70703725051426947	42.232082426954939	-2
+0.44490029922343532	-0.77080801668518173	42.104707846010555	-2
+0.46494617120891785	-0.7420730643702147	42.188046754531001	-2
+0.38488698982537295	-0.82670458825125226	41.903038796185292	-2
+0.35679123268416629	-0.83037213686353351	41.82644910260769	-2
+0.41354055363378567	-0.83136045860589469	41.973831519242019	-2
+0.43976247371933286	-0.81890595120057375	42.047960170868976	-2
+0.33726308778598418	-0.80984230396122481	41.773045658540177	-2
+0.50600189674371421	-0.68072192912054863	42.376491746222939	-2
+0.29271847831277481	-0.84341396187459183	41.650726602436883	-2
+0.25578646048357701	-0.8732970391727749	41.568968367576076	-2
+0.30970433623719856	-0.82189003384524262	41.691995760853999	-2
+0.24029213836852129	-0.14345449999999998	48.696791679213298	-2
+0.20499999999999999	-0.14345449999999998	49.999999993208917	0
+0.279512934201122	-0.097699835424495229	47.594041613630992	-2
+0.24648096623519622	-0.10087573297927614	48.548554675515533	-2
+0.44884890059651988	-0.15862679874575336	44.563793997650762	-2
+0.43001298960334927	-0.13800065875565937	44.804968049513647	-2
+0.48856469665236923	-0.20344419667497957	44.122567731865743	-2
+0.47657719281128758	-0.15525470671171104	44.325859061682365	-2
+0.49480501879212613	-0.17630613229109221	44.142211413921167	-2
+0.51177806751898536	-0.21735265577054141	43.936540359701652	-2
+0.53214025682857224	-0.29009567708355982	43.619400589062494	-2
+0.55346716102893889	-0.23546843277438884	43.687602557378604	-2
+0.55081604421506791	-0.26847423285202843	43.615469812660436	-2
+0.31259973066781999	-0.095157959630576147	46.78773358667101	-2
+0.42009359766138149	-0.10652603429678993	44.959906511001762	-2
+0.38838465557781693	-0.084765257318255585	45.39412954648008	-2
+0.35586785354090072	-0.082672289021620424	45.924810247205365	-2
+0.018551488070911119	-0.95515594431016138	41.314929512153071	-2
+0	-0.97116087500000003	41.323163829419144	-2
+0.012763803416189129	-0.96631697179291265	41.321641402013206	-2
+0.034128481413048306	-0.95547834679242216	41.319262030553766	-2
+0.079175922951985389	-0.95438512113524954	41.343180861969522	-2
+0.054796265634466816	-0.96674698400663661	41.335148876144387	-2
+0.1232529480191748	-0.96269862725274169	41.386680057708055	-2
+0.1470750311771756	-0.94667985072431104	41.407289082776103	-2
+0.09623692862770479	-0.97279514653689392	41.365152083821101	-2
+0.17290265283046599	-0.95700334943068477	41.445410323996633	-2
+0.20236112959053323	-0.94434224638747022	41.486875075947779	-2
+0.22719954611391754	-0.92406520400192527	41.526186688375581	-2
+0.2494078535813018	-0.90313787412188617	41.565402005671672	-2
+0.050000000000000003	0.024950750000000001	0	1
+0.082521331169767551	0.01482285768672599	19.865017563336654	-2
+0.11321718424036548	-0.0034833897529567277	32.510567750245933	-2
+0.143385471781973	-0.027702134822346854	41.961485784957553	-2
+0.17499999999999999	-0.01884849999999999	49.999999993208924	0
+0.5441018650154501	-0.50583574121089614	42.846209898531953	-2
+0.56120519302529248	-0.53233773790953498	42.793284744481468	-2
+0.575126885775057	-0.50014999192932508	42.888448996429588	-2
+0.58017618553430261	-0.46971410018727333	42.972912684610279	-2
+0.54113591527835214	-0.65004528650226601	42.505211730530519	-2
+0.54594648901076048	-0.59706037932581069	42.617690079342324	-2
+0.57445724705045964	-0.56962196020333089	42.72186643878581	-2
+0.55583412583933778	-0.30606040246370642	43.491829668758385	-2
+0.59350503153384071	-0.30836021623054055	43.389780001300899	-2
+0.5961180917885589	-0.3881986432570384	43.186620622503796	-2
+0.62218302225008015	-0.33099976601139242	43.285438216543312	-2
+0.63234702499719553	-0.3620013572129428	43.207822196021176	-2
+0.624040199906988	-0.38866325212111696	43.160451065484935	-2
+0.61836322573563696	-0.43468107510112464	43.060026206377017	-2
+0.4903872983075413	-0.72467235547114495	42.273727005586672	-2
+0.46971390243509592	-0.80195884193073785	42.135010265096248	-2
+0.48472560455509717	-0.77099206305111356	42.203747528636562	-2
+0.50568151885979851	-0.75004765029873266	42.2774962640176	-2
+0.3660524920884155	-0.85714995522889548	41.84087751683785	-2
+0.39904406242005402	-0.85651111645359757	41.920836700522713	-2
+0.33028595062410493	-0.85559651160630301	41.752219743071784	-2
+0.44110235456017916	-0.85555823758315763	42.017757379614309	-2
+0.47496249587636979	-0.83596979401396265	42.111267204974865	-2
+0.52120961698974244	-0.72481479595454645	42.345165805179256	-2
+0.5477307479987118	-0.68732391298657858	42.456416368357857	-2
+0.3049349251542372	-0.86975686426548027	41.686793337374617	-2
+0.30044911800620389	-0.89844601925542034	41.675594844550709	-2
+0.20499999999999999	-0.11230299999999999	49.999999993208931	0
+0.29421643213440124	-0.072479494927668781	47.224531715604883	-2
+0.25965692032058224	-0.064548703775343247	48.161928860559591	-2
+0.20499999999999999	-0.081151499999999988	49.999999993208931	0
+0.23011877506736833	-0.065575749999999988	49.102025320711562	-2
+0.45998555332133373	-0.13451291482803135	44.498115467412596	-2
+0.44324819448671193	-0.11594597139725894	44.689341702266425	-2
+0.50533880936488351	-0.13643105527123395	44.121133429667893	-2
+0.52247461331164691	-0.17317408854343153	43.96428653868864	-2
+0.55441623032754839	-0.19613940901859395	43.755071263862348	-2
+0.5788405316637697	-0.25083792478136191	43.558061340560158	-2
+0.59218547119925891	-0.21672680150078202	43.565770304859605	-2
+0.58172018228336919	-0.280363114606898	43.485577002416079	-2
+0.33977465793152828	-0.05433976378864494	46.206278145723019	-2
+0.42982070711494447	-0.074991455450646394	44.838918220663018	-2
+0.40705816158957497	-0.050962897028665036	45.099473385418236	-2
+0.37406491503712569	-0.053599330331895456	45.594192708182653	-2
+0.022511286730311473	-0.96708849737772595	41.323409787864499	-2
+0	-0.98051124999999995	41.32673923946485	-2
+0.0062476073715647482	-0.97671997325944337	41.325740650469399	-2
+0.013314928937246956	-0.97857990419363383	41.327016397466849	-2
+0.022923049356634889	-0.9768577928603428	41.328007145698393	-2
+0.031168661758303039	-0.97163366407563956	41.327690319961334	-2
+0.072476829290992362	-0.98088616807101903	41.349878405097044	-2
+0.041932832754862384	-0.97980132877348503	41.334530280697926	-2
+0.051631868432984715	-0.98479886515767134	41.339551039018517	-2
+0.15008353522261322	-0.9729070765851916	41.417641503978302	-2
+0.13040196020729425	-0.99050122555197684	41.395675658079824	-2
+0.087155742747658166	-0.99619469809174555	41.359588211291879	-2
+0.17364817766693033	-0.98480775301220813	41.443746486835224	-2
+0.21623361138472552	-0.97536678965063828	41.504525544700449	-2
+0.23344182830955776	-0.95222231938405755	41.537127901112413	-2
+0.26111970472894047	-0.93131578389478109	41.589910787360523	-2
+0.050000000000000003	0.049901500000000001	0	1
+0.071651438221314007	0.037359952149541603	14.042481791211115	-2
+0.10659809687880437	0.041236177130650017	30.15841727474611	-2
+0.14243161128870796	0.010972964868392266	41.809749555967663	-2
+0.17499999999999999	0.012303000000000008	49.999999993208938	0
+0.59051429574753522	-0.53166335631087347	42.825423548859192	-2
+0.60685453313022175	-0.48520941250241967	42.941864660614286	-2
+0.56758183579317778	-0.63746114189706427	42.577163682491673	-2
+0.58405739463361561	-0.66167484397288023	42.563750792333821	-2
+0.57520803214595029	-0.60918414530071296	42.642083568694588	-2
+0.60288809814816291	-0.55824092781531709	42.77968768017729	-2
+0.60346915929213518	-0.58885960773956858	42.72038442370738	-2
+0.61100544955847369	-0.28843116838749472	43.391468045450857	-2
+0.63447763686404368	-0.30077977163075875	43.31870039976328	-2
+0.65302332511783301	-0.33805559356372328	43.226017220148307	-2
+0.6679414934609087	-0.38905440163122862	43.125305852463278	-2
+0.67693823524837682	-0.35876757214788974	43.166177832604234	-2
+0.64332553978374885	-0.40886066901070067	43.104939069145153	-2
+0.6377506170811359	-0.4656717043393751	42.990971075445977	-2
+0.65726298158884011	-0.44195988666370056	43.036242038425975	-2
+0.50865014988907753	-0.81336063284196847	42.207740112697977	-2
+0.51596391983812462	-0.78129161528495705	42.260934130332224	-2
+0.54242963164908931	-0.75526778571193698	42.348174935424389	-2
+0.35061977365539526	-0.8894530491546162	41.790044026709403	-2
+0.38309627099457544	-0.88513059326546273	41.865094831658936	-2
+0.42054392762441206	-0.87681133969849812	41.953400263840074	-2
+0.3265032407458508	-0.88256022248291155	41.736766517648647	-2
+0.46130913087034964	-0.88616659541054443	42.030076716667956	-2
+0.49999999999999994	-0.86602540378443882	42.129798454668752	-2
+0.55386258374594854	-0.72468148787488373	42.412561642939195	-2
+0.58065322029252386	-0.70601344559789858	42.488799953202943	-2
+0.31471981316844394	-0.92563537960110664	41.696686592979312	-2
+0.33212553203984452	-0.90700420046745378	41.741163328154826	-2
+0.29198024872239658	-0.04337179989701262	47.257877077003236	-2
+0.26457252367388201	-0.036794847483752072	47.992351865435324	-2
+0.20499999999999999	-0.049999999999999989	49.999999993208924	0
+0.24326351132780349	-0.018345845120048478	48.615695398078117	-2
+0.46725090888595461	-0.10896454814775004	44.451743322457943	-2
+0.4957158772541625	-0.10963364326791979	44.205215056312156	-2
+0.46219002824861755	-0.076934325220459412	44.490214305363345	-2
+0.53684612157762013	-0.15017331554594121	43.904058874120281	-2
+0.53700216948947999	-0.12305226362367572	43.913050324113016	-2
+0.56289548167708336	-0.15772359015879542	43.756387587620679	-2
+0.58898906718037503	-0.17382995678477747	43.623374742735564	-2
+0.60618038042230837	-0.26235147730806407	43.450938295003631	-2
+0.60710247674674589	-0.19404776938215151	43.536060194833702	-2
+0.6219725563158689	-0.22961901293184142	43.45115631306426	-2
+0.32148897219676625	-0.024402817573609896	46.530471387903738	-2
+0.35616705234826601	-0.019109632475907475	45.82425495156577	-2
+0.4473030079970286	-0.04812591808597716	44.607249087210427	-2
+0.42334873888678343	-0.026828478488267034	44.838137252319065	-2
+0.39501060318540604	-0.020134964319331018	45.197026403576274	-2
+0	-0.9851864374999999	41.327975817944463	-2
+0.0055210948357589974	-0.98399173760711256	41.327865641636194	-2
+0.009978094630748658	-0.98746232096542164	41.328946890204165	-2
+0.015886692206596074	-0.98943605818242597	41.329971979011411	-2
+0.031239390834720028	-0.98196857654365299	41.331481003704091	-2
+0.026993945040237808	-0.9913915064664458	41.332305405841147	-2
+0.059187999836045613	-0.99741579611828945	41.344061500426193	-2
+0.037844819706204513	-0.98991739581116123	41.335078506623326	-2
+0.045204128380239336	-0.99802634513156119	41.338103797173495	-2
+0.25881904510252074	-0.96592582628906842	41.574702283627104	-2
+0.3004195942140947	-0.95280922353748843	41.655762587602069	-2
+0.050000000000000003	0.074852250000000009	0	1
+0.072129737950486883	0.062376875000000005	14.42843090384881	-2
+0.12479512358421721	0.068985874379676154	36.169432052094614	-2
+0.13970786163147869	0.043454500000000007	40.861059671388809	-2
+0.095435501077052343	0.072486360062863783	25.426610768965617	-2
+0.17499999999999999	0.043454500000000007	49.99999999320891	0
+0.61981217776269026	-0.53271806117463716	42.846520105922032	-2
+0.6380374171896499	-0.50222588042725858	42.918627208095231	-2
+0.61164102000119258	-0.63003324130075766	42.658181208933712	-2
+0.61385265038757886	-0.65980507358848328	42.613168578651575	-2
+0.59986914615401699	-0.68267662201175872	42.556562388204846	-2
+0.63230354278458234	-0.55937358783944668	42.806353451603535	-2
+0.63827349641555609	-0.58819911394969382	42.761076321932208	-2
+0.63244995180699914	-0.27615175662072966	43.362075240236337	-2
+0.66619434477197392	-0.30825127822815312	43.251916230582253	-2
+0.65715447099975033	-0.27557092835026997	43.309892397210341	-2
+0.69828399990410994	-0.31391051888856347	43.199215144232305	-2
+0.69984625926170152	-0.39525073138342376	43.096016249265482	-2
+0.67775266160433334	-0.41908728998058109	43.070098606449754	-2
+0.7136448016367325	-0.36115290098323599	43.130248353520876	-2
+0.66630500086234845	-0.47130651429999726	42.983523205033819	-2
+0.68952199914785128	-0.44903180880920024	43.020138606596085	-2
+0.53678821817552302	-0.84258872403671536	42.228813039347749	-2
+0.54219387018656306	-0.80414221806037434	42.285570575659698	-2
+0.56314852318181274	-0.77980551472420279	42.356546766825048	-2
+0.57256199991611956	-0.74910113283501933	42.413955238806551	-2
+0.35590115520455401	-0.91621287184123079	41.785562272532765	-2
+0.42261826174069939	-0.90630778703665005	41.931132245657146	-2
+0.38231920253318408	-0.92300020391127924	41.834255412835539	-2
+0.60785683928708101	-0.70772223890073227	42.532138225301559	-2
+0.61325620327882302	-0.73443934445948467	42.503798990923379	-2
+0.34202014332566871	-0.93969262078590843	41.741853212094561	-2
+0.28882301033725449	0.0038669676348356621	47.218752435264626	-2
+0.20499999999999999	-0.01884849999999999	49.99999999320891	0
+0.20499999999999999	0.012303000000000008	49.999999993208938	0
+0.24703856288587236	0.012805821819743254	48.441212858067573	-2
+0.5110331148564754	-0.085631886150633482	44.079573755840975	-2
+0.48853155219574557	-0.064171123533946509	44.240288095204157	-2
+0.47349058877101735	-0.041827769120604805	44.337566053002938	-2
+0.55478803794218423	-0.10023922410226263	43.803853297644764	-2
+0.5369031187758474	-0.077503755001404981	43.896900101334765	-2
+0.57818960699539379	-0.11724329581083642	43.686586523222907	-2
+0.58597544949210945	-0.14331425003010584	43.650038647388556	-2
+0.61142811377651107	-0.15293068794195488	43.542086338711499	-2
+0.63372209634221721	-0.19936297445195206	43.443140937142935	-2
+0.64103593744069676	-0.16728305329169696	43.434144330008365	-2
+0.65194868820904206	-0.24206534058502466	43.357380726439459	-2
+0.31504066902423306	0.0011538988693924009	46.588181870375962	-2
+0.33228891656701387	0.021084386215563369	46.126332832785906	-2
+0.37661260699482979	0.019162433339379649	45.320834335473876	-2
+0.45046922680201729	-0.016229789786399884	44.497298832340547	-2
+0.42227316370612622	-0.0023887431405098039	44.771033872315421	-2
+0.39921745409888409	0.0057899963922166536	45.043774626684062	-2
+0	-0.98986162499999997	41.328907832859706	-2
+0.0038125409815512714	-0.98937603326641488	41.328910512254993	-2
+0.010054492069423271	-0.99162526020029906	41.32961806731165	-2
+0.0059928246952850395	-0.99254109740405272	41.329479813323353	-2
+0.019322060724565559	-0.99478260448914591	41.331123329489351	-2
+0.013474436454461804	-0.99517959246902976	41.330318945825312	-2
+0.023415192693324795	-0.99897767060862486	41.331961246217155	-2
+0.031220256924433053	-0.99863689414483325	41.333666636473311	-2
+0.074817358123522582	0.088099560263388596	15.493687073947854	-2
+0.050000000000000003	0.099803000000000003	0	1
+0.14541006211114915	0.090181750000000005	42.379759419060491	-2
+0.12631445279636289	0.11558014054560234	36.606478686843474	-2
+0.17499999999999999	0.074606000000000006	49.999999993208924	0
+0.088729133593200921	0.10990190744517417	22.482311320011011	-2
+0.66002197329577628	-0.53012949545680965	42.878513186980193	-2
+0.66922732637351889	-0.50026448263384038	42.933583086081207	-2
+0.65426612383027927	-0.62071636482257597	42.725777947388821	-2
+0.65831921037455898	-0.65672619994328552	42.677055843274459	-2
+0.62576952517109141	-0.68717734792088991	42.589436336014423	-2
+0.68151235860551407	-0.56421309369008155	42.837838667497607	-2
+0.66546657679356003	-0.58625355023390013	42.790219648678715	-2
+0.69089520922898273	-0.26781162210945381	43.255479785864111	-2
+0.73874071296643673	-0.34072299062659223	43.130930216660389	-2
+0.72086774551925836	-0.28664917615018193	43.194991493575188	-2
+0.74777790883052087	-0.30965025187438283	43.14760786120268	-2
+0.7220919369685842	-0.41894542291049131	43.056330042706755	-2
+0.74896526867043067	-0.37142550621253079	43.097287745888103	-2
+0.69377518241484037	-0.48092384458912796	42.971240223205704	-2
+0.71737024646430125	-0.44650641244591316	43.0207347800702	-2
+0.57357643635104605	-0.81915204428899202	42.325254868378138	-2
+0.60818202301879265	-0.79259824370398513	42.419119826930199	-2
+0.60042122082956972	-0.76262033550351249	42.444749109495625	-2
+0.63329575961386519	-0.71182062806464896	42.565583607457242	-2
+0.64278760968653925	-0.76604444311897824	42.508510757575969	-2
+0.64411208961451505	-0.73520742918084336	42.550209526996298	-2
+0.271620908969609	0.032309299161314697	47.599444864252689	-2
+0.30453580329786217	0.027673757608828939	46.717660029891356	-2
+0.20499999999999999	0.043454500000000007	49.999999993208924	0
+0.24030536949812201	0.043454500000000014	48.588425513411622	-2
+0.5172993342222455	-0.058768354019751529	44.006433392635252	-2
+0.50003389155558808	-0.037255117322052	44.099923097226231	-2
+0.48779048498088778	0.0028165463089822314	44.086304309480326	-2
+0.57172235603238419	-0.076154078486389748	43.694495656826561	-2
+0.54647888116301169	-0.052133922651309471	43.802184333544297	-2
+0.60162976620409647	-0.082881863191912805	43.555309073552742	-2
+0.60674964469031412	-0.12682148847235086	43.560486536534391	-2
+0.63958179520321723	-0.13441210740303763	43.439532503392769	-2
+0.661222052572636	-0.19657132517834927	43.367010746220437	-2
+0.66102221317595766	-0.15502505304547148	43.374721458503721	-2
+0.67589768835348452	-0.17314769154115203	43.333449796184723	-2
+0.67654044776733757	-0.22338591631572319	43.314687881362005	-2
+0.35455336073298782	0.046640198770797572	45.533945987120454	-2
+0.32897889881413828	0.068883218505971844	45.862783852126306	-2
+0.39645189062592984	0.048586820193960691	44.853178005353605	-2
+0.44697617943399376	0.01229450460372794	44.434544004033484	-2
+0.41991321047409913	0.021960551440243559	44.692152693944259	-2
+0	-0.99453681250000003	41.329487798712265	-2
+0.0028491216716722886	-0.99309666376420502	41.32940617603532	-2
+0.0088366813445651879	-0.99560682229077802	41.32990834747222	-2
+0.0051755261570967728	-0.99762725106111738	41.329802821673141	-2
+0.015610128462216532	-0.99931844707241657	41.330699721157792	-2
+0.011707596346662397	-0.99948883530431243	41.330272871535655	-2
+0.050000000000000003	0.14970450000000002	0	1
+0.073220346544016573	0.13355499473313351	14.623807540253972	-2
+0.17499999999999999	0.1057575	49.999999993208924	0
+0.15756540908598088	0.12133325	45.61072941680446	-2
+0.098265299980069179	0.14669810400661701	26.118912773503684	-2
+0.14008548143911576	0.14421716740822155	40.477625166113505	-2
+0.70281076178579771	-0.52696717127361425	42.90605191939958	-2
+0.67957601921498068	-0.61328235009521526	42.763102295263714	-2
+0.67275692656050445	-0.63686814786433588	42.722576490136703	-2
+0.69606205966177637	-0.66898951784433036	42.705360310203091	-2
+0.66106830085757096	-0.70121436602725673	42.619228991412626	-2
+0.69243471926944056	-0.59024956450031629	42.808179190794625	-2
+0.71694893134351911	-0.55976433975703421	42.868224265072591	-2
+0.72097409954240488	-0.2532164446282793	43.215677296755679	-2
+0.70467993267484375	-0.21875360414574962	43.259232787027436	-2
+0.79308671970437705	-0.33967842567009876	43.095592006089142	-2
+0.75593906410742651	-0.2728597461427591	43.15996591524474	-2
+0.78735556750342428	-0.29912923678916337	43.119573052820094	-2
+0.74596068862642961	-0.43141512891657552	43.035662725516083	-2
+0.76301897694128717	-0.41057704663078765	43.053582783177902	-2
+0.78538006562738405	-0.3755009643800965	43.076134803679423	-2
+0.73117276030794875	-0.49516879126568392	42.95894159098259	-2
+0.74278980228288438	-0.45815753631341227	43.005914623420558	-2
+0.67494719543654336	-0.73657561215276302	42.592307398827693	-2
+0.26040696207272684	0.069664059106510232	47.757215172270136	-2
+0.29266623096411903	0.062567962772192315	46.806808757658445	-2
+0.20499999999999999	0.074606000000000006	49.999999993208945	0
+0.23452184331711232	0.090181750000000005	48.637901906776861	-2
+0.52701800574420599	-0.032952423133279271	43.892658506828646	-2
+0.53093009208673625	-0.0059089178820168758	43.797415275403836	-2
+0.47383860033755637	0.035353420072089317	44.073818770739535	-2
+0.5043658916052588	0.029183854584336529	43.860623973201335	-2
+0.59733618359303498	-0.05252924520622828	43.535235410328163	-2
+0.55571619165250996	-0.023299162051165008	43.693919881195349	-2
+0.62241341756064816	-0.10541530736967258	43.48809932179266	-2
+0.64815561739598393	-0.060820480510867074	43.349608422705209	-2
+0.66627545855943526	-0.12754111939822024	43.351633016271741	-2
+0.66458145000814672	-0.10002944052241189	43.338801778235577	-2
+0.6888215163396062	-0.19505129290321205	43.299149844169946	-2
+0.6836619312985962	-0.14892973097606352	43.311420206500337	-2
+0.7011721554767274	-0.17032025558626035	43.273107366080879	-2
+0.37290419018083237	0.075136726418112088	44.998353026523034	-2
+0.33436332463471813	0.097117155572532976	45.470658601671175	-2
+0.30567739866321869	0.095310253568130165	46.15404344454852	-2
+0.42111065775286827	0.061537323193892393	44.455235289823179	-2
+0.4149340223790095	0.088696474499303526	44.318139894731928	-2
+0.44894490789313851	0.060524977748560721	44.169477436326162	-2
+0	-0.99687440625000001	41.329636614947169	-2
+0.0024296405595798294	-0.99626140044800704	41.329635388432308	-2
+0.0078050642311082623	-0.99965922353620829	41.329966624950984	-2
+0.0039025321155541312	-0.99982961176810403	41.329781004944905	-2
+0.0028764098249098409	-0.99871581461211179	41.329744719260709	-2
+0.050000000000000003	0.19960600000000001	0	1
+0.067135991061224587	0.17465525000000001	10.968207762812748	-2
+0.17499999999999999	0.136909	49.999999993208931	0
+0.15840800938331806	0.144696875	45.637959617082117	-2
+0.11918226453983552	0.18299635764612865	32.448492037054137	-2
+0.086232825657921008	0.19813913859621185	19.623808773431612	-2
+0.15843841032859057	0.16554554532348489	45.332908733540712	-2
+0.14306400080472967	0.17219676936584552	40.485990875906623	-2
+0.73170654691342196	-0.53395672404443983	42.909963129577925	-2
+0.70589447988959064	-0.61506952861740039	42.78610071014112	-2
+0.72104587325332525	-0.64510529357122492	42.762411311850322	-2
+0.73657561215276268	-0.67494719543654369	42.742898389122878	-2
+0.70710678118654746	-0.70710678118654779	42.670660018555893	-2
+0.7206520954594936	-0.58926191290480601	42.83205059047706	-2
+0.74795261584367634	-0.57749323273960429	42.866402754235509	-2
+0.75485952325687955	-0.55011641033979808	42.902491578682202	-2
+0.74947186984919045	-0.23573399812512794	43.18070263597194	-2
+0.72226852324196489	-0.19630520979866933	43.2308240096568	-2
+0.7466345919219276	-0.20859285840696198	43.18918741882392	-2
+0.81957209181627944	-0.31525541899032944	43.092362009864445	-2
+0.81751169118544531	-0.35788831450313979	43.075368114838575	-2
+0.77606391582579981	-0.25022790021192176	43.145051614362892	-2
+0.79515318152258596	-0.27157438667545963	43.121781266080447	-2
+0.83226462143004176	-0.27634098738287655	43.093503452567454	-2
+0.78838668013258428	-0.44354414338016779	43.020958549280529	-2
+0.79304075725044876	-0.41371931012073776	43.045200527844599	-2
+0.81760772331269305	-0.39617948996007557	43.053706225305177	-2
+0.76555674591115819	-0.48563239145617126	42.977739163242347	-2
+0.75900706729760503	-0.52218804387923801	42.936016731178647	-2
+0.26934960107385841	0.10315217250355428	47.157090668246859	-2
+0.20499999999999999	0.1057575	49.999999993208931	0
+0.22253321250902458	0.12133325	48.995740529161246	-2
+0.2488883423312036	0.13483963358285778	47.534524234162348	-2
+0.53298979902103749	0.041457850457878864	43.625311146216404	-2
+0.56503133771228886	0.016336382624150984	43.535451503535924	-2
+0.48127546616546141	0.062547657452719563	43.875372290586945	-2
+0.50905794215784894	0.057755210500614662	43.698774805308318	-2
+0.59499430439031997	-0.011617909261540297	43.469473164732591	-2
+0.62704804288781391	-0.030305759518171629	43.376975734656106	-2
+0.65968947283684032	-0.030284705245303082	43.265530294358918	-2
+0.67491965920334607	-0.072653326630876106	43.281488445328542	-2
+0.6820765141962396	-0.046158965330786075	43.226180259714567	-2
+0.69303789585660536	-0.12354725021128697	43.276627013131424	-2
+0.69768519601366541	-0.096890512931239292	43.245961578755683	-2
+0.70833661168553097	-0.14362132187908808	43.251005424863017	-2
+0.73203599277967735	-0.16429160148693728	43.208864862669593	-2
+0.3865372577315645	0.10479739838666732	44.529436926814157	-2
+0.35592241235551808	0.11612644225937933	44.847131401261535	-2
+0.32691952457413809	0.12728952183638384	45.231825319464107	-2
+0.29589876513463464	0.12915883430312558	45.956617962194109	-2
+0.44361403649240166	0.11575812681544596	43.812953938841829	-2
+0.41613426322755598	0.12390507228516467	43.984885067446051	-2
+0.46303661640915089	0.094680317428524688	43.813605791094318	-2
+0	-0.99921199999999999	41.329714953041389	-2
+0.0014022663923630009	-0.99853477986771177	41.329714873928225	-2
+0.0019512660577770632	-0.99991480588405213	41.329737043245039	-2
+0.050000000000000003	0.24950750000000002	0	1
+0.069156219487023163	0.22455675	10.955000559209241	-2
+0.17499999999999999	0.15248475	49.999999993208924	0
+0.14170344404254342	0.1964040012816225	38.600891254071612	-2
+0.1207807889979325	0.20915764877646958	31.285815941478944	-2
+0.099297824157103365	0.2313709864997861	22.969933085965689	-2
+0.17499999999999999	0.1680605	49.999999993208931	0
+0.16511653569675733	0.18090828892728522	46.907775557666533	-2
+0.15625731270214441	0.19189807362244179	43.437238535855833	-2
+0.74099680888837305	-0.61801891203898263	42.813493206186187	-2
+0.7660444431189779	-0.64278760968653958	42.80802911164254	-2
+0.76452855385055085	-0.60119810352831882	42.851598042522362	-2
+0.77815603819143431	-0.5705535798145791	42.893660354425528	-2
+0.78489466725441526	-0.5403046726840991	42.928081686789	-2
+0.78616985361105218	-0.22000445463288612	43.135447023445359	-2
+0.76909632705173347	-0.19309569524088593	43.155235384760822	-2
+0.76034964865211818	-0.16610587643067218	43.160790663675591	-2
+0.84105792623007425	-0.33855559357757425	43.074770610042826	-2
+0.85524473316355254	-0.31021350958071003	43.076712100860611	-2
+0.84549348292155113	-0.36993815327384172	43.062422551386078	-2
+0.80590009225690484	-0.24503052752029747	43.116204020524151	-2
+0.84465850862011904	-0.23914972116813876	43.084946428915977	-2
+0.86805170214755134	-0.27679343476986562	43.073991356917837	-2
+0.81294191599148391	-0.46165507849542453	43.00767730012258	-2
+0.80100220635632657	-0.4897336987012566	42.981958107331138	-2
+0.82618428488085005	-0.43416680381269512	43.02863849905463	-2
+0.84309104409563096	-0.39532244853333204	43.051011207389969	-2
+0.20499999999999999	0.136909	49.99999999320891	0
+0.22457246624715815	0.144696875	48.687572429911413	-2
+0.23448395767561164	0.15676999474687475	47.900043260093284	-2
+0.26044793963113066	0.16055135417226107	46.493551102706867	-2
+0.5699612493078613	0.055618964899102917	43.375014157277505	-2
+0.54715787917433378	0.087983012993892801	43.338413140008761	-2
+0.60214647940219113	0.033872687663366804	43.314179604492217	-2
+0.49862977334132291	0.084766152957640034	43.622369500813214	-2
+0.62444954980833511	0.0020707591008246335	43.317438845378796	-2
+0.65714777326920371	0.0020788819323630733	43.20835149493368	-2
+0.68653441666496007	-0.011715580783856504	43.155279658699214	-2
+0.70288889370562713	-0.064047973499106653	43.197996194722705	-2
+0.71190332894879227	-0.032509180566629277	43.132195716335318	-2
+0.7311650739713963	-0.13285654742715189	43.197434554387932	-2
+0.72628478692267284	-0.10874021779871218	43.191168274996784	-2
+0.72405964551180746	-0.084235865080732719	43.173322110733331	-2
+0.75626413540503834	-0.1402588985057939	43.15631088953981	-2
+0.39389985768628288	0.15505700555761348	43.844292267278199	-2
+0.35070984891209067	0.14584149783698108	44.515689406284366	-2
+0.31293580766365747	0.15355875460215301	45.064183431551172	-2
+0.29507271555721715	0.17736057951394188	44.921466986142626	-2
+0.46725434404248778	0.1312182898152689	43.506844568127491	-2
+0.44479101702154411	0.14439595801838306	43.541188927822184	-2
+0.42137163181314741	0.15939864436767462	43.555630618841136	-2
+0.48800942049120116	0.11548683083241271	43.493580025609653	-2
+0	-1	41.329725516928931	-2
+0.0009756330288885342	-0.99995740294202606	41.329729346246715	-2
+0.050000000000000003	0.27445825000000001	0	1
+0.079227548268198639	0.261982875	14.582365292615789	-2
+0.15623911288012227	0.20096829843177877	42.468878946631129	-2
+0.14524420864715507	0.21055554634232823	38.200815327382017	-2
+0.1377061664278823	0.22854251165988723	34.375366221052666	-2
+0.12369763517997354	0.25033409207905877	29.044685796914152	-2
+0.17499999999999999	0.18363625	49.999999993208924	0
+0.16524637093599359	0.19068723036507865	46.456039606125465	-2
+0.17078123703255449	0.18888047254341944	48.501532762960586	-2
+0.16413053072233613	0.19640159972228427	45.544392685496341	-2
+0.79259824370398479	-0.60818202301879298	42.865794401130643	-2
+0.81915204428899169	-0.57357643635104638	42.916006078226886	-2
+0.81407912783877645	-0.54408265585648541	42.938891197687006	-2
+0.81962242069378732	-0.51518148285650933	42.966072598204299	-2
+0.80342017811419419	-0.19018824562572001	43.112239438401204	-2
+0.83616611085881265	-0.20087861061984638	43.083457905156948	-2
+0.78149693665007181	-0.14719167772266256	43.121925630988109	-2
+0.8901175094598478	-0.34762633376593804	43.061393883048623	-2
+0.89639285970731142	-0.30681803103356542	43.064766572386034	-2
+0.86721647174821348	-0.38707030343564514	43.052893421197993	-2
+0.87339302042357136	-0.24119152174247471	43.068255324376345	-2
+0.87466802414491129	-0.21241278855842591	43.060044758926267	-2
+0.89766896665001439	-0.25670021456227582	43.060608932056226	-2
+0.91654231890803284	-0.28225592497459584	43.058380089932591	-2
+0.83468060645643272	-0.48747673340947456	42.992672178006181	-2
+0.84240296325469133	-0.45891395579635186	43.013909448760259	-2
+0.86060575685346441	-0.41393472714638613	43.041081436153931	-2
+0.86527614690940546	-0.44199769168519076	43.027522120878402	-2
+0.20499999999999999	0.15248475	49.999999993208924	0
+0.22156158967140921	0.16554554532348531	48.631726150819176	-2
+0.23693599919526956	0.17219676936584671	47.345160839404407	-2
+0.25703039010893552	0.18320922371632989	45.894765339731272	-2
+0.57380264593348074	0.082541105040410359	43.246862775460066	-2
+0.59980367379127852	0.065096012000918746	43.217316595781845	-2
+0.55005058521697359	0.11758602216361069	43.173622088832992	-2
+0.5213401015595488	0.10981337600491624	43.349186223924015	-2
+0.57291192565613602	0.10750897290670738	43.135579948552653	-2
+0.62828388386120215	0.056968992296199505	43.149850898530033	-2
+0.64080895760161838	0.03013071100426476	43.189375431677789	-2
+0.6724249848723669	0.025056237813648505	43.112777412235531	-2
+0.69781539942017301	0.014254435799465323	43.075772192533201	-2
+0.72586587868164976	0.010397889875600079	43.026238924838637	-2
+0.73757955185044266	-0.056905624700644301	43.113993648992142	-2
+0.74778122775843914	-0.020459003457835537	43.041506836225345	-2
+0.74959927268391513	-0.11660465103412897	43.15276318567485	-2
+0.75295245847376968	-0.088813752988430389	43.121754502094809	-2
+0.77409611372486442	-0.11464286675530291	43.111982820290052	-2
+0.4025954504978127	0.17991700727625404	43.438237138905762	-2
+0.37748389322880344	0.17474980598332998	43.724014780661513	-2
+0.34767578037364916	0.17585732322519512	44.03399841168855	-2
+0.30524909531516342	0.2069912051305963	43.848996133818233	-2
+0.26244145887900222	0.21078827244423354	44.497462199350551	-2
+0.46778763652448846	0.15725610076876237	43.282137282098184	-2
+0.49673128258482308	0.14679946510943384	43.220418437037431	-2
+0.44513769170228606	0.17071744467175068	43.275894983804484	-2
+0.42333340830124788	0.19615185023631013	43.097110233177752	-2
+0.050000000000000003	0.29940900000000004	0	1
+0.077492906096685646	0.29564507749976882	12.99753334186236	-2
+0.10555026206487191	0.27978734908768182	22.468652717074455	-2
+0.16532755008104882	0.20169598099205072	45.169550387356395	-2
+0.16414529729388905	0.21070378509872925	43.130817503661717	-2
+0.15467388659845518	0.22168588395289601	39.082988047481869	-2
+0.15556394196504014	0.23254460163434215	37.792450274543171	-2
+0.1495988627000876	0.24984589351275341	34.655519266851137	-2
+0.13816427649923285	0.29132630752724697	29.576980430341013	-2
+0.17499999999999999	0.191424125	49.999999993208938	0
+0.16892390596501025	0.19520108156370508	47.432364909632561	-2
+0.17280668759338455	0.19337109375	49.102019659911299	-2
+0.16875676867559752	0.19813815161208298	47.002321638261861	-2
+0.84258872403671514	-0.53678821817552336	42.959126887202714	-2
+0.8660254037844386	-0.50000000000000033	42.994533849117602	-2
+0.8277467521957621	-0.1711705272052223	43.079204687374038	-2
+0.85409262652265849	-0.15569467625921585	43.049191169396607	-2
+0.87959551570794869	-0.17252351162457732	43.039634398768122	-2
+0.80226806780670235	-0.12812231425396564	43.08312203192051	-2
+0.82770362641990136	-0.1402924773860578	43.062514892046309	-2
+0.91326257735956728	-0.33029884545117277	43.06058847349555	-2
+0.91510106609441733	-0.35687626670956868	43.057902607034954	-2
+0.89321749303294751	-0.37761801773954567	43.054206581345696	-2
+0.92678716845730613	-0.30708871830109447	43.059171973413058	-2
+0.88580999457418363	-0.40589132450427434	43.045711936563549	-2
+0.90945267579445499	-0.22830947635316723	43.049030119574972	-2
+0.91301326585475207	-0.19777732910340071	43.035636586142274	-2
+0.93001684086211467	-0.25348554057948258	43.050264962427576	-2
+0.95280922353748843	-0.30041959421409514	43.056580692711101	-2
+0.88616659541054421	-0.46130913087035008	43.022231255104622	-2
+0.90630778703664994	-0.42261826174069977	43.042132922454684	-2
+0.20499999999999999	0.1680605	49.999999993208931	0
+0.21488346430324265	0.18090828892728547	48.853454390893148	-2
+0.2237426872978549	0.19189807362244179	47.51165471343009	-2
+0.23829655595745525	0.19640400128162169	46.187966834723923	-2
+0.59607482214097662	0.098145851908135379	43.099099258468158	-2
+0.63503525001740757	0.085806292272666146	43.032834425984873	-2
+0.56925557381636716	0.14029888884856903	42.981404626026318	-2
+0.53365460079775184	0.15092561132362789	43.037351854930627	-2
+0.6057173871451208	0.13633058092944722	42.904806551993467	-2
+0.66269676813200562	0.056687249428261498	43.05326476427004	-2
+0.69396152466270755	0.042305282179123681	43.017751414404877	-2
+0.74798621679752664	0.038060784899272455	42.928800035711632	-2
+0.75793038759547871	0.0099600528676452322	42.971484721650938	-2
+0.76836224572264344	-0.061732231091932432	43.066993932244088	-2
+0.78296570531889753	-0.015295485946285388	42.979293342100014	-2
+0.80408455281532198	-0.099983712745705153	43.057360225120753	-2
+0.39699245442891312	0.20565102085452505	43.096105875521495	-2
+0.36768922513674046	0.1984427322408156	43.406620607294215	-2
+0.33948209901262644	0.20916638402117951	43.401860920884054	-2
+0.31776008591849164	0.23571415403100882	42.855513665393964	-2
+0.28621478160936287	0.23187548894913224	43.15910358660232	-2
+0.25807803779278754	0.24664590603758182	42.475446921430496	-2
+0.23541935969802899	0.2185141866182404	44.665621636424916	-2
+0.48835842965116555	0.17019318930532276	43.07223874304961	-2
+0.46809232346550961	0.18360254162879705	43.036696969273933	-2
+0.51248133491995196	0.17312767921951674	42.958966236751621	-2
+0.44324233058152607	0.21584232780736629	42.782369235536052	-2
+0.41730775962645267	0.22349726395390385	42.756449452836918	-2
+0.050000000000000003	0.32435975000000006	0	1
+0.079150894271053734	0.32334486221811232	13.492710139952655	-2
+0.09780617396395605	0.31455005427260407	19.479140735694436	-2
+0.17090574926820501	0.20463463807628787	46.315987315799077	-2
+0.17017116015922318	0.20071765002720909	47.073952867433846	-2
+0.16870852116109814	0.21803305648676269	42.695740812856315	-2
+0.17323031790708251	0.21067815435758944	45.216045902441586	-2
+0.16289508301708108	0.22448492923926194	40.38372469740537	-2
+0.16434005900232046	0.23900089453266207	38.482821523421642	-2
+0.17114794337501801	0.26369566823269203	36.683552630302032	-2
+0.15846325072080275	0.31213240629869937	31.776791502954758	-2
+0.12584893427452187	0.33055112213727761	25.791671654239092	-2
+0.17499999999999999	0.1953180625	49.99999999320891	0
+0.17167694642197184	0.19849434997279092	48.21525059356145	-2
+0.17307550011386591	0.196291546875	49.085962584264173	-2
+0.88344058109821699	-0.13895827715822368	43.016403483193308	-2
+0.87115617350103736	-0.1074860223514405	42.999678787031982	-2
+0.91288275809918962	-0.1394457907550683	43.001055261222589	-2
+0.93232482847349718	-0.16156106501572762	43.007987718263799	-2
+0.84003010740092221	-0.095229021999298835	43.013958074605739	-2
+0.93969262078590843	-0.3420201433256691	43.059333973896713	-2
+0.92300020391127924	-0.38231920253318441	43.054449241295437	-2
+0.93962430871866143	-0.22243049821527175	43.037806456826104	-2
+0.95415343023241717	-0.18919150037234858	43.018399376343943	-2
+0.96592582628906842	-0.25881904510252113	43.046546036855077	-2
+0.20499999999999999	0.18363625	49.999999993208895	0
+0.21475362906400625	0.1906872303650787	48.53210753257936	-2
+0.20921876296744549	0.18888047254341944	49.364528843261198	-2
+0.21586946927766379	0.19640159972228421	48.019578544240446	-2
+0.22376088711987738	0.20096829843177824	46.816913415565793	-2
+0.64671838450931873	0.12496857056129221	42.855898362841891	-2
+0.66684374289258974	0.097513530301302526	42.915445539552948	-2
+0.55914708780424871	0.1713815032873863	42.832346938615444	-2
+0.6140445760018487	0.17204989257883693	42.714092399435025	-2
+0.53652499010653576	0.19124982800646625	42.760553205475411	-2
+0.63797735796660704	0.15378066922603462	42.756015089384576	-2
+0.688376144985264	0.071337294869731019	42.951640098399963	-2
+0.73639092556326835	0.065521427549525474	42.883301426001587	-2
+0.76091542826075498	0.083610750153013461	42.807208883377314	-2
+0.77766072850164047	0.035239255403666514	42.894936712764526	-2
+0.7883591326723185	0.010816519438418156	42.928127242925555	-2
+0.79643302217677203	-0.048208108919000472	43.009818989013723	-2
+0.81740952335128281	-0.070584038214472886	43.010993530864631	-2
+0.81352269336466687	-0.022003673473472592	42.95262376877325	-2
+0.37608897432955873	0.22746204188004879	42.821495187379774	-2
+0.39810957839074917	0.24015094631951958	42.556207780596949	-2
+0.34787881555689987	0.2381360803808179	42.696531090868298	-2
+0.31336325053343189	0.26200719848713688	42.051861243904121	-2
+0.29330474241988252	0.27956603103471578	41.321899991785884	-2
+0.25214373837672022	0.2813710664831614	40.50628918000988	-2
+0.22263840954307659	0.2536346169353606	41.507685747649688	-2
+0.21160341080019723	0.2295063653948996	43.809335489258636	-2
+0.21585470270611187	0.21070378509872975	46.286655956972446	-2
+0.48888048462040856	0.19300136891722661	42.875148777011979	-2
+0.47706222059880893	0.21621333047510691	42.691154180676001	-2
+0.50907412463475088	0.20361751235874673	42.731392460425369	-2
+0.4476919590702455	0.25630375098409441	42.306398500582198	-2
+0.47385875951014172	0.24988320485583448	42.362353863271927	-2
+0.42144489907274252	0.25021961593185027	42.392995391033914	-2
+0.050000000000000003	0.34931050000000002	0	1
+0.063825860200715692	0.33714745030737181	7.0561308829540401	-2
+0.080961689971792608	0.34388966998428466	14.218629972329021	-2
+0.10923522163844245	0.35823532577566153	22.469595549147808	-2
+0.17373638437692407	0.20182930005441818	48.249522010832365	-2
+0.17488513271978598	0.20441801886905031	47.52563977046173	-2
+0.17373638437692407	0.19960600000000001	49.077587039073144	-2
+0.17140132176311559	0.2262361081176795	41.549495950968684	-2
+0.18000784008678575	0.21474449147583977	45.154275951402774	-2
+0.1785437679256397	0.20697748451288506	47.232271160145181	-2
+0.18412710979741478	0.24161127608105157	40.665135339681754	-2
+0.19411704765341836	0.26233861291256699	39.17301335683527	-2
+0.18480863295570077	0.29984977891558162	35.550502559065123	-2
+0.15635548445129138	0.34112377435694224	30.579940267398204	-2
+0.18840184150589634	0.34160080346837396	34.183339411652888	-2
+0.15441988989987204	0.370449686347882	30.215841505344102	-2
+0.17499999999999999	0.19726503125	49.999999993208924	0
+0.17400323085423333	0.198238515625	49.422324183890709	-2
+0.91102367590066735	-0.11005832285729178	42.97786394832552	-2
+0.89519063654398223	-0.082597868727283821	42.960079202336267	-2
+0.84699858622611657	-0.062510428640721344	42.972732493892913	-2
+0.87684159015374519	-0.056750737883309234	42.943311253166492	-2
+0.94472847276209637	-0.13105308915992364	42.98198801448639	-2
+0.96133551585358989	-0.15558048979631087	42.996108963039994	-2
+0.97536678965063839	-0.21623361138472594	43.029116423776721	-2
+0.98480775301220824	-0.17364817766693075	43.004509354127364	-2
+0.20499999999999999	0.191424125	49.999999993208924	0
+0.21107609403498967	0.19520108156370508	48.810789699385296	-2
+0.20719331240661543	0.19337109375	49.581643177869957	-2
+0.21124323132440243	0.19813815161208295	48.535059666783155	-2
+0.21467244991895129	0.20169598099205044	47.624176211946256	-2
+0.68328238942740183	0.12293146887689663	42.799329936659809	-2
+0.68746832650772494	0.15291110583415046	42.687553596795063	-2
+0.70073140403209233	0.098196218915465844	42.850759469211411	-2
+0.56849581388266379	0.20270101366861876	42.625746826562107	-2
+0.60865360367938237	0.21320787690583476	42.51339466232875	-2
+0.64772514221428112	0.18226791684225827	42.619843687539756	-2
+0.53926016825642753	0.23396904755304718	42.451423251536205	-2
+0.7353166210701807	0.10014483298913997	42.793697073584013	-2
+0.7913749358009734	0.084555856083299977	42.774029173536036	-2
+0.77470688397095866	0.13320513787121949	42.66463467568137	-2
+0.81399481913747906	0.018147103541161912	42.886631293834576	-2
+0.8083323436416483	0.05327509712285565	42.825689428971607	-2
+0.82988684288482983	-0.04256596707069138	42.964135800317486	-2
+0.84247716144419227	-0.010155970043653456	42.907120969970528	-2
+0.3711923830014045	0.25727310546062215	42.274618397601763	-2
+0.39976395760102718	0.27829248432691445	41.962048254472094	-2
+0.33490711630812731	0.27770809641232413	41.720169584875535	-2
+0.3151372403667782	0.30172990316757131	40.931841645895268	-2
+0.29060543045087567	0.318396489329693	40.030095162619702	-2
+0.26109501967748971	0.31544344885665088	39.381509047741609	-2
+0.21755713555435752	0.28806580940122156	38.759196808992307	-2
+0.19984564286087222	0.24005398710365905	42.03658748372596	-2
+0.20454837246378157	0.21826219888318746	45.539516130438734	-2
+0.19940798696097567	0.22426456381021992	44.436442433816893	-2
+0.20676968209291752	0.21067815435759069	46.863720115776836	-2
+0.20909425073179508	0.20463463807628798	47.871862557052722	-2
+0.50738370954838274	0.24531347663869837	42.389058845270213	-2
+0.43092457108637022	0.27994948834341088	42.007602972682797	-2
+0.46685872570767267	0.27523942933246304	42.108650031416595	-2
+0.50388000207886419	0.27896654076387262	42.10108507956749	-2
+0.050000000000000003	0.36178587500000003	0	1
+0.064537940872342894	0.35554818750000006	7.7254839305709195	-2
+0.078025414745524713	0.36381550379222161	13.665916155136282	-2
+0.12742166623721546	0.38206224676447398	26.346702114639903	-2
+0.098019147507607388	0.38788983831728541	20.956623405888273	-2
+0.17541126059419729	0.20163516470179221	48.979720947710526	-2
+0.17499999999999999	0.20000000000000001	49.999999993208938	0
+0.17749999999999999	0.20263616852935099	48.820938042586434	-2
+0.17499999999999999	0.199212	49.999999993208931	0
+0.18501392016193532	0.22167249381198623	44.086512281336759	-2
+0.18755404480528615	0.21239402369216093	46.429112434153943	-2
+0.18488045008162726	0.20732929652218546	47.678279792584704	-2
+0.18150565002720909	0.20363626761362733	48.681037358334827	-2
+0.20971254140718112	0.31766232759872504	36.802695787586032	-2
+0.22007934108268845	0.34647241283353419	36.45858548420027	-2
+0.20034768701950068	0.36935010606791013	34.763580657686191	-2
+0.17730528553949032	0.38888916320559058	32.689957722384676	-2
+0.13238165699993487	0.41162349542864735	28.276462811007988	-2
+0.93768048931059056	-0.098883026808045671	42.956759028841134	-2
+0.92532135815951255	-0.072754023379858646	42.935250620890812	-2
+0.91923795172170075	-0.041729919715654616	42.902666768940598	-2
+0.85517898574650397	-0.035431486223345895	42.932159788041282	-2
+0.89452837520559325	-0.032033202496964633	42.902593249676784	-2
+0.96730930997953612	-0.10924887720082178	42.958349807177527	-2
+0.99050122555197695	-0.13040196020729466	42.972484542074191	-2
+0.20499999999999999	0.1953180625	49.999999993208924	0
+0.20832305357802813	0.19849434997279089	49.084098110475857	-2
+0.20692449988613407	0.196291546875	49.545688511439252	-2
+0.20982883984077694	0.20071765002720912	48.452985325238082	-2
+0.72328467410242692	0.13262816081350176	42.712982035176708	-2
+0.69664772811010767	0.18007179670282175	42.577342927107296	-2
+0.71451263595917713	0.15890254745076945	42.636734331436408	-2
+0.57659237955910725	0.2395730085071085	42.388211333479866	-2
+0.62329335298250066	0.24666102132371814	42.330648809807961	-2
+0.64475556210152618	0.21733884717197502	42.462313927433577	-2
+0.67734892741664043	0.20127370308020162	42.511016818784789	-2
+0.5693550313017125	0.26635774045319832	42.220642443266975	-2
+0.5319526071056454	0.26389238452136338	42.236019710973466	-2
+0.81907323987418279	0.0793344884543912	42.763138712525667	-2
+0.81699654597592086	0.11153934257577799	42.692091031543008	-2
+0.74873982453596122	0.15572820809909163	42.620070713527532	-2
+0.77802635527730668	0.16326255615170407	42.580449079743822	-2
+0.82456588780756868	0.14291083203296745	42.613636358191812	-2
+0.8403666913492126	0.040418511080191635	42.824640333570038	-2
+0.84238952779798626	0.066808837738133856	42.773091494090259	-2
+0.86504090619042795	0.016116889142937182	42.848848950823545	-2
+0.87202733745003536	-0.012708786039811352	42.888924093746475	-2
+0.3678413244728217	0.29375517028985554	41.579471891952196	-2
+0.38581875196946813	0.32567667946578888	41.184406890526219	-2
+0.42233956131894751	0.31659117842457607	41.521071300683893	-2
+0.35067796424993875	0.32444414499777668	40.864204982985058	-2
+0.31652525428951517	0.33280993875109438	40.223338492376875	-2
+0.27317192160351778	0.34368486988661789	38.951862942313213	-2
+0.24737582970485519	0.35936719859001154	37.597983572709445	-2
+0.19861485357289183	0.21304249569179992	46.59342340791018	-2
+0.19237733020523204	0.21548198224164519	45.905536614567573	-2
+0.20145623207436034	0.20697748451288439	47.983750976408515	-2
+0.205114867280214	0.20441801886905045	48.415505543845825	-2
+0.20626361562307594	0.20182930005441824	48.965051767037252	-2
+0.45562132565738844	0.2990230252139684	41.837840309664927	-2
+0.48274678955415945	0.29620387590648084	41.92417064330823	-2
+0.49603070723593051	0.32002143089134155	41.741724231032698	-2
+0.52884377905976709	0.3124915354955291	41.869772001433994	-2
+0.050000000000000003	0.37426125000000005	0	1
+0.06066367384363576	0.3709330876724502	6.2601785730930306	-2
+0.079829886016046847	0.38684477433156855	15.516295356669167	-2
+0.067785706730509543	0.37953932098791704	10.142563078435941	-2
+0.082459315110240336	0.39736786596592927	17.513329483301668	-2
+0.090619610433889344	0.41162575495148274	21.221057604673177	-2
+0.11150139607606113	0.4257150684389393	26.274521081215259	-2
+0.17664338621436379	0.20048418019518227	49.99999999320891	0
+0.17835661378563616	0.20048418019518227	49.999999993208931	0
+0.180394	0.20126361562307593	49.544789203133412	-2
+0.19	0.20721552263122481	47.912450136602025	-2
+0.18420265002720909	0.20237265199055141	49.210406447077716	-2
+0.187697	0.20264180129461337	49.195166793919668	-2
+0.1819395	0.20105227507254467	49.627963454976751	-2
+0.24689956810045413	0.38955240963266785	37.146724276001116	-2
+0.21193893318272658	0.4063761330940191	35.205067615196477	-2
+0.16658229260724564	0.42345254392705206	32.121910726293329	-2
+0.19529266512944685	0.43093606742102286	34.29885871064026	-2
+0.14453839431657625	0.45215230720956512	31.25721478275242	-2
+0.96255092233965356	-0.071131742031223924	42.922344516023053	-2
+0.9416892383941674	-0.053436015178648856	42.908559952268426	-2
+0.91705760182524909	-0.015275514208184841	42.869531964470056	-2
+0.94202648687065293	-0.028118448002809816	42.878239651329686	-2
+0.99619469809174577	-0.087155742747658554	42.933838860172052	-2
+0.20499999999999999	0.19726503125	49.999999993208924	0
+0.20599676914576664	0.198238515625	49.694785286222583	-2
+0.20626361562307594	0.19960600000000001	49.490851620958942	-2
+0.71442870113221368	0.20256182873100012	42.485497449336535	-2
+0.74797019195122716	0.19114963451000971	42.50837384091065	-2
+0.59660384245103626	0.27158300275964664	42.196637345981188	-2
+0.65223562849794969	0.25222788782253019	42.300545490965206	-2
+0.64009326143860645	0.27908320827907906	42.17002434497293	-2
+0.68168963857234466	0.25117593479829442	42.302744969744161	-2
+0.71272083954008347	0.23962464156640823	42.347482962639049	-2
+0.55156228730174783	0.28764668913965108	42.074326419918236	-2
+0.56867410166399834	0.31039940766724211	41.944689259279748	-2
+0.84358506260952504	0.093249562102753328	42.718238001627675	-2
+0.85044360097121818	0.12940730328033087	42.636988267112038	-2
+0.82229907993722107	0.17132925904110405	42.542340033647399	-2
+0.79784074437982411	0.18610675164937296	42.508495709922151	-2
+0.84774344890628539	0.15847120711618268	42.570186078288735	-2
+0.87362203846702813	0.049669085429666124	42.788074957737962	-2
+0.86931064068700725	0.078838972472533728	42.736331246562166	-2
+0.91326483742019382	0.012545361174007175	42.831706606412681	-2
+0.40849204126833955	0.33887231423710151	41.166817671685592	-2
+0.3871484204671285	0.35412527053226944	40.803485481890867	-2
+0.4544430620705342	0.32404377681516994	41.574856625362649	-2
+0.43511178215248469	0.33997261646214832	41.320133067903527	-2
+0.34007887395609299	0.35506997708098709	40.229460734138705	-2
+0.28893677192354561	0.37004580530837178	38.903497966163215	-2
+0.19511954991837274	0.20732929652218546	47.980915512444128	-2
+0.19849434997279092	0.20363626761362733	48.968602704413115	-2
+0.20250000000000001	0.20263616852935082	49.192456768341494	-2
+0.20458873940580263	0.20163516470179227	49.361496843111702	-2
+0.20499999999999999	0.20000000000000001	49.999999993208917	0
+0.47616456426497122	0.33162402419620074	41.578701687697681	-2
+0.49608250181110219	0.34291897245168362	41.555381221327799	-2
+0.52427191196744749	0.34584562127940721	41.618148609470644	-2
+0.55070072164827932	0.3324778587445813	41.772580533754834	-2
+0.050000000000000003	0.386736625	0	1
+0.057112646157259341	0.38152463178521068	4.6610573195181084	-2
+0.06656783272076916	0.39159344210386521	10.734422874693664	-2
+0.071654209970987551	0.39831605257005087	13.912700792492959	-2
+0.060132416517377996	0.387238855381353	6.8231259636547321	-2
+0.076223901008395087	0.40624305418280959	16.841538383082469	-2
+0.075715757597995648	0.41537876548628833	18.352041141589602	-2
+0.089185910850141478	0.43740167809637204	24.237096828303244	-2
+0.11362598486349107	0.45692087606526161	28.854072196717535	-2
+0.17999999999999999	0.20000000000000001	49.999999993208903	0
+0.180788	0.20000000000000001	49.999999993208924	0
+0.192303	0.20264180129461337	49.244785391527728	-2
+0.183091	0.20000000000000001	49.999999993208917	0
+0.185394	0.20000000000000001	49.999999993208931	0
+0.19	0.20000000000000001	49.999999993208931	0
+0.26604282151287845	0.41033849884110418	37.660800141565623	-2
+0.23858247657753798	0.41700596551334868	36.552254207133046	-2
+0.21572437751501963	0.44946811525583957	35.559496241355205	-2
+0.17633425507543316	0.45375858486481624	33.505415085439139	-2
+0.16933460482821505	0.48900392747704308	34.033613718589322	-2
+0.13672893845522563	0.50410690068796882	32.951200920893008	-2
+0.10913427630767572	0.48836886174229166	30.635903885811764	-2
+0.99809734904587299	-0.043577871373829458	42.887933539061244	-2
+0.96195955805642208	-0.041045000847919011	42.889302628282785	-2
+0.95057343413273854	0.0084303470818085438	42.827450001167698	-2
+0.97423689879064812	-0.020705630163208661	42.862688249430029	-2
+0.20499999999999999	0.199212	49.999999993208931	0
+0.74300174372151684	0.22622931959252232	42.392970500709744	-2
+0.77536193393682284	0.21292090588346688	42.433098626154397	-2
+0.60761572916700679	0.30896284255156237	41.995558852912779	-2
+0.66781053516732503	0.27544261326277036	42.197460535838587	-2
+0.6355064017134977	0.30668801197532608	42.032239267611793	-2
+0.66116268013289681	0.31786029226685264	42.001960133143434	-2
+0.68710969533697075	0.296934521803564	42.113908586037766	-2
+0.71366348030621984	0.28556543126006129	42.172372306461916	-2
+0.73819708733104672	0.26077478594706577	42.272708046566343	-2
+0.58004356110995525	0.33649990159112503	41.805118209831619	-2
+0.87955628590522184	0.12729711293658449	42.63501671936698	-2
+0.82211698309579995	0.19865720012465726	42.470754353783036	-2
+0.84652293568439951	0.1863608998124153	42.501679799276999	-2
+0.81779351747309759	0.22566281924065915	42.395617559332344	-2
+0.87191832964406302	0.1724318572632681	42.535812875200477	-2
+0.92702089790608433	0.040899824303915276	42.783720101412136	-2
+0.91824238651956447	0.071167670565477015	42.735464635241662	-2
+0.90558507490467033	0.10384040403129845	42.677712505073345	-2
+0.41358402480512613	0.36472004166081912	40.916328957814372	-2
+0.36653950945694735	0.37378139270720373	40.33576369002585	-2
+0.38156133200640441	0.40035487929268632	40.229064284027693	-2
+0.46039462899757505	0.34837493311490397	41.365773322606991	-2
+0.44039736581160532	0.366307738294257	41.088549246991001	-2
+0.31863487705708071	0.39355255409264062	39.290740566110912	-2
+0.35139110622767006	0.40499845749019664	39.758805587203462	-2
+0.2923025033803997	0.42077663871418236	38.381329317720777	-2
+0.19579734997279091	0.20237265199055141	49.332638727447765	-2
+0.1980605	0.20105227507254467	49.705378378520905	-2
+0.19960600000000001	0.20126361562307593	49.654715190230348	-2
+0.20335661378563619	0.20048418019518224	49.999999993208931	0
+0.20164338621436384	0.20048418019518224	49.999999993208903	0
+0.49132802795363545	0.36531752308613935	41.361846551740733	-2
+0.52124649242355903	0.38399403265484955	41.350054264349659	-2
+0.56021715367879366	0.37209712609877243	41.551574893023961	-2
+0.050000000000000003	0.39297431250000003	0	1
+0.054222704272811513	0.38985546874999999	3.1980864664171125	-2
+0.059064638778996884	0.39361311730223286	6.9586467003539774	-2
+0.06322934534143583	0.39860995899280532	10.297900508418543	-2
+0.06711140658310763	0.40541729629144746	13.606038822454959	-2
+0.062974603822163452	0.41207290321333068	13.902562863171408	-2
+0.061016918565499512	0.4275202971682725	17.766602441634159	-2
+0.083763478548275899	0.46925149084708995	27.28177975863084	-2
+0.056550788407668383	0.45183647320037507	22.311532113153277	-2
+0.194606	0.20000000000000001	49.999999993208895	0
+0.27018961048355467	0.43815662278710488	37.652505273159953	-2
+0.24299944981258434	0.44534960835147219	36.702296180834828	-2
+0.20158251257658566	0.47315142845357006	35.178520253387141	-2
+0.23300286702631656	0.47152130558500238	36.434259968816633	-2
+0.19693316252840931	0.50441986301022124	35.507205189382645	-2
+0.16896598151304612	0.53095562943916141	35.102893209585027	-2
+0.13393452419761603	0.54023986817658032	34.243487012776583	-2
+0.097694511076457435	0.54048793984856336	33.087252764658956	-2
+0.075896553449061904	0.50608531041292681	30.191502201386385	-2
+1.0000000000000002	-3.6082248300317588e-16	42.834617433871713	-2
+0.97042678401778582	0.037973568781017306	42.782709537612007	-2
+0.78013539367609053	0.2490008000763558	42.321036245151411	-2
+0.61204812334394421	0.34097307835170831	41.832107023192947	-2
+0.64412915919324365	0.34540463290783241	41.857228655098986	-2
+0.69464270122219929	0.32482024464362308	42.005421544034277	-2
+0.69681528408092119	0.35894695900274409	41.868970296972314	-2
+0.71895460199964856	0.31236485715285123	42.073877431476241	-2
+0.75503454871849385	0.29131940679443608	42.17229169380991	-2
+0.77894453660207952	0.27689791245426953	42.231285247894789	-2
+0.59276637967124635	0.36690598553661669	41.659657422750108	-2
+0.9086106299376614	0.13874829806957412	42.608630076357755	-2
+0.90067309898209524	0.1689522738084531	42.544308423885305	-2
+0.84634953603051144	0.21638560386617636	42.425600237057253	-2
+0.8897166335347817	0.19528277933035526	42.483882174983655	-2
+0.80955347313302906	0.2544182292983031	42.311591634743337	-2
+0.85978489809087155	0.25325403792804568	42.331772715566792	-2
+0.95234633609273478	0.059656875248318572	42.750399469199564	-2
+0.94110823850026659	0.093851654788842331	42.693329290293171	-2
+0.9466380167397348	0.12558226902291555	42.635389796183766	-2
+0.42550978675350754	0.39052377237229041	40.761423130944316	-2
+0.40902415399251485	0.41368149741490357	40.417611748828072	-2
+0.36893737755044764	0.44518336527143643	39.708754832318803	-2
+0.46466871836506779	0.37325715894428146	41.171077080624386	-2
+0.4537985085067851	0.39604381161162927	40.924192370827804	-2
+0.32768046101700998	0.43033192463854719	39.130800417309459	-2
+0.2950789871780643	0.44706653784479417	38.310041901997415	-2
+0.196909	0.20000000000000001	49.999999993208938	0
+0.199212	0.20000000000000001	49.999999993208903	0
+0.20000000000000001	0.20000000000000001	49.999999993208931	0
+0.48940108316954484	0.40053418689330983	41.097691775008116	-2
+0.54924904536325569	0.40594541905320303	41.322952795946577	-2
+0.52674372142954362	0.43350475015156276	41.077906328089	-2
+0.57923370042083722	0.39696038031257852	41.467325671091942	-2
+0.050000000000000003	0.39609315625000002	0	1
+0.053090380317364995	0.39498150622279093	2.8300871713424938	-2
+0.056760386280691029	0.39929243705272566	6.6791014972676717	-2
+0.059425821561537299	0.40388692919241903	9.832017568816168	-2
+0.055402206110058416	0.4073545540217085	9.3016827020133963	-2
+0.049787415711699201	0.41673360271539106	11.671207788226873	-2
+0.045595537620739007	0.42967332325262686	15.553242654145112	-2
+0.041678391194295894	0.490345674259833	27.064523732068121	-2
+0.036363820634330593	0.44495249652518543	18.786402897700977	-2
+0.033346709400884557	0.46036838112637979	21.973838604609337	-2
+0.26570272431863312	0.46901639080487251	37.484235141538917	-2
+0.2209370543555414	0.494514989602027	36.202034954882649	-2
+0.24686909475253876	0.49586503438999086	37.035281095533598	-2
+0.2327120249016118	0.51806802906400795	36.818406652085727	-2
+0.21087920011211611	0.53278955619164103	36.389185688110089	-2
+0.15938664767611518	0.56554349710946961	35.642767721343148	-2
+0.1877907998772633	0.56097231377897194	36.220121550990896	-2
+0.11012441502057664	0.56403527366761852	34.382842340113129	-2
+0.12830525186327624	0.58348872101622973	35.397386503296246	-2
+0.06408106516116524	0.53767880966814363	31.988136547074845	-2
+0.078679611610272468	0.56550593863900023	33.759287560759404	-2
+0.033125596136461676	0.52428053007218678	30.228797506893063	-2
+0.99809734904587299	0.043577871373828729	42.774838767872978	-2
+0.9797876695480896	0.064608924956858882	42.742054622656589	-2
+0.63033945176294914	0.37470779836712742	41.697328207858831	-2
+0.66507863831385505	0.37315941446868528	41.765092804319586	-2
+0.72022887130240509	0.34750725964899187	41.941626659084527	-2
+0.69590448142963712	0.39945357432547268	41.709184126472223	-2
+0.72568001470877253	0.37985953808697293	41.82840282130902	-2
+0.73967728907861674	0.33016304349823405	42.024451840791905	-2
+0.76814991321221771	0.3189623598475001	42.087175249712608	-2
+0.80591972759708852	0.28410943728466803	42.221070974107434	-2
+0.79758308435606595	0.31296696208189828	42.127721708546993	-2
+0.60901131245461415	0.40660943631088936	41.498485581259331	-2
+0.92852221512155286	0.16280683758405828	42.560817422691123	-2
+0.91756574967423921	0.18913734310596056	42.502913451262692	-2
+0.87999992362142865	0.22697865516569138	42.405672932674641	-2
+0.91073666188336255	0.21455706438485087	42.44469698457673	-2
+0.83510437392893144	0.27261322631928087	42.269419459549368	-2
+0.86452525794100565	0.28470927135771501	42.251640566873199	-2
+0.91257503088167047	0.26138327770682079	42.33631506065008	-2
+0.9710040025962472	0.10583721343943284	42.673551888634861	-2
+0.95806412792009299	0.16096350116849883	42.570072603191612	-2
+0.99050122555197706	0.13040196020729392	42.634047302502509	-2
+0.43239811884700236	0.43914664336400999	40.446343613702972	-2
+0.40035099700819021	0.45210032519877946	40.05127439315855	-2
+0.34266636016928526	0.45710289160128842	39.229183215521665	-2
+0.3754082669038839	0.47241091448161571	39.641277483533827	-2
+0.47259974701912189	0.43224257531574783	40.795503791665197	-2
+0.31482178150957923	0.46464748578738074	38.682319534905609	-2
+0.29070859014266232	0.4718500523929362	38.136614936433041	-2
+0.55596681068817999	0.43439997950405218	41.195176034273814	-2
+0.58254351693868078	0.42496668997733844	41.334855976740364	-2
+0.48790529816349498	0.46469942200415376	40.70430534795279	-2
+0.51894538380349253	0.48270552864188437	40.792115998518703	-2
+0.54831844316947864	0.46687766813741388	41.005876748733996	-2
+0.050000000000000003	0.39921200000000001	0	1
+0.051179466613876491	0.39765257812499999	1.3741294836520339	-2
+0.053171156693687091	0.3985453040201119	3.6282903314361143	-2
+0.053382584514155416	0.4007176500272091	4.7276595182214773	-2
+0.05411922747827911	0.40411922747827911	7.0296147715534856	-2
+0.049290344872793941	0.40674894715358706	6.4565060025481484	-2
+0.041690248187616651	0.41664424331754407	9.9411891793683456	-2
+0.043703640179598949	0.40880087926239134	6.2327366039825769	-2
+0.021722227688064463	0.43926248648756888	16.044936410559821	-2
+0.030439336545105611	0.41704574992652726	8.7759276854467689	-2
+0.015086809811196613	0.49429175000000003	26.762796381870203	-2
+0.017785564945550288	0.47041610128490713	23.180944631470918	-2
+0.022604381857520235	0.45253077487712889	19.685539170454764	-2
+0.27855631274675513	0.49806282486679049	37.865517892361574	-2
+0.27539468539707412	0.52966842847904017	37.891815857774901	-2
+0.24448418097349087	0.55907717270155566	37.449862548292067	-2
+0.2165490945138529	0.56016480594488716	36.863722405913286	-2
+0.15683534245751082	0.59701393119068003	36.242197272917736	-2
+0.20365734672012711	0.58497115272151701	36.921173879236513	-2
+0.10339974412331102	0.58979877970560801	35.109028724422572	-2
+0.12031203565961707	0.60913981254875926	35.891559353349159	-2
+0.038071328086294848	0.55531287449970024	32.508971846505084	-2
+0.05346999668832355	0.57796657606721658	33.900774215647665	-2
+0.079040658828406302	0.59796799754114294	34.988852700377919	-2
+0	0.51299250000000007	28.728401125993781	-2
+0	0.55039400000000005	31.876813349402688	-2
+0.99619469809174577	0.087155742747657819	42.707865057735837	-2
+0.63498889965459715	0.40857058347665887	41.553229197529618	-2
+0.65953241146402086	0.41730540820296036	41.568720049283272	-2
+0.74399367766084967	0.35819822623896425	41.929512114416951	-2
+0.68561517443710074	0.42446861381222589	41.593662228070421	-2
+0.72497510989157954	0.41120914848711931	41.714264827246652	-2
+0.76131520250112383	0.3806608053185519	41.872503725973196	-2
+0.75509883225967078	0.4101549852603586	41.764585910513603	-2
+0.78867482822761736	0.34165318404821521	42.030182418448518	-2
+0.84802655721652698	0.3119066167433926	42.166456326002688	-2
+0.82331450705245035	0.33668393267855096	42.076055544537859	-2
+0.61520898798862578	0.44380483067317728	41.34684671408688	-2
+0.94379106308852889	0.18689421888420127	42.514300491925475	-2
+0.94294616989882829	0.21946446881107237	42.445152630070019	-2
+0.93886298838054638	0.25204017541398488	42.371109594289941	-2
+0.9084209007342402	0.29106467249177903	42.261607307958961	-2
+0.89660455572225528	0.31860765679305025	42.184458338937787	-2
+0.9340343156345281	0.27951806087536929	42.305587006401772	-2
+0.98480775301220835	0.17364817766693003	42.553549074025824	-2
+0.45213215640939503	0.46752592546758304	40.444712709350803	-2
+0.43089346141826762	0.48954449471619582	40.155519721628892	-2
+0.4007601848311666	0.4842638509289891	39.885915198294363	-2
+0.35036609401835805	0.48490496995566357	39.241921941795624	-2
+0.36364427521208037	0.51835761393050861	39.331714291701971	-2
+0.39057317247993095	0.51042369375629015	39.679392256618208	-2
+0.31055213688480865	0.49431839833845009	38.536149168179179	-2
+0.57861223935924766	0.45289254400212459	41.189860078389962	-2
+0.45855333878363319	0.4949721825538817	40.358195203530322	-2
+0.48208863130372359	0.51048406887129005	40.457233411373963	-2
+0.51677220869888452	0.51816230808204877	40.631043831897358	-2
+0.54925989358703897	0.50379372329050665	40.847912172580543	-2
+0.5735882725872028	0.48181283551789911	41.042645670869057	-2
+0.050000000000000003	0.40000000000000002	0	1
+0.051263615623075923	0.39960600000000002	1.9799879290095108	-2
+0.051007318863870395	0.40100731886387042	2.7759640470192255	-2
+0.050717650027209085	0.40338258451415543	4.6347406049839392	-2
+0.048551434699955459	0.4031679404263584	3.4720700659662316	-2
+0.045073849972790889	0.40300914205920696	2.5175802401441585	-2
+0.037621314945542585	0.40964310846049518	5.8072462952458004	-2
+0.040132500000000002	0.40403971842434322	2.6857044737123603	-2
+0.015649216850231403	0.42626652512003055	11.265947230651225	-2
+0.0085793601047848139	0.4335143125	13.612808582304609	-2
+0.010445119385356885	0.4471476522795782	17.812129079555973	-2
+0.032141266099203508	0.40687307327719602	3.837495819404019	-2
+0.015134555236033903	0.41615472905161355	7.2872726774957819	-2
+0.016903480660939961	0.40657522180272049	3.0708614496372837	-2
+0	0.47559100000000004	23.857767352752099	-2
+0.012314107771829209	0.45935010816734784	20.822054451893152	-2
+0.30360300624307696	0.53441553956728516	38.436264259915816	-2
+0.29295131068966762	0.56096334193344444	38.327990923569509	-2
+0.26938174463600428	0.58802036053907036	38.069429797637092	-2
+0.23145270499899762	0.58366321115662512	37.411846177577409	-2
+0.14487476812762951	0.62205580108742409	36.526342503556684	-2
+0.17262242856179888	0.62435740009852125	36.945400242588349	-2
+0.19753963469253444	0.61207093228312548	37.161889344959121	-2
+0.096241643089796949	0.62107657105445913	35.860012306799703	-2
+0.12088163360478379	0.63600141265503574	36.475339220285065	-2
+0.026145660592363389	0.57988747334198354	33.705632237339081	-2
+0.04727122896037679	0.60464773923676685	34.86444069638344	-2
+0.069633976633058356	0.63211795299278062	35.865056982273778	-2
+0	0.58779550000000003	33.945274488114215	-2
+0.63956050919602703	0.43421783520348595	41.452628879014249	-2
+0.66891162412004435	0.44862996334371985	41.46456466298671	-2
+0.70552545660173926	0.44277715561748604	41.565441062460053	-2
+0.74221271800585931	0.43740380117694866	41.651646889569264	-2
+0.81041689580315868	0.36999504546683715	41.963592987955323	-2
+0.80550309170054812	0.40537629954824228	41.849879248888648	-2
+0.78337584932782367	0.44019870642286296	41.710012505446045	-2
+0.85360523654966125	0.34218273743475847	42.086869622252379	-2
+0.84357152840230087	0.37404055447793605	41.987016465354273	-2
+0.60278061953548678	0.47198754138070753	41.187707448515781	-2
+0.63536622790628461	0.4600502774363241	41.336352714950571	-2
+0.9753667896506385	0.21623361138472524	42.465910050562726	-2
+0.96592582628906865	0.25881904510252046	42.371170940965776	-2
+0.92647756311485874	0.31498535261034355	42.216267196594565	-2
+0.8754027700958511	0.36392285423579751	42.047403735442522	-2
+0.90728606568997816	0.35220355102802919	42.107809121412302	-2
+0.95280922353748876	0.30041959421409448	42.270140368129525	-2
+0.43683601528491817	0.51955425329943095	40.091346394950854	-2
+0.32765739564701984	0.51893552732443937	38.818967234944409	-2
+0.3935822320828995	0.53833530706865718	39.631538933894717	-2
+0.36523044658114912	0.54840152381405205	39.309990607028475	-2
+0.46638448891937495	0.54955496413664984	40.21219124191056	-2
+0.49981070008943795	0.54949413632868427	40.422699044015687	-2
+0.5639561057829241	0.53452261518847222	40.795677887422421	-2
+0.53688959775732459	0.55520225719416205	40.598385308789219	-2
+0.58589151048772281	0.50846342351605023	40.982473787652921	-2
+0.049212000000000006	0.40000000000000002	0	1
+0.049606000000000004	0.40126361562307594	1.9252340812686779	-2
+0.047698750000000005	0.40116507005338947	1.2802761821543811	-2
+0.043159000000000003	0.40000000000000002	0	1
+0.046185500000000004	0.40000000000000002	0	1
+0.037106	0.40000000000000002	0	1
+0.0057450550176240669	0.42416393750000003	10.216252963091964	-2
+0	0.42883912499999999	11.861787914250714	-2
+0	0.43818950000000001	15.00155277361241	-2
+0	0.45689025000000005	20.099589699296576	-2
+0.025000000000000001	0.40000000000000002	0	1
+0.0054121953274278867	0.41676446186031268	7.2827983766300148	-2
+0.0068444710290566507	0.41103901208019106	4.8950228215864504	-2
+0.012894000000000001	0.40000000000000002	0	1
+0.0098675000000000013	0.40344401547539216	1.5588917396176871	-2
+0.33851131052207245	0.56223048722274904	38.971635558361903	-2
+0.30709850508200054	0.59394005478674028	38.616698550307149	-2
+0.24741452213650889	0.61198035008077267	37.89875119315063	-2
+0.28324849477456221	0.62278389688282798	38.421264825454905	-2
+0.21965240580304934	0.62888907149512807	37.65766080078248	-2
+0.15509511413818333	0.66725234386781573	37.32467200879384	-2
+0.19183093078756272	0.65192170500766045	37.533377738741784	-2
+0.093833598254014924	0.65285407525158778	36.526595878177275	-2
+0.12244543937080749	0.66864326357647563	37.041727765694247	-2
+0.019972698726390414	0.60649625000000007	34.754473297873645	-2
+0.036214538464976839	0.6438587485281303	35.944299780414468	-2
+0.062422079500950238	0.66502330529129483	36.539451939183145	-2
+0	0.625197	35.303941308924806	-2
+0.65418784126289853	0.47782598367507689	41.31781410300556	-2
+0.70836768627312685	0.48683863600821387	41.416883333998335	-2
+0.73034231919253068	0.46558009657935256	41.535167833044952	-2
+0.77624117062715137	0.48013390750306806	41.573524680318393	-2
+0.81309910311621059	0.43464441496345246	41.771479392966953	-2
+0.83822397234388113	0.41250394677922081	41.87001755880884	-2
+0.814285429203222	0.48010484680417492	41.638570997574703	-2
+0.87059777515087999	0.40393678406697597	41.933422477174055	-2
+0.62737485159463502	0.48467479299050115	41.215564605756853	-2
+0.93969262078590876	0.34202014332566849	42.162026894863224	-2
+0.89776669934035924	0.39547378504659136	41.986894740584226	-2
+0.92300020391127946	0.38231920253318386	42.04733938400495	-2
+0.42626654431154126	0.56234970779595783	39.874800814385296	-2
+0.39554825398272131	0.5888325767384468	39.562833255298578	-2
+0.36480387958039373	0.58030403997389046	39.271696094310037	-2
+0.45138015595304587	0.5718011678270658	40.042910004974615	-2
+0.48939018841387749	0.5812546185294849	40.264409712812345	-2
+0.51818114343241151	0.57741978949186856	40.434389886577343	-2
+0.59378637989920191	0.53737064712426375	40.904515072910897	-2
+0.57222003995363446	0.57339164229373185	40.698532129436366	-2
+0.54642073088448528	0.60361563156784581	40.493311262064168	-2
+0.62864147545612614	0.51231965269321889	41.114879550247743	-2
+0	0.41948875000000002	8.3402901864430241	-2
+0	0.41481356250000001	6.435190265061693	-2
+0.0033365844519652904	0.41123960635416301	4.9479379298414106	-2
+0.0052053714854993927	0.40597108976224938	2.654399905352181	-2
+0.0026154823763429136	0.40780078125000008	3.4488240631954921	-2
+0.0068410000000000007	0.40000000000000002	0	1
+0.0053277500000000009	0.40280244335766852	1.2500806652294487	-2
+0.3371811325003235	0.5923269521156177	38.978711078886953	-2
+0.32424541315775685	0.63240057055008347	38.89656221896746	-2
+0.25418733338022875	0.65434591621015192	38.254844830697522	-2
+0.29540837162742151	0.66314051074043356	38.697938781322897	-2
+0.22488333169802216	0.6579463425017702	37.958295070516478	-2
+0.16147776459416724	0.69734609696985239	37.703741732799521	-2
+0.20736502755133931	0.68171179229546142	37.967219667049768	-2
+0.090918702836505536	0.69195478593285764	37.146167349902214	-2
+0.14100071821935178	0.720303944742962	37.789719544674504	-2
+0.1101210385240918	0.71644404391692018	37.56298636134872	-2
+0	0.66259849999999998	36.277397036417682	-2
+0.030678414592062105	0.67752234170511483	36.644972767565498	-2
+0.057414322139740695	0.6988641951757304	37.090244992671693	-2
+0.65973971996259695	0.5086445471555664	41.220198328728301	-2
+0.71563857981900025	0.51632210838504955	41.334692342024155	-2
+0.73851258841473422	0.49504289840517546	41.453862056089378	-2
+0.68650728797126515	0.52489583987333055	41.235071319775265	-2
+0.78729652335250211	0.50691837727123812	41.512135974946908	-2
+0.76029662835584655	0.51743666205600714	41.428041153037817	-2
+0.83862030790708897	0.45086138371248163	41.760814974702605	-2
+0.86686208635904849	0.43574910376523357	41.841988157099053	-2
+0.84399101509397634	0.48007744245461997	41.686250927427515	-2
+0.8291640460254498	0.50808354015328761	41.583222623956885	-2
+0.90630778703665027	0.42261826174069922	41.926711529983614	-2
+0.42337707995709911	0.60280470382729034	39.771998169909352	-2
+0.40045935694166113	0.62388649365374149	39.575101147399792	-2
+0.3664999344241075	0.63386916091514833	39.291525778914853	-2
+0.45421532457915953	0.59848422247344113	40.000097574586349	-2
+0.4803138159114767	0.60724505821107866	40.143412705140115	-2
+0.50888601193980287	0.60493752077847918	40.308087288024453	-2
+0.63638093759030301	0.53818036891205823	41.048138311375368	-2
+0.61671162757948828	0.55666804483890631	40.920729836382421	-2
+0.57319513905751807	0.6003471779713313	40.618358309067432	-2
+0.60227293016207739	0.58579990301811258	40.775015336738477	-2
+0.56967526890008258	0.6252436532736072	40.532400899220079	-2
+0.52239062106049494	0.63248007923601468	40.305050585743928	-2
+0.55007653345129348	0.64099527341918006	40.408922801037278	-2
+0	0.41013837500000005	4.4602105454733492	-2
+0.0025139078425679101	0.40429439062500006	1.9065979659745584	-2
+0	0.40546318750000004	2.4193235885503142	-2
+0.0038145000000000006	0.40000000000000002	0	1
+0.001657615623075921	0.40165761562307595	0.73626771198266505	-2
+0.34430965573952838	0.66372019430895668	39.128121247512958	-2
+0.24371534901476197	0.69016743681026482	38.345534080808143	-2
+0.28121072086093707	0.69893415501912393	38.699467423219815	-2
+0.31601539765747921	0.68604928699193846	38.933809955746874	-2
+0.18414689284694152	0.71814231842637877	38.053595790703405	-2
+0.21886111105388467	0.71465257711108798	38.284770783313562	-2
+0.07916778917114542	0.71966115550389587	37.449539301513198	-2
+0.12149429621965278	0.7509071499652189	37.947882928887701	-2
+0.15936365846864758	0.75352672610939031	38.151991765872239	-2
+0.085246255464670143	0.74913621503388128	37.787294028394562	-2
+0	0.69999999999999996	36.975328972020513	-2
+0.028975578633500827	0.71300046086379643	37.20627549599277	-2
+0.03712126574367796	0.74369645280607433	37.599705943426166	-2
+0.65829306518131159	0.55394534851601129	41.061980316784805	-2
+0.72549821437012008	0.54504367942267606	41.266486515287802	-2
+0.69639739629213238	0.56765579236802599	41.123951949109419	-2
+0.79726861830964035	0.54143233745932484	41.429946402925317	-2
+0.76214202586140423	0.54896749695826985	41.336444209637314	-2
+0.88616659541054466	0.46130913087034953	41.799324499434178	-2
+0.86602540378443904	0.49999999999999983	41.665619971156147	-2
+0.84258872403671559	0.53678821817552291	41.526486966441425	-2
+0.44243543384276207	0.62662015991731623	39.869662864241363	-2
+0.4270547216047853	0.65296082226015928	39.733966284897988	-2
+0.38785502758795753	0.65696257118601631	39.462092853578206	-2
+0.46788072540665848	0.62965205515391842	40.021887104572656	-2
+0.49344341236320305	0.63144210740431128	40.161390133168467	-2
+0.65620734374956025	0.59438748107762884	40.928253675327923	-2
+0.62617310455232456	0.60935623533887018	40.786135509213977	-2
+0.59371052768260502	0.61785918960593178	40.646997553702398	-2
+0.59205189989280016	0.65526832972512716	40.538349913009128	-2
+0.52807855296929884	0.66088194022237956	40.265595471188327	-2
+0.49867630938713969	0.66474182806570847	40.118259418402722	-2
+0.57096726765627048	0.68621397714205812	40.381593065288641	-2
+0	0.40312559375000001	1.3865808229814687	-2
+0.00078800000000000018	0.40000000000000002	0	1
+0	0.40078800000000003	0.34985714339248819	-2
+0.34301768174880692	0.70089308047595811	39.157733984979743	-2
+0.37057072871017549	0.68324181421694952	39.339736014601939	-2
+0.24978186979665101	0.72118242638602814	38.543235427204415	-2
+0.27859984896854512	0.72856892593193789	38.773081467973505	-2
+0.31158715290509448	0.71654276497589375	38.966516395641122	-2
+0.20208183467488691	0.73866775936636697	38.305744547483577	-2
+0.22870828023037532	0.7444977045833775	38.503335635766398	-2
+0.10112183344309877	0.79604349294229471	38.19011472596334	-2
+0.13398269489084716	0.79650278467825852	38.299525586659911	-2
+0.16635473448563454	0.79083725588913767	38.394529166856088	-2
+0.19794075074792539	0.76560857019422801	38.42475306829774	-2
+0.058903540844082836	0.76658919220320332	37.865655977829235	-2
+0.071807208885749638	0.79307765665292462	38.095352917829267	-2
+0	0.73740149999999993	37.489425237244625	-2
+0.027473660718938812	0.76988616487466555	37.841496335143646	-2
+0.68430452431846067	0.59305256395561989	41.013677989197944	-2
+0.74564576283644501	0.57590209084417487	41.220279768854716	-2
+0.7295181101433158	0.60276763963685887	41.102695154585852	-2
+0.81915204428899224	0.57357643635104594	41.381453165330896	-2
+0.78166768890679539	0.57379384433812253	41.305347362984385	-2
+0.46523905810431559	0.65759638872027781	39.956897294252478	-2
+0.40327311000742289	0.68437841216312156	39.555677236792427	-2
+0.4420505148061486	0.68902148559390619	39.782845203133661	-2
+0.65202514201861106	0.6236117110537579	40.829024659182295	-2
+0.62856177279392289	0.65179827526190226	40.674513940225062	-2
+0.61115223212111025	0.69211497914910824	40.510383295021747	-2
+0.52128153787484754	0.6897469925804387	40.171875890262484	-2
+0.54697727564888343	0.69997466160851529	40.256254560775503	-2
+0.48054478275853596	0.693158413882911	39.977569836712057	-2
+0.58782122369347445	0.71121836999610666	40.3831780097387	-2
+0	0.40000000000000002	0	1
+0.35835865008693757	0.72334913798453782	39.276806773815174	-2
+0.38547580885859789	0.72541784012180421	39.439177122686971	-2
+0.25939361951157502	0.75128801590358207	38.71788981467563	-2
+0.31735104694655392	0.74464005537305167	39.048720374554556	-2
+0.30542845635964977	0.77072706432157734	39.024846425232944	-2
+0.23813058991408345	0.7746468992524862	38.674723119214541	-2
+0.095643891049577046	0.82471606815613219	38.328433177432686	-2
+0.11749303301669439	0.84407425550827486	38.462554422316572	-2
+0.1502236299187853	0.8250733848365529	38.480615646175004	-2
+0.1881998922196273	0.82204840874035279	38.601494461340152	-2
+0.21924304243339632	0.79996516161656439	38.661647462562392	-2
+0.0423460167460337	0.79350374999999995	38.047404277200926	-2
+0.067476699061038231	0.83237986080342508	38.310387235901842	-2
+0	0.77480299999999991	37.861690693790592	-2
+0.70097943269398388	0.61570606236782854	40.992109321298102	-2
+0.76122526406551549	0.60352818690285215	41.175632692769206	-2
+0.73151757540619433	0.63403840924658894	41.018561688740206	-2
+0.79259824370398535	0.60818202301879265	41.231634933206685	-2
+0.4202768197851679	0.71734453080417171	39.63682987179785	-2
+0.45166489694107326	0.71894358473805331	39.797097640112554	-2
+0.66519371620993806	0.65003395703670852	40.793578331433565	-2
+0.64804370803048938	0.6751246230917638	40.673609923883042	-2
+0.63336607340190543	0.70904410013682861	40.539242888109221	-2
+0.61851492820178255	0.73269771229459635	40.433595863859054	-2
+0.50311906242332383	0.71779400967286511	40.037873571076958	-2
+0.52300927727519053	0.73684342756624577	40.084963321938609	-2
+0.54893889275654462	0.72756140139093295	40.203973321936473	-2
+0.47658174143369969	0.73809872038254309	39.888828061137168	-2
+0.5829264416433968	0.7409726403582888	40.296646640756556	-2
+0.34685847070377351	0.74799392856054425	39.225929036180027	-2
+0.37392697768151761	0.74997940978101629	39.375425357732425	-2
+0.40663081361275072	0.75036081770006247	39.544061995168363	-2
+0.27247041325134957	0.78454856051995503	38.87277699422792	-2
+0.33169510775972538	0.76947809316937188	39.158922286247339	-2
+0.30171155135512451	0.80806971222080781	39.051162075976777	-2
+0.34282020187421386	0.79330516150888675	39.230577007323852	-2
+0.26668864137348869	0.82154875192535659	38.917462732305005	-2
+0.069693770804129723	0.86287912354320218	38.438709405950924	-2
+0.11475837980945712	0.87317599483409247	38.548368250180076	-2
+0.15640933432800502	0.86241052614132374	38.618376688509436	-2
+0.18278479851971571	0.8504840129708674	38.663232941991744	-2
+0.21585024153207058	0.85197886299846803	38.775988699132029	-2
+0.24601355174385892	0.84468960751207345	38.872490023040932	-2
+0	0.81220450000000011	38.132489224994679	-2
+0.034483621429978475	0.82614690604378538	38.235507351175684	-2
+0.03418418291606741	0.85972224272387299	38.390400901581593	-2
+0.69985334551955503	0.65034882457179111	40.890429427465726	-2
+0.76604444311897857	0.64278760968653925	41.077005983389903	-2
+0.73657561215276335	0.67494719543654336	40.918810342777562	-2
+0.44354496682809968	0.75528930576825115	39.717811717546198	-2
+0.68319210002353437	0.68074277041575881	40.761668519469566	-2
+0.66113015792659557	0.70601004470373396	40.631348983586768	-2
+0.64651187460604354	0.737826334942836	40.50649540690754	-2
+0.64278760968653992	0.76604444311897801	40.426018617650428	-2
+0.60644573510331212	0.76145724794259229	40.326432910897026	-2
+0.51726740691489781	0.76377912680899174	40.012049722831847	-2
+0.55610677988440593	0.76578635739361045	40.14940594564159	-2
+0.46447390811654587	0.78167044787436224	39.774069668414242	-2
+0.49702907991761758	0.79089698739813452	39.888362962337659	-2
+0.58254790922613431	0.77840858972657989	40.210992099092635	-2
+0.3577920255030051	0.77180392635935413	39.29666902368983	-2
+0.38730436897463116	0.77674594408345177	39.438813055117201	-2
+0.417642782785063	0.77459036220109323	39.581026530628847	-2
+0.292530676256061	0.83645477626902953	39.038619246395264	-2
+0.3274355411296887	0.81508123292376056	39.17111381101148	-2
+0.35897573544224354	0.81521233640700708	39.306025759445745	-2
+0.054183648649692349	0.88923356426081934	38.503181876414899	-2
+0.088852243933260577	0.88671341275316895	38.539706021848744	-2
+0.14384503609932733	0.88649154345761205	38.641516381855837	-2
+0.12131424092665194	0.90166125847976974	38.625499825613659	-2
+0.19196597875906699	0.87793602122428716	38.746595629547095	-2
+0.16393980845414871	0.90476603685618362	38.717789511027789	-2
+0.24215451530079607	0.87548029386703508	38.893491066907401	-2
+0.21757412160856743	0.88721038736020907	38.831443964306096	-2
+0.27063373643226674	0.88662907964386151	38.993586729652179	-2
+0.29345915068395129	0.86627319782086576	39.061883398595739	-2
+0	0.84960599999999997	38.33010164767137	-2
+0	0.88700749999999995	38.464887531135297	-2
+0.70710678118654813	0.70710678118654746	40.755973413022524	-2
+0.43385840488295146	0.79569457722458692	39.632526450501558	-2
+0.67494719543654402	0.73657561215276268	40.591358830189975	-2
+0.60818202301879332	0.79259824370398502	40.25899031565433	-2
+0.53591111981085493	0.80032336581125052	40.009853780851756	-2
+0.47263064820776901	0.81434234456497845	39.760058761712564	-2
+0.50048026963006442	0.81890627440255925	39.852893237096829	-2
+0.57357643635104671	0.81915204428899191	40.093221985717648	-2
+0.38478491654441932	0.80656295794843202	39.418871142697739	-2
+0.40902063899973634	0.79976957839867446	39.525308897585077	-2
+0.31743790302543906	0.85060289073057849	39.144197479735254	-2
+0.34263863968546981	0.83698444882446843	39.23915285607918	-2
+0.3787019387039891	0.83124289451733857	39.382017999790868	-2
+0.061759742270451688	0.90849090150205958	38.556761585330399	-2
+0.031279755138278027	0.91924700010370075	38.558663122010806	-2
+0.08628346732449553	0.90772194571063469	38.582513307220445	-2
+0.12933859117758623	0.92985257545336653	38.679586466485254	-2
+0.095936012345623392	0.92655769483048012	38.627101650890523	-2
+0.20867590648956771	0.91295165024918878	38.831113153184639	-2
+0.14727893600902253	0.9530319752942733	38.728249711061295	-2
+0.18103698255100653	0.94393573552377064	38.785441165963576	-2
+0.24166105767879562	0.90606539033718259	38.914150359925969	-2
+0.27014813774886698	0.91720890394799137	38.996360882963025	-2
+0.30153779329325331	0.9081989201319931	39.089145609227451	-2
+0.32067363539594118	0.88173555242149992	39.154086676192534	-2
+0	0.92440900000000004	38.556411270716502	-2
+0.4301309069861397	0.82103548099827872	39.590691353151634	-2
+0.53678821817552369	0.84258872403671536	39.92865037819363	-2
+0.47998052132050123	0.83830192309426577	39.749025542641519	-2
+0.45538325650440636	0.84310365212048644	39.656002019789327	-2
+0.50000000000000067	0.86602540378443882	39.766662547289855	-2
+0.4047633073007178	0.82457674219147337	39.488930296943835	-2
+0.35187643881041925	0.88420489383416878	39.259597409690862	-2
+0.37198355790190224	0.85575748706648302	39.344010043346827	-2
+0.39670554467946351	0.84935480170445876	39.438291984811485	-2
+0.052396824057270801	0.92694565684334362	38.583577008861262	-2
+0.074151385793202157	0.92506465795551462	38.600010196335553	-2
+0.019234760261361013	0.94857254226160581	38.596540721676497	-2
+0.044586868391556261	0.94802181654628559	38.606976353027939	-2
+0.11092102735775101	0.95265463440859621	38.673609064498699	-2
+0.081527423035383753	0.95910575486923311	38.645518884824398	-2
+0.2285246544994424	0.92698617178936726	38.886363425710748	-2
+0.20354483530440692	0.95415354056112645	38.83422872162042	-2
+0.16054829521999889	0.9688495437068595	38.754605242284818	-2
+0.13762594990510507	0.97121956367584039	38.71952275954667	-2
+0.18059300263382733	0.9657509737056913	38.788682813740486	-2
+0.25175357856350172	0.93415259901968251	38.945965397123977	-2
+0.27476047844080859	0.94395724936234826	39.001189388938634	-2
+0.31637659958252057	0.93089003478061627	39.120035481256437	-2
+0.33416147007272251	0.90967743186630401	39.186161730716776	-2
+0	0.96181050000000001	38.607009348336213	-2
+0.42191872202455616	0.84529688373585732	39.533811648736204	-2
+0.47359599148772341	0.86253660520253195	39.687972372645994	-2
+0.44007059920459224	0.86586081005050886	39.571732406601974	-2
+0.46130913087035041	0.88616659541054454	39.609940386288045	-2
+0.38231920253318474	0.92300020391127946	39.318408517143055	-2
+0.39033740994485777	0.88536639290831631	39.383924223287558	-2
+0.41309365135665749	0.87082165629317176	39.474895177395318	-2
+0.065582093070992539	0.94514864001534404	38.617411790367179	-2
+0.024048612759285239	0.96289503882802785	38.611498763465214	-2
+0.010932481070437736	0.97039665020744192	38.614578530014548	-2
+0.039345411582572494	0.9728322944936808	38.624274468762763	-2
+0.058743916435573786	0.96520590660430816	38.630514441677967	-2
+0.11714969727691682	0.97338557156279526	38.691410795522458	-2
+0.092458132817662658	0.97641852414616048	38.664855341636901	-2
+0.072476829676666299	0.98088617690439261	38.648439546310662	-2
+0.23313839009500692	0.95085359804934466	38.898551306058131	-2
+0.19494089452582852	0.98008727133142348	38.811939024315521	-2
+0.21623361138472613	0.97536678965063861	38.854598054004498	-2
+0.15202506893711287	0.98765448928209276	38.740173150645333	-2
+0.17364817766693091	0.98480775301220846	38.773909609048033	-2
+0.1304019602072948	0.99050122555197717	38.709129287244544	-2
+0.25881904510252135	0.96592582628906865	38.950246117219031	-2
+0.30041959421409536	0.95280922353748876	39.061170349954004	-2
+0.34202014332566938	0.93969262078590876	39.182648994518701	-2
+0	0.97116087500000003	38.613869810338102	-2
+0.42261826174070011	0.90630778703665027	39.459921260098199	-2
+0.022981168720018073	0.97796712053527646	38.620723585032714	-2
+0.013048302942813568	0.98040244474704585	38.619701545188938	-2
+0.0069865425913642077	0.97983180765624789	38.618815293682751	-2
+0.037844822810169577	0.98991746690364646	38.629513292831803	-2
+0.051631866769985858	0.98479882706873345	38.635065019557771	-2
+0.10877885147747675	0.99334796182186158	38.682866838912119	-2
+0.087155742747658693	0.99619469809174599	38.661632080167514	-2
+0.059187999836045876	0.99741579611828968	38.640950818248037	-2
+0	0.98051124999999995	38.618664940968856	-2
+0.016192666126529177	0.98561622892139478	38.621914959438755	-2
+0.026993921978405371	0.99139097826364264	38.625841036215682	-2
+0.010477543795977262	0.98592166232354661	38.621200924615799	-2
+0.0047832114951114257	0.98649654706298506	38.620851447335347	-2
+0.03122025692443306	0.99863689414483348	38.627632474241928	-2
+0.045204128380239468	0.99802634513156163	38.63332097513981	-2
+0	0.98986162499999997	38.621479701048784	-2
+0.019322093719605474	0.99478336019980307	38.624302948683301	-2
+0.013463241788243919	0.99492319245858252	38.623273040455068	-2
+0.023415192693324798	0.99897767060862508	38.625396385804194	-2
+0.0082611302543130413	0.99119834914660621	38.62207647430747	-2
+0.0034861388837016008	0.99219921874999994	38.621964987505145	-2
+0	0.99453681250000003	38.622179134819682	-2
+0.015610128462216535	0.99931844707241668	38.623768438097834	-2
+0.011707596346662399	0.99948883530431254	38.623219216366465	-2
+0.0086579940230241299	0.99583805825538663	38.622737570338195	-2
+0.0049011800344806516	0.99473572346559758	38.62235108809579	-2
+0.0024296405595798311	0.99626140044800704	38.622394128769933	-2
+0	0.99687440625000001	38.622381944786028	-2
+0.0078050642311082632	0.9996592235362084	38.62280188034984	-2
+0.0051755261570967772	0.99762725106111738	38.622578358717043	-2
+0.0028764098249098435	0.99871581461211179	38.622511712667375	-2
+0.0014022663923630011	0.99853477986771177	38.622474885757129	-2
+0	0.99921199999999999	38.622475151126444	-2
+0.0039025321155541368	0.99982961176810403	38.622554676681261	-2
+0.0019512660577770632	0.99991480588405213	38.622500678128759	-2
+0.00097563302888853409	0.99995740294202606	38.622488210430653	-2
+0	1	38.622480563071974	-2
+3787
+0	1	2	0
+2	1	4	0
+3	4	1	0
+5	2	4	0
+7	4	3	0
+7	3	6	0
+4	8	5	0
+8	4	7	0
+5	8	9	0
+7	6	11	0
+7	12	8	0
+10	11	6	0
+9	8	13	0
+11	12	7	0
+13	8	12	0
+9	13	14	0
+10	16	11	0
+12	11	17	0
+16	10	15	0
+13	12	17	0
+11	16	17	0
+18	14	13	0
+13	17	18	0
+14	18	19	0
+16	15	21	0
+16	21	17	0
+21	15	20	0
+22	18	17	0
+18	23	19	0
+21	22	17	0
+18	22	24	0
+23	18	24	0
+19	23	25	0
+27	21	20	0
+21	27	22	0
+20	26	27	0
+24	22	28	0
+23	24	29	0
+28	22	27	0
+30	25	23	0
+30	23	29	0
+24	31	29	0
+32	24	28	0
+32	31	24	0
+27	26	35	0
+33	25	30	0
+27	35	28	0
+34	35	26	0
+32	28	36	0
+37	30	29	0
+37	29	31	0
+36	28	35	0
+38	33	30	0
+40	31	32	0
+30	37	38	0
+31	39	37	0
+41	32	36	0
+39	31	40	0
+45	35	34	0
+33	38	43	0
+42	40	32	0
+42	32	41	0
+45	36	35	0
+38	37	47	0
+34	44	45	0
+39	47	37	0
+46	41	36	0
+45	46	36	0
+48	43	38	0
+40	51	39	0
+52	40	42	0
+38	47	49	0
+48	38	49	0
+42	41	53	0
+47	39	50	0
+51	50	39	0
+53	41	46	0
+51	40	52	0
+45	44	58	0
+56	43	48	0
+58	46	45	0
+42	53	54	0
+52	42	55	0
+55	42	54	0
+47	61	49	0
+53	46	59	0
+62	47	50	0
+44	57	58	0
+63	48	49	0
+58	60	46	0
+46	60	59	0
+65	50	51	0
+53	59	54	0
+56	48	63	0
+52	66	51	0
+47	62	61	0
+55	66	52	0
+49	61	63	0
+58	57	60	0
+50	64	62	0
+55	54	67	0
+64	50	65	0
+68	54	59	0
+65	51	66	0
+60	68	59	0
+60	57	71	0
+70	56	63	0
+54	68	67	0
+55	69	66	0
+69	55	67	0
+62	74	61	0
+63	61	73	0
+72	68	60	0
+75	62	64	0
+60	71	72	0
+64	65	76	0
+63	73	70	0
+73	61	74	0
+65	66	77	0
+74	62	75	0
+77	66	69	0
+78	67	68	0
+78	69	67	0
+76	75	64	0
+77	76	65	0
+72	79	68	0
+79	78	68	0
+70	73	83	0
+69	80	77	0
+71	85	72	0
+78	81	69	0
+69	81	80	0
+73	74	83	0
+70	83	82	0
+75	88	74	0
+72	87	79	0
+75	76	89	0
+85	71	84	0
+72	85	86	0
+76	77	91	0
+88	83	74	0
+72	86	87	0
+93	77	80	0
+95	78	79	0
+81	78	94	0
+90	88	75	0
+89	90	75	0
+92	89	76	0
+96	80	81	0
+91	92	76	0
+91	77	93	0
+79	87	95	0
+83	99	82	0
+94	78	95	0
+80	96	93	0
+83	88	99	0
+85	84	101	0
+94	97	81	0
+85	102	86	0
+96	81	97	0
+103	87	86	0
+90	99	88	0
+98	82	99	0
+101	84	100	0
+90	89	106	0
+104	95	87	0
+92	105	89	0
+98	99	90	0
+85	101	102	0
+102	103	86	0
+92	91	108	0
+108	91	93	0
+103	104	87	0
+107	98	90	0
+93	96	110	0
+105	106	89	0
+112	94	95	0
+111	97	94	0
+106	107	90	0
+109	105	92	0
+114	96	97	0
+109	92	108	0
+110	108	93	0
+95	104	113	0
+94	112	111	0
+100	117	101	0
+114	110	96	0
+112	95	113	0
+102	101	118	0
+111	115	97	0
+119	103	102	0
+114	97	115	0
+104	103	120	0
+105	121	106	0
+116	117	100	0
+121	105	109	0
+122	107	106	0
+101	117	118	0
+113	104	120	0
+119	102	118	0
+108	123	109	0
+103	119	120	0
+110	124	108	0
+122	106	121	0
+126	110	114	0
+128	111	112	0
+111	127	115	0
+112	113	129	0
+124	123	108	0
+121	109	125	0
+125	109	123	0
+110	126	124	0
+115	132	114	0
+113	120	131	0
+127	111	128	0
+135	117	116	0
+130	128	112	0
+129	130	112	0
+118	117	136	0
+132	126	114	0
+131	129	113	0
+118	137	119	0
+127	133	115	0
+119	139	120	0
+132	115	133	0
+122	121	140	0
+116	134	135	0
+140	121	125	0
+135	136	117	0
+124	142	123	0
+141	125	123	0
+131	120	139	0
+136	137	118	0
+143	124	126	0
+137	138	119	0
+138	139	119	0
+127	128	146	0
+126	132	145	0
+130	147	128	0
+133	127	146	0
+141	123	142	0
+130	129	149	0
+144	140	125	0
+143	142	124	0
+131	149	129	0
+125	141	144	0
+143	126	145	0
+133	154	132	0
+148	146	128	0
+139	153	131	0
+147	148	128	0
+134	158	135	0
+147	130	150	0
+151	130	149	0
+136	135	159	0
+151	150	130	0
+132	154	145	0
+149	131	152	0
+137	136	160	0
+160	138	137	0
+146	156	133	0
+131	153	152	0
+138	161	139	0
+154	133	155	0
+155	133	156	0
+141	142	163	0
+162	144	141	0
+134	157	158	0
+142	143	165	0
+159	135	158	0
+153	139	161	0
+143	145	166	0
+136	159	160	0
+160	161	138	0
+146	148	169	0
+170	148	147	0
+163	162	141	0
+167	145	154	0
+147	150	170	0
+164	163	142	0
+142	165	164	0
+169	156	146	0
+172	151	149	0
+166	165	143	0
+152	173	149	0
+174	150	151	0
+168	166	145	0
+167	168	145	0
+176	152	153	0
+155	178	154	0
+171	169	148	0
+170	171	148	0
+156	180	155	0
+153	161	177	0
+173	172	149	0
+170	150	174	0
+151	172	175	0
+184	158	157	0
+154	178	167	0
+174	151	175	0
+176	173	152	0
+159	158	185	0
+160	159	186	0
+153	177	176	0
+156	169	182	0
+188	161	160	0
+155	179	178	0
+179	155	180	0
+162	163	189	0
+163	164	189	0
+180	156	181	0
+181	156	182	0
+191	164	165	0
+169	171	182	0
+183	184	157	0
+193	165	166	0
+177	161	188	0
+184	185	158	0
+168	195	166	0
+159	185	186	0
+196	168	167	0
+186	187	160	0
+187	188	160	0
+170	198	171	0
+178	196	167	0
+199	170	174	0
+164	190	189	0
+190	164	191	0
+201	172	173	0
+172	201	175	0
+191	165	192	0
+193	192	165	0
+173	176	202	0
+194	193	166	0
+200	182	171	0
+204	174	175	0
+195	194	166	0
+176	177	206	0
+168	197	195	0
+197	168	196	0
+178	179	210	0
+198	170	199	0
+200	171	198	0
+211	179	180	0
+208	177	188	0
+180	181	214	0
+201	173	202	0
+199	174	203	0
+181	182	216	0
+205	175	201	0
+174	204	203	0
+196	178	209	0
+204	175	205	0
+184	183	218	0
+176	207	202	0
+218	185	184	0
+206	207	176	0
+219	186	185	0
+177	208	206	0
+187	186	220	0
+188	187	221	0
+210	209	178	0
+182	200	216	0
+212	210	179	0
+212	179	211	0
+191	222	190	0
+213	211	180	0
+213	180	214	0
+224	191	192	0
+225	192	193	0
+214	181	215	0
+181	216	215	0
+194	226	193	0
+221	208	188	0
+195	228	194	0
+217	218	183	0
+229	195	197	0
+185	218	219	0
+232	197	196	0
+220	186	219	0
+220	221	187	0
+198	199	233	0
+198	233	200	0
+209	231	196	0
+223	222	191	0
+235	199	203	0
+224	223	191	0
+225	224	192	0
+201	202	239	0
+201	238	205	0
+226	225	193	0
+226	194	227	0
+242	203	204	0
+228	227	194	0
+202	207	241	0
+204	205	243	0
+230	228	195	0
+237	216	200	0
+195	229	230	0
+244	207	206	0
+232	229	197	0
+208	245	206	0
+232	196	231	0
+234	233	199	0
+235	234	199	0
+250	209	210	0
+233	236	200	0
+251	210	212	0
+200	236	237	0
+212	211	252	0
+213	252	211	0
+248	208	221	0
+238	201	240	0
+201	239	240	0
+242	235	203	0
+213	214	255	0
+239	202	241	0
+215	256	214	0
+243	205	238	0
+243	242	204	0
+248	221	220	0
+258	215	216	0
+209	249	231	0
+241	207	246	0
+206	245	244	0
+218	217	262	0
+207	244	247	0
+219	218	263	0
+246	207	247	0
+248	245	208	0
+265	220	219	0
+249	209	250	0
+251	250	210	0
+223	267	222	0
+216	237	260	0
+223	224	269	0
+251	212	253	0
+212	252	253	0
+224	225	270	0
+252	213	254	0
+255	254	213	0
+273	225	226	0
+256	255	214	0
+227	274	226	0
+258	257	215	0
+275	227	228	0
+215	259	256	0
+259	215	257	0
+265	248	220	0
+216	260	258	0
+228	230	277	0
+229	278	230	0
+262	217	261	0
+279	229	232	0
+262	264	218	0
+263	218	264	0
+232	231	282	0
+266	219	263	0
+265	219	266	0
+283	233	234	0
+236	233	283	0
+235	284	234	0
+267	223	268	0
+236	286	237	0
+254	253	252	0
+223	269	268	0
+231	249	281	0
+235	242	285	0
+269	224	271	0
+271	224	270	0
+288	238	240	0
+225	272	270	0
+240	239	289	0
+243	238	288	0
+225	273	272	0
+290	239	241	0
+273	226	274	0
+246	290	241	0
+274	227	276	0
+242	243	292	0
+275	276	227	0
+228	277	275	0
+245	293	244	0
+293	247	244	0
+260	237	287	0
+279	278	229	0
+277	230	280	0
+245	248	294	0
+280	230	278	0
+295	246	247	0
+279	232	282	0
+264	266	263	0
+281	282	231	0
+249	250	298	0
+250	251	300	0
+284	283	234	0
+285	284	235	0
+253	300	251	0
+283	286	236	0
+253	254	303	0
+286	287	237	0
+265	297	248	0
+254	255	304	0
+256	305	255	0
+289	239	290	0
+288	240	291	0
+242	292	285	0
+291	240	289	0
+256	259	306	0
+288	292	243	0
+257	307	259	0
+308	257	258	0
+258	260	309	0
+298	281	249	0
+295	290	246	0
+293	245	294	0
+247	293	296	0
+261	314	262	0
+295	247	296	0
+294	248	297	0
+262	315	264	0
+316	266	264	0
+250	299	298	0
+266	317	265	0
+250	300	299	0
+300	253	301	0
+302	301	253	0
+320	268	269	0
+302	253	303	0
+312	260	287	0
+269	271	321	0
+304	303	254	0
+322	271	270	0
+270	272	322	0
+255	305	304	0
+256	306	305	0
+273	325	272	0
+307	257	308	0
+258	309	308	0
+328	273	274	0
+259	307	310	0
+259	311	306	0
+274	276	328	0
+265	317	297	0
+329	276	275	0
+259	310	311	0
+277	329	275	0
+309	260	312	0
+313	314	261	0
+280	332	277	0
+278	333	280	0
+315	262	314	0
+279	334	278	0
+315	316	264	0
+335	279	282	0
+337	282	281	0
+266	316	318	0
+266	318	317	0
+320	319	268	0
+284	341	283	0
+283	340	286	0
+269	321	320	0
+342	284	285	0
+271	322	323	0
+321	271	324	0
+298	338	281	0
+271	323	324	0
+286	345	287	0
+272	326	322	0
+344	285	292	0
+272	325	326	0
+273	327	325	0
+288	291	348	0
+328	327	273	0
+292	288	348	0
+289	290	350	0
+351	291	289	0
+330	328	276	0
+331	276	329	0
+295	352	290	0
+330	276	331	0
+332	329	277	0
+355	293	294	0
+356	296	293	0
+278	334	333	0
+297	355	294	0
+287	347	312	0
+296	357	295	0
+336	332	280	0
+335	334	279	0
+336	280	333	0
+281	338	337	0
+335	282	339	0
+339	282	337	0
+361	298	299	0
+300	362	299	0
+301	362	300	0
+283	341	340	0
+341	284	342	0
+302	365	301	0
+297	317	355	0
+342	285	343	0
+340	345	286	0
+367	302	303	0
+285	344	343	0
+368	303	304	0
+369	304	305	0
+345	346	287	0
+346	347	287	0
+306	370	305	0
+308	372	307	0
+370	306	311	0
+289	350	349	0
+349	351	289	0
+310	307	372	0
+292	354	344	0
+308	309	373	0
+353	348	291	0
+352	350	290	0
+354	292	348	0
+351	353	291	0
+360	338	298	0
+376	309	312	0
+311	310	377	0
+356	293	355	0
+352	295	358	0
+313	381	314	0
+356	359	296	0
+357	358	295	0
+314	383	315	0
+359	357	296	0
+315	383	316	0
+360	298	361	0
+316	385	318	0
+387	317	318	0
+363	361	299	0
+299	362	363	0
+364	362	301	0
+390	319	320	0
+301	365	364	0
+340	346	345	0
+391	320	321	0
+365	302	366	0
+366	302	367	0
+376	312	347	0
+321	324	392	0
+303	368	367	0
+393	323	322	0
+323	394	324	0
+368	304	369	0
+393	322	326	0
+371	305	370	0
+369	305	371	0
+396	328	330	0
+396	327	328	0
+308	374	372	0
+353	354	348	0
+373	375	308	0
+374	308	375	0
+397	331	329	0
+332	397	329	0
+309	376	373	0
+386	355	317	0
+310	372	377	0
+378	370	311	0
+398	330	331	0
+311	377	379	0
+332	336	400	0
+311	379	378	0
+401	333	334	0
+336	333	401	0
+403	334	335	0
+313	380	381	0
+314	381	382	0
+339	404	335	0
+383	314	382	0
+337	338	405	0
+406	339	337	0
+383	384	316	0
+385	316	384	0
+340	341	409	0
+317	387	386	0
+318	385	388	0
+410	341	342	0
+388	387	318	0
+340	409	346	0
+343	410	342	0
+355	386	356	0
+411	343	344	0
+319	390	389	0
+320	391	390	0
+321	392	391	0
+407	338	360	0
+347	346	414	0
+323	393	394	0
+344	354	412	0
+392	324	395	0
+324	394	395	0
+349	350	418	0
+419	351	349	0
+350	352	420	0
+396	330	398	0
+351	421	353	0
+399	331	397	0
+331	399	398	0
+354	353	422	0
+397	332	400	0
+352	358	420	0
+401	334	402	0
+356	423	359	0
+416	376	347	0
+424	358	357	0
+334	403	402	0
+359	425	357	0
+403	335	404	0
+337	405	406	0
+428	360	361	0
+338	407	405	0
+339	408	404	0
+408	339	406	0
+363	429	361	0
+430	363	362	0
+362	364	430	0
+409	341	410	0
+434	364	365	0
+411	410	343	0
+423	356	386	0
+366	435	365	0
+344	413	411	0
+436	366	367	0
+344	412	413	0
+346	409	415	0
+368	437	367	0
+414	346	415	0
+438	368	369	0
+414	417	347	0
+371	439	369	0
+417	416	347	0
+440	371	370	0
+349	418	419	0
+354	422	412	0
+350	420	418	0
+378	441	370	0
+372	374	444	0
+419	421	351	0
+444	377	372	0
+375	373	445	0
+407	360	427	0
+376	445	373	0
+400	399	397	0
+421	422	353	0
+447	374	375	0
+377	444	379	0
+420	358	426	0
+425	424	357	0
+449	378	379	0
+359	423	425	0
+424	426	358	0
+380	452	381	0
+360	428	427	0
+382	381	453	0
+453	383	382	0
+361	429	428	0
+454	384	383	0
+431	429	363	0
+455	385	384	0
+430	432	363	0
+363	432	431	0
+364	433	430	0
+388	385	455	0
+386	387	456	0
+434	433	364	0
+387	388	457	0
+365	435	434	0
+435	366	436	0
+416	445	376	0
+460	389	390	0
+436	367	437	0
+460	390	391	0
+438	437	368	0
+392	461	391	0
+438	369	439	0
+392	395	462	0
+370	441	440	0
+442	439	371	0
+443	371	440	0
+442	371	443	0
+446	444	374	0
+456	423	386	0
+447	446	374	0
+448	375	445	0
+449	441	378	0
+402	403	464	0
+447	375	448	0
+404	465	403	0
+379	444	450	0
+408	465	404	0
+449	379	450	0
+451	452	380	0
+409	410	466	0
+453	381	452	0
+410	411	468	0
+383	453	454	0
+467	415	409	0
+468	411	413	0
+454	455	384	0
+469	413	412	0
+433	432	430	0
+414	415	471	0
+457	456	387	0
+455	458	388	0
+414	471	417	0
+457	388	458	0
+469	412	422	0
+416	417	472	0
+459	389	460	0
+460	391	461	0
+419	418	477	0
+461	392	462	0
+420	478	418	0
+421	419	479	0
+462	395	463	0
+478	420	426	0
+482	422	421	0
+425	423	484	0
+403	465	464	0
+416	473	445	0
+425	487	424	0
+486	426	424	0
+466	467	409	0
+410	468	466	0
+489	427	428	0
+428	429	489	0
+431	490	429	0
+413	470	468	0
+413	469	470	0
+471	415	467	0
+491	433	434	0
+473	416	472	0
+434	435	492	0
+471	474	417	0
+456	485	423	0
+417	475	472	0
+435	436	493	0
+473	448	445	0
+417	474	476	0
+476	475	417	0
+436	437	495	0
+495	437	438	0
+478	477	418	0
+469	422	483	0
+497	438	439	0
+477	481	419	0
+419	480	479	0
+439	442	498	0
+441	499	440	0
+481	480	419	0
+421	479	482	0
+440	500	443	0
+422	482	483	0
+442	443	502	0
+441	449	501	0
+426	488	478	0
+423	485	484	0
+444	446	504	0
+425	484	487	0
+424	487	486	0
+450	444	504	0
+446	447	505	0
+426	486	488	0
+448	507	447	0
+450	509	449	0
+489	429	490	0
+452	451	513	0
+491	434	492	0
+452	514	453	0
+435	493	492	0
+515	454	453	0
+436	494	493	0
+455	454	516	0
+495	494	436	0
+448	473	508	0
+438	496	495	0
+517	458	455	0
+438	497	496	0
+457	518	456	0
+498	497	439	0
+458	519	457	0
+499	500	440	0
+459	460	522	0
+441	501	499	0
+502	498	442	0
+460	461	522	0
+503	443	500	0
+524	461	462	0
+503	502	443	0
+463	525	462	0
+504	446	505	0
+506	505	447	0
+467	466	526	0
+518	485	456	0
+506	447	507	0
+526	466	468	0
+449	510	501	0
+448	508	507	0
+471	467	527	0
+450	504	511	0
+468	470	528	0
+449	509	510	0
+469	530	470	0
+450	511	509	0
+474	471	527	0
+451	512	513	0
+472	532	473	0
+513	514	452	0
+532	472	475	0
+529	469	483	0
+514	515	453	0
+476	474	533	0
+534	475	476	0
+454	515	516	0
+455	516	517	0
+536	477	478	0
+536	481	477	0
+518	457	519	0
+520	458	517	0
+537	479	480	0
+458	520	519	0
+537	482	479	0
+538	480	481	0
+536	478	488	0
+537	483	482	0
+521	459	523	0
+522	523	459	0
+524	522	461	0
+524	462	525	0
+485	544	484	0
+532	508	473	0
+484	544	487	0
+547	486	487	0
+467	526	527	0
+486	548	488	0
+468	528	526	0
+529	530	469	0
+531	528	470	0
+531	470	530	0
+549	491	492	0
+533	474	527	0
+549	492	493	0
+550	493	494	0
+495	551	494	0
+475	534	532	0
+495	496	551	0
+476	533	535	0
+534	476	535	0
+485	518	546	0
+499	552	500	0
+501	552	499	0
+483	543	529	0
+500	553	503	0
+537	480	539	0
+538	539	480	0
+481	536	542	0
+481	541	538	0
+481	540	541	0
+543	483	537	0
+481	542	540	0
+555	504	505	0
+510	554	501	0
+488	542	536	0
+505	506	557	0
+556	511	504	0
+507	558	506	0
+544	485	545	0
+508	559	507	0
+546	545	485	0
+547	487	544	0
+488	548	542	0
+510	509	561	0
+548	486	547	0
+511	561	509	0
+546	518	519	0
+519	520	546	0
+565	513	512	0
+549	493	550	0
+513	568	514	0
+550	494	551	0
+515	514	569	0
+532	559	508	0
+570	516	515	0
+571	517	516	0
+500	552	553	0
+554	552	501	0
+517	572	520	0
+556	504	555	0
+557	555	505	0
+576	521	523	0
+557	506	558	0
+522	578	523	0
+522	524	578	0
+560	558	507	0
+554	510	562	0
+560	507	559	0
+525	580	524	0
+556	563	511	0
+561	562	510	0
+526	582	527	0
+511	564	561	0
+528	583	526	0
+511	563	564	0
+546	520	574	0
+566	565	512	0
+531	585	528	0
+527	584	533	0
+586	530	529	0
+513	565	567	0
+513	567	568	0
+587	531	530	0
+514	568	569	0
+570	515	569	0
+534	589	532	0
+570	571	516	0
+543	586	529	0
+535	533	590	0
+571	572	517	0
+534	535	592	0
+572	573	520	0
+574	545	546	0
+520	573	574	0
+537	539	595	0
+596	539	538	0
+521	577	575	0
+521	576	577	0
+543	537	595	0
+541	596	538	0
+576	523	579	0
+579	523	578	0
+559	532	589	0
+541	540	600	0
+542	599	540	0
+580	578	524	0
+581	580	525	0
+564	562	561	0
+526	583	582	0
+548	602	542	0
+584	527	582	0
+544	545	604	0
+544	604	547	0
+583	528	585	0
+606	548	547	0
+530	586	587	0
+531	588	585	0
+587	588	531	0
+590	533	584	0
+552	607	553	0
+552	554	607	0
+589	534	591	0
+593	591	534	0
+535	590	594	0
+592	593	534	0
+592	535	594	0
+611	556	555	0
+557	611	555	0
+545	574	605	0
+554	562	609	0
+558	613	557	0
+597	595	539	0
+563	556	612	0
+586	543	603	0
+539	596	597	0
+616	558	560	0
+560	559	617	0
+580	579	578	0
+599	598	540	0
+601	596	541	0
+600	540	598	0
+603	543	595	0
+541	600	601	0
+542	602	599	0
+564	620	562	0
+622	564	563	0
+604	545	605	0
+624	565	566	0
+602	548	606	0
+624	567	565	0
+604	606	547	0
+568	567	627	0
+569	568	628	0
+589	617	559	0
+628	570	569	0
+608	553	607	0
+607	554	610	0
+571	570	631	0
+610	554	609	0
+572	571	631	0
+612	556	611	0
+634	573	572	0
+557	614	611	0
+636	574	573	0
+613	615	557	0
+557	615	614	0
+613	558	616	0
+575	577	638	0
+562	620	609	0
+639	577	576	0
+618	616	560	0
+639	576	579	0
+563	612	621	0
+617	619	560	0
+560	619	618	0
+580	640	579	0
+580	581	640	0
+621	622	563	0
+564	623	620	0
+582	583	642	0
+584	582	642	0
+564	622	623	0
+643	583	585	0
+636	605	574	0
+643	585	588	0
+626	624	566	0
+626	566	625	0
+567	624	627	0
+646	587	586	0
+645	590	584	0
+588	587	647	0
+568	627	629	0
+568	629	628	0
+590	645	594	0
+589	591	649	0
+628	632	570	0
+570	630	631	0
+630	570	632	0
+650	591	593	0
+603	646	586	0
+572	631	633	0
+593	592	651	0
+594	651	592	0
+634	572	633	0
+634	635	573	0
+616	615	613	0
+636	573	635	0
+595	597	656	0
+638	637	575	0
+596	658	597	0
+595	656	603	0
+657	596	601	0
+639	638	577	0
+589	649	617	0
+599	660	598	0
+639	579	640	0
+598	661	600	0
+640	581	641	0
+662	599	602	0
+600	663	601	0
+583	643	642	0
+644	584	642	0
+606	662	602	0
+606	604	662	0
+584	644	645	0
+605	667	604	0
+643	588	648	0
+646	647	587	0
+648	588	647	0
+607	669	608	0
+649	619	617	0
+607	610	669	0
+650	649	591	0
+671	610	609	0
+645	655	594	0
+652	650	593	0
+593	651	653	0
+611	674	612	0
+653	652	593	0
+609	620	670	0
+674	611	614	0
+654	651	594	0
+654	594	655	0
+614	615	676	0
+612	675	621	0
+615	616	677	0
+605	636	668	0
+657	658	596	0
+618	678	616	0
+659	656	597	0
+659	597	658	0
+603	666	646	0
+619	679	618	0
+598	660	661	0
+599	662	660	0
+664	657	601	0
+603	656	665	0
+661	663	600	0
+620	623	682	0
+622	621	683	0
+601	663	664	0
+643	644	642	0
+623	622	685	0
+662	604	667	0
+665	666	603	0
+626	686	624	0
+686	627	624	0
+688	626	625	0
+668	667	605	0
+691	629	627	0
+619	649	681	0
+692	628	629	0
+670	671	609	0
+672	669	610	0
+628	692	632	0
+673	610	671	0
+610	673	672	0
+630	695	631	0
+654	653	651	0
+632	696	630	0
+633	631	695	0
+674	675	612	0
+676	674	614	0
+699	634	633	0
+676	615	677	0
+634	700	635	0
+616	678	677	0
+682	670	620	0
+635	701	636	0
+618	680	678	0
+679	680	618	0
+637	638	703	0
+681	679	619	0
+675	683	621	0
+665	656	659	0
+649	650	681	0
+639	704	638	0
+705	639	640	0
+640	641	705	0
+684	622	683	0
+682	623	685	0
+622	684	685	0
+644	643	707	0
+644	708	645	0
+643	648	707	0
+625	687	688	0
+626	690	686	0
+646	709	647	0
+626	688	689	0
+627	686	691	0
+668	636	701	0
+690	626	689	0
+647	711	648	0
+655	645	708	0
+691	693	629	0
+692	629	694	0
+693	694	629	0
+650	652	715	0
+632	692	697	0
+653	716	652	0
+696	695	630	0
+666	710	646	0
+717	653	654	0
+697	696	632	0
+633	695	698	0
+719	654	655	0
+633	698	699	0
+699	700	634	0
+701	635	700	0
+658	657	722	0
+659	658	723	0
+703	702	637	0
+722	657	664	0
+681	650	714	0
+704	703	638	0
+660	662	725	0
+660	726	661	0
+705	704	639	0
+659	724	665	0
+727	663	661	0
+706	705	641	0
+729	664	663	0
+728	662	667	0
+707	708	644	0
+666	665	731	0
+668	728	667	0
+646	710	709	0
+690	691	686	0
+707	648	712	0
+709	711	647	0
+648	711	713	0
+648	713	712	0
+671	670	735	0
+650	715	714	0
+673	671	736	0
+737	672	673	0
+708	720	655	0
+715	652	716	0
+716	653	718	0
+735	670	682	0
+717	718	653	0
+674	739	675	0
+695	696	698	0
+676	740	674	0
+717	654	719	0
+719	655	721	0
+742	676	677	0
+655	720	721	0
+741	683	675	0
+677	678	744	0
+701	733	668	0
+722	723	658	0
+680	745	678	0
+680	679	746	0
+746	679	681	0
+659	723	724	0
+710	666	732	0
+726	660	725	0
+726	727	661	0
+662	728	725	0
+664	730	722	0
+750	682	685	0
+751	684	683	0
+727	729	663	0
+731	665	724	0
+753	685	684	0
+664	729	730	0
+731	732	666	0
+755	688	687	0
+668	734	728	0
+688	755	689	0
+668	733	734	0
+757	690	689	0
+690	758	691	0
+681	714	746	0
+671	735	736	0
+691	758	693	0
+692	694	760	0
+673	736	738	0
+737	673	738	0
+761	694	693	0
+697	692	760	0
+674	740	739	0
+675	739	741	0
+743	740	676	0
+742	743	676	0
+700	699	763	0
+677	744	742	0
+701	700	763	0
+682	749	735	0
+745	744	678	0
+766	702	703	0
+745	680	747	0
+704	766	703	0
+680	746	748	0
+747	680	748	0
+751	683	741	0
+704	705	768	0
+770	705	706	0
+749	682	750	0
+707	771	708	0
+751	752	684	0
+728	734	725	0
+752	753	684	0
+750	685	753	0
+712	771	707	0
+773	709	710	0
+711	709	773	0
+755	687	754	0
+773	713	711	0
+733	701	764	0
+689	755	756	0
+708	772	720	0
+776	712	713	0
+689	756	757	0
+690	757	759	0
+715	778	714	0
+759	758	690	0
+715	716	779	0
+693	758	761	0
+781	716	718	0
+694	762	760	0
+718	717	782	0
+732	775	710	0
+762	694	761	0
+783	717	719	0
+741	739	740	0
+719	721	783	0
+785	721	720	0
+701	763	764	0
+742	744	743	0
+722	788	723	0
+766	765	702	0
+789	724	723	0
+746	714	778	0
+769	766	704	0
+730	787	722	0
+768	767	704	0
+704	767	769	0
+791	726	725	0
+705	770	768	0
+727	726	792	0
+731	724	790	0
+729	727	792	0
+791	725	734	0
+772	708	771	0
+732	731	790	0
+773	710	774	0
+771	712	776	0
+775	774	710	0
+713	773	777	0
+796	734	733	0
+776	713	777	0
+736	735	797	0
+736	797	738	0
+778	748	746	0
+778	715	780	0
+738	798	737	0
+715	779	780	0
+779	716	781	0
+772	785	720	0
+759	761	758	0
+797	735	749	0
+783	782	717	0
+741	740	802	0
+718	784	781	0
+784	718	782	0
+740	743	801	0
+786	783	721	0
+785	786	721	0
+806	743	744	0
+733	764	796	0
+741	803	751	0
+745	807	744	0
+787	788	722	0
+789	723	788	0
+747	808	745	0
+794	775	732	0
+789	790	724	0
+748	809	747	0
+791	793	726	0
+792	726	793	0
+750	812	749	0
+814	750	753	0
+790	795	732	0
+751	815	752	0
+796	791	734	0
+732	795	794	0
+816	753	752	0
+755	754	819	0
+755	819	756	0
+820	757	756	0
+738	799	798	0
+797	800	738	0
+748	778	811	0
+800	799	738	0
+759	757	822	0
+740	801	802	0
+825	761	759	0
+803	741	802	0
+825	762	761	0
+801	743	805	0
+743	804	805	0
+743	806	804	0
+765	766	826	0
+807	806	744	0
+797	749	812	0
+808	807	745	0
+769	826	766	0
+828	767	768	0
+829	769	767	0
+810	808	747	0
+747	809	810	0
+809	748	811	0
+830	768	770	0
+811	778	780	0
+815	751	803	0
+832	772	771	0
+812	750	813	0
+813	750	814	0
+771	776	832	0
+796	793	791	0
+774	835	773	0
+752	815	816	0
+773	834	777	0
+817	814	753	0
+774	775	836	0
+817	753	816	0
+785	772	833	0
+777	838	776	0
+754	818	819	0
+756	819	821	0
+821	820	756	0
+839	780	779	0
+839	779	781	0
+820	823	757	0
+757	823	822	0
+822	824	759	0
+775	794	836	0
+840	781	784	0
+759	824	825	0
+782	783	843	0
+782	844	784	0
+783	786	843	0
+786	785	845	0
+765	826	827	0
+788	787	847	0
+788	847	789	0
+829	767	828	0
+769	831	826	0
+828	768	830	0
+789	849	790	0
+829	831	769	0
+839	811	780	0
+795	790	849	0
+772	832	833	0
+795	850	794	0
+835	834	773	0
+776	837	832	0
+835	774	836	0
+834	838	777	0
+853	800	797	0
+776	838	837	0
+799	800	856	0
+857	802	801	0
+839	781	841	0
+802	858	803	0
+833	845	785	0
+857	801	805	0
+781	840	842	0
+797	812	854	0
+842	841	781	0
+840	784	844	0
+805	804	860	0
+782	843	844	0
+860	804	806	0
+843	786	846	0
+807	863	806	0
+859	815	803	0
+845	846	786	0
+863	807	808	0
+854	812	813	0
+836	794	850	0
+810	864	808	0
+848	789	847	0
+865	810	809	0
+831	827	826	0
+865	809	811	0
+848	849	789	0
+795	849	851	0
+813	814	869	0
+850	795	852	0
+851	852	795	0
+871	814	817	0
+872	816	815	0
+797	854	853	0
+817	816	873	0
+800	853	856	0
+855	799	856	0
+818	875	819	0
+819	875	821	0
+820	821	876	0
+802	857	858	0
+811	839	868	0
+823	820	876	0
+859	803	858	0
+878	822	823	0
+805	861	857	0
+822	878	824	0
+860	861	805	0
+862	860	806	0
+863	862	806	0
+864	863	808	0
+881	827	831	0
+854	813	870	0
+866	864	810	0
+829	828	883	0
+828	830	882	0
+810	865	867	0
+867	866	810	0
+884	831	829	0
+865	811	868	0
+872	815	859	0
+851	849	848	0
+832	886	833	0
+869	870	813	0
+871	869	814	0
+886	832	837	0
+888	834	835	0
+834	887	838	0
+871	817	873	0
+872	873	816	0
+835	836	890	0
+833	886	845	0
+837	838	891	0
+818	874	875	0
+839	841	893	0
+877	821	875	0
+877	876	821	0
+850	890	836	0
+842	840	895	0
+823	876	879	0
+895	840	844	0
+896	841	842	0
+878	823	879	0
+844	843	899	0
+846	898	843	0
+827	881	880	0
+901	846	845	0
+890	850	852	0
+828	882	883	0
+881	831	884	0
+829	883	885	0
+885	884	829	0
+868	839	894	0
+851	903	852	0
+834	888	887	0
+889	888	835	0
+853	854	905	0
+853	904	856	0
+889	835	890	0
+837	892	886	0
+838	887	891	0
+856	906	855	0
+891	892	837	0
+857	908	858	0
+909	859	858	0
+894	839	893	0
+908	857	861	0
+905	854	870	0
+893	841	896	0
+886	901	845	0
+861	860	912	0
+860	862	912	0
+895	897	842	0
+842	897	896	0
+900	895	844	0
+863	914	862	0
+898	899	843	0
+864	914	863	0
+859	910	872	0
+899	900	844	0
+890	852	903	0
+898	846	902	0
+864	866	916	0
+846	901	902	0
+918	867	865	0
+918	865	868	0
+866	867	919	0
+921	870	869	0
+871	921	869	0
+904	853	905	0
+856	904	907	0
+873	924	871	0
+906	856	907	0
+926	873	872	0
+858	908	909	0
+875	874	928	0
+911	859	909	0
+875	928	877	0
+918	868	894	0
+911	910	859	0
+877	929	876	0
+913	908	861	0
+876	929	879	0
+913	861	912	0
+912	862	915	0
+915	862	914	0
+933	880	881	0
+917	914	864	0
+916	917	864	0
+923	905	870	0
+933	881	884	0
+882	934	883	0
+919	916	866	0
+883	935	885	0
+867	918	920	0
+884	885	936	0
+920	919	867	0
+910	926	872	0
+921	922	870	0
+922	923	870	0
+941	887	888	0
+921	871	925	0
+892	940	886	0
+941	891	887	0
+888	889	942	0
+925	871	924	0
+926	924	873	0
+944	889	890	0
+940	901	886	0
+891	945	892	0
+928	874	927	0
+913	909	908	0
+894	893	948	0
+931	877	928	0
+929	877	930	0
+896	948	893	0
+903	944	890	0
+931	930	877	0
+895	951	897	0
+932	880	933	0
+914	917	915	0
+900	952	895	0
+954	896	897	0
+935	883	934	0
+898	956	899	0
+884	937	933	0
+956	898	902	0
+957	900	899	0
+937	884	936	0
+935	938	885	0
+885	939	936	0
+949	918	894	0
+885	938	939	0
+901	959	902	0
+961	904	905	0
+888	942	941	0
+961	907	904	0
+889	943	942	0
+907	962	906	0
+926	925	924	0
+944	943	889	0
+945	891	941	0
+947	940	892	0
+946	892	945	0
+947	892	946	0
+909	965	911	0
+949	920	918	0
+966	909	913	0
+911	967	910	0
+905	923	961	0
+894	948	950	0
+894	950	949	0
+969	913	912	0
+948	896	953	0
+915	970	912	0
+952	951	895	0
+901	940	960	0
+937	932	933	0
+954	953	896	0
+926	910	967	0
+955	897	951	0
+915	917	972	0
+955	954	897	0
+974	917	916	0
+916	919	974	0
+952	900	958	0
+956	957	899	0
+920	976	919	0
+900	957	958	0
+959	956	902	0
+960	959	901	0
+979	922	921	0
+921	925	978	0
+923	922	980	0
+963	962	907	0
+907	961	964	0
+907	964	963	0
+926	984	925	0
+927	986	928	0
+909	966	965	0
+968	911	965	0
+928	986	931	0
+967	911	968	0
+920	949	977	0
+947	960	940	0
+930	931	987	0
+913	969	966	0
+912	970	969	0
+970	915	971	0
+932	937	989	0
+934	990	935	0
+973	971	915	0
+915	972	973	0
+938	935	990	0
+972	917	975	0
+961	923	981	0
+992	937	936	0
+975	917	974	0
+991	936	939	0
+976	974	919	0
+995	939	938	0
+976	920	977	0
+950	977	949	0
+926	967	984	0
+921	978	979	0
+942	997	941	0
+922	979	980	0
+997	945	941	0
+943	998	942	0
+981	923	980	0
+983	978	925	0
+945	997	946	0
+925	982	983	0
+982	925	984	0
+1000	947	946	0
+927	985	986	0
+1002	950	948	0
+1002	948	953	0
+931	986	987	0
+964	961	981	0
+952	1005	951	0
+947	1001	960	0
+989	988	932	0
+951	1006	955	0
+1008	953	954	0
+952	958	1007	0
+1008	954	955	0
+936	991	992	0
+937	993	989	0
+993	937	992	0
+990	994	938	0
+996	991	939	0
+1013	957	956	0
+938	994	995	0
+956	959	1012	0
+958	957	1013	0
+995	996	939	0
+959	960	1012	0
+950	1004	977	0
+942	998	997	0
+962	963	1015	0
+997	999	946	0
+964	1016	963	0
+999	1000	946	0
+947	1000	1001	0
+965	966	1019	0
+1020	968	965	0
+1002	1003	950	0
+966	969	1021	0
+968	1022	967	0
+1003	1004	950	0
+1023	969	970	0
+1005	1006	951	0
+1002	953	1008	0
+981	1018	964	0
+1007	1005	952	0
+1024	970	971	0
+1025	971	973	0
+1010	955	1006	0
+972	1026	973	0
+1008	955	1009	0
+972	975	1026	0
+1001	1012	960	0
+984	967	1022	0
+1010	1009	955	0
+976	1028	974	0
+974	1029	975	0
+1014	1007	958	0
+956	1012	1011	0
+956	1011	1013	0
+1028	976	977	0
+1013	1014	958	0
+1032	979	978	0
+979	1033	980	0
+978	983	1032	0
+1015	963	1016	0
+998	999	997	0
+981	980	1034	0
+1016	964	1017	0
+964	1018	1017	0
+982	984	1036	0
+1037	983	982	0
+965	1019	1020	0
+966	1021	1019	0
+968	1020	1022	0
+1041	986	985	0
+1004	1031	977	0
+969	1023	1021	0
+986	1041	987	0
+1023	970	1024	0
+1043	988	989	0
+1024	971	1025	0
+1043	989	993	0
+1027	1025	973	0
+1027	973	1026	0
+991	1045	992	0
+1026	975	1030	0
+993	992	1046	0
+996	1044	991	0
+1029	974	1028	0
+1030	975	1029	0
+981	1035	1018	0
+977	1031	1028	0
+994	1048	995	0
+995	1049	996	0
+1032	1033	979	0
+984	1022	1039	0
+1033	1034	980	0
+998	1052	999	0
+981	1034	1035	0
+983	1038	1032	0
+1000	999	1052	0
+982	1036	1037	0
+1000	1054	1001	0
+983	1037	1038	0
+1036	984	1039	0
+1002	1056	1003	0
+1004	1003	1056	0
+985	1040	1041	0
+1002	1008	1057	0
+1012	1001	1055	0
+1059	1006	1005	0
+1059	1005	1007	0
+988	1043	1042	0
+1008	1009	1057	0
+1010	1006	1060	0
+991	1044	1045	0
+1010	1062	1009	0
+1061	1007	1014	0
+992	1045	1046	0
+1043	993	1047	0
+1047	993	1046	0
+1066	1011	1012	0
+996	1051	1044	0
+1013	1011	1067	0
+1031	1004	1058	0
+1050	995	1048	0
+1050	1049	995	0
+1014	1013	1068	0
+1049	1051	996	0
+1015	1016	1070	0
+1016	1017	1071	0
+1053	1000	1052	0
+1053	1054	1000	0
+1072	1017	1018	0
+1054	1055	1001	0
+1020	1019	1074	0
+1056	1002	1057	0
+1019	1021	1075	0
+1004	1056	1058	0
+1077	1022	1020	0
+1023	1080	1021	0
+1060	1006	1059	0
+1035	1073	1018	0
+1023	1024	1080	0
+1061	1059	1007	0
+1063	1057	1009	0
+1024	1025	1081	0
+1066	1012	1055	0
+1009	1062	1063	0
+1060	1065	1010	0
+1083	1025	1027	0
+1010	1064	1062	0
+1084	1027	1026	0
+1077	1039	1022	0
+1065	1064	1010	0
+1026	1030	1084	0
+1068	1061	1014	0
+1086	1029	1028	0
+1066	1067	1011	0
+1031	1086	1028	0
+1029	1087	1030	0
+1013	1067	1069	0
+1013	1069	1068	0
+1032	1090	1033	0
+1071	1070	1016	0
+1034	1033	1091	0
+1038	1089	1032	0
+1017	1072	1071	0
+1091	1035	1034	0
+1072	1018	1073	0
+1036	1094	1037	0
+1019	1075	1074	0
+1095	1036	1039	0
+1038	1037	1096	0
+1020	1074	1078	0
+1077	1020	1076	0
+1020	1078	1076	0
+1021	1079	1075	0
+1088	1031	1058	0
+1080	1079	1021	0
+1043	1099	1042	0
+1080	1024	1081	0
+1025	1082	1081	0
+1025	1083	1082	0
+1047	1100	1043	0
+1044	1102	1045	0
+1103	1046	1045	0
+1083	1027	1085	0
+1027	1084	1085	0
+1051	1101	1044	0
+1105	1047	1046	0
+1093	1073	1035	0
+1084	1030	1087	0
+1086	1087	1029	0
+1048	1107	1050	0
+1031	1088	1086	0
+1049	1050	1108	0
+1108	1051	1049	0
+1089	1090	1032	0
+1095	1039	1077	0
+1033	1090	1091	0
+1053	1111	1054	0
+1091	1092	1035	0
+1092	1093	1035	0
+1055	1054	1111	0
+1089	1038	1097	0
+1095	1094	1036	0
+1113	1056	1057	0
+1113	1058	1056	0
+1094	1096	1037	0
+1038	1096	1097	0
+1066	1055	1112	0
+1057	1063	1115	0
+1059	1118	1060	0
+1099	1098	1042	0
+1059	1061	1120	0
+1100	1099	1043	0
+1112	1067	1066	0
+1060	1121	1065	0
+1102	1044	1101	0
+1063	1062	1123	0
+1123	1062	1064	0
+1102	1103	1045	0
+1122	1061	1068	0
+1100	1047	1106	0
+1104	1046	1103	0
+1065	1125	1064	0
+1105	1046	1104	0
+1105	1106	1047	0
+1069	1122	1068	0
+1088	1087	1086	0
+1101	1051	1110	0
+1116	1088	1058	0
+1067	1127	1069	0
+1050	1107	1109	0
+1050	1109	1108	0
+1108	1110	1051	0
+1071	1129	1070	0
+1072	1130	1071	0
+1132	1072	1073	0
+1055	1111	1112	0
+1074	1075	1133	0
+1113	1057	1114	0
+1078	1074	1133	0
+1057	1115	1114	0
+1075	1079	1134	0
+1058	1113	1117	0
+1136	1077	1076	0
+1078	1135	1076	0
+1058	1117	1116	0
+1119	1118	1059	0
+1079	1080	1138	0
+1132	1073	1093	0
+1120	1119	1059	0
+1121	1060	1118	0
+1080	1081	1138	0
+1063	1124	1115	0
+1082	1139	1081	0
+1061	1122	1120	0
+1082	1083	1139	0
+1067	1112	1127	0
+1095	1077	1136	0
+1083	1085	1141	0
+1063	1123	1124	0
+1142	1085	1084	0
+1121	1126	1065	0
+1125	1123	1064	0
+1084	1087	1142	0
+1126	1125	1065	0
+1128	1122	1069	0
+1144	1087	1088	0
+1145	1090	1089	0
+1128	1069	1127	0
+1146	1091	1090	0
+1130	1129	1071	0
+1091	1147	1092	0
+1089	1097	1145	0
+1130	1072	1131	0
+1092	1149	1093	0
+1132	1131	1072	0
+1095	1152	1094	0
+1075	1134	1133	0
+1094	1153	1096	0
+1114	1117	1113	0
+1076	1135	1136	0
+1155	1097	1096	0
+1088	1116	1144	0
+1078	1133	1137	0
+1078	1137	1135	0
+1134	1079	1138	0
+1098	1099	1158	0
+1100	1159	1099	0
+1138	1081	1139	0
+1083	1140	1139	0
+1160	1102	1101	0
+1141	1140	1083	0
+1106	1159	1100	0
+1085	1143	1141	0
+1103	1102	1164	0
+1085	1142	1143	0
+1104	1103	1164	0
+1161	1101	1110	0
+1144	1142	1087	0
+1105	1104	1165	0
+1151	1132	1093	0
+1117	1144	1116	0
+1106	1105	1166	0
+1090	1145	1146	0
+1147	1091	1146	0
+1095	1136	1154	0
+1169	1109	1107	0
+1147	1148	1092	0
+1110	1108	1170	0
+1108	1109	1171	0
+1148	1149	1092	0
+1150	1093	1149	0
+1093	1150	1151	0
+1097	1156	1145	0
+1153	1094	1152	0
+1172	1114	1115	0
+1152	1095	1154	0
+1173	1117	1114	0
+1096	1153	1155	0
+1155	1156	1097	0
+1098	1158	1157	0
+1177	1118	1119	0
+1115	1124	1175	0
+1099	1159	1158	0
+1177	1121	1118	0
+1178	1119	1120	0
+1178	1120	1122	0
+1161	1160	1101	0
+1121	1177	1126	0
+1160	1163	1102	0
+1123	1179	1124	0
+1123	1125	1179	0
+1102	1163	1162	0
+1122	1128	1178	0
+1102	1162	1164	0
+1181	1125	1126	0
+1164	1165	1104	0
+1106	1168	1159	0
+1165	1166	1105	0
+1144	1117	1176	0
+1166	1167	1106	0
+1167	1168	1106	0
+1130	1182	1129	0
+1110	1170	1161	0
+1183	1130	1131	0
+1169	1171	1109	0
+1170	1108	1171	0
+1186	1131	1132	0
+1133	1134	1187	0
+1187	1137	1133	0
+1173	1114	1172	0
+1135	1189	1136	0
+1188	1134	1138	0
+1115	1174	1172	0
+1190	1135	1137	0
+1174	1115	1175	0
+1176	1117	1173	0
+1151	1186	1132	0
+1139	1193	1138	0
+1140	1194	1139	0
+1177	1119	1178	0
+1141	1196	1140	0
+1124	1180	1175	0
+1136	1191	1154	0
+1141	1143	1197	0
+1142	1198	1143	0
+1180	1124	1179	0
+1181	1179	1125	0
+1142	1144	1199	0
+1201	1146	1145	0
+1201	1147	1146	0
+1184	1182	1130	0
+1183	1184	1130	0
+1148	1147	1203	0
+1131	1185	1183	0
+1148	1204	1149	0
+1185	1131	1186	0
+1145	1156	1202	0
+1205	1150	1149	0
+1150	1207	1151	0
+1187	1134	1188	0
+1190	1189	1135	0
+1153	1152	1210	0
+1191	1136	1189	0
+1192	1137	1187	0
+1210	1152	1154	0
+1137	1192	1190	0
+1153	1211	1155	0
+1193	1188	1138	0
+1199	1144	1176	0
+1215	1156	1155	0
+1194	1193	1139	0
+1195	1194	1140	0
+1195	1140	1196	0
+1217	1157	1158	0
+1141	1197	1196	0
+1218	1158	1159	0
+1142	1199	1198	0
+1200	1197	1143	0
+1198	1200	1143	0
+1161	1220	1160	0
+1160	1221	1163	0
+1219	1159	1168	0
+1151	1209	1186	0
+1202	1201	1145	0
+1224	1162	1163	0
+1162	1223	1164	0
+1147	1201	1203	0
+1164	1223	1165	0
+1161	1170	1222	0
+1203	1204	1148	0
+1165	1226	1166	0
+1154	1191	1212	0
+1149	1204	1205	0
+1167	1166	1228	0
+1205	1206	1150	0
+1207	1150	1206	0
+1168	1167	1229	0
+1207	1208	1151	0
+1209	1151	1208	0
+1232	1171	1169	0
+1170	1171	1233	0
+1156	1215	1202	0
+1210	1211	1153	0
+1212	1210	1154	0
+1173	1172	1234	0
+1214	1155	1211	0
+1172	1174	1234	0
+1213	1155	1214	0
+1213	1215	1155	0
+1236	1176	1173	0
+1238	1174	1175	0
+1216	1157	1217	0
+1218	1217	1158	0
+1239	1175	1180	0
+1159	1219	1218	0
+1179	1240	1180	0
+1181	1240	1179	0
+1160	1220	1221	0
+1222	1220	1161	0
+1242	1182	1184	0
+1162	1224	1223	0
+1163	1221	1225	0
+1243	1184	1183	0
+1183	1185	1243	0
+1176	1236	1199	0
+1225	1224	1163	0
+1226	1165	1223	0
+1246	1185	1186	0
+1219	1168	1231	0
+1166	1226	1227	0
+1228	1166	1227	0
+1247	1187	1188	0
+1230	1167	1228	0
+1222	1170	1233	0
+1230	1229	1167	0
+1248	1192	1187	0
+1231	1168	1229	0
+1250	1189	1190	0
+1193	1249	1188	0
+1189	1250	1191	0
+1211	1210	1212	0
+1252	1190	1192	0
+1171	1232	1233	0
+1194	1249	1193	0
+1186	1209	1246	0
+1234	1235	1173	0
+1254	1194	1195	0
+1173	1235	1237	0
+1255	1195	1196	0
+1238	1234	1174	0
+1236	1173	1237	0
+1196	1197	1257	0
+1239	1238	1175	0
+1257	1197	1200	0
+1191	1253	1212	0
+1199	1259	1198	0
+1200	1198	1259	0
+1180	1241	1239	0
+1240	1241	1180	0
+1261	1201	1202	0
+1201	1261	1203	0
+1263	1204	1203	0
+1244	1242	1184	0
+1244	1184	1243	0
+1245	1243	1185	0
+1264	1205	1204	0
+1246	1245	1185	0
+1205	1266	1206	0
+1262	1202	1215	0
+1207	1206	1267	0
+1187	1247	1248	0
+1208	1207	1268	0
+1247	1188	1249	0
+1208	1269	1209	0
+1230	1231	1229	0
+1251	1250	1190	0
+1192	1248	1252	0
+1252	1251	1190	0
+1259	1199	1236	0
+1253	1191	1250	0
+1273	1211	1212	0
+1254	1249	1194	0
+1273	1214	1211	0
+1207	1267	1227	0
+1213	1274	1215	0
+1214	1275	1213	0
+1227	1268	1207	0
+1195	1256	1254	0
+1256	1195	1255	0
+1258	1255	1196	0
+1196	1257	1258	0
+1217	1278	1216	0
+1278	1217	1218	0
+1279	1218	1219	0
+1200	1260	1257	0
+1259	1260	1200	0
+1268	1227	1226	0
+1228	1227	1267	0
+1282	1221	1220	0
+1261	1202	1262	0
+1283	1220	1222	0
+1203	1261	1263	0
+1246	1209	1272	0
+1284	1225	1221	0
+1219	1231	1280	0
+1263	1264	1204	0
+1224	1286	1223	0
+1264	1265	1205	0
+1223	1286	1226	0
+1205	1265	1266	0
+1224	1225	1288	0
+1253	1273	1212	0
+1206	1266	1267	0
+1285	1222	1233	0
+1208	1268	1270	0
+1270	1269	1208	0
+1230	1228	1290	0
+1271	1209	1269	0
+1232	1285	1233	0
+1274	1262	1215	0
+1209	1271	1272	0
+1292	1231	1230	0
+1274	1213	1275	0
+1276	1214	1273	0
+1268	1226	1270	0
+1276	1275	1214	0
+1235	1234	1296	0
+1295	1234	1238	0
+1235	1297	1237	0
+1278	1277	1216	0
+1298	1236	1237	0
+1279	1278	1218	0
+1238	1239	1301	0
+1279	1219	1281	0
+1219	1280	1281	0
+1301	1239	1241	0
+1270	1226	1286	0
+1228	1267	1290	0
+1282	1220	1283	0
+1282	1284	1221	0
+1242	1244	1302	0
+1285	1283	1222	0
+1243	1245	1303	0
+1244	1243	1304	0
+1298	1259	1236	0
+1246	1305	1245	0
+1287	1286	1224	0
+1225	1284	1289	0
+1288	1287	1224	0
+1306	1248	1247	0
+1306	1247	1249	0
+1289	1288	1225	0
+1280	1231	1294	0
+1252	1248	1307	0
+1309	1250	1251	0
+1306	1249	1254	0
+1230	1290	1291	0
+1309	1253	1250	0
+1230	1291	1292	0
+1252	1311	1251	0
+1292	1293	1231	0
+1256	1306	1254	0
+1259	1298	1260	0
+1294	1231	1293	0
+1272	1305	1246	0
+1266	1290	1267	0
+1296	1234	1295	0
+1256	1255	1316	0
+1315	1255	1258	0
+1297	1235	1296	0
+1237	1297	1299	0
+1300	1295	1238	0
+1299	1298	1237	0
+1257	1320	1258	0
+1260	1320	1257	0
+1300	1238	1301	0
+1314	1273	1253	0
+1261	1262	1324	0
+1266	1291	1290	0
+1324	1263	1261	0
+1304	1243	1303	0
+1302	1244	1304	0
+1303	1245	1305	0
+1327	1264	1263	0
+1280	1294	1281	0
+1265	1264	1328	0
+1266	1265	1329	0
+1262	1274	1326	0
+1308	1248	1306	0
+1314	1276	1273	0
+1307	1248	1308	0
+1310	1309	1251	0
+1331	1269	1270	0
+1331	1271	1269	0
+1252	1307	1312	0
+1311	1310	1251	0
+1252	1312	1311	0
+1313	1253	1309	0
+1272	1271	1334	0
+1317	1306	1256	0
+1253	1313	1314	0
+1298	1323	1260	0
+1274	1275	1336	0
+1255	1315	1316	0
+1266	1330	1291	0
+1286	1332	1270	0
+1276	1337	1275	0
+1256	1316	1319	0
+1317	1256	1318	0
+1319	1318	1256	0
+1315	1258	1321	0
+1341	1277	1278	0
+1279	1341	1278	0
+1321	1258	1320	0
+1342	1279	1281	0
+1260	1322	1320	0
+1286	1287	1332	0
+1322	1260	1323	0
+1325	1324	1262	0
+1347	1282	1283	0
+1272	1335	1305	0
+1325	1262	1326	0
+1291	1330	1292	0
+1282	1347	1284	0
+1263	1324	1327	0
+1327	1328	1264	0
+1298	1299	1323	0
+1281	1294	1346	0
+1329	1265	1328	0
+1349	1289	1284	0
+1266	1329	1330	0
+1288	1350	1287	0
+1289	1351	1288	0
+1339	1276	1314	0
+1306	1317	1308	0
+1270	1332	1331	0
+1333	1271	1331	0
+1274	1336	1326	0
+1271	1333	1334	0
+1355	1293	1292	0
+1335	1272	1334	0
+1294	1293	1356	0
+1275	1337	1336	0
+1359	1296	1295	0
+1338	1337	1276	0
+1276	1339	1338	0
+1360	1297	1296	0
+1300	1359	1295	0
+1297	1361	1299	0
+1341	1340	1277	0
+1343	1341	1279	0
+1279	1342	1343	0
+1301	1363	1300	0
+1342	1281	1344	0
+1287	1350	1332	0
+1344	1281	1345	0
+1304	1364	1302	0
+1365	1304	1303	0
+1346	1345	1281	0
+1366	1303	1305	0
+1327	1324	1325	0
+1292	1330	1354	0
+1284	1347	1348	0
+1284	1348	1349	0
+1367	1307	1308	0
+1323	1299	1361	0
+1312	1307	1367	0
+1309	1310	1369	0
+1288	1352	1350	0
+1311	1370	1310	0
+1289	1349	1353	0
+1351	1352	1288	0
+1313	1309	1369	0
+1368	1308	1317	0
+1289	1353	1351	0
+1311	1312	1372	0
+1358	1346	1294	0
+1314	1313	1374	0
+1292	1354	1355	0
+1318	1368	1317	0
+1355	1357	1293	0
+1335	1366	1305	0
+1356	1293	1357	0
+1315	1376	1316	0
+1294	1356	1358	0
+1321	1376	1315	0
+1316	1377	1319	0
+1296	1359	1360	0
+1318	1319	1378	0
+1297	1360	1362	0
+1361	1297	1362	0
+1359	1300	1363	0
+1320	1381	1321	0
+1381	1320	1322	0
+1314	1374	1339	0
+1383	1322	1323	0
+1364	1304	1365	0
+1366	1365	1303	0
+1384	1325	1326	0
+1325	1385	1327	0
+1368	1367	1308	0
+1388	1328	1327	0
+1329	1328	1389	0
+1389	1330	1329	0
+1386	1326	1336	0
+1369	1310	1371	0
+1310	1370	1371	0
+1367	1373	1312	0
+1332	1390	1331	0
+1370	1311	1372	0
+1333	1331	1390	0
+1312	1373	1372	0
+1375	1313	1369	0
+1386	1336	1337	0
+1333	1392	1334	0
+1374	1313	1375	0
+1334	1393	1335	0
+1368	1318	1379	0
+1383	1323	1361	0
+1376	1377	1316	0
+1337	1338	1395	0
+1332	1350	1390	0
+1330	1389	1354	0
+1339	1397	1338	0
+1318	1378	1379	0
+1380	1319	1377	0
+1378	1319	1380	0
+1321	1382	1376	0
+1341	1400	1340	0
+1341	1343	1400	0
+1382	1321	1381	0
+1322	1383	1381	0
+1343	1342	1401	0
+1375	1339	1374	0
+1342	1344	1402	0
+1404	1344	1345	0
+1325	1384	1385	0
+1335	1394	1366	0
+1387	1384	1326	0
+1345	1346	1406	0
+1326	1386	1387	0
+1385	1388	1327	0
+1408	1349	1348	0
+1328	1388	1389	0
+1346	1358	1407	0
+1353	1349	1409	0
+1410	1350	1352	0
+1375	1398	1339	0
+1391	1333	1390	0
+1351	1353	1411	0
+1412	1352	1351	0
+1391	1392	1333	0
+1395	1386	1337	0
+1334	1392	1393	0
+1335	1393	1394	0
+1354	1415	1355	0
+1355	1416	1357	0
+1395	1338	1396	0
+1356	1357	1417	0
+1338	1397	1396	0
+1417	1358	1356	0
+1398	1397	1339	0
+1400	1399	1340	0
+1360	1359	1422	0
+1359	1363	1421	0
+1362	1360	1422	0
+1342	1402	1401	0
+1423	1361	1362	0
+1403	1400	1343	0
+1401	1403	1343	0
+1390	1350	1410	0
+1404	1402	1344	0
+1404	1345	1405	0
+1425	1364	1365	0
+1406	1405	1345	0
+1366	1425	1365	0
+1389	1414	1354	0
+1406	1346	1407	0
+1426	1367	1368	0
+1409	1349	1408	0
+1373	1367	1426	0
+1361	1423	1383	0
+1428	1369	1371	0
+1370	1429	1371	0
+1429	1370	1372	0
+1428	1375	1369	0
+1409	1411	1353	0
+1412	1351	1411	0
+1427	1368	1379	0
+1413	1410	1352	0
+1352	1412	1413	0
+1373	1433	1372	0
+1414	1415	1354	0
+1394	1425	1366	0
+1407	1358	1420	0
+1355	1415	1416	0
+1376	1436	1377	0
+1417	1357	1416	0
+1417	1418	1358	0
+1377	1436	1380	0
+1376	1382	1436	0
+1437	1379	1378	0
+1418	1419	1358	0
+1378	1380	1438	0
+1358	1419	1420	0
+1421	1422	1359	0
+1381	1442	1382	0
+1381	1383	1441	0
+1375	1435	1398	0
+1362	1422	1424	0
+1424	1423	1362	0
+1444	1385	1384	0
+1387	1444	1384	0
+1385	1445	1388	0
+1447	1387	1386	0
+1368	1427	1426	0
+1389	1388	1449	0
+1447	1386	1395	0
+1428	1371	1430	0
+1431	1371	1429	0
+1431	1430	1371	0
+1391	1390	1452	0
+1426	1434	1373	0
+1432	1429	1372	0
+1372	1433	1432	0
+1454	1392	1391	0
+1396	1447	1395	0
+1428	1435	1375	0
+1455	1393	1392	0
+1434	1433	1373	0
+1455	1394	1393	0
+1439	1427	1379	0
+1441	1383	1423	0
+1397	1457	1396	0
+1390	1410	1452	0
+1437	1378	1438	0
+1414	1389	1451	0
+1398	1459	1397	0
+1439	1379	1437	0
+1440	1380	1436	0
+1380	1440	1438	0
+1400	1461	1399	0
+1382	1443	1436	0
+1381	1441	1442	0
+1400	1403	1461	0
+1403	1401	1462	0
+1402	1463	1401	0
+1442	1443	1382	0
+1424	1422	1421	0
+1404	1464	1402	0
+1404	1405	1464	0
+1446	1385	1444	0
+1445	1385	1446	0
+1466	1405	1406	0
+1387	1448	1444	0
+1407	1467	1406	0
+1387	1447	1448	0
+1450	1388	1445	0
+1450	1449	1388	0
+1451	1389	1449	0
+1432	1431	1429	0
+1410	1413	1469	0
+1398	1435	1459	0
+1420	1467	1407	0
+1452	1453	1391	0
+1454	1391	1453	0
+1470	1415	1414	0
+1396	1457	1447	0
+1416	1415	1471	0
+1392	1454	1456	0
+1455	1392	1456	0
+1472	1417	1416	0
+1417	1472	1418	0
+1475	1419	1418	0
+1457	1397	1458	0
+1459	1458	1397	0
+1477	1420	1419	0
+1460	1399	1461	0
+1479	1424	1421	0
+1423	1424	1479	0
+1462	1401	1463	0
+1462	1461	1403	0
+1464	1463	1402	0
+1469	1452	1410	0
+1465	1464	1405	0
+1481	1426	1427	0
+1414	1451	1470	0
+1465	1405	1466	0
+1466	1406	1468	0
+1430	1482	1428	0
+1446	1450	1445	0
+1434	1426	1481	0
+1406	1467	1468	0
+1423	1480	1441	0
+1483	1430	1431	0
+1428	1482	1435	0
+1431	1432	1484	0
+1427	1439	1481	0
+1486	1432	1433	0
+1433	1434	1487	0
+1415	1470	1471	0
+1473	1416	1471	0
+1416	1473	1472	0
+1418	1472	1474	0
+1478	1467	1420	0
+1492	1437	1438	0
+1436	1491	1440	0
+1474	1475	1418	0
+1437	1492	1439	0
+1443	1490	1436	0
+1419	1475	1476	0
+1440	1493	1438	0
+1476	1477	1419	0
+1420	1477	1478	0
+1442	1441	1496	0
+1443	1442	1497	0
+1479	1480	1423	0
+1489	1459	1435	0
+1446	1444	1499	0
+1444	1448	1499	0
+1483	1482	1430	0
+1502	1448	1447	0
+1446	1501	1450	0
+1483	1431	1485	0
+1485	1431	1484	0
+1484	1432	1486	0
+1481	1488	1434	0
+1504	1449	1450	0
+1449	1504	1451	0
+1447	1457	1502	0
+1489	1435	1482	0
+1487	1486	1433	0
+1434	1488	1487	0
+1452	1506	1453	0
+1481	1439	1494	0
+1453	1507	1454	0
+1490	1491	1436	0
+1441	1480	1496	0
+1508	1456	1454	0
+1493	1492	1438	0
+1491	1493	1440	0
+1509	1457	1458	0
+1495	1439	1492	0
+1505	1470	1451	0
+1506	1452	1469	0
+1458	1459	1510	0
+1494	1439	1495	0
+1443	1498	1490	0
+1460	1461	1514	0
+1442	1496	1497	0
+1462	1514	1461	0
+1443	1497	1498	0
+1515	1462	1463	0
+1464	1516	1463	0
+1499	1500	1446	0
+1464	1465	1516	0
+1501	1446	1500	0
+1466	1518	1465	0
+1448	1503	1499	0
+1503	1448	1502	0
+1519	1466	1468	0
+1504	1450	1501	0
+1520	1468	1467	0
+1512	1459	1489	0
+1504	1505	1451	0
+1488	1481	1494	0
+1523	1471	1470	0
+1478	1520	1467	0
+1506	1507	1453	0
+1523	1473	1471	0
+1509	1502	1457	0
+1472	1473	1524	0
+1507	1508	1454	0
+1472	1524	1474	0
+1475	1474	1527	0
+1509	1458	1511	0
+1510	1511	1458	0
+1528	1476	1475	0
+1510	1459	1512	0
+1476	1530	1477	0
+1478	1477	1532	0
+1460	1514	1513	0
+1514	1462	1515	0
+1479	1535	1480	0
+1515	1463	1516	0
+1517	1516	1465	0
+1523	1470	1505	0
+1465	1518	1517	0
+1482	1483	1537	0
+1518	1466	1519	0
+1538	1483	1485	0
+1468	1521	1519	0
+1485	1484	1539	0
+1489	1482	1537	0
+1486	1539	1484	0
+1522	1468	1520	0
+1521	1468	1522	0
+1480	1536	1496	0
+1503	1502	1509	0
+1486	1487	1542	0
+1488	1543	1487	0
+1523	1525	1473	0
+1473	1525	1524	0
+1474	1524	1526	0
+1494	1544	1488	0
+1474	1526	1527	0
+1547	1491	1490	0
+1497	1496	1536	0
+1527	1529	1475	0
+1528	1475	1529	0
+1491	1548	1493	0
+1534	1520	1478	0
+1492	1493	1549	0
+1528	1531	1476	0
+1498	1547	1490	0
+1495	1492	1549	0
+1530	1476	1531	0
+1530	1533	1477	0
+1495	1551	1494	0
+1533	1532	1477	0
+1478	1532	1534	0
+1546	1512	1489	0
+1498	1497	1554	0
+1535	1536	1480	0
+1557	1500	1499	0
+1483	1538	1537	0
+1557	1499	1503	0
+1501	1500	1558	0
+1540	1538	1485	0
+1504	1501	1559	0
+1539	1541	1485	0
+1541	1540	1485	0
+1539	1486	1542	0
+1505	1504	1562	0
+1546	1489	1537	0
+1542	1487	1543	0
+1509	1561	1503	0
+1524	1525	1526	0
+1488	1545	1543	0
+1545	1488	1544	0
+1561	1509	1511	0
+1564	1511	1510	0
+1547	1548	1491	0
+1536	1554	1497	0
+1565	1510	1512	0
+1494	1551	1544	0
+1523	1505	1563	0
+1493	1548	1550	0
+1549	1493	1550	0
+1513	1514	1570	0
+1495	1549	1553	0
+1552	1551	1495	0
+1553	1552	1495	0
+1547	1498	1555	0
+1515	1571	1514	0
+1515	1516	1573	0
+1573	1516	1517	0
+1554	1556	1498	0
+1574	1517	1518	0
+1556	1555	1498	0
+1518	1519	1575	0
+1500	1557	1558	0
+1577	1519	1521	0
+1558	1560	1501	0
+1560	1559	1501	0
+1557	1503	1561	0
+1520	1580	1522	0
+1512	1546	1565	0
+1581	1521	1522	0
+1504	1559	1562	0
+1505	1562	1563	0
+1525	1523	1582	0
+1534	1579	1520	0
+1526	1525	1583	0
+1526	1584	1527	0
+1511	1566	1561	0
+1510	1565	1564	0
+1527	1585	1529	0
+1529	1586	1528	0
+1511	1564	1568	0
+1567	1566	1511	0
+1586	1531	1528	0
+1511	1568	1567	0
+1531	1588	1530	0
+1530	1588	1533	0
+1553	1549	1550	0
+1569	1513	1570	0
+1570	1514	1571	0
+1533	1591	1532	0
+1532	1590	1534	0
+1571	1515	1572	0
+1515	1573	1572	0
+1574	1573	1517	0
+1595	1536	1535	0
+1582	1523	1563	0
+1576	1574	1518	0
+1518	1575	1576	0
+1538	1596	1537	0
+1575	1519	1578	0
+1577	1578	1519	0
+1597	1538	1540	0
+1598	1541	1539	0
+1521	1581	1577	0
+1580	1520	1579	0
+1546	1537	1596	0
+1542	1598	1539	0
+1600	1540	1541	0
+1598	1542	1543	0
+1522	1580	1581	0
+1554	1536	1595	0
+1583	1525	1582	0
+1603	1543	1545	0
+1584	1526	1583	0
+1544	1604	1545	0
+1584	1585	1527	0
+1604	1544	1551	0
+1587	1529	1585	0
+1548	1547	1607	0
+1587	1586	1529	0
+1556	1554	1595	0
+1586	1589	1531	0
+1593	1579	1534	0
+1608	1550	1548	0
+1551	1552	1604	0
+1589	1588	1531	0
+1547	1555	1607	0
+1553	1550	1609	0
+1532	1591	1590	0
+1592	1533	1588	0
+1553	1610	1552	0
+1592	1591	1533	0
+1606	1565	1546	0
+1594	1534	1590	0
+1593	1534	1594	0
+1556	1613	1555	0
+1615	1558	1557	0
+1596	1538	1597	0
+1614	1557	1561	0
+1558	1616	1560	0
+1617	1559	1560	0
+1540	1599	1597	0
+1562	1559	1617	0
+1600	1599	1540	0
+1598	1601	1541	0
+1614	1561	1566	0
+1602	1600	1541	0
+1543	1603	1598	0
+1602	1541	1601	0
+1620	1563	1562	0
+1596	1606	1546	0
+1564	1565	1621	0
+1568	1564	1621	0
+1605	1603	1545	0
+1545	1604	1605	0
+1566	1567	1623	0
+1568	1625	1567	0
+1548	1607	1608	0
+1620	1582	1563	0
+1611	1604	1552	0
+1609	1550	1608	0
+1569	1570	1628	0
+1570	1571	1628	0
+1628	1571	1572	0
+1552	1610	1611	0
+1609	1612	1553	0
+1607	1555	1613	0
+1610	1553	1612	0
+1630	1572	1573	0
+1574	1630	1573	0
+1574	1576	1632	0
+1576	1575	1633	0
+1557	1614	1615	0
+1578	1633	1575	0
+1558	1615	1616	0
+1578	1577	1635	0
+1565	1606	1621	0
+1619	1560	1616	0
+1560	1618	1617	0
+1581	1637	1577	0
+1619	1618	1560	0
+1617	1620	1562	0
+1641	1580	1579	0
+1601	1598	1603	0
+1566	1622	1614	0
+1580	1642	1581	0
+1643	1583	1582	0
+1644	1584	1583	0
+1566	1623	1622	0
+1568	1621	1626	0
+1579	1593	1641	0
+1646	1585	1584	0
+1623	1567	1624	0
+1624	1567	1625	0
+1587	1585	1646	0
+1625	1568	1626	0
+1586	1587	1649	0
+1589	1586	1647	0
+1628	1627	1569	0
+1588	1589	1650	0
+1572	1629	1628	0
+1592	1588	1650	0
+1572	1630	1629	0
+1652	1590	1591	0
+1631	1630	1574	0
+1592	1653	1591	0
+1594	1590	1652	0
+1632	1631	1574	0
+1632	1576	1634	0
+1576	1633	1634	0
+1620	1643	1582	0
+1577	1636	1635	0
+1596	1597	1656	0
+1638	1633	1578	0
+1619	1616	1615	0
+1637	1636	1577	0
+1622	1615	1614	0
+1639	1578	1635	0
+1657	1597	1599	0
+1638	1578	1640	0
+1658	1599	1600	0
+1640	1578	1639	0
+1656	1606	1596	0
+1581	1642	1637	0
+1659	1600	1602	0
+1641	1642	1580	0
+1602	1601	1661	0
+1601	1603	1660	0
+1603	1605	1660	0
+1583	1643	1644	0
+1663	1605	1604	0
+1645	1584	1644	0
+1584	1645	1646	0
+1663	1604	1611	0
+1586	1648	1647	0
+1607	1667	1608	0
+1646	1649	1587	0
+1586	1649	1648	0
+1627	1628	1629	0
+1668	1609	1608	0
+1589	1647	1651	0
+1667	1607	1613	0
+1612	1609	1668	0
+1651	1650	1589	0
+1610	1669	1611	0
+1669	1610	1612	0
+1665	1621	1606	0
+1652	1591	1653	0
+1592	1650	1654	0
+1654	1653	1592	0
+1594	1652	1655	0
+1638	1634	1633	0
+1615	1673	1619	0
+1618	1674	1617	0
+1656	1597	1657	0
+1622	1673	1615	0
+1674	1620	1617	0
+1621	1665	1626	0
+1619	1675	1618	0
+1657	1599	1658	0
+1658	1600	1659	0
+1673	1622	1623	0
+1601	1660	1661	0
+1662	1659	1602	0
+1678	1623	1624	0
+1602	1661	1662	0
+1624	1625	1679	0
+1606	1656	1666	0
+1664	1660	1605	0
+1625	1626	1681	0
+1605	1663	1664	0
+1674	1643	1620	0
+1666	1665	1606	0
+1683	1627	1629	0
+1630	1683	1629	0
+1668	1608	1667	0
+1663	1611	1670	0
+1631	1683	1630	0
+1632	1684	1631	0
+1634	1685	1632	0
+1669	1671	1611	0
+1670	1611	1671	0
+1668	1672	1612	0
+1672	1669	1612	0
+1688	1635	1636	0
+1687	1634	1638	0
+1639	1635	1688	0
+1636	1637	1690	0
+1619	1673	1675	0
+1676	1674	1618	0
+1676	1618	1675	0
+1691	1637	1642	0
+1638	1640	1692	0
+1626	1665	1681	0
+1673	1623	1677	0
+1694	1640	1639	0
+1642	1641	1691	0
+1677	1623	1678	0
+1666	1656	1657	0
+1624	1680	1678	0
+1624	1679	1680	0
+1644	1643	1697	0
+1679	1625	1681	0
+1661	1660	1664	0
+1645	1644	1698	0
+1699	1646	1645	0
+1682	1627	1683	0
+1649	1646	1701	0
+1663	1670	1664	0
+1702	1647	1648	0
+1683	1631	1684	0
+1703	1648	1649	0
+1702	1651	1647	0
+1686	1684	1632	0
+1685	1686	1632	0
+1704	1650	1651	0
+1687	1685	1634	0
+1650	1704	1654	0
+1706	1652	1653	0
+1689	1688	1636	0
+1652	1706	1655	0
+1643	1674	1697	0
+1653	1654	1707	0
+1689	1636	1690	0
+1692	1687	1638	0
+1691	1690	1637	0
+1688	1693	1639	0
+1693	1694	1639	0
+1657	1658	1711	0
+1640	1695	1692	0
+1658	1659	1712	0
+1640	1694	1696	0
+1640	1696	1695	0
+1657	1710	1666	0
+1713	1659	1662	0
+1661	1714	1662	0
+1698	1644	1697	0
+1664	1715	1661	0
+1698	1700	1645	0
+1699	1645	1700	0
+1701	1646	1699	0
+1674	1676	1697	0
+1718	1665	1666	0
+1682	1683	1684	0
+1717	1664	1670	0
+1686	1682	1684	0
+1701	1703	1649	0
+1702	1648	1703	0
+1651	1702	1705	0
+1671	1669	1719	0
+1705	1704	1651	0
+1672	1719	1669	0
+1670	1671	1720	0
+1665	1718	1681	0
+1707	1706	1653	0
+1654	1704	1708	0
+1654	1708	1707	0
+1709	1655	1706	0
+1675	1673	1722	0
+1677	1722	1673	0
+1676	1675	1723	0
+1710	1657	1711	0
+1678	1726	1677	0
+1658	1712	1711	0
+1659	1713	1712	0
+1727	1678	1680	0
+1680	1679	1729	0
+1679	1681	1728	0
+1715	1714	1661	0
+1713	1662	1716	0
+1714	1716	1662	0
+1666	1710	1718	0
+1664	1717	1715	0
+1676	1724	1697	0
+1670	1720	1717	0
+1689	1732	1688	0
+1719	1721	1671	0
+1721	1720	1671	0
+1693	1688	1732	0
+1723	1675	1722	0
+1693	1734	1694	0
+1709	1706	1707	0
+1676	1723	1724	0
+1722	1677	1725	0
+1735	1696	1694	0
+1695	1696	1737	0
+1726	1725	1677	0
+1681	1718	1731	0
+1678	1727	1726	0
+1739	1698	1697	0
+1728	1729	1679	0
+1727	1680	1730	0
+1698	1740	1700	0
+1729	1730	1680	0
+1699	1700	1741	0
+1681	1731	1728	0
+1741	1701	1699	0
+1743	1703	1701	0
+1702	1703	1745	0
+1702	1744	1705	0
+1746	1704	1705	0
+1746	1708	1704	0
+1693	1732	1733	0
+1693	1733	1734	0
+1697	1724	1739	0
+1734	1736	1694	0
+1709	1707	1749	0
+1750	1707	1708	0
+1735	1694	1736	0
+1738	1696	1735	0
+1696	1738	1737	0
+1711	1752	1710	0
+1698	1739	1740	0
+1711	1712	1754	0
+1713	1754	1712	0
+1752	1718	1710	0
+1700	1740	1742	0
+1741	1700	1742	0
+1741	1743	1701	0
+1716	1756	1713	0
+1758	1714	1715	0
+1716	1714	1758	0
+1745	1744	1702	0
+1715	1717	1759	0
+1703	1743	1745	0
+1705	1744	1747	0
+1705	1748	1746	0
+1717	1720	1762	0
+1705	1747	1748	0
+1752	1731	1718	0
+1721	1762	1720	0
+1751	1708	1746	0
+1749	1707	1750	0
+1723	1722	1763	0
+1750	1708	1751	0
+1763	1722	1725	0
+1724	1723	1765	0
+1725	1726	1766	0
+1711	1755	1752	0
+1753	1711	1754	0
+1755	1711	1753	0
+1726	1727	1768	0
+1713	1757	1754	0
+1727	1730	1768	0
+1757	1713	1756	0
+1729	1728	1770	0
+1724	1765	1739	0
+1728	1731	1769	0
+1730	1729	1771	0
+1715	1759	1758	0
+1761	1756	1716	0
+1758	1760	1716	0
+1761	1716	1760	0
+1762	1759	1717	0
+1733	1776	1734	0
+1739	1765	1740	0
+1736	1734	1776	0
+1777	1735	1736	0
+1764	1723	1763	0
+1777	1738	1735	0
+1752	1769	1731	0
+1723	1764	1765	0
+1737	1738	1779	0
+1763	1725	1766	0
+1766	1726	1767	0
+1767	1726	1768	0
+1781	1742	1740	0
+1753	1754	1757	0
+1782	1743	1741	0
+1741	1742	1783	0
+1728	1769	1770	0
+1782	1745	1743	0
+1772	1729	1770	0
+1772	1771	1729	0
+1730	1774	1768	0
+1773	1730	1771	0
+1745	1785	1744	0
+1785	1747	1744	0
+1730	1773	1775	0
+1730	1775	1774	0
+1748	1787	1746	0
+1748	1747	1788	0
+1787	1751	1746	0
+1740	1765	1781	0
+1736	1776	1778	0
+1791	1749	1750	0
+1778	1777	1736	0
+1750	1751	1792	0
+1780	1738	1777	0
+1738	1780	1779	0
+1794	1752	1755	0
+1795	1755	1753	0
+1753	1757	1795	0
+1782	1741	1783	0
+1781	1784	1742	0
+1783	1742	1784	0
+1756	1797	1757	0
+1786	1745	1782	0
+1797	1756	1761	0
+1752	1794	1769	0
+1786	1785	1745	0
+1758	1759	1799	0
+1758	1799	1760	0
+1759	1762	1799	0
+1800	1761	1760	0
+1747	1785	1789	0
+1789	1788	1747	0
+1790	1787	1748	0
+1790	1748	1788	0
+1763	1802	1764	0
+1751	1787	1793	0
+1763	1766	1802	0
+1750	1792	1791	0
+1769	1794	1770	0
+1804	1765	1764	0
+1751	1793	1792	0
+1766	1767	1805	0
+1768	1806	1767	0
+1794	1755	1796	0
+1795	1796	1755	0
+1774	1806	1768	0
+1757	1798	1795	0
+1804	1781	1765	0
+1770	1808	1772	0
+1797	1798	1757	0
+1809	1771	1772	0
+1773	1771	1809	0
+1773	1810	1775	0
+1761	1801	1797	0
+1800	1760	1799	0
+1775	1811	1774	0
+1801	1761	1800	0
+1814	1777	1778	0
+1802	1803	1764	0
+1793	1787	1790	0
+1814	1780	1777	0
+1803	1804	1764	0
+1807	1770	1794	0
+1805	1802	1766	0
+1815	1779	1780	0
+1767	1806	1805	0
+1781	1817	1784	0
+1782	1783	1819	0
+1770	1807	1808	0
+1782	1819	1786	0
+1821	1783	1784	0
+1808	1809	1772	0
+1773	1809	1810	0
+1774	1812	1806	0
+1786	1822	1785	0
+1789	1785	1822	0
+1774	1811	1812	0
+1810	1813	1775	0
+1813	1811	1775	0
+1789	1825	1788	0
+1824	1790	1788	0
+1804	1818	1781	0
+1816	1780	1814	0
+1780	1816	1815	0
+1790	1828	1793	0
+1792	1830	1791	0
+1793	1830	1792	0
+1781	1818	1817	0
+1820	1819	1783	0
+1832	1794	1796	0
+1817	1821	1784	0
+1795	1833	1796	0
+1820	1783	1821	0
+1833	1795	1798	0
+1786	1819	1823	0
+1786	1823	1822	0
+1836	1798	1797	0
+1794	1832	1807	0
+1835	1797	1801	0
+1788	1825	1824	0
+1789	1822	1827	0
+1825	1789	1826	0
+1802	1837	1803	0
+1826	1789	1827	0
+1829	1790	1824	0
+1837	1802	1805	0
+1803	1838	1804	0
+1790	1829	1828	0
+1806	1837	1805	0
+1828	1831	1793	0
+1831	1830	1793	0
+1812	1837	1806	0
+1808	1807	1840	0
+1809	1808	1841	0
+1841	1810	1809	0
+1838	1818	1804	0
+1834	1832	1796	0
+1834	1796	1833	0
+1810	1842	1813	0
+1843	1812	1811	0
+1836	1833	1798	0
+1835	1836	1797	0
+1813	1844	1811	0
+1822	1823	1827	0
+1847	1815	1816	0
+1840	1807	1832	0
+1839	1803	1837	0
+1803	1839	1838	0
+1818	1848	1817	0
+1848	1821	1817	0
+1819	1820	1850	0
+1840	1841	1808	0
+1823	1819	1850	0
+1821	1851	1820	0
+1810	1841	1842	0
+1837	1812	1845	0
+1811	1844	1843	0
+1843	1845	1812	0
+1846	1813	1842	0
+1854	1824	1825	0
+1853	1827	1823	0
+1846	1844	1813	0
+1818	1838	1849	0
+1829	1824	1854	0
+1825	1826	1856	0
+1827	1858	1826	0
+1849	1848	1818	0
+1859	1828	1829	0
+1831	1828	1859	0
+1851	1821	1848	0
+1839	1837	1845	0
+1830	1831	1861	0
+1852	1850	1820	0
+1820	1851	1852	0
+1853	1823	1850	0
+1832	1834	1862	0
+1834	1833	1863	0
+1836	1863	1833	0
+1854	1825	1855	0
+1840	1832	1862	0
+1855	1825	1856	0
+1835	1865	1836	0
+1827	1853	1858	0
+1857	1856	1826	0
+1826	1858	1857	0
+1829	1854	1860	0
+1838	1839	1866	0
+1859	1829	1860	0
+1841	1840	1868	0
+1845	1867	1839	0
+1831	1859	1861	0
+1841	1869	1842	0
+1838	1866	1849	0
+1871	1846	1842	0
+1845	1843	1872	0
+1834	1864	1862	0
+1873	1843	1844	0
+1864	1834	1863	0
+1865	1863	1836	0
+1874	1844	1846	0
+1840	1862	1868	0
+1866	1839	1867	0
+1878	1848	1849	0
+1848	1877	1851	0
+1869	1841	1868	0
+1869	1870	1842	0
+1850	1852	1880	0
+1842	1870	1871	0
+1853	1850	1880	0
+1851	1881	1852	0
+1875	1867	1845	0
+1873	1872	1843	0
+1844	1874	1873	0
+1875	1845	1872	0
+1876	1846	1871	0
+1866	1879	1849	0
+1885	1854	1855	0
+1858	1853	1884	0
+1874	1846	1876	0
+1887	1855	1856	0
+1885	1860	1854	0
+1857	1888	1856	0
+1848	1878	1877	0
+1858	1889	1857	0
+1878	1849	1879	0
+1881	1851	1877	0
+1859	1860	1892	0
+1861	1859	1891	0
+1882	1880	1852	0
+1852	1881	1883	0
+1883	1882	1852	0
+1884	1853	1880	0
+1894	1862	1864	0
+1873	1875	1872	0
+1864	1863	1895	0
+1895	1863	1865	0
+1894	1868	1862	0
+1855	1886	1885	0
+1886	1855	1887	0
+1897	1866	1867	0
+1856	1888	1887	0
+1858	1884	1890	0
+1889	1888	1857	0
+1898	1869	1868	0
+1858	1890	1889	0
+1885	1893	1860	0
+1870	1869	1899	0
+1867	1875	1897	0
+1900	1871	1870	0
+1897	1879	1866	0
+1891	1859	1892	0
+1860	1893	1892	0
+1882	1884	1880	0
+1902	1876	1871	0
+1904	1873	1874	0
+1875	1873	1903	0
+1864	1896	1894	0
+1874	1876	1904	0
+1868	1894	1898	0
+1896	1864	1895	0
+1878	1908	1877	0
+1908	1881	1877	0
+1879	1909	1878	0
+1899	1869	1898	0
+1900	1870	1899	0
+1883	1881	1908	0
+1900	1901	1871	0
+1901	1902	1871	0
+1897	1875	1905	0
+1884	1882	1911	0
+1882	1883	1912	0
+1903	1873	1904	0
+1906	1875	1903	0
+1876	1902	1907	0
+1890	1884	1911	0
+1897	1910	1879	0
+1885	1886	1915	0
+1875	1906	1905	0
+1876	1907	1904	0
+1896	1898	1894	0
+1887	1916	1886	0
+1893	1885	1914	0
+1888	1918	1887	0
+1889	1918	1888	0
+1909	1908	1878	0
+1910	1909	1879	0
+1889	1890	1920	0
+1908	1913	1883	0
+1912	1911	1882	0
+1892	1924	1891	0
+1912	1883	1913	0
+1924	1892	1893	0
+1915	1914	1885	0
+1886	1917	1915	0
+1886	1916	1917	0
+1898	1896	1926	0
+1887	1919	1916	0
+1926	1899	1898	0
+1918	1919	1887	0
+1890	1911	1923	0
+1900	1899	1928	0
+1889	1921	1918	0
+1928	1901	1900	0
+1905	1927	1897	0
+1889	1920	1921	0
+1890	1922	1920	0
+1902	1901	1929	0
+1925	1893	1914	0
+1910	1897	1927	0
+1923	1922	1890	0
+1930	1903	1904	0
+1907	1902	1929	0
+1906	1903	1930	0
+1907	1930	1904	0
+1893	1925	1924	0
+1931	1905	1906	0
+1909	1934	1908	0
+1919	1917	1916	0
+1928	1899	1926	0
+1910	1935	1909	0
+1908	1934	1913	0
+1936	1911	1912	0
+1937	1912	1913	0
+1927	1905	1931	0
+1906	1930	1932	0
+1939	1914	1915	0
+1932	1931	1906	0
+1933	1907	1929	0
+1930	1907	1933	0
+1923	1911	1936	0
+1927	1935	1910	0
+1917	1941	1915	0
+1942	1917	1919	0
+1934	1909	1935	0
+1914	1940	1925	0
+1918	1944	1919	0
+1918	1921	1944	0
+1913	1934	1938	0
+1936	1912	1937	0
+1920	1947	1921	0
+1938	1937	1913	0
+1920	1922	1947	0
+1939	1940	1914	0
+1949	1922	1923	0
+1939	1915	1941	0
+1941	1917	1943	0
+1917	1942	1943	0
+1919	1945	1942	0
+1946	1919	1944	0
+1936	1950	1923	0
+1931	1952	1927	0
+1946	1945	1919	0
+1944	1921	1947	0
+1927	1952	1935	0
+1932	1930	1953	0
+1953	1930	1933	0
+1940	1951	1925	0
+1954	1931	1932	0
+1948	1947	1922	0
+1948	1922	1949	0
+1923	1950	1949	0
+1935	1957	1934	0
+1957	1938	1934	0
+1936	1937	1958	0
+1937	1938	1959	0
+1952	1931	1955	0
+1955	1931	1954	0
+1940	1939	1961	0
+1956	1932	1953	0
+1956	1954	1932	0
+1939	1941	1962	0
+1957	1935	1952	0
+1936	1958	1950	0
+1962	1941	1943	0
+1943	1942	1965	0
+1965	1942	1945	0
+1940	1963	1951	0
+1937	1959	1958	0
+1960	1938	1957	0
+1959	1938	1960	0
+1947	1967	1944	0
+1968	1946	1944	0
+1945	1946	1969	0
+1961	1939	1962	0
+1940	1961	1964	0
+1963	1940	1964	0
+1947	1948	1972	0
+1949	1973	1948	0
+1962	1943	1966	0
+1950	1975	1949	0
+1965	1966	1943	0
+1944	1967	1968	0
+1965	1945	1970	0
+1958	1975	1950	0
+1969	1970	1945	0
+1955	1977	1952	0
+1968	1971	1946	0
+1972	1967	1947	0
+1977	1957	1952	0
+1969	1946	1971	0
+1954	1978	1955	0
+1954	1956	1978	0
+1963	1976	1951	0
+1948	1973	1972	0
+1957	1977	1960	0
+1949	1974	1973	0
+1975	1974	1949	0
+1959	1982	1958	0
+1959	1960	1982	0
+1961	1962	1984	0
+1984	1964	1961	0
+1979	1977	1955	0
+1984	1962	1966	0
+1963	1964	1985	0
+1978	1979	1955	0
+1978	1956	1980	0
+1981	1975	1958	0
+1960	1977	1983	0
+1982	1981	1958	0
+1966	1965	1990	0
+1965	1970	1989	0
+1986	1976	1963	0
+1982	1960	1983	0
+1968	1967	1992	0
+1972	1992	1967	0
+1971	1968	1993	0
+1995	1970	1969	0
+1963	1985	1986	0
+1971	1996	1969	0
+1964	1984	1988	0
+1964	1987	1985	0
+1979	1978	1980	0
+1988	1984	1966	0
+1987	1964	1988	0
+1977	1979	1983	0
+1998	1972	1973	0
+1989	1990	1965	0
+1966	1991	1988	0
+1973	1974	1999	0
+1966	1990	1991	0
+1975	2000	1974	0
+1994	1968	1992	0
+1968	1994	1993	0
+2000	1975	1981	0
+1989	1970	1997	0
+1993	1996	1971	0
+1969	1996	1995	0
+2002	1979	1980	0
+1972	1998	1992	0
+1997	1970	1995	0
+1976	1986	2001	0
+2002	1983	1979	0
+2002	1981	1982	0
+2002	1982	1983	0
+1998	1973	1999	0
+2000	1999	1974	0
+2003	1986	1985	0
+2003	1985	1987	0
+1987	1988	2007	0
+1998	1994	1992	0
+2007	1988	1991	0
+1990	1989	2008	0
+2009	1991	1990	0
+2005	2001	1986	0
+2004	1986	2003	0
+1997	2008	1989	0
+2005	1986	2004	0
+1987	2006	2003	0
+2006	1987	2007	0
+2008	2009	1990	0
+2010	2007	1991	0
+2010	1991	2009	0
+2005	2011	2001	0
+2003	2012	2004	0
+2006	2013	2003	0
+2005	2004	2014	0
+2012	2003	2013	0
+2017	2006	2007	0
+2004	2012	2014	0
+2011	2005	2015	0
+2007	2010	2017	0
+2014	2015	2005	0
+2016	2013	2006	0
+2016	2006	2017	0
+2012	2013	2019	0
+2018	2011	2015	0
+2014	2012	2020	0
+2016	2021	2013	0
+2015	2014	2022	0
+2020	2012	2019	0
+2019	2013	2021	0
+2015	2023	2018	0
+2014	2020	2022	0
+2015	2022	2023	0
+2019	2025	2020	0
+2021	2025	2019	0
+2023	2024	2018	0
+2020	2027	2022	0
+2020	2025	2026	0
+2020	2026	2027	0
+2028	2023	2022	0
+2029	2024	2023	0
+2027	2028	2022	0
+2029	2023	2028	0
+2024	2029	2030	0
+2026	2031	2027	0
+2032	2028	2027	0
+2032	2029	2028	0
+2031	2032	2027	0
+2029	2034	2030	0
+2032	2033	2029	0
+2034	2029	2033	0
+2035	2030	2034	0
+2036	2032	2031	0
+2036	2033	2032	0
+2034	2033	2037	0
+2037	2033	2036	0
+2034	2038	2035	0
+2037	2038	2034	0
+2039	2035	2038	0
+2
+49.99999999320891	7.2792319725432762e-09
+0	-7.2792320288731286e-09
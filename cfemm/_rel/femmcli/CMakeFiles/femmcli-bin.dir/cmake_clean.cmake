@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/cfemm/bin/femmcli"
+  "/root/repo/cfemm/bin/femmcli.pdb"
+  "CMakeFiles/femmcli-bin.dir/main.cpp.o"
+  "CMakeFiles/femmcli-bin.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/femmcli-bin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/cfemm/fmesher/test
+# Build directory: /root/repo/cfemm/_rel/fmesher/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(fmesher_Temp.fem.setup "/usr/bin/cmake" "-E" "copy" "/root/repo/cfemm/fmesher/test/Temp.fem" ".")
+set_tests_properties(fmesher_Temp.fem.setup PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cfemm/fmesher/test/CMakeLists.txt;3;add_test;/root/repo/cfemm/fmesher/test/CMakeLists.txt;16;test_fmesher;/root/repo/cfemm/fmesher/test/CMakeLists.txt;0;")
+add_test(fmesher_Temp.fem "/root/repo/cfemm/bin/fmesher" "Temp.fem")
+set_tests_properties(fmesher_Temp.fem PROPERTIES  DEPENDS "fmesher_Temp.fem.setup" LABELS "magnetics;mesher" _BACKTRACE_TRIPLES "/root/repo/cfemm/fmesher/test/CMakeLists.txt;7;add_test;/root/repo/cfemm/fmesher/test/CMakeLists.txt;16;test_fmesher;/root/repo/cfemm/fmesher/test/CMakeLists.txt;0;")
+add_test(fmesher_split_seg_err_test.fem.setup "/usr/bin/cmake" "-E" "copy" "/root/repo/cfemm/fmesher/test/split_seg_err_test.fem" ".")
+set_tests_properties(fmesher_split_seg_err_test.fem.setup PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cfemm/fmesher/test/CMakeLists.txt;3;add_test;/root/repo/cfemm/fmesher/test/CMakeLists.txt;17;test_fmesher;/root/repo/cfemm/fmesher/test/CMakeLists.txt;0;")
+add_test(fmesher_split_seg_err_test.fem "/root/repo/cfemm/bin/fmesher" "split_seg_err_test.fem")
+set_tests_properties(fmesher_split_seg_err_test.fem PROPERTIES  DEPENDS "fmesher_split_seg_err_test.fem.setup" LABELS "magnetics;mesher" _BACKTRACE_TRIPLES "/root/repo/cfemm/fmesher/test/CMakeLists.txt;7;add_test;/root/repo/cfemm/fmesher/test/CMakeLists.txt;17;test_fmesher;/root/repo/cfemm/fmesher/test/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/cfemm/bin/fpproc-test"
+  "/root/repo/cfemm/bin/fpproc-test.pdb"
+  "CMakeFiles/fpproc-test.dir/main.cpp.o"
+  "CMakeFiles/fpproc-test.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fpproc-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
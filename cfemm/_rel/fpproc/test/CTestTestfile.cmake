@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/cfemm/fpproc/test
+# Build directory: /root/repo/cfemm/_rel/fpproc/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(fpproc_bounds "/root/repo/cfemm/bin/fpproc_bounds" "/root/repo/cfemm/fpproc/test/Temp.ans")
+set_tests_properties(fpproc_bounds PROPERTIES  LABELS "magnetics;postprocessor" _BACKTRACE_TRIPLES "/root/repo/cfemm/fpproc/test/CMakeLists.txt;7;add_test;/root/repo/cfemm/fpproc/test/CMakeLists.txt;0;")
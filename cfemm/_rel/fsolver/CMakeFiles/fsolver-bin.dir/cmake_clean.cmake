@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/cfemm/bin/fsolver"
+  "/root/repo/cfemm/bin/fsolver.pdb"
+  "CMakeFiles/fsolver-bin.dir/main.cpp.o"
+  "CMakeFiles/fsolver-bin.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fsolver-bin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/cfemm/fsolver/test
+# Build directory: /root/repo/cfemm/_rel/fsolver/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(fsolver_Temp.setup "/usr/bin/cmake" "-E" "copy" "/root/repo/cfemm/fsolver/test/Temp.edge" "/root/repo/cfemm/fsolver/test/Temp.ele" "/root/repo/cfemm/fsolver/test/Temp.node" "/root/repo/cfemm/fsolver/test/Temp.pbc" ".")
+set_tests_properties(fsolver_Temp.setup PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cfemm/fsolver/test/CMakeLists.txt;18;add_test;/root/repo/cfemm/fsolver/test/CMakeLists.txt;64;test_fsolver;/root/repo/cfemm/fsolver/test/CMakeLists.txt;0;")
+add_test(fsolver_Temp.solve "/root/repo/cfemm/bin/fsolver" "Temp")
+set_tests_properties(fsolver_Temp.solve PROPERTIES  DEPENDS "fsolver_Temp.setup" LABELS "magnetics;solver" _BACKTRACE_TRIPLES "/root/repo/cfemm/fsolver/test/CMakeLists.txt;36;add_test;/root/repo/cfemm/fsolver/test/CMakeLists.txt;64;test_fsolver;/root/repo/cfemm/fsolver/test/CMakeLists.txt;0;")
+add_test(fsolver_Temp.check "/usr/bin/cmake" "-E" "compare_files" "Temp.ans" "Temp.ans.check")
+set_tests_properties(fsolver_Temp.check PROPERTIES  DEPENDS "fsolver_Temp.solve" DISABLED "TRUE" LABELS "magnetics" _BACKTRACE_TRIPLES "/root/repo/cfemm/fsolver/test/CMakeLists.txt;51;add_test;/root/repo/cfemm/fsolver/test/CMakeLists.txt;64;test_fsolver;/root/repo/cfemm/fsolver/test/CMakeLists.txt;0;")
+add_test(fsolver_Temp1.mesh "/root/repo/cfemm/bin/fmesher" "Temp1.fem")
+set_tests_properties(fsolver_Temp1.mesh PROPERTIES  LABELS "magnetics;mesher" _BACKTRACE_TRIPLES "/root/repo/cfemm/fsolver/test/CMakeLists.txt;29;add_test;/root/repo/cfemm/fsolver/test/CMakeLists.txt;65;test_fsolver;/root/repo/cfemm/fsolver/test/CMakeLists.txt;0;")
+add_test(fsolver_Temp1.solve "/root/repo/cfemm/bin/fsolver" "Temp1")
+set_tests_properties(fsolver_Temp1.solve PROPERTIES  DEPENDS "fsolver_Temp1.mesh" LABELS "magnetics;solver" _BACKTRACE_TRIPLES "/root/repo/cfemm/fsolver/test/CMakeLists.txt;36;add_test;/root/repo/cfemm/fsolver/test/CMakeLists.txt;65;test_fsolver;/root/repo/cfemm/fsolver/test/CMakeLists.txt;0;")
+add_test(fsolver_Temp1.check "/usr/bin/cmake" "-E" "compare_files" "Temp1.ans" "Temp1.ans.check")
+set_tests_properties(fsolver_Temp1.check PROPERTIES  DEPENDS "fsolver_Temp1.solve" DISABLED "TRUE" LABELS "magnetics" _BACKTRACE_TRIPLES "/root/repo/cfemm/fsolver/test/CMakeLists.txt;51;add_test;/root/repo/cfemm/fsolver/test/CMakeLists.txt;65;test_fsolver;/root/repo/cfemm/fsolver/test/CMakeLists.txt;0;")